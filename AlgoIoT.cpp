@@ -7,8 +7,6 @@
 // submitTransactionToAlgorand():
 //  check for network errors separately and return appropriate error code
 // Max number of attempts connecting to WiFi
-// SHA512/256
-// Mnemonics checksum (requires SHA512/256)
 
 // By Fernando Carello for GT50
 /* Copyright 2023 GT50 S.r.l.
@@ -28,15 +26,41 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
-#include <Crypto.h>
+#if defined(ARDUINO)
+  #include <Crypto.h>
+#endif
 #include <base64.hpp>    
-#include <Ed25519.h>
-#include "base32decode.h" // Base32 decoding for Algorand addresses
-#include "bip39enwords.h" // BIP39 english words to convert Algorand private key from mnemonics
+#include "algoaddress.h"  // Algorand address decoding and validation
+#include "algoiotkeycache.h"
+#include "bip39en.h"      // BIP39 english words to convert Algorand private key from mnemonics
 #include "AlgoIoT.h"
+#include "minmpkdecode.h"   // Reads back transactions queued in the outbox
+#include "base32decode.h"   // IDs of queued transactions, to ask algod for them
 
 #define LIB_DEBUGMODE
-#define DEBUG_SERIAL Serial
+#if defined(ARDUINO)
+  #define DEBUG_SERIAL Serial
+#else
+  #define DEBUG_SERIAL AlgoIoTDebugConsole  // Standard error (see algoiotplatform.h)
+#endif
+
+
+// AlgoNode server of "networkType": endpoint used unless the sketch adds its own (see addAlgodEndpoint())
+static const char* defaultEndpoint(const uint8_t networkType)
+{
+  if (networkType == ALGORAND_MAINNET)
+    return ALGORAND_MAINNET_API_ENDPOINT;
+
+  return ALGORAND_TESTNET_API_ENDPOINT;
+}
+
+
+// 1 if a request failed before algod could get it whole (see algoiottransport.h): only such a transaction is
+// safe to keep in the outbox, as algod never saw it. After a timeout or a lost connection it may be in the pool
+static uint8_t neverSent(const int httpCode)
+{
+  return (httpCode == ALGOIOT_HTTP_ERROR_CONNECT) || (httpCode == ALGOIOT_HTTP_ERROR_SEND);
+}
 
 
 // Class AlgoIoT
@@ -46,15 +70,18 @@
 ///////////////////////////////
 
 // Constructor
+// Runs at static initialization time for global objects (before setup()): only stores parameters
+// Keys are derived by begin()
 AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
 {
-  int iErr = 0;
+  m_endpoints.add(defaultEndpoint(m_networkType), NULL);
 
   if (sAppName == NULL)
   {
     #ifdef LIB_DEBUGMODE
     DEBUG_SERIAL.println("\n Error: NULL AppName passed to constructor\n");
     #endif
+    m_initError = ALGOIOT_NULL_POINTER_ERROR;
     return;
   }
   if (strlen(sAppName) > DAPP_NAME_MAX_LEN)
@@ -62,6 +89,7 @@ AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
     #ifdef LIB_DEBUGMODE
     DEBUG_SERIAL.println("\n Error: app name too long\n");
     #endif
+    m_initError = ALGOIOT_BAD_PARAM;
     return;
   }
   strcpy(m_appName, sAppName);
@@ -71,36 +99,93 @@ AlgoIoT::AlgoIoT(const char* sAppName, const char* nodeAccountMnemonics)
     #ifdef LIB_DEBUGMODE
     DEBUG_SERIAL.println("\n Error: NULL mnemonic words passed to constructor\n");
     #endif
+    m_initError = ALGOIOT_NULL_POINTER_ERROR;
     return;
   }
+  m_mnemonics = nodeAccountMnemonics;
+}
 
-    // Configure HTTP client
-  m_httpClient.setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
 
-  // Decode private key from mnemonics
-  iErr = decodePrivateKeyFromMnemonics(nodeAccountMnemonics, m_privateKey);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Error %d decoding Algorand private key from mnemonic words\n", iErr);
-    #endif
-    return;
+int AlgoIoT::begin(AlgoIoTKeyCache* keyCache)
+{
+  int iErr = 0;
+  uint8_t privateKey[ALGORAND_KEY_BYTES];
+  AlgoIoTKeyRecord keyRecord;
+
+  if (m_initialized)
+    return ALGOIOT_NO_ERROR;
+  if (m_initError)
+    return m_initError;
+
+  // Transport keeps its connection open (keep-alive), so one connection serves all requests (see closeConnection())
+  m_transport->setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
+#if defined(ARDUINO)
+  // Asynchronous submission: server certificate not verified, as HTTPClient does when given no CA certificate
+  m_asyncTlsClient.setInsecure();
+#else
+  // POSIX host: server certificate verified against the system CA store, by both transport and async submission
+  m_asyncPlainClient.setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
+  m_asyncTlsClient.setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
+#endif
+
+  if ((keyCache != NULL) && (keyCache->load(&keyRecord) == ALGOIOT_KEY_CACHE_OK) &&
+      AlgoIoTKeyCache::isValidFor(&keyRecord, m_mnemonics))
+  { // Keys derived on a previous boot
+    memcpy(m_signingKey, keyRecord.signingKey, ED25519_EXPANDED_KEY_BYTES);
+    memcpy(m_senderAddressBytes, keyRecord.publicKey, ALGORAND_KEY_BYTES);
   }
+  else
+  {
+    // Decode private key from mnemonics
+    iErr = decodePrivateKeyFromMnemonics(m_mnemonics, privateKey);
+    if (iErr)
+    {
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.printf("\n Error %d decoding Algorand private key from mnemonic words\n", iErr);
+      #endif
+      return ALGOIOT_BAD_PARAM;
+    }
+
+    // Expand private key once: SHA-512 and clamping are the same for every signature
+    // Only the expanded key is kept
+    AlgoEd25519::expandPrivateKey(m_signingKey, privateKey);
+    memset(privateKey, 0, ALGORAND_KEY_BYTES);
 
-  // Derive public key = sender address ( = this node address) from private key
-  Ed25519::derivePublicKey(m_senderAddressBytes, m_privateKey);
+    // Derive public key = sender address ( = this node address) from private key
+    AlgoEd25519::derivePublicKeyExpanded(m_senderAddressBytes, m_signingKey);
+
+    if (keyCache != NULL)
+    { // Failing to save only costs the derivation again on next boot
+      memcpy(keyRecord.signingKey, m_signingKey, ED25519_EXPANDED_KEY_BYTES);
+      memcpy(keyRecord.publicKey, m_senderAddressBytes, ALGORAND_KEY_BYTES);
+      AlgoIoTKeyCache::seal(&keyRecord, m_mnemonics);
+      iErr = keyCache->store(&keyRecord);
+      #ifdef LIB_DEBUGMODE
+      if (iErr)
+        DEBUG_SERIAL.printf("\n Error %d saving derived keys to cache\n", iErr);
+      #endif
+    }
+  }
+  memset(&keyRecord, 0, sizeof(keyRecord));
 
   // By default, use current (sender) address as destination address (transaction to self)
-  // User may set a different address later, with appropriate setter
-  m_receiverAddressBytes = (uint8_t*)malloc(ALGORAND_ADDRESS_BYTES);
-  if (!m_receiverAddressBytes)
+  // User may set a different address, with appropriate setter, before or after begin()
+  if (!m_receiverSet)
+    memcpy((void*)(&(m_receiverAddressBytes[0])), m_senderAddressBytes, ALGORAND_ADDRESS_BYTES);
+
+  // Retry jitter differs from device to device (address), and from boot to boot
+  uint32_t retrySeed = micros();
+  for (uint8_t i = 0; i < ALGORAND_ADDRESS_BYTES; i += 4)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n Memory error creating receiver address\n", iErr);
-    #endif
-    return;
+    retrySeed ^= ((uint32_t)m_senderAddressBytes[i] << 24) | ((uint32_t)m_senderAddressBytes[i + 1] << 16) |
+                 ((uint32_t)m_senderAddressBytes[i + 2] << 8) | m_senderAddressBytes[i + 3];
   }
-  memcpy((void*)(&(m_receiverAddressBytes[0])), m_senderAddressBytes, ALGORAND_ADDRESS_BYTES);
+  m_retry.seed(retrySeed);
+  m_asyncRetry.seed(~retrySeed);
+
+  m_initialized = 1;
+
+  return ALGOIOT_NO_ERROR;
 }
 
 
@@ -112,14 +197,12 @@ int AlgoIoT::setDestinationAddress(const char* algorandAddress)
   {
     return ALGOIOT_NULL_POINTER_ERROR;
   }
-  if (strlen(algorandAddress) != ALGORAND_ADDRESS_BYTES)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
   iErr = decodeAlgorandAddress(algorandAddress, m_receiverAddressBytes);
+  if (iErr)
   {
     return ALGOIOT_BAD_PARAM;
   }
+  m_receiverSet = 1;
 
   return ALGOIOT_NO_ERROR;
 }
@@ -132,251 +215,752 @@ int AlgoIoT::setAlgorandNetwork(const uint8_t networkType)
     return ALGOIOT_BAD_PARAM;
   }
 
-  m_networkType = networkType;
-  if (m_networkType == ALGORAND_TESTNET)
-  {
-    m_httpBaseURL = ALGORAND_TESTNET_API_ENDPOINT;
-  }
-  else
-  {
-    m_httpBaseURL = ALGORAND_MAINNET_API_ENDPOINT;
+  if (networkType != m_networkType)
+  { // Genesis hash is decoded again on next transaction
+    m_netHashValid = 0;
+    // Other chain, other rounds
+    invalidateTxParams();
+    // Other server: the open connection, if any, is of no use
+    closeConnection();
+    m_networkType = networkType;
+    if (!m_customEndpoints)
+    { // Default endpoint follows the network; the sketch's ones are its own
+      m_endpoints.clear();
+      m_endpoints.add(defaultEndpoint(m_networkType), NULL);
+    }
   }
 
   return ALGOIOT_NO_ERROR;
 }
 
 
-const char* AlgoIoT::getTransactionID()
-{
-  return m_transactionID;
-}
-
-
-// Public methods to add values to be written in the blockchain
-// Strongly typed; this helps towards adding ARC-2/MessagePack in the future
-
-int AlgoIoT::dataAddInt8Field(const char* label, const int8_t value)
+int AlgoIoT::addAlgodEndpoint(const char* url, const char* apiToken)
 {
-  int len = 0;
+  int iErr = 0;
 
-  if (label == NULL)
-  {
+  if (url == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  if (!m_customEndpoints)
+    m_endpoints.clear();  // First one replaces the default
+  iErr = m_endpoints.add(url, apiToken);
+  if (iErr)
   {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Error %d adding algod endpoint %s\n", iErr, url);
+    #endif
+    if (!m_customEndpoints)
+      m_endpoints.add(defaultEndpoint(m_networkType), NULL);
+    return ALGOIOT_BAD_PARAM;
   }
-
-  // Update note len
-  m_noteLen = len;
+  m_customEndpoints = 1;
 
   return ALGOIOT_NO_ERROR;
 }
 
-int AlgoIoT::dataAddUInt8Field(const char* label, const uint8_t value)
-{
-  int len = 0;
-
-  if (label == NULL)
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+void AlgoIoT::clearAlgodEndpoints()
+{
+  m_endpoints.clear();
+  m_endpoints.add(defaultEndpoint(m_networkType), NULL);
+  m_customEndpoints = 0;
+}
 
-  // Update note len
-  m_noteLen = len;
 
-  return ALGOIOT_NO_ERROR;
+uint8_t AlgoIoT::algodEndpointCount()
+{
+  return m_endpoints.count();
 }
 
-int AlgoIoT::dataAddInt16Field(const char* label, const int16_t value)
+
+int AlgoIoT::getAlgodEndpointStats(const uint8_t index, AlgoIoTEndpointStats* stats)
 {
-  int len = 0;
+  const AlgoIoTEndpoint* endpoint = m_endpoints.get(index);
 
-  if (label == NULL)
-  {
+  if (stats == NULL)
     return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
+  if (endpoint == NULL)
     return ALGOIOT_BAD_PARAM;
-  }
+  memcpy((void*)stats, (const void*)&(endpoint->stats), sizeof(AlgoIoTEndpointStats));
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+  return ALGOIOT_NO_ERROR;
+}
 
-  // Update note len
-  m_noteLen = len;
 
-  return ALGOIOT_NO_ERROR;
+void AlgoIoT::closeConnection()
+{
+  m_transport->close();
+  m_asyncHttp.close();
 }
 
-int AlgoIoT::dataAddUInt16Field(const char* label, const uint16_t value)
+
+void AlgoIoT::setTransport(AlgoIoTTransport* transport)
 {
-  int len = 0;
+  m_transport->close();
+  m_transport = (transport != NULL) ? transport : &m_defaultTransport;
+  m_transport->setConnectTimeout(HTTP_CONNECT_TIMEOUT_MS);
+}
 
-  if (label == NULL)
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+///////////////////////////////
+// Asynchronous submission
+///////////////////////////////
 
-  // Update note len
-  m_noteLen = len;
+Client* AlgoIoT::asyncClient(const char* url)
+{
+  if (AlgoIoTHttpExchange::isSecureURL(url))
+    return &m_asyncTlsClient;
 
-  return ALGOIOT_NO_ERROR;
+  return &m_asyncPlainClient;
 }
 
-int AlgoIoT::dataAddInt32Field(const char* label, const int32_t value)
+
+// The exchange reconnects by itself when the endpoint selected is not the one it is connected to
+int AlgoIoT::beginAsyncRequest(const char* path, const char* method, const char* contentType, Stream* body, const uint32_t bodyLength)
 {
-  int len = 0;
+  const AlgoIoTEndpoint* endpoint = NULL;
+  int iErr = 0;
 
-  if (label == NULL)
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
+  m_asyncEndpoint = selectEndpoint(m_asyncURL, path);
+  m_asyncRequestMillis = millis();
+  iErr = m_asyncHttp.begin(asyncClient(m_asyncURL), m_asyncURL, method, contentType, body, bodyLength, HTTP_QUERY_TIMEOUT_S * 1000UL);
+  if (iErr)
+    return iErr;
+  endpoint = m_endpoints.get(m_asyncEndpoint);
+  if ((endpoint != NULL) && (endpoint->apiToken[0] != '\0'))
+    m_asyncHttp.addHeader(ALGORAND_API_TOKEN_HEADER, endpoint->apiToken);
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+  return 0;
+}
 
-  // Update note len
-  m_noteLen = len;
 
-  return ALGOIOT_NO_ERROR;
+void AlgoIoT::endAsyncRequest(const int httpCode)
+{
+  m_endpoints.report(m_asyncEndpoint, httpCode, millis() - m_asyncRequestMillis);
 }
 
-int AlgoIoT::dataAddUInt32Field(const char* label, const uint32_t value)
-{
-  int len = 0;
 
-  if (label == NULL)
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
+int AlgoIoT::finishSubmit(const int result)
+{
+  m_asyncState = ALGOIOT_ASYNC_IDLE;
+  m_asyncResult = result;
+  if (m_asyncCallback != NULL)
+    m_asyncCallback(result, m_asyncContext);
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+  return result;
+}
 
-  // Update note len
-  m_noteLen = len;
 
-  return ALGOIOT_NO_ERROR;
-}
+int AlgoIoT::beginSubmit(AlgoIoTSubmitCallback callback, void* context)
+{
+  int iErr = 0;
 
-int AlgoIoT::dataAddFloatField(const char* label, const float value)
-{ 
-  int len = 0;
+  if (m_asyncState != ALGOIOT_ASYNC_IDLE)
+    return ALGOIOT_BUSY;
 
-  if (label == NULL)
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if (strlen(label) > NOTE_LABEL_MAX_LEN)
-  {
-    return ALGOIOT_BAD_PARAM;
-  }
+  // Lazy initialization, if the sketch did not call begin(): blocking, once
+  iErr = begin();
+  if (iErr)
+    return iErr;
 
-  m_noteJDoc[label] = value;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
-  {
-    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
-  }
+  iErr = buildNote(m_asyncNote, &m_asyncNoteLen);
+  if (iErr)
+    return iErr;
 
-  // Update note len
-  m_noteLen = len;
+  m_asyncCallback = callback;
+  m_asyncContext = context;
+  m_asyncSampleMillis = takeSampleMillis();
+  m_asyncRetried = 0;
+  m_asyncRequested = 0;
+  m_asyncResult = ALGOIOT_IN_PROGRESS;
+  m_asyncRetry.start(0);
+  m_asyncState = ALGOIOT_ASYNC_PARAMS;
 
   return ALGOIOT_NO_ERROR;
 }
 
-int AlgoIoT::dataAddShortStringField(const char* label, char* shortCString)
+
+// One step per call. Steps needing algod start their request, then read its response as it arrives
+int AlgoIoT::poll()
 {
-  int len = 0;
+  int iErr = 0;
 
-  if ( (label == NULL)||(shortCString == NULL) )
-  {
-    return ALGOIOT_NULL_POINTER_ERROR;
-  }
-  if ( (strlen(label) > NOTE_LABEL_MAX_LEN)||(strlen(shortCString) > NOTE_LABEL_MAX_LEN) )
+  switch (m_asyncState)
   {
-    return ALGOIOT_BAD_PARAM;
-  }
+    case ALGOIOT_ASYNC_IDLE:
+      return ALGOIOT_NO_ERROR;
 
-  m_noteJDoc[label] = shortCString;
-  
-  // It is not trivial to anticipate how many chars we are going to add,
-  // so we check JSON length after the fact
-  len = m_noteOffset + measureJson(m_noteJDoc);
-  if (len >= ALGORAND_MAX_NOTES_SIZE)
+    case ALGOIOT_ASYNC_PARAMS:
+    {
+      if (!m_asyncRequested)
+      {
+        m_asyncEstimated = cachedTxParams(&m_asyncFv, &m_asyncFee);
+        if (!m_asyncEstimated)
+        {
+          m_asyncParamsMillis = millis();
+          m_asyncRetry.attempt();
+          m_asyncHttpCode = beginAsyncRequest(GET_TRANSACTION_PARAMS, "GET", NULL, NULL, 0);
+          if (m_asyncHttpCode == 0)
+          {
+            m_asyncRequested = 1;
+            return ALGOIOT_IN_PROGRESS;
+          }
+          endAsyncRequest(m_asyncHttpCode);
+          iErr = ALGOIOT_NETWORK_ERROR;
+        }
+      }
+      else
+      {
+        m_asyncHttpCode = m_asyncHttp.poll();
+        if (m_asyncHttpCode == 0)
+          return ALGOIOT_IN_PROGRESS;
+        m_asyncRequested = 0;
+        endAsyncRequest(m_asyncHttpCode);
+        if ((m_asyncHttpCode == 200) && !m_asyncHttp.truncated() &&
+            (parseTxParams(m_asyncHttp.response(), &m_asyncFv, &m_asyncFee) == ALGOIOT_NO_ERROR))
+          storeTxParams(m_asyncFv, m_asyncFee, m_asyncParamsMillis);
+        else
+          iErr = ALGOIOT_NETWORK_ERROR;
+      }
+
+      if (iErr && m_asyncRetry.retry(m_asyncHttpCode))
+      { // Asked again: at once if another endpoint is there, otherwise once the backoff delay is over
+        m_asyncRetryState = ALGOIOT_ASYNC_PARAMS;
+        m_asyncState = m_endpoints.failover() ? ALGOIOT_ASYNC_PARAMS : ALGOIOT_ASYNC_BACKOFF;
+        break;
+      }
+      if (!iErr && !m_asyncEstimated)
+        m_asyncRetry.retry(m_asyncHttpCode);  // Request over: statistics
+      if (iErr)
+      { // No parameters from algod
+        m_paramsValid = 0;
+        if (m_outbox == NULL)
+          return finishSubmit(ALGOIOT_NETWORK_ERROR);
+        // Signed anyway, and kept for later
+        estimateOfflineTxParams(&m_asyncFv, &m_asyncFee);
+        m_asyncMode = ALGOIOT_SUBMIT_QUEUE;
+      }
+      else if ((m_outbox != NULL) && (m_outbox->pending() > 0))
+        m_asyncMode = ALGOIOT_SUBMIT_QUEUE;  // Behind the queued ones, so that order is kept
+      else
+        m_asyncMode = (m_outbox != NULL) ? ALGOIOT_SUBMIT_POST_OR_QUEUE : ALGOIOT_SUBMIT_POST;
+      m_asyncState = ALGOIOT_ASYNC_ENCODE;
+    }
+    break;
+
+    case ALGOIOT_ASYNC_ENCODE:
+    {
+      iErr = encodePayment(m_asyncFv, m_asyncFee, m_asyncNote, m_asyncNoteLen, NULL, &m_asyncPayment);
+      if (iErr)
+        return finishSubmit(iErr);
+      m_asyncState = ALGOIOT_ASYNC_SIGN;
+    }
+    break;
+
+    case ALGOIOT_ASYNC_SIGN:
+    {
+      iErr = signEncodedPayment(&m_asyncPayment);
+      if (iErr)
+        return finishSubmit(iErr);
+      if (m_asyncMode == ALGOIOT_SUBMIT_QUEUE)
+        return finishSubmit(queueSignedTransaction(m_asyncPayment.segments, m_asyncPayment.nSegments, m_asyncFv + ALGORAND_MAX_WAIT_ROUNDS));
+      m_asyncRetry.start(validityMs(m_asyncFv, m_asyncFv + ALGORAND_MAX_WAIT_ROUNDS));
+      m_asyncState = ALGOIOT_ASYNC_POST;
+    }
+    break;
+
+    case ALGOIOT_ASYNC_POST:
+    {
+      if (!m_asyncRequested)
+      {
+        m_asyncBody = AlgoIoTSegmentStream(m_asyncPayment.segments, m_asyncPayment.nSegments);
+        m_asyncRetry.attempt();
+        iErr = beginAsyncRequest(POST_TRANSACTION, "POST", ALGORAND_POST_MIME_TYPE, &m_asyncBody, m_asyncBody.length());
+        if (iErr)
+        {
+          endAsyncRequest(iErr);
+          m_asyncHttpCode = iErr;
+          m_asyncState = ALGOIOT_ASYNC_PARSE;
+          break;
+        }
+        m_asyncRequested = 1;
+        break;
+      }
+      m_asyncHttpCode = m_asyncHttp.poll();
+      if (m_asyncHttpCode == 0)
+        return ALGOIOT_IN_PROGRESS;
+      m_asyncRequested = 0;
+      endAsyncRequest(m_asyncHttpCode);
+      m_asyncState = ALGOIOT_ASYNC_PARSE;
+    }
+    break;
+
+    case ALGOIOT_ASYNC_PARSE:
+    {
+      uint8_t duplicate = 0;
+
+      if ((m_asyncHttpCode == 400) && (parseDuplicateTransaction(m_asyncHttp.response()) == ALGOIOT_NO_ERROR))
+      { // A retry of a transaction accepted after all: ID read from the refusal
+        duplicate = 1;
+        m_asyncHttpCode = 200;
+      }
+      if (m_asyncRetry.retry(m_asyncHttpCode))
+      { // Same signed transaction posted again: at once to another endpoint, if any, otherwise after the backoff
+        m_asyncRetryState = ALGOIOT_ASYNC_POST;
+        m_asyncState = m_endpoints.failover() ? ALGOIOT_ASYNC_POST : ALGOIOT_ASYNC_BACKOFF;
+        break;
+      }
+      if (m_asyncHttpCode == 200)
+      {
+        if (!duplicate && parseTransactionID(m_asyncHttp.response()))
+          return finishSubmit(ALGOIOT_INTERNAL_GENERIC_ERROR);
+        #ifdef LIB_DEBUGMODE
+        DEBUG_SERIAL.print("\t Transaction successfully submitted with ID=");
+        DEBUG_SERIAL.println(getTransactionID());
+        #endif
+        trackTransaction(m_asyncFv + ALGORAND_MAX_WAIT_ROUNDS, m_asyncSampleMillis);
+        return finishSubmit(ALGOIOT_NO_ERROR);
+      }
+      if (m_asyncHttpCode == 400)
+      { // Refused: parameters may be the reason, as for submitTransactionToAlgorand()
+        invalidateTxParams();
+        if (m_asyncEstimated && !m_asyncRetried)
+        {
+          m_asyncRetried = 1;
+          m_asyncRetry.start(0);
+          m_asyncState = ALGOIOT_ASYNC_PARAMS;
+          break;
+        }
+        return finishSubmit(ALGOIOT_TRANSACTION_ERROR);
+      }
+      if (neverSent(m_asyncHttpCode) && (m_asyncMode == ALGOIOT_SUBMIT_POST_OR_QUEUE))
+      { // Not sent at all: kept for later (segments still valid: note and payment are members)
+        return finishSubmit(queueSignedTransaction(m_asyncPayment.segments, m_asyncPayment.nSegments, m_asyncFv + ALGORAND_MAX_WAIT_ROUNDS));
+      }
+      if (AlgoIoTRetryScheduler::classify(m_asyncHttpCode) == ALGOIOT_RETRY_RETRIABLE)
+        return finishSubmit(ALGOIOT_NETWORK_ERROR);  // Given up for now: next transaction may get through
+      return finishSubmit(ALGOIOT_TRANSACTION_ERROR);
+    }
+
+    case ALGOIOT_ASYNC_BACKOFF:
+    {
+      if (m_asyncRetry.waitMs() > 0)
+        return ALGOIOT_IN_PROGRESS;
+      m_asyncState = m_asyncRetryState;
+    }
+    break;
+
+    default:
+      return finishSubmit(ALGOIOT_INTERNAL_GENERIC_ERROR);
+  }
+
+  return ALGOIOT_IN_PROGRESS;
+}
+
+
+uint8_t AlgoIoT::submitState()
+{
+  if (((m_asyncState == ALGOIOT_ASYNC_PARAMS) || (m_asyncState == ALGOIOT_ASYNC_POST)) &&
+      m_asyncRequested && (m_asyncHttp.state() == ALGOIOT_HTTP_CONNECT))
+    return ALGOIOT_ASYNC_CONNECT;
+
+  return m_asyncState;
+}
+
+
+int AlgoIoT::submitResult()
+{
+  return m_asyncResult;
+}
+
+
+void AlgoIoT::setRetryPolicy(const uint8_t maxAttempts, const uint32_t baseDelayMs, const uint32_t maxDelayMs, const uint32_t budgetMs)
+{
+  m_retry.setPolicy(maxAttempts, baseDelayMs, maxDelayMs, budgetMs);
+  m_asyncRetry.setPolicy(maxAttempts, baseDelayMs, maxDelayMs, budgetMs);
+}
+
+
+void AlgoIoT::getRetryStats(AlgoIoTRetryStats* stats)
+{
+  if (stats != NULL)
+    *stats = m_retryStats;
+}
+
+
+void AlgoIoT::resetRetryStats()
+{
+  memset((void*)&m_retryStats, 0, sizeof(m_retryStats));
+}
+
+
+///////////////////////////////
+// Confirmation tracking
+///////////////////////////////
+
+void AlgoIoT::setConfirmationTracking(AlgoIoTConfirmationCallback callback, void* context)
+{
+  m_confirmationCallback = callback;
+  m_confirmationContext = context;
+  m_trackedCount = 0;
+}
+
+
+void AlgoIoT::setSampleTime(const uint32_t sampleMillis)
+{
+  m_sampleMillis = sampleMillis;
+  m_sampleSet = 1;
+}
+
+
+uint32_t AlgoIoT::takeSampleMillis()
+{
+  if (!m_sampleSet)
+    return millis();
+  m_sampleSet = 0;
+
+  return m_sampleMillis;
+}
+
+
+void AlgoIoT::trackTransaction(const uint64_t lastValid, const uint32_t sampleMillis)
+{
+  AlgoIoTConfirmation* tracked = NULL;
+
+  if (m_confirmationCallback == NULL)
+    return;
+  if (m_trackedCount >= ALGOIOT_MAX_TRACKED_TXNS)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\nToo many transactions waiting for confirmation: not tracked");
+    #endif
+    return;
+  }
+
+  tracked = &(m_tracked[m_trackedCount++]);
+  memset((void*)tracked, 0, sizeof(AlgoIoTConfirmation));
+  memcpy((void*)tracked->txID, (const void*)m_transactionID, ALGORAND_TRANSACTIONID_SIZE);
+  tracked->txID[ALGORAND_TRANSACTIONID_SIZE] = '\0';
+  tracked->lastValid = lastValid;
+  tracked->sampleMillis = sampleMillis;
+  tracked->state = ALGOIOT_CONFIRMATION_PENDING;
+}
+
+
+// algod has no status request for several transactions: they are asked for one after the other, right after
+// the round, on the connection the long poll opened. The first call waits for the round after the last one
+// known (transaction parameters): answered at once, as that round is already past
+int AlgoIoT::waitForConfirmations()
+{
+  uint64_t round = 0;
+  int iErr = 0;
+
+  if (m_trackedCount == 0)
+    return ALGOIOT_NO_ERROR;
+
+  if (m_statusRound < m_paramsRound)
+    m_statusRound = m_paramsRound;
+  if (getAlgorandRoundAfter(m_statusRound, &round) != 200)
+    return ALGOIOT_NETWORK_ERROR;
+  m_statusRound = round;
+
+  for (uint8_t i = 0; i < m_trackedCount; i++)
+  {
+    AlgoIoTConfirmation* tracked = &(m_tracked[i]);
+    uint64_t confirmedRound = 0;
+    uint8_t poolError = 0;
+    int httpCode = getPendingTransaction(tracked->txID, &confirmedRound, &poolError);
+
+    if (httpCode == 200)
+    {
+      tracked->misses = 0;
+      if (confirmedRound > 0)
+      {
+        tracked->state = ALGOIOT_CONFIRMATION_CONFIRMED;
+        tracked->confirmedRound = confirmedRound;
+        tracked->latencyMs = millis() - tracked->sampleMillis;
+      }
+      else if (poolError)
+      {
+        tracked->state = ALGOIOT_CONFIRMATION_FAILED;
+      }
+    }
+    else if (httpCode == 404)
+    { // Not (yet, or any more) known to the node answering
+      tracked->misses++;
+      if (tracked->misses >= ALGOIOT_CONFIRMATION_MAX_MISSES)
+        tracked->state = ALGOIOT_CONFIRMATION_UNKNOWN;
+    }
+    else
+    { // Next call asks again, for all of them
+      iErr = ALGOIOT_NETWORK_ERROR;
+      break;
+    }
+    if ((tracked->state == ALGOIOT_CONFIRMATION_PENDING) && (round > tracked->lastValid))
+      tracked->state = ALGOIOT_CONFIRMATION_EXPIRED;
+  }
+
+  // Final ones reported and removed, in order. The callback gets a copy: it may submit, and so track, again
+  for (uint8_t i = 0; i < m_trackedCount; )
+  {
+    AlgoIoTConfirmation done;
+
+    if (m_tracked[i].state == ALGOIOT_CONFIRMATION_PENDING)
+    {
+      i++;
+      continue;
+    }
+    memcpy((void*)&done, (const void*)&(m_tracked[i]), sizeof(AlgoIoTConfirmation));
+    m_trackedCount--;
+    memmove((void*)&(m_tracked[i]), (const void*)&(m_tracked[i + 1]), (m_trackedCount - i) * sizeof(AlgoIoTConfirmation));
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("Transaction %s: state %u, round %u\n", done.txID, done.state, (uint32_t)done.confirmedRound);
+    #endif
+    if (m_confirmationCallback != NULL)
+      m_confirmationCallback(&done, m_confirmationContext);
+  }
+
+  return iErr;
+}
+
+
+uint8_t AlgoIoT::confirmationsPending()
+{
+  return m_trackedCount;
+}
+
+
+const char* AlgoIoT::getTransactionID()
+{
+  return m_transactionID;
+}
+
+
+// Public methods to add values to be written in the blockchain
+// Strongly typed; this helps towards adding ARC-2/MessagePack in the future
+
+int AlgoIoT::dataAddInt8Field(const char* label, const int8_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddUInt8Field(const char* label, const uint8_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddInt16Field(const char* label, const int16_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddUInt16Field(const char* label, const uint16_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddInt32Field(const char* label, const int32_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddUInt32Field(const char* label, const uint32_t value)
+{
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddFloatField(const char* label, const float value)
+{ 
+  int len = 0;
+
+  if (label == NULL)
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if (strlen(label) > NOTE_LABEL_MAX_LEN)
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = value;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
+  {
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Update note len
+  m_noteLen = len;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+int AlgoIoT::dataAddShortStringField(const char* label, char* shortCString)
+{
+  int len = 0;
+
+  if ( (label == NULL)||(shortCString == NULL) )
+  {
+    return ALGOIOT_NULL_POINTER_ERROR;
+  }
+  if ( (strlen(label) > NOTE_LABEL_MAX_LEN)||(strlen(shortCString) > NOTE_LABEL_MAX_LEN) )
+  {
+    return ALGOIOT_BAD_PARAM;
+  }
+
+  m_noteJDoc[label] = shortCString;
+  
+  // It is not trivial to anticipate how many chars we are going to add,
+  // so we check JSON length after the fact
+  len = m_noteOffset + measureJson(m_noteJDoc);
+  if (len >= ALGORAND_MAX_NOTES_SIZE)
   {
     return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
   }
@@ -387,94 +971,724 @@ int AlgoIoT::dataAddShortStringField(const char* label, char* shortCString)
   return ALGOIOT_NO_ERROR;
 }
 
-// Submit transaction to Algorand network
-// Return: error code (0 = OK)
-// We have the Note field ready, in ARC-2 JSON format
-int AlgoIoT::submitTransactionToAlgorand()
+// Writes the ARC-2 note into "notes": "<app-name>:j" followed by the JSON data fields
+// "notesLen" set to the note length (no trailing NULL)
+// Return: error code (0 = OK, ALGOIOT_JSON_ERROR if the data fields could not be serialized)
+int AlgoIoT::buildNote(char* notes, uint16_t* notesLen)
+{
+  // Add preamble to ARC-2 note field
+  // Write app name and format specifier for ARC-2 (we use the JSON flavour of ARC-2)
+  memcpy((void*)&(notes[0]), (void*)m_appName, strlen(m_appName));
+  m_noteOffset = strlen(m_appName);
+  notes[m_noteOffset++] = ':';
+  notes[m_noteOffset++] = 'j';
+  m_noteLen += m_noteOffset;
+
+  // Serialize Note field to binary buffer after "<app-name>:j"
+  int jlen = serializeJson(m_noteJDoc, (char*) (notes + m_noteOffset), ALGORAND_MAX_NOTES_SIZE - m_noteOffset + 1);
+  if (jlen < 1)
+  {
+    return ALGOIOT_JSON_ERROR;
+  }
+  *notesLen = jlen + m_noteOffset;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Submit transaction to Algorand network
+// Return: error code (0 = OK)
+// We have the Note field ready, in ARC-2 JSON format
+int AlgoIoT::submitTransactionToAlgorand()
+{
+  uint64_t fv = 0;
+  uint64_t fee = 0;
+  uint8_t estimated = 0;
+  uint8_t rejected = 0;
+  uint8_t submitMode = ALGOIOT_SUBMIT_POST;
+  int iErr = 0;
+  char notes[ALGORAND_MAX_NOTES_SIZE + 1] = "";
+  uint16_t notesLen = 0;
+  uint32_t sampleMillis = takeSampleMillis();
+
+  // Lazy initialization, if the sketch did not call begin()
+  iErr = begin();
+  if (iErr)
+    return iErr;
+
+  iErr = buildNote(notes, &notesLen);
+  if (iErr)
+    return iErr;
+
+  // Transactions queued earlier go first
+  if ((m_outbox != NULL) && (m_outbox->pending() > 0))
+    flushOutbox();
+  if ((m_outbox != NULL) && (m_outbox->pending() > 0))
+  { // Outbox could not be emptied: queued behind the others, so that order is kept
+    // algod is not asked again (and retried again) for parameters: the flush already did
+    estimateOfflineTxParams(&fv, &fee);
+    return signAndSubmitPayment(fv, fee, notes, notesLen, &rejected, ALGOIOT_SUBMIT_QUEUE);
+  }
+
+  // Get current Algorand parameters: from cache (round estimated locally) when recent enough
+  iErr = getTxParams(&fv, &fee, &estimated);
+  if ((iErr == ALGOIOT_NETWORK_ERROR) && (m_outbox != NULL))
+  { // algod unreachable: sign anyway, and keep for later
+    estimateOfflineTxParams(&fv, &fee);
+    return signAndSubmitPayment(fv, fee, notes, notesLen, &rejected, ALGOIOT_SUBMIT_QUEUE);
+  }
+  if (iErr)
+  {
+    return iErr;
+  }
+
+  submitMode = (m_outbox != NULL) ? ALGOIOT_SUBMIT_POST_OR_QUEUE : ALGOIOT_SUBMIT_POST;
+
+  iErr = signAndSubmitPayment(fv, fee, notes, notesLen, &rejected, submitMode);
+  if (rejected)
+  { // Parameters may be the reason (round estimate off, fee raised): next request asks algod
+    invalidateTxParams();
+  }
+  if (rejected && estimated)
+  { // Rejected with cached parameters: once more with fresh ones
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\nTransaction rejected with cached parameters: retrying with fresh ones");
+    #endif
+    iErr = getTxParams(&fv, &fee, &estimated);
+    if (!iErr)
+      iErr = signAndSubmitPayment(fv, fee, notes, notesLen, &rejected, submitMode);
+    if (rejected)
+      invalidateTxParams();
+  }
+  if (iErr == ALGOIOT_NO_ERROR)
+    trackTransaction(fv + ALGORAND_MAX_WAIT_ROUNDS, sampleMillis);
+
+  return iErr;
+}
+
+
+int AlgoIoT::signPayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, const uint8_t* group, AlgoIoTSignedPayment* payment)
+{
+  int iErr = 0;
+
+  iErr = encodePayment(fv, fee, notes, notesLen, group, payment);
+  if (iErr)
+    return iErr;
+
+  return signEncodedPayment(payment);
+}
+
+
+int AlgoIoT::encodePayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, const uint8_t* group, AlgoIoTSignedPayment* payment)
+{
+  int iErr = 0;
+  uint8_t signature[ALGORAND_SIG_BYTES];  // Dry run only: content does not matter
+  MpkCountingSink headerCounter;
+  MpkCountingSink txCounter;
+  MpkWriter<MpkCountingSink> headerDryRun(headerCounter);
+  MpkWriter<MpkCountingSink> txDryRun(txCounter);
+
+  // Dry run: exact size of signed transaction header and of the transaction MessagePack, nothing written
+  // The transaction is assembled by reference (scatter-gather): encoded fields go to a small scratch buffer,
+  // the note is referenced where it already is, so only the copied bytes need room
+  iErr = createSignedBinaryTransaction(headerDryRun, signature);
+  if (!iErr)
+    iErr = prepareTransactionMessagePack(txDryRun, fv, fee, PAYMENT_AMOUNT_MICROALGOS, notes, notesLen, group);
+  if (iErr)
+  {
+    return ALGOIOT_MESSAGEPACK_ERROR;
+  }
+  payment->headerLen = headerCounter.length();
+  if ((payment->headerLen > ALGORAND_SIGNED_TX_HEADER_BYTES) || (txCounter.copiedLength() > ALGORAND_TX_SCRATCH_SIZE))
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Signed transaction needs %u scratch bytes, buffer holds %u\n", txCounter.copiedLength(), ALGORAND_TX_SCRATCH_SIZE);
+    #endif
+    return ALGOIOT_DATA_STRUCTURE_TOO_LONG;
+  }
+
+  // Prepare transaction structure as MessagePack segments
+  // Single bounds check for the copied bytes, then unchecked encoding
+  // Encoded bytes also go straight to the signature nonce hash, "TX" prefix first, while still hot:
+  // signing then reads the transaction only once more, instead of twice
+  MpkScatterSink<ALGORAND_TX_MAX_SEGMENTS> txSink(payment->scratch, ALGORAND_TX_SCRATCH_SIZE);
+  MpkHashSink<AlgoEd25519Hash> nonceSink(payment->nonceHash);
+  MpkTeeSink<MpkScatterSink<ALGORAND_TX_MAX_SEGMENTS>, MpkHashSink<AlgoEd25519Hash> > txTee(txSink, nonceSink);
+  MpkWriter<MpkTeeSink<MpkScatterSink<ALGORAND_TX_MAX_SEGMENTS>, MpkHashSink<AlgoEd25519Hash> > > msgPackTx(txTee);
+  AlgoEd25519::beginNonceHash(payment->nonceHash, m_signingKey);
+  payment->nonceHash.update(ALGORAND_TRANSACTION_PREFIX, ALGORAND_TRANSACTION_PREFIX_BYTES);
+  iErr = msgPackTx.reserve(txCounter.copiedLength());
+  if (!iErr)
+    iErr = prepareTransactionMessagePack(msgPackTx, fv, fee, PAYMENT_AMOUNT_MICROALGOS, notes, notesLen, group);
+  if (!iErr)
+    iErr = txSink.status();
+  if (iErr)
+  {
+    payment->nonceHash.clear();
+    return ALGOIOT_MESSAGEPACK_ERROR;
+  }
+
+  // Header segment comes first, written once signed
+  memcpy((void*)&(payment->segments[1]), (const void*)txSink.segments(), txSink.segmentCount() * sizeof(mpkSegment));
+  payment->nSegments = txSink.segmentCount() + 1;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::signEncodedPayment(AlgoIoTSignedPayment* payment)
+{
+  int iErr = 0;
+  uint8_t signature[ALGORAND_SIG_BYTES];
+
+  // Payment transaction correctly assembled, and already in the nonce hash. Now sign it
+  iErr = signMessagePackAddingPrefix(payment->nonceHash, &(payment->segments[1]), payment->nSegments - 1, &(signature[0]));
+  if (iErr)
+  {
+    payment->nonceHash.clear();
+    return ALGOIOT_SIGNATURE_ERROR;
+  }
+
+  // Signed OK: now compose payload header, in its own segment ahead of the transaction ones
+  MpkBufferSink headerSink(payment->header, ALGORAND_SIGNED_TX_HEADER_BYTES);
+  MpkWriter<MpkBufferSink> headerWriter(headerSink);
+  iErr = headerWriter.reserve(payment->headerLen);
+  if (!iErr)
+    iErr = createSignedBinaryTransaction(headerWriter, signature);
+  if (iErr)
+  {
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
+  }
+  payment->segments[0].data = payment->header;
+  payment->segments[0].len = payment->headerLen;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Encodes, signs and posts a payment transaction with the given parameters
+// "submitMode": ALGOIOT_SUBMIT_POST, ALGOIOT_SUBMIT_POST_OR_QUEUE (to the outbox if algod cannot be reached)
+// or ALGOIOT_SUBMIT_QUEUE (to the outbox only)
+// "rejected" set to 1 if algod refused the transaction, 0 otherwise
+// Return: error code (0 = OK, ALGOIOT_TRANSACTION_QUEUED if kept in the outbox)
+int AlgoIoT::signAndSubmitPayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, uint8_t* rejected, const uint8_t submitMode)
+{
+  int iErr = 0;
+  AlgoIoTSignedPayment payment;
+
+  *rejected = 0;
+
+  iErr = signPayment(fv, fee, notes, notesLen, NULL, &payment);
+  if (iErr)
+    return iErr;
+
+  if (submitMode == ALGOIOT_SUBMIT_QUEUE)
+  {
+    return queueSignedTransaction(payment.segments, payment.nSegments, fv + ALGORAND_MAX_WAIT_ROUNDS);
+  }
+
+  // Payload ready. Now we can submit it via algod REST API
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nReady to submit transaction to Algorand network");
+  DEBUG_SERIAL.println();
+  #endif
+  // Same signed transaction posted again on retriable errors: algod accepts it once at most
+  m_retry.start(validityMs(fv, fv + ALGORAND_MAX_WAIT_ROUNDS));
+  for (;;)
+  {
+    m_retry.attempt();
+    iErr = submitTransaction(payment.segments, payment.nSegments); // Returns HTTP code
+    if (!m_retry.retry(iErr))
+      break;
+    if (m_endpoints.failover())
+      continue;  // Another endpoint, at once
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("\nSubmission failed (%d): retrying in %u ms\n", iErr, m_retry.waitMs());
+    #endif
+    delay(m_retry.waitMs());
+  }
+  if (iErr != 200)  // 200 = HTTP OK
+  { // Something went wrong. ALGOIOT_TRANSACTION_ERROR here means algod refused the transaction (HTTP 400)
+    *rejected = (iErr == ALGOIOT_TRANSACTION_ERROR);
+    // Not sent at all (no connection, or body not fully sent): kept for later. Other failures are not
+    // queued, as algod may have accepted the transaction anyway (e.g. connection lost or timed out while
+    // waiting for the response)
+    if ((submitMode == ALGOIOT_SUBMIT_POST_OR_QUEUE) && neverSent(iErr))
+      return queueSignedTransaction(payment.segments, payment.nSegments, fv + ALGORAND_MAX_WAIT_ROUNDS);
+    if (AlgoIoTRetryScheduler::classify(iErr) == ALGOIOT_RETRY_RETRIABLE)
+      return ALGOIOT_NETWORK_ERROR;  // Retries exhausted: next transaction may get through
+    return ALGOIOT_TRANSACTION_ERROR;
+  }
+  // OK: our transaction, carrying sensor data in the Note field, 
+  // was successfully submitted to the Algorand blockchain
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.print("\t Transaction successfully submitted with ID=");
+  DEBUG_SERIAL.println(getTransactionID());
+  #endif
+  
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Appends a signed transaction to the outbox
+// Return: error code (ALGOIOT_TRANSACTION_QUEUED = queued)
+int AlgoIoT::queueSignedTransaction(const mpkSegment* signedTxSegments, const uint8_t nSegments, const uint64_t lastValid)
+{
+  m_transactionID[0] = '\0';
+  if (m_outbox->push(signedTxSegments, nSegments, lastValid) != ALGOIOT_OUTBOX_OK)
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("\nTransaction could not be queued: outbox full or storage error");
+    #endif
+    return ALGOIOT_OUTBOX_ERROR;
+  }
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.printf("\nTransaction queued in the outbox (%u pending)\n", m_outbox->pending());
+  #endif
+
+  return ALGOIOT_TRANSACTION_QUEUED;
+}
+
+
+// Note of a queued signed transaction, referenced in the record. Returns 0 if the record is a signed transaction
+static int findQueuedNote(const uint8_t* signedTx, const uint32_t signedTxLen, const uint8_t** note, uint16_t* noteLen)
+{
+  mpkReader reader;
+  const uint8_t* found = NULL;
+  uint32_t foundLen = 0;
+
+  if ((msgpackReaderInit(&reader, signedTx, signedTxLen) != MPK_NO_ERROR) ||
+      (msgpackMapFind(&reader, "txn") != MPK_NO_ERROR))
+    return ALGOIOT_TRANSACTION_ERROR;
+  if (msgpackMapFind(&reader, "note") == MPK_NO_ERROR)
+  {
+    if ((msgpackReadByteArray(&reader, &found, &foundLen) != MPK_NO_ERROR) || (foundLen > ALGORAND_MAX_NOTES_SIZE))
+      return ALGOIOT_TRANSACTION_ERROR;
+  }
+  *note = found;
+  *noteLen = (uint16_t)foundLen;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// ID of a queued signed transaction, as algod computes it: SHA-512/256 of "TX" and the "txn" map, as it is in
+// the record. "txID": ALGORAND_TRANSACTIONID_SIZE + 1 chars. Returns 0 if the record is a signed transaction
+static int queuedTransactionID(const uint8_t* signedTx, const uint32_t signedTxLen, char* txID)
+{
+  mpkReader reader;
+  uint32_t start = 0;
+  uint8_t hash[ALGORAND_TX_HASH_BYTES];
+  AlgoSHA512 txHash;
+
+  if ((msgpackReaderInit(&reader, signedTx, signedTxLen) != MPK_NO_ERROR) ||
+      (msgpackMapFind(&reader, "txn") != MPK_NO_ERROR))
+    return ALGOIOT_TRANSACTION_ERROR;
+  start = msgpackReaderGetPosition(&reader);
+  if (msgpackSkip(&reader) != MPK_NO_ERROR)
+    return ALGOIOT_TRANSACTION_ERROR;
+
+  txHash.resetSHA512_256();
+  txHash.update(ALGORAND_TRANSACTION_PREFIX, ALGORAND_TRANSACTION_PREFIX_BYTES);
+  txHash.update(signedTx + start, msgpackReaderGetPosition(&reader) - start);
+  txHash.finalize(hash, ALGORAND_TX_HASH_BYTES);
+  if (Base32::encode(hash, ALGORAND_TX_HASH_BYTES, txID, ALGORAND_TRANSACTIONID_SIZE + 1) == 0)
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Signs the note of a queued transaction again, with parameters "fv" and "fee", and posts it
+// Receiver and amount are the current ones
+// "rejected" set to 1 if algod refused the transaction, 0 otherwise
+// Return: error code (0 = OK)
+int AlgoIoT::resubmitQueuedNote(const uint8_t* signedTx, const uint32_t signedTxLen, const uint64_t fv, const uint64_t fee, uint8_t* rejected)
+{
+  const uint8_t* note = NULL;
+  uint16_t noteLen = 0;
+
+  *rejected = 0;
+  if (findQueuedNote(signedTx, signedTxLen, &note, &noteLen) != ALGOIOT_NO_ERROR)
+  { // Not a signed transaction: cannot be sent, nor signed again
+    *rejected = 1;
+    return ALGOIOT_TRANSACTION_ERROR;
+  }
+
+  // Note is referenced where it is, in the record read back
+  return signAndSubmitPayment(fv, fee, (const char*)note, noteLen, rejected, ALGOIOT_SUBMIT_POST);
+}
+
+
+int AlgoIoT::readQueuedNote(const uint32_t index, uint8_t* signedTx, const uint8_t** note, uint16_t* noteLen)
+{
+  uint32_t signedTxLen = 0;
+  uint64_t lastValid = 0;
+  int iErr = 0;
+
+  iErr = m_outbox->peekAt(index, signedTx, ALGORAND_SIGNED_TX_MAX_BYTES, &signedTxLen, &lastValid);
+  if (iErr == ALGOIOT_OUTBOX_BAD_PARAM)
+    return ALGOIOT_TRANSACTION_ERROR;  // Longer than any signed transaction we write
+  if (iErr)
+    return ALGOIOT_OUTBOX_ERROR;
+
+  return findQueuedNote(signedTx, signedTxLen, note, noteLen);
+}
+
+
+// Transaction ID = SHA-512/256 of "TX" and the transaction, encoded as it is signed (same bytes)
+int AlgoIoT::resignedTransactionID(const uint8_t* note, const uint16_t noteLen, const uint64_t fv, const uint64_t fee, const uint8_t* group, uint8_t txID[ALGORAND_TX_HASH_BYTES])
+{
+  AlgoSHA512 txHash;
+  MpkHashSink<AlgoSHA512> txSink(txHash);
+  MpkWriter<MpkHashSink<AlgoSHA512> > txWriter(txSink);
+  int iErr = 0;
+
+  txHash.resetSHA512_256();
+  txHash.update(ALGORAND_TRANSACTION_PREFIX, ALGORAND_TRANSACTION_PREFIX_BYTES);
+  iErr = prepareTransactionMessagePack(txWriter, fv, fee, PAYMENT_AMOUNT_MICROALGOS, (const char*)note, noteLen, group);
+  txHash.finalize(txID, ALGORAND_TX_HASH_BYTES);
+
+  return iErr ? ALGOIOT_MESSAGEPACK_ERROR : ALGOIOT_NO_ERROR;
+}
+
+
+// Group ID = SHA-512/256 of "TG" and MessagePack { "txlist": [ transaction IDs ] }, where each transaction ID is
+// SHA-512/256 of "TX" and the transaction without "grp". Each member then carries the group ID in "grp", and is
+// signed with it: two passes over the queued records, this one for the IDs, the other to sign while posting
+int AlgoIoT::queuedGroupID(uint8_t* signedTx, const uint8_t count, const uint64_t fv, const uint64_t fee, uint8_t groupID[ALGORAND_TX_HASH_BYTES], uint32_t* bodyLen)
+{
+  uint8_t signature[ALGORAND_SIG_BYTES];  // Dry runs only: content does not matter
+  AlgoSHA512 groupHash;
+  MpkHashSink<AlgoSHA512> groupSink(groupHash);
+  MpkWriter<MpkHashSink<AlgoSHA512> > groupList(groupSink);
+  int iErr = 0;
+
+  *bodyLen = 0;
+
+  // Transaction IDs, hashed straight into the group ID, and request body length
+  groupHash.resetSHA512_256();
+  groupHash.update(ALGORAND_GROUP_PREFIX, ALGORAND_GROUP_PREFIX_BYTES);
+  groupList.putShortMap(1);
+  groupList.putShortString("txlist", 6);
+  groupList.putArray(count);
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const uint8_t* note = NULL;
+    uint16_t noteLen = 0;
+    uint8_t txID[ALGORAND_TX_HASH_BYTES];
+    MpkCountingSink headerCounter;
+    MpkCountingSink memberCounter;
+    MpkWriter<MpkCountingSink> headerDryRun(headerCounter);
+    MpkWriter<MpkCountingSink> memberDryRun(memberCounter);
+
+    iErr = readQueuedNote(i, signedTx, &note, &noteLen);
+    if (iErr)
+      return iErr;
+    iErr = resignedTransactionID(note, noteLen, fv, fee, NULL, txID);
+    if (!iErr)
+      iErr = createSignedBinaryTransaction(headerDryRun, signature);
+    // Any 32 bytes measure as the group ID does
+    if (!iErr)
+      iErr = prepareTransactionMessagePack(memberDryRun, fv, fee, PAYMENT_AMOUNT_MICROALGOS, (const char*)note, noteLen, groupID);
+    if (iErr)
+      return ALGOIOT_MESSAGEPACK_ERROR;
+    groupList.putShortByteArray(txID, ALGORAND_TX_HASH_BYTES);
+    *bodyLen += headerCounter.length() + memberCounter.length();
+  }
+  groupHash.finalize(groupID, ALGORAND_TX_HASH_BYTES);
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::submitQueuedGroup(uint8_t* signedTx, const uint8_t count, const uint64_t fv, const uint64_t fee, uint8_t* rejected)
+{
+  uint32_t bodyLen = 0;
+  uint8_t groupID[ALGORAND_TX_HASH_BYTES];
+  int iErr = 0;
+
+  *rejected = 0;
+
+  iErr = queuedGroupID(signedTx, count, fv, fee, groupID, &bodyLen);
+  if (iErr == ALGOIOT_TRANSACTION_ERROR)
+  { // Sent on its own, and dropped there
+    *rejected = 1;
+    return iErr;
+  }
+  if (iErr)
+    return iErr;
+
+  // Members signed one at a time while the body is sent
+  AlgoIoTGroupStream body(*this, signedTx, count, fv, fee, groupID, bodyLen);
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.printf("\nSubmitting %u queued transactions as one group\n", count);
+  #endif
+  iErr = submitTransaction(&body, body.length());
+  if (body.failed())
+    return ALGOIOT_OUTBOX_ERROR;
+  if (iErr != 200)
+  {
+    if (iErr != ALGOIOT_TRANSACTION_ERROR)
+      return ALGOIOT_NETWORK_ERROR;  // Kept for next time
+    invalidateTxParams();
+    *rejected = 1;
+    return ALGOIOT_TRANSACTION_ERROR;
+  }
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Expired records ahead of the others, up to a group: queued in order, they expire in order
+uint8_t AlgoIoT::expiredQueued(uint8_t* signedTx, const uint64_t round)
+{
+  uint8_t count = 0;
+
+  while ((count < ALGORAND_MAX_GROUP_TXNS) && (count < m_outbox->pending()))
+  {
+    uint32_t signedTxLen = 0;
+    uint64_t lastValid = 0;
+
+    if ((m_outbox->peekAt(count, signedTx, ALGORAND_SIGNED_TX_MAX_BYTES, &signedTxLen, &lastValid) != ALGOIOT_OUTBOX_OK) ||
+        (lastValid > round))
+      break;
+    count++;
+  }
+
+  return count;
+}
+
+
+// The oldest record may be in the ledger already, in the form it was last posted in: as queued (the post of a
+// still valid record got no answer), or signed again with the parameters kept (m_resign*). Asked for by ID
+// Not needed while those parameters are valid: the same transactions are posted again, and algod tells
+int AlgoIoT::queuedSettled(uint8_t* signedTx, const uint32_t signedTxLen, const uint64_t round, uint8_t* settled)
 {
-  uint32_t fv = 0;
-  uint16_t fee = 0;
+  char txID[ALGORAND_TRANSACTIONID_SIZE + 1];
+  uint8_t hash[ALGORAND_TX_HASH_BYTES];
+  uint8_t groupID[ALGORAND_TX_HASH_BYTES];
+  const uint8_t* note = NULL;
+  uint16_t noteLen = 0;
+  uint32_t bodyLen = 0;
+  uint64_t confirmedRound = 0;
+  uint8_t poolError = 0;
+  int httpCode = 0;
   int iErr = 0;
-  uint8_t signature[ALGORAND_SIG_BYTES];
-  char notes[ALGORAND_MAX_NOTES_SIZE + 1] = "";
-  uint8_t transactionMessagePackBuffer[ALGORAND_MAX_TX_MSGPACK_SIZE];
-  char transactionID[ALGORAND_TRANSACTIONID_SIZE + 1];
-  msgPack msgPackTx = NULL;
-
-  
-  // Add preamble to ARC-2 note field
-  // Write app name and format specifier for ARC-2 (we use the JSON flavour of ARC-2)
-  memcpy((void*)&(notes[0]), (void*)m_appName, strlen(m_appName));
-  m_noteOffset = strlen(m_appName);
-  notes[m_noteOffset++] = ':';
-  notes[m_noteOffset++] = 'j';
-  m_noteLen += m_noteOffset;
 
-  // Serialize Note field to binary buffer after "<app-name>:j"
-  int jlen = serializeJson(m_noteJDoc, (char*) (notes + m_noteOffset), ALGORAND_MAX_NOTES_SIZE);
-  if (jlen < 1)
+  *settled = 0;
+  if (m_resignCount == 0)
   {
-    return ALGOIOT_JSON_ERROR;
+    if (queuedTransactionID(signedTx, signedTxLen, txID) != ALGOIOT_NO_ERROR)
+      return ALGOIOT_NO_ERROR;  // Not a signed transaction: dropped when signed again
   }
-  int notesLen = jlen + m_noteOffset;
-
-  // Get current Algorand parameters
-  int httpResCode = getAlgorandTxParams(&fv, &fee);
-  if (httpResCode != 200)
+  else
   {
-    return ALGOIOT_NETWORK_ERROR;
+    if (m_resignFv + ALGORAND_MAX_WAIT_ROUNDS > round)
+      return ALGOIOT_NO_ERROR;
+    // "signedTx" reused: the oldest record is read back last
+    if (m_resignCount > 1)
+      iErr = queuedGroupID(signedTx, m_resignCount, m_resignFv, m_resignFee, groupID, &bodyLen);
+    if (!iErr)
+      iErr = readQueuedNote(0, signedTx, &note, &noteLen);
+    if (!iErr)
+      iErr = resignedTransactionID(note, noteLen, m_resignFv, m_resignFee, (m_resignCount > 1) ? groupID : NULL, hash);
+    if (iErr)
+    {
+      m_resignCount = 0;
+      return ALGOIOT_NO_ERROR;
+    }
+    Base32::encode(hash, ALGORAND_TX_HASH_BYTES, txID, sizeof(txID));
   }
 
-  // Prepare transaction structure as MessagePack
-  msgPackTx = msgpackInit(&(transactionMessagePackBuffer[0]), ALGORAND_MAX_TX_MSGPACK_SIZE);
-  if (msgPackTx == NULL)  
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.println("\n Error initializing transaction MessagePack\n");
-    #endif
-    return ALGOIOT_MESSAGEPACK_ERROR;
-  }  
-  iErr = prepareTransactionMessagePack(msgPackTx, fv, fee, PAYMENT_AMOUNT_MICROALGOS, notes, (uint16_t)notesLen);
-  if (iErr)
-  {
-    return ALGOIOT_MESSAGEPACK_ERROR;
+  httpCode = getPendingTransaction(txID, &confirmedRound, &poolError);
+  if (httpCode == 404)
+  { // Unknown: never got there, or a pool entry dropped when it expired
+    m_resignCount = 0;
+    return ALGOIOT_NO_ERROR;
   }
+  if (httpCode != 200)
+    return ALGOIOT_NETWORK_ERROR;  // Kept for next time
+  // In the pool but not confirmed: expired, so it never will be
+  *settled = (confirmedRound > 0);
+  if (!*settled)
+    m_resignCount = 0;
+  #ifdef LIB_DEBUGMODE
+  if (*settled)
+    DEBUG_SERIAL.printf("\nQueued transaction %s already confirmed in round %llu\n", txID, (unsigned long long)confirmedRound);
+  #endif
 
-  // Payment transaction correctly assembled. Now sign it
-  iErr = signMessagePackAddingPrefix(msgPackTx, &(signature[0]));
-  if (iErr)
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Pops the "count" oldest records (posted)
+int AlgoIoT::popQueued(uint8_t* signedTx, const uint8_t count)
+{
+  m_resignCount = 0;
+  for (uint8_t i = 0; i < count; i++)
   {
-    return ALGOIOT_SIGNATURE_ERROR;
+    uint32_t signedTxLen = 0;
+    uint64_t lastValid = 0;
+    // peek() first: pop() applies to the record it found
+    if ((m_outbox->peek(signedTx, ALGORAND_SIGNED_TX_MAX_BYTES, &signedTxLen, &lastValid) != ALGOIOT_OUTBOX_OK) ||
+        (m_outbox->pop() != ALGOIOT_OUTBOX_OK))
+      return ALGOIOT_OUTBOX_ERROR;
   }
 
-  // Signed OK: now compose payload
-  iErr = createSignedBinaryTransaction(msgPackTx, signature);
+  return ALGOIOT_NO_ERROR;
+}
+
+
+// Queued transactions are sent as they are while still valid: posted again, algod recognizes them by ID
+// Expired ones (or refused ones: expired after all, as the round is only estimated) are signed again, the
+// expired ones at the head of the outbox as one group. A post of those that gets no answer leaves them in the
+// outbox with the parameters used (m_resign*): signed again with the same ones while valid, the same
+// transactions are posted; once expired, the ledger is asked whether they got there before signing with new ones
+// Transactions refused even then are dropped, so that one of them cannot block the outbox
+// Return: error code (0 = outbox empty)
+int AlgoIoT::flushOutbox()
+{
+  uint8_t signedTx[ALGORAND_SIGNED_TX_MAX_BYTES];
+  uint32_t signedTxLen = 0;
+  uint64_t lastValid = 0;
+  uint64_t round = 0;
+  uint64_t fee = 0;
+  uint64_t fv = 0;
+  uint8_t estimated = 0;
+  uint8_t rejected = 0;
+  uint8_t settled = 0;
+  uint8_t count = 1;
+  int iErr = 0;
+
+  if (m_outbox == NULL)
+    return ALGOIOT_NO_ERROR;
+  iErr = begin();
   if (iErr)
+    return iErr;
+
+  while (m_outbox->pending() > 0)
   {
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  }
+    iErr = m_outbox->peek(signedTx, sizeof(signedTx), &signedTxLen, &lastValid);
+    if (iErr == ALGOIOT_OUTBOX_EMPTY)
+      break;
+    if (iErr)
+      return ALGOIOT_OUTBOX_ERROR;
 
-  // Payload ready. Now we can submit it via algod REST API
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.println("\nReady to submit transaction to Algorand network");
-  DEBUG_SERIAL.println();
-  #endif
-  iErr = submitTransaction(msgPackTx); // Returns HTTP code
-  if (iErr != 200)  // 200 = HTTP OK
-  { // Something went wrong
-    return ALGOIOT_TRANSACTION_ERROR;
+    iErr = getTxParams(&round, &fee, &estimated);
+    if (iErr)
+      return iErr;
+
+    count = 1;
+    if (lastValid > round)
+    { // Still valid, as far as we know: sent as it is
+      mpkSegment record = { signedTx, signedTxLen };
+      iErr = submitTransaction(&record, 1);
+      if (iErr == 200)
+      {
+        if (popQueued(signedTx, 1))
+          return ALGOIOT_OUTBOX_ERROR;
+        continue;
+      }
+      if (iErr != ALGOIOT_TRANSACTION_ERROR)
+        return ALGOIOT_NETWORK_ERROR;  // Kept for next time
+      // Refused: signed again below, with fresh parameters
+      invalidateTxParams();
+      iErr = getTxParams(&round, &fee, &estimated);
+      if (iErr)
+        return iErr;
+    }
+    else
+    { // Expired: signed again below, unless it is in the ledger already
+      iErr = queuedSettled(signedTx, signedTxLen, round, &settled);
+      if (iErr)
+        return iErr;
+      if (settled)
+      {
+        if (popQueued(signedTx, (m_resignCount > 0) ? m_resignCount : 1))
+          return ALGOIOT_OUTBOX_ERROR;
+        continue;
+      }
+      count = expiredQueued(signedTx, round);
+    }
+
+    fv = round;
+    if (m_resignCount > 0)
+    { // Same transactions as the post that got no answer
+      fv = m_resignFv;
+      fee = m_resignFee;
+      count = m_resignCount;
+    }
+
+    if (count > 1)
+    {
+      iErr = submitQueuedGroup(signedTx, count, fv, fee, &rejected);
+      if (!iErr)
+      {
+        if (popQueued(signedTx, count))
+          return ALGOIOT_OUTBOX_ERROR;
+        continue;
+      }
+      if (!rejected)
+      { // Kept for next time
+        m_resignFv = fv;
+        m_resignFee = fee;
+        m_resignCount = count;
+        return iErr;
+      }
+      // Refused as a whole: oldest one on its own, with fresh parameters, so that a bad record only costs itself
+      m_resignCount = 0;
+      iErr = getTxParams(&round, &fee, &estimated);
+      if (iErr)
+        return iErr;
+      fv = round;
+    }
+
+    if (m_outbox->peek(signedTx, sizeof(signedTx), &signedTxLen, &lastValid) != ALGOIOT_OUTBOX_OK)
+      return ALGOIOT_OUTBOX_ERROR;
+    iErr = resubmitQueuedNote(signedTx, signedTxLen, fv, fee, &rejected);
+    if (rejected)
+    {
+      invalidateTxParams();
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.println("\nQueued transaction refused by algod: dropped");
+      #endif
+    }
+    else if (iErr)
+    { // Kept for next time
+      m_resignFv = fv;
+      m_resignFee = fee;
+      m_resignCount = 1;
+      return iErr;
+    }
+    if (popQueued(signedTx, 1))
+      return ALGOIOT_OUTBOX_ERROR;
   }
-  // OK: our transaction, carrying sensor data in the Note field, 
-  // was successfully submitted to the Algorand blockchain
-  #ifdef LIB_DEBUGMODE
-  DEBUG_SERIAL.print("\t Transaction successfully submitted with ID=");
-  DEBUG_SERIAL.println(getTransactionID());
-  #endif
-  
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::setOutbox(AlgoIoTOutbox* outbox)
+{
+  m_outbox = NULL;
+  if (outbox == NULL)
+    return ALGOIOT_NO_ERROR;
+  if (outbox->open() != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_ERROR;
+  m_outbox = outbox;
+
   return ALGOIOT_NO_ERROR;
 }
 
 
+uint32_t AlgoIoT::outboxPending()
+{
+  return (m_outbox != NULL) ? m_outbox->pending() : 0;
+}
+
+
 ///////////////////////////
 //
 // End exported functions
@@ -485,9 +1699,9 @@ int AlgoIoT::submitTransactionToAlgorand()
 // Private methods
 
 // Decodes Base64 Algorand network hash to 32-byte binary buffer suitable for our functions
-// outBinaryHash has to be freed by caller
+// outBinaryHash passed by caller
 // Returns error code (0 = OK)
-int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash)
+int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t outBinaryHash[ALGORAND_NET_HASH_BYTES])
 { 
   if (hashB64 == NULL)
     return 1;
@@ -496,12 +1710,9 @@ int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash)
   if (inputLen > encode_base64_length(ALGORAND_NET_HASH_BYTES))
     return 2;
   
-  outBinaryHash = (uint8_t*) malloc(ALGORAND_NET_HASH_BYTES);
-  
   int hashLen = decode_base64((unsigned char*)hashB64, outBinaryHash);
   if (hashLen != ALGORAND_NET_HASH_BYTES)
   {
-    free(outBinaryHash);
     return 3;
   }
 
@@ -509,537 +1720,668 @@ int AlgoIoT::decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash)
 }
 
 
-int AlgoIoT::decodeAlgorandAddress(const char* addressB32, uint8_t*& outBinaryAddress)
-{
-  if (addressB32 == NULL)
-    return 1;
-  
-  int iLen = Base32::fromBase32((uint8_t*)addressB32, strlen(addressB32), outBinaryAddress);
-  if (iLen < ALGORAND_ADDRESS_BYTES + 4)  // Decoded address len from Base32 has to be exactly 36 bytes (but we use only the first 32 bytes)
-  {
-    free(outBinaryAddress);
-    return 2;
-  }
+int AlgoIoT::decodeAlgorandAddress(const char* addressB32, uint8_t outBinaryAddress[ALGORAND_ADDRESS_BYTES])
+{
+  uint8_t decodedAddress[ALGORAND_ADDRESS_BYTES];
+
+  if (addressB32 == NULL)
+    return 1;
+
+  // Decoded to a local buffer, so current address is left unchanged on error
+  int iErr = AlgoAddress::decode(addressB32, decodedAddress);
+  if (iErr)
+    return iErr;  // 2 = wrong length, 3 = invalid char, 4 = wrong checksum (see algoaddress.h)
+
+  memcpy(outBinaryAddress, decodedAddress, ALGORAND_ADDRESS_BYTES);
+
+  return 0;
+}
+
+
+int AlgoIoT::decodePrivateKeyFromMnemonics(const char* inMnemonicWords, uint8_t privateKey[ALGORAND_KEY_BYTES])
+{ 
+  uint16_t  indexes11bit[ALGORAND_MNEMONICS_NUMBER];
+  uint8_t   decodedBytes[ALGORAND_KEY_BYTES + 3];
+  const char* mnWord = NULL;
+  uint8_t   wordLen = 0;
+  int16_t   wordIndex = 0;
+
+  if (inMnemonicWords == NULL)
+    return 1;
+
+  int inputLen = strlen(inMnemonicWords);
+
+  // Early sanity check: mnemonicWords contains 25 space-delimited words, each composed by a minimum of 3 chars
+  if (inputLen < ALGORAND_MNEMONICS_NUMBER * (ALGORAND_MNEMONIC_MIN_LEN + 1))
+    return 2;
+
+  if (strchr(inMnemonicWords, ' ') == NULL)
+    return 3; // Invalid input, does not contain spaces
+
+  // Input parsing loop
+  // Words are delimited in place (pointer + length): input is neither copied nor modified
+  uint8_t index = 0;
+  mnWord = inMnemonicWords;
+  while (1)
+  {
+    // Skip delimiters, as strtok() did
+    while (*mnWord == ' ')
+      mnWord++;
+    if (*mnWord == '\0')
+      break;
+    wordLen = 0;
+    while ((mnWord[wordLen] != ' ') && (mnWord[wordLen] != '\0') && (wordLen <= ALGORAND_MNEMONIC_MAX_LEN))
+      wordLen++;
+
+    if (index >= ALGORAND_MNEMONICS_NUMBER)
+    {
+      return 5; // Wrong mnemonics: too many words
+    }
+
+    // Check word validity against BIP39 English words
+    wordIndex = Bip39En::wordIndex(mnWord, wordLen);
+    if (wordIndex < 0)
+    {
+      return 4; // Wrong mnemonics: invalid word
+    }
+    indexes11bit[index++] = (uint16_t)wordIndex;
+
+    mnWord += wordLen;
+  }
+
+  if (index != ALGORAND_MNEMONICS_NUMBER)
+  {
+    return 6; // Wrong mnemonics: too few words (we already managed the too much words case)
+  }
+  
+  // We now have an array of ALGORAND_MNEMONICS_NUMBER 16-bit unsigned values, which actually only use 11 bits (0..2047)
+  // The last element is a checksum, verified below once the key is decoded
+
+  // We now build a byte array from the uint16_t array: 25 x 11-bits values become 34/35 x 8-bits values
+
+  uint32_t tempInt = 0;
+  uint16_t numBits = 0;
+  uint16_t destIndex = 0;
+  for (uint16_t i = 0; i < ALGORAND_MNEMONICS_NUMBER; i++)
+  { 
+    // For each 11-bit value, fill appropriate consecutive byte array elements
+    tempInt |= (((uint32_t)indexes11bit[i]) << numBits);
+    numBits += 11;
+    while (numBits >= 8)
+    {
+      decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
+      destIndex++;
+      tempInt = tempInt >> 8;
+      numBits -= 8;
+    }
+  }
+  if (numBits != 0)
+  {
+    decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
+  }
+
+  // Checksum word: low 11 bits of the first 2 bytes (little endian) of SHA512/256 of the key
+  uint8_t keyHash[2];
+  AlgoSHA512 checksumHash;
+  checksumHash.resetSHA512_256();
+  checksumHash.update(decodedBytes, ALGORAND_KEY_BYTES);
+  checksumHash.finalize(keyHash, sizeof(keyHash));
+  checksumHash.clear();
+  if (indexes11bit[ALGORAND_MNEMONICS_NUMBER - 1] != ((keyHash[0] | ((uint16_t)keyHash[1] << 8)) & 0x7FF))
+  {
+    return 7; // Wrong mnemonics: checksum word does not match the key
+  }
+
+  // Copy key to output array
+  memcpy((void*)&(privateKey[0]), (void*)decodedBytes, ALGORAND_KEY_BYTES);
+
+  return 0;
+}
+
+
+// Current transaction parameters, from algod or from cache
+// Cached values are used while younger than m_paramsMaxAgeMs; the round is then extrapolated from the
+// elapsed time, at a slower pace than the real one so that the estimate lags the chain and "fv" is never
+// a future round (which algod would reject). The lag only shortens the validity window a little
+// "estimated" is set to 1 if values come from cache
+// Returns error code (0 = OK)
+int AlgoIoT::getTxParams(uint64_t* round, uint64_t* minFee, uint8_t* estimated)
+{
+  uint32_t requestMillis = 0;
+  int httpCode = 0;
+
+  *estimated = cachedTxParams(round, minFee);
+  if (*estimated)
+    return ALGOIOT_NO_ERROR;
+
+  // Timestamp taken before the request: the round received is at least that recent
+  // On failure, last values received are kept: the outbox signs offline with them (see estimateOfflineTxParams())
+  m_retry.start(0);
+  for (;;)
+  {
+    requestMillis = millis();
+    m_retry.attempt();
+    httpCode = getAlgorandTxParams(round, minFee);
+    if (!m_retry.retry(httpCode))
+      break;
+    if (m_endpoints.failover())
+      continue;  // Another endpoint, at once
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.printf("Transaction parameters request failed (%d): retrying in %u ms\n", httpCode, m_retry.waitMs());
+    #endif
+    delay(m_retry.waitMs());
+  }
+  if (httpCode != 200)
+  {
+    m_paramsValid = 0;
+    return ALGOIOT_NETWORK_ERROR;
+  }
+  storeTxParams(*round, *minFee, requestMillis);
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+uint8_t AlgoIoT::cachedTxParams(uint64_t* round, uint64_t* minFee)
+{
+  uint32_t ageMs = millis() - m_paramsMillis;
+
+  if (!m_paramsValid || (ageMs >= m_paramsMaxAgeMs))
+    return 0;
+
+  *round = m_paramsRound + ageMs / ALGORAND_ROUND_ESTIMATE_MS;
+  *minFee = m_paramsMinFee;
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.print("Cached transaction parameters, estimated round = "); DEBUG_SERIAL.println(*round);
+  #endif
+
+  return 1;
+}
+
+
+void AlgoIoT::storeTxParams(const uint64_t round, const uint64_t minFee, const uint32_t requestMillis)
+{
+  m_paramsMillis = requestMillis;
+  m_paramsRound = round;
+  m_paramsMinFee = minFee;
+  m_paramsValid = 1;
+}
+
+
+// Parameters for a transaction signed while algod cannot be reached, to be queued in the outbox
+// Last round received, extrapolated as getTxParams() does, however old; without one, round 1: such a
+// transaction is already expired when the network is back, and flushOutbox() signs it again anyway
+void AlgoIoT::estimateOfflineTxParams(uint64_t* round, uint64_t* minFee)
+{
+  if (m_paramsRound > 0)
+    *round = m_paramsRound + (millis() - m_paramsMillis) / ALGORAND_ROUND_ESTIMATE_MS;
+  else
+    *round = 1;
+  *minFee = (m_paramsMinFee > 0) ? m_paramsMinFee : ALGORAND_MIN_FEE_MICROALGOS;
+}
+
+
+void AlgoIoT::setTxParamsMaxAge(const uint32_t maxAgeMs)
+{
+  m_paramsMaxAgeMs = maxAgeMs;
+}
+
+
+void AlgoIoT::invalidateTxParams()
+{
+  m_paramsValid = 0;
+}
+
+
+// "response" NULL: transport response in progress, read from the connection as it arrives
+int AlgoIoT::scanResponse(AlgoIoTJsonScanner* scanner, const char* response)
+{
+  if (response != NULL)
+    scanner->write((const uint8_t*)response, strlen(response));
+  else if (m_transport->readBody(scanner) < 0)
+    return ALGOIOT_NETWORK_ERROR;  // Body cut short, or timeout
+
+  if (!scanner->complete())
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("JSON response parsing failed!");
+    #endif
+    return ALGOIOT_JSON_ERROR;
+  }
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::parseTxParams(const char* response, uint64_t* round, uint64_t* minFee)
+{
+  AlgoIoTJsonScanner scanner;
+  char roundText[ALGOIOT_JSON_NUMBER_CHARS + 1];
+  char minFeeText[ALGOIOT_JSON_NUMBER_CHARS + 1];
+  int iErr = 0;
+
+  // Fetch interesting fields
+  scanner.watch("last-round", roundText, sizeof(roundText));
+  scanner.watch("min-fee", minFeeText, sizeof(minFeeText));
+  iErr = scanResponse(&scanner, response);
+  if (iErr)
+    return iErr;
+  if (!AlgoIoTJsonScanner::toUInt64(roundText, round) || !AlgoIoTJsonScanner::toUInt64(minFeeText, minFee) || (*round == 0))
+  {
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.println("GetParams: last-round or min-fee missing in response!");
+    #endif
+    return ALGOIOT_JSON_ERROR;
+  }
+
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("Algorand transaction parameters received:");
+  DEBUG_SERIAL.print("min-fee = "); DEBUG_SERIAL.print(*minFee); DEBUG_SERIAL.println(" microAlgo");
+  DEBUG_SERIAL.print("last-round = "); DEBUG_SERIAL.println(*round);                  
+  #endif                  
+
+  return ALGOIOT_NO_ERROR;
+}
+
+
+int AlgoIoT::parseTransactionID(const char* response)
+{
+  AlgoIoTJsonScanner scanner;
+  char txID[ALGORAND_TRANSACTIONID_SIZE + 1];
+  int8_t txIDField = scanner.watch("txId", txID, sizeof(txID));
+  int iErr = 0;
+
+  iErr = scanResponse(&scanner, response);
+  if (iErr)
+    return iErr;
+  if (!scanner.found(txIDField) || scanner.truncated(txIDField) || (txID[0] == '\0'))
+    return ALGOIOT_JSON_ERROR;
+  strcpy(m_transactionID, txID);
 
-  return 0;
+  return ALGOIOT_NO_ERROR;
 }
 
 
-int AlgoIoT::decodePrivateKeyFromMnemonics(const char* inMnemonicWords, uint8_t privateKey[ALGORAND_KEY_BYTES])
-{ 
-  uint16_t  indexes11bit[ALGORAND_MNEMONICS_NUMBER];
-  uint8_t   decodedBytes[ALGORAND_KEY_BYTES + 3];
-  // char      checksumWord[ALGORAND_MNEMONIC_MAX_LEN + 1] = "";  
-  char*     mnWord = NULL;
-  char*     mnemonicWords = NULL;
+// Time left before "lastValid", counted at a faster pace than the real one and less a margin: a retry started
+// within it reaches algod while the transaction is still valid, even if "round" lags the chain a little
+uint32_t AlgoIoT::validityMs(const uint64_t round, const uint64_t lastValid)
+{
+  uint64_t validMs = 0;
 
-  if (inMnemonicWords == NULL)
+  if (lastValid <= round + ALGORAND_DEADLINE_MARGIN_ROUNDS)
     return 1;
+  validMs = (lastValid - round - ALGORAND_DEADLINE_MARGIN_ROUNDS) * ALGORAND_ROUND_FAST_MS;
 
-  int inputLen = strlen(inMnemonicWords);
+  return (validMs < 0xFFFFFFFFULL) ? (uint32_t)validMs : 0xFFFFFFFFUL;
+}
 
-  // Early sanity check: mnemonicWords contains 25 space-delimited words, each composed by a minimum of 3 chars
-  if (inputLen < ALGORAND_MNEMONICS_NUMBER * (ALGORAND_MNEMONIC_MIN_LEN + 1))
-    return 2;
 
-  // Copy input to work string
-  mnemonicWords = (char*)malloc(inputLen + 1);
-  if (!mnemonicWords)
-    return 7;
-  strcpy(mnemonicWords, inMnemonicWords);
+// algod refuses a transaction it already has, e.g. posted again after a gateway error although it got through:
+// {"message":"transaction already in ledger: <ID>"}. ID characters are Base32 (A-Z, 2-7)
+int AlgoIoT::parseDuplicateTransaction(const char* response)
+{
+  AlgoIoTJsonScanner scanner;
+  char message[ALGORAND_MAX_MESSAGE_CHARS + 1];
+  const char* txID = NULL;
+  uint16_t len = 0;
+  int iErr = 0;
 
-  // Off-cycle
-  mnWord = strtok(mnemonicWords, " ");
-  if (mnWord == NULL)
+  scanner.watch("message", message, sizeof(message));
+  iErr = scanResponse(&scanner, response);
+  if (iErr == ALGOIOT_NETWORK_ERROR)
+    return iErr;  // Body cut short: the message may have been that one
+  if (iErr)
+    return ALGOIOT_TRANSACTION_ERROR;
+  txID = strstr(message, ALGORAND_DUPLICATE_TX_MESSAGE);
+  if (txID == NULL)
   {
-    free(mnemonicWords);
-    return 3; // Invalid input, does not contain spaces
+    #ifdef LIB_DEBUGMODE
+    DEBUG_SERIAL.print("Server response: "); DEBUG_SERIAL.println(message);
+    #endif
+    return ALGOIOT_TRANSACTION_ERROR;
   }
-
-  // Input parsing loop
-  uint8_t index = 0;
-  uint8_t found = 0;
-  uint16_t pos = 0;
-  while (mnWord != NULL) 
+  txID += sizeof(ALGORAND_DUPLICATE_TX_MESSAGE) - 1;
+  while ((len < ALGORAND_TRANSACTIONID_SIZE) &&
+         (((txID[len] >= 'A') && (txID[len] <= 'Z')) || ((txID[len] >= '2') && (txID[len] <= '7'))))
   {
-    // Check word validity against BIP39 English words
-    found = 0;
-    pos = 0;
-    while ((pos < BIP39_EN_WORDS_NUM) && (!found))
-    {
-      if (!strcmp(mnWord, BIP39_EN_Wordlist[pos]))
-      {
-        indexes11bit[index++] = pos;
-        found = 1;
-      }
-      pos++;
-    }
-    if (!found)
-    {
-      free(mnemonicWords);
-      return 4; // Wrong mnemonics: invalid word
-    }
-    if (index > ALGORAND_MNEMONICS_NUMBER)
-    {
-      free(mnemonicWords);
-      return 5; // Wrong mnemonics: too many words
-    }
-
-    mnWord = strtok(NULL, " "); // strtok with NULL as first argument means it continues to parse the original string
+    len++;
   }
+  if (len == 0)
+    return ALGOIOT_TRANSACTION_ERROR;
+  memcpy(m_transactionID, txID, len);
+  m_transactionID[len] = '\0';
 
-  if (index != ALGORAND_MNEMONICS_NUMBER)
-  {
-    free(mnemonicWords);
-    return 6; // Wrong mnemonics: too few words (we already managed the too much words case)
-  }
-  
-  // We now have an array of ALGORAND_MNEMONICS_NUMBER 16-bit unsigned values, which actually only use 11 bits (0..2047)
-  // The last element is a checksum 
+  #ifdef LIB_DEBUGMODE
+  DEBUG_SERIAL.println("\nTransaction was already accepted");
+  #endif
 
-  // Save checksum word (not used ATM, see below)
-  // strncpy(checksumWord, BIP39_EN_Wordlist[indexes[index-1]], ALGORAND_MNEMONIC_MAX_LEN);
+  return ALGOIOT_NO_ERROR;
+}
 
-  free(mnemonicWords);
 
-  // We now build a byte array from the uint16_t array: 25 x 11-bits values become 34/35 x 8-bits values
+uint8_t AlgoIoT::selectEndpoint(char* url, const char* path)
+{
+  uint8_t index = m_endpoints.select();
+  const AlgoIoTEndpoint* endpoint = m_endpoints.get(index);
 
-  uint32_t tempInt = 0;
-  uint16_t numBits = 0;
-  uint16_t destIndex = 0;
-  for (uint16_t i = 0; i < ALGORAND_MNEMONICS_NUMBER; i++)
-  { 
-    // For each 11-bit value, fill appropriate consecutive byte array elements
-    tempInt |= (((uint32_t)indexes11bit[i]) << numBits);
-    numBits += 11;
-    while (numBits >= 8)
-    {
-      decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
-      destIndex++;
-      tempInt = tempInt >> 8;
-      numBits -= 8;
-    }
-  }
-  if (numBits != 0)
+  url[0] = '\0';
+  if (endpoint != NULL)
   {
-    decodedBytes[destIndex] = (uint8_t)(tempInt & 0xff);
+    strcpy(url, endpoint->url);
+    strcat(url, path);
   }
 
-  // TODO we do not verify the checksum, because at the moment we miss a viable implementation of SHA512/256
-
-  // Copy key to output array
-  memcpy((void*)&(privateKey[0]), (void*)decodedBytes, ALGORAND_KEY_BYTES);
-
-  return 0;
+  return index;
 }
 
 
-// Retrieves current Algorand transaction parameters
-// Returns HTTP error code
-// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
-int AlgoIoT::getAlgorandTxParams(uint32_t* round, uint16_t* minFee)
+// The transport reuses its open connection if the endpoint selected is the one it is connected to
+int AlgoIoT::sendRequest(const char* path, const char* method, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs, const uint8_t timed)
 {
-  String httpRequest = m_httpBaseURL + GET_TRANSACTION_PARAMS;
-          
-  *round = 0;
-  *minFee = 0;
-
-  // configure server and url               
-  m_httpClient.begin(httpRequest);
-    
-  int httpResponseCode = m_httpClient.GET();
+  char url[ALGORAND_API_ENDPOINT_CHARS + ALGORAND_API_PATH_CHARS + 1];
+  const AlgoIoTEndpoint* endpoint = NULL;
+  const char* apiToken = NULL;
+  uint8_t endpointIndex = selectEndpoint(url, path);
+  uint32_t requestMillis = millis();
+  int httpResponseCode = 0;
+
+  endpoint = m_endpoints.get(endpointIndex);
+  if ((endpoint != NULL) && (endpoint->apiToken[0] != '\0'))
+    apiToken = endpoint->apiToken;
+  httpResponseCode = m_transport->request(url, method, (apiToken != NULL) ? ALGORAND_API_TOKEN_HEADER : NULL, apiToken,
+                                          ALGORAND_POST_MIME_TYPE, body, bodyLength, timeoutMs);
+  m_endpoints.report(endpointIndex, httpResponseCode, timed ? millis() - requestMillis : ALGOIOT_ENDPOINT_NO_LATENCY);
 
-      
   // httpResponseCode will be negative on error
   if (httpResponseCode < 0)
   {
     #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.print("HTTP GET failed, error: "); DEBUG_SERIAL.println(m_httpClient.errorToString(httpResponseCode).c_str());
+    DEBUG_SERIAL.printf("\nHTTP %s %s failed, error %d\n", method, path, httpResponseCode);
     #endif
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
+    // Connection in unknown state: next request opens a new one
+    m_transport->close();
   }
-  else
-  {
-    switch (httpResponseCode)
-    {
-      case 200:
-      {   // No error: let's get the response
-        String payload = m_httpClient.getString();
-        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
-                        
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("GetParams server response:");
-        DEBUG_SERIAL.println(payload);
-        #endif
-
-        DeserializationError error = deserializeJson(JSONResDoc, payload);                
-        if (error) 
-        {
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("GetParams: JSON response parsing failed!");
-          #endif
-          return ALGOIOT_INTERNAL_GENERIC_ERROR;
-        }
-        else
-        { // Fetch interesting fields
-          *minFee = JSONResDoc["min-fee"];
-          *round = JSONResDoc["last-round"];
-
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("Algorand transaction parameters received:");
-          DEBUG_SERIAL.print("min-fee = "); DEBUG_SERIAL.print(*minFee); DEBUG_SERIAL.println(" microAlgo");
-          DEBUG_SERIAL.print("last-round = "); DEBUG_SERIAL.println(*round);                  
-          #endif                  
-        }
-      }
-      break;
-      case 204:
-      {   // No error, but no data available from server
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("Server returned no data");
-        #endif
-        return ALGOIOT_NETWORK_ERROR;
-      }
-      break;
-      default:
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.print("Unmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
-        #endif
-        return ALGOIOT_INTERNAL_GENERIC_ERROR;
-      }
-      break;
-    }
-  }        
-  
-  m_httpClient.end();
 
   return httpResponseCode;
 }
 
 
-
-// To be called AFTER getAlgorandTxParams(), because we need current "min-fee" and "last-round" values from algod
-// Returns error code (0 = OK)
-int AlgoIoT::prepareTransactionMessagePack(msgPack msgPackTx,
-                                  const uint32_t lastRound, 
-                                  const uint16_t fee, 
-                                  const uint32_t paymentAmountMicroAlgos,
-                                  const char* notes,
-                                  const uint16_t notesLen)
-{ 
+// Same connection as the other requests (kept alive). A response timeout other than the default one applies to
+// this request only
+int AlgoIoT::httpGet(const char* path, AlgoIoTJsonScanner* scanner, const uint16_t timeoutMs, const uint8_t timed)
+{
+  int httpResponseCode = 0;
   int iErr = 0;
-  char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
-  uint32_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
-  const char type[] = "pay";
-  uint8_t nFields = ALGORAND_PAYMENT_TRANSACTION_MIN_FIELDS;
 
-  if (msgPackTx == NULL)
-    return ALGOIOT_NULL_POINTER_ERROR;
-  if (msgPackTx->msgBuffer == NULL)
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  if ((lastRound == 0) || (fee == 0) || (paymentAmountMicroAlgos < ALGORAND_MIN_PAYMENT_MICROALGOS))
-  {
-    return ALGOIOT_INTERNAL_GENERIC_ERROR;
-  }
-  
-  if ( (notes != NULL) && (notesLen > 0) )
-    nFields++;  // We have 9 fields without Note, 10 with Note
+  httpResponseCode = sendRequest(path, "GET", NULL, 0, timeoutMs, timed);
+  if (httpResponseCode < 0)
+    return httpResponseCode;
+  if (httpResponseCode == 200)
+    iErr = scanResponse(scanner, NULL);
+  if (iErr == ALGOIOT_NETWORK_ERROR)
+  { // Body cut short: as if no response, connection in unknown state
+    m_transport->close();
+    return ALGOIOT_HTTP_ERROR_CONNECTION_LOST;
+  }
+  m_transport->end();
+  if (iErr)
+    return iErr;
 
-  if (m_networkType == ALGORAND_TESTNET)
-  { // TestNet
-    strncpy(gen, ALGORAND_TESTNET_ID, ALGORAND_NETWORK_ID_CHARS);
-    // Decode Algorand network hash
-    iErr = decodeAlgorandNetHash(ALGORAND_TESTNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  else
-  { // MainNet
-    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
-    iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
-    if (iErr)
-    {
-      #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
-      #endif
-      return ALGOIOT_INTERNAL_GENERIC_ERROR;
-    }
-  }
-  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
+  return httpResponseCode;
+}
 
 
-  // We leave a blank space header so we can add:
-  // - "TX" prefix before signing
-  // - m_signature field and "txn" node field after signing
-  iErr = msgPackModifyCurrentPosition(msgPackTx, BLANK_MSGPACK_HEADER);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d from msgPackModifyCurrentPosition()\n\n");
-    #endif
+// Decimal digits of "value" at "dest", null-terminated
+static void formatRound(char* dest, uint64_t value)
+{
+  char digits[21];
+  uint8_t n = 0;
 
-    return 5;
+  do
+  {
+    digits[n++] = '0' + (char)(value % 10);
+    value /= 10;
+  } while (value > 0);
+  while (n > 0)
+  {
+    *dest++ = digits[--n];
   }
+  *dest = '\0';
+}
 
-  // Add root map
-  iErr = msgpackAddShortMap(msgPackTx, nFields); 
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding root map\n\n");
-    #endif
 
-    return 5;
-  }
+// Status JSON is long (about 700 bytes), and only "last-round" is needed: the rest is skipped as it streams in
+int AlgoIoT::getAlgorandRoundAfter(const uint64_t afterRound, uint64_t* round)
+{
+  char path[sizeof(GET_STATUS_AFTER_ROUND) + 20];
+  AlgoIoTJsonScanner scanner;
+  char roundText[ALGOIOT_JSON_NUMBER_CHARS + 1];
+  int httpCode = 0;
 
-  // Fields must follow alphabetical order
+  strcpy(path, GET_STATUS_AFTER_ROUND);
+  formatRound(path + strlen(path), afterRound);
 
-  // "amt" label
-  iErr = msgpackAddShortString(msgPackTx, "amt");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding amt label\n\n");
-    #endif
+  // Slow by design: no latency sample for the endpoint
+  scanner.watch("last-round", roundText, sizeof(roundText));
+  httpCode = httpGet(path, &scanner, HTTP_WAIT_BLOCK_TIMEOUT_MS, 0);
+  if (httpCode != 200)
+    return httpCode;
 
-    return 5;
-  }
-  // amt value
-  // Note: encoding depends on payment amount
-  if (paymentAmountMicroAlgos < 128)
-  {
-    iErr = msgpackAddUInt7(msgPackTx, (uint8_t)paymentAmountMicroAlgos);
-  }
-  else
-  {
-    if (paymentAmountMicroAlgos < 256)
-    {
-      iErr = msgpackAddUInt8(msgPackTx, (uint8_t)paymentAmountMicroAlgos);
-    }
-    else
-    {
-      if (paymentAmountMicroAlgos < 65536)
-      {
-        iErr = msgpackAddUInt16(msgPackTx, (uint16_t)paymentAmountMicroAlgos);
-      }
-      else    
-      {
-        iErr = msgpackAddUInt32(msgPackTx, paymentAmountMicroAlgos);
-      }
-    }
-  }
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding amt value\n\n");
-    #endif
+  if (!AlgoIoTJsonScanner::toUInt64(roundText, round) || (*round == 0))
+    return ALGOIOT_JSON_ERROR;
 
-    return 5;
-  }
+  return httpCode;
+}
 
-  // "fee" label
-  iErr = msgpackAddShortString(msgPackTx, "fee");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fee label\n\n");
-    #endif
 
-    return 5;
-  }
-  // fee value
-  iErr = msgpackAddUInt16(msgPackTx, fee);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fee value\n\n");
-    #endif
+// Pending transaction JSON holds the whole transaction, note included: only two top-level fields are read,
+// the transaction (nested) is skipped as it streams in
+int AlgoIoT::getPendingTransaction(const char* txID, uint64_t* confirmedRound, uint8_t* poolError)
+{
+  char path[sizeof(POST_TRANSACTION) + sizeof(GET_PENDING_TRANSACTION) + ALGORAND_TRANSACTIONID_SIZE];
+  AlgoIoTJsonScanner scanner;
+  char roundText[ALGOIOT_JSON_NUMBER_CHARS + 1];
+  char poolErrorText[2];  // Only whether it is empty matters
+  int httpCode = 0;
+
+  strcpy(path, POST_TRANSACTION GET_PENDING_TRANSACTION);
+  strcat(path, txID);
+
+  scanner.watch("confirmed-round", roundText, sizeof(roundText));
+  scanner.watch("pool-error", poolErrorText, sizeof(poolErrorText));
+  httpCode = httpGet(path, &scanner, HTTP_QUERY_TIMEOUT_S * 1000);
+  if (httpCode != 200)
+    return httpCode;
+
+  if (!AlgoIoTJsonScanner::toUInt64(roundText, confirmedRound))
+    *confirmedRound = 0;  // Absent while in the pool
+  *poolError = (poolErrorText[0] != '\0');
+
+  return httpCode;
+}
 
-    return 5;
-  }
 
-  // "fv" label
-  iErr = msgpackAddShortString(msgPackTx, "fv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fv label\n\n");
-    #endif
+// Retrieves current Algorand transaction parameters
+// Returns HTTP response code (200 = OK; negative if no response), or AlgoIoT error code if the response is unusable
+// The connection stays open for the submission that follows (keep-alive), unless the request failed
+int AlgoIoT::getAlgorandTxParams(uint64_t* round, uint64_t* minFee)
+{
+  int iResult = 0;
 
-    return 5;
-  }
-  // fv value
-  iErr = msgpackAddUInt32(msgPackTx, lastRound);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding fv value\n\n");
-    #endif
+  *round = 0;
+  *minFee = 0;
 
-    return 5;
-  }
+  // Best endpoint: an open connection to the same server is reused
+  int httpResponseCode = sendRequest(GET_TRANSACTION_PARAMS, "GET", NULL, 0, HTTP_QUERY_TIMEOUT_S * 1000UL);
 
-  // "gen" label
-  iErr = msgpackAddShortString(msgPackTx, "gen");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gen label\n\n");
-    #endif
+  // httpResponseCode will be negative on error (connection closed already)
+  if (httpResponseCode < 0)
+    return httpResponseCode;
 
-    return 5;
-  }
-  // gen string
-  iErr = msgpackAddShortString(msgPackTx, gen);
-  if (iErr)
+  iResult = httpResponseCode;
+  switch (httpResponseCode)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gen string\n\n");
-    #endif
+    case 200:
+    {   // No error: fields read from the response as it arrives
+      int iErr = parseTxParams(NULL, round, minFee);
 
-    return 5;
+      if (iErr == ALGOIOT_NETWORK_ERROR)
+        iResult = ALGOIOT_HTTP_ERROR_CONNECTION_LOST;  // Body cut short: as if no response, worth a retry
+      else if (iErr)
+        iResult = ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
+    break;
+    case 204:
+    {   // No error, but no data available from server
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.println("Server returned no data");
+      #endif
+      iResult = ALGOIOT_NETWORK_ERROR;
+    }
+    break;
+    default:
+    {   // Returned as it is: 5xx, for one, is worth a retry (see AlgoIoTRetryScheduler::classify())
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.print("Unmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
+      #endif
+    }
+    break;
   }
+  
+  // Every path that got a response ends here: unread response bytes are discarded, connection is kept
+  // (unless the body was cut short: connection in unknown state)
+  if (iResult < 0)
+    m_transport->close();
+  else
+    m_transport->end();
 
-  // "gh" label
-  iErr = msgpackAddShortString(msgPackTx, "gh");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gh label\n\n");
-    #endif
+  return iResult;
+}
 
-    return 5;
-  }
-  // gh value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding gh value\n\n");
-    #endif
 
-    return 5;
-  }
 
-  // "lv" label
-  iErr = msgpackAddShortString(msgPackTx, "lv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding lv label\n\n");
-    #endif
+// To be called AFTER getAlgorandTxParams(), because we need current "min-fee" and "last-round" values from algod
+// Called twice per transaction: first with a counting sink to get the exact size, then to actually write
+// Returns error code (0 = OK)
+template <class TSink>
+int AlgoIoT::prepareTransactionMessagePack(MpkWriter<TSink>& msgPackTx,
+                                  const uint64_t lastRound, 
+                                  const uint64_t fee, 
+                                  const uint64_t paymentAmountMicroAlgos,
+                                  const char* notes,
+                                  const uint16_t notesLen,
+                                  const uint8_t* group)
+{ 
+  int iErr = 0;
+  char gen[ALGORAND_NETWORK_ID_CHARS + 1] = "";
+  uint64_t lv = lastRound + ALGORAND_MAX_WAIT_ROUNDS;
+  const char type[] = "pay";
+  uint8_t nFields = ALGORAND_PAYMENT_TRANSACTION_MIN_FIELDS;
 
-    return 5;
-  }
-  // lv value
-  iErr = msgpackAddUInt32(msgPackTx, lv);
-  if (iErr)
+  if ((lastRound == 0) || (fee == 0) || (paymentAmountMicroAlgos < ALGORAND_MIN_PAYMENT_MICROALGOS))
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding lv value\n\n");
-    #endif
-
-    return 5;
+    return ALGOIOT_INTERNAL_GENERIC_ERROR;
   }
+  
+  if ( (notes != NULL) && (notesLen > 0) )
+    nFields++;  // We have 9 fields without Note, 10 with Note
+  if (group != NULL)
+    nFields++;  // One more in a group
 
-  if ((notes != NULL) && (notesLen > 0))
-  {
-    // Add "note" label
-    iErr = msgpackAddShortString(msgPackTx, "note");
+  if (m_networkType == ALGORAND_TESTNET)
+  { // TestNet
+    strncpy(gen, ALGORAND_TESTNET_ID, ALGORAND_NETWORK_ID_CHARS);
+    // Decode Algorand network hash (once per network: see setAlgorandNetwork())
+    if (!m_netHashValid)
+      iErr = decodeAlgorandNetHash(ALGORAND_TESTNET_HASH, m_netHash);
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding note label\n\n");
+      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
-
-      return 5;
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
-    // Add note content as binary buffer
-    // WARNING: if note len is < 256, we have to encode Bin 8 so msgpackAddShortByteArray
-    // Otherwise, m_signature does not pass verification
-    if (notesLen < 256)
-      iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)notes, (const uint8_t)notesLen);    
-    else
-      iErr = msgpackAddByteArray(msgPackTx, (const uint8_t*)notes, (const uint16_t)notesLen);
+  }
+  else
+  { // MainNet
+    strncpy(gen, ALGORAND_MAINNET_ID, ALGORAND_NETWORK_ID_CHARS);
+    if (!m_netHashValid)
+      iErr = decodeAlgorandNetHash(ALGORAND_MAINNET_HASH, m_netHash);
     if (iErr)
     {
       #ifdef LIB_DEBUGMODE
-      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding notes content\n\n");
+      DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d decoding Algorand network hash\n\n", iErr);
       #endif
-
-      return 5;
+      return ALGOIOT_INTERNAL_GENERIC_ERROR;
     }
   }
+  m_netHashValid = 1;
+  gen[ALGORAND_NETWORK_ID_CHARS] = '\0';
 
-  // "rcv" label
-  iErr = msgpackAddShortString(msgPackTx, "rcv");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding rcv label\n\n");
-    #endif
+  // From here on, straight-line unchecked stores: caller reserved room for the whole transaction,
+  // whose exact size comes from a dry run of this same function
 
-    return 5;
-  }
-  // rcv value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_receiverAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding rcv value\n\n");
-    #endif
+  // Add root map
+  msgPackTx.putShortMap(nFields);
 
-    return 5;
-  }
+  // Fields must follow alphabetical order
 
-  // "snd" label
-  iErr = msgpackAddShortString(msgPackTx, "snd");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding snd label\n\n");
-    #endif
+  // Integers always take the smallest encoding for their value, as canonical MessagePack requires
 
-    return 5;
-  }
-  // snd value (binary buffer)
-  iErr = msgpackAddShortByteArray(msgPackTx, (const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding snd value\n\n");
-    #endif
+  // "amt" label and value
+  msgPackTx.putShortString("amt", 3);
+  msgPackTx.putUInt(paymentAmountMicroAlgos);
 
-    return 5;
-  }
+  // "fee" label and value
+  msgPackTx.putShortString("fee", 3);
+  msgPackTx.putUInt(fee);
 
-  // "type" label
-  iErr = msgpackAddShortString(msgPackTx, "type");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding type label\n\n");
-    #endif
+  // "fv" label and value
+  msgPackTx.putShortString("fv", 2);
+  msgPackTx.putUInt(lastRound);
 
-    return 5;
-  }
-  // type string
-  iErr = msgpackAddShortString(msgPackTx, "pay");
-  if (iErr)
+  // "gen" label and string
+  msgPackTx.putShortString("gen", 3);
+  msgPackTx.putShortString(gen);
+
+  // "gh" label and value (binary buffer)
+  msgPackTx.putShortString("gh", 2);
+  msgPackTx.putShortByteArray((const uint8_t*)&(m_netHash[0]), (const uint8_t)ALGORAND_NET_HASH_BYTES);
+
+  if (group != NULL)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n prepareTransactionMessagePack(): ERROR %d adding type string\n\n");
-    #endif
+    // "grp" label and value (binary buffer): group ID, also covered by the signature
+    msgPackTx.putShortString("grp", 3);
+    msgPackTx.putShortByteArray(group, (const uint8_t)ALGORAND_TX_HASH_BYTES);
+  }
 
-    return 5;
+  // "lv" label and value
+  msgPackTx.putShortString("lv", 2);
+  msgPackTx.putUInt(lv);
+
+  if ((notes != NULL) && (notesLen > 0))
+  {
+    // Add "note" label
+    msgPackTx.putShortString("note", 4);
+    // Add note content as binary buffer, referenced in place (not copied) by sinks supporting it
+    // WARNING: if note len is < 256, it has to be encoded as Bin 8 (putBinaryRef() takes care of that)
+    // Otherwise, m_signature does not pass verification
+    msgPackTx.putBinaryRef((const uint8_t*)notes, notesLen);
   }
 
+  // "rcv" label and value (binary buffer)
+  msgPackTx.putShortString("rcv", 3);
+  msgPackTx.putShortByteArray((const uint8_t*)&(m_receiverAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
+
+  // "snd" label and value (binary buffer)
+  msgPackTx.putShortString("snd", 3);
+  msgPackTx.putShortByteArray((const uint8_t*)&(m_senderAddressBytes[0]), (const uint8_t)ALGORAND_ADDRESS_BYTES);  
+
+  // "type" label and string
+  msgPackTx.putShortString("type", 4);
+  msgPackTx.putShortString(type, 3);
+
   // End of messagepack
 
   return 0;
@@ -1047,43 +2389,39 @@ int AlgoIoT::prepareTransactionMessagePack(msgPack msgPackTx,
 
 
 
-// Obtains Ed25519 signature of passed MessagePack, adding "TX" prefix; fills "signature" return buffer
-// To be called AFTER convertToMessagePack()
+// Obtains Ed25519 signature of transaction MessagePack, adding "TX" prefix; fills "signature" return buffer
+// To be called AFTER prepareTransactionMessagePack(), which fed "TX" and the transaction to "nonceHash"
+// (started by AlgoEd25519::beginNonceHash()): only the challenge hash reads the segments again
+// Prefix is just one more segment in front of the transaction ones: nothing is copied
 // Returns error code (0 = OK)
 // Caller passes a 64-byte array in "signature", to be filled
-int AlgoIoT::signMessagePackAddingPrefix(msgPack msgPackTx, uint8_t signature[ALGORAND_SIG_BYTES])
+int AlgoIoT::signMessagePackAddingPrefix(AlgoEd25519Hash& nonceHash, const mpkSegment* txSegments, const uint8_t nSegments, uint8_t signature[ALGORAND_SIG_BYTES])
 {
-  uint8_t* payloadPointer = NULL;
-  uint32_t payloadBytes = 0;
+  mpkSegment prefixedTx[ALGORAND_TX_MAX_SEGMENTS + 1];
 
-  if (msgPackTx == NULL)
+  if (txSegments == NULL)
     return 1;
-  if (msgPackTx->msgBuffer == NULL)
+  if ((nSegments == 0) || (nSegments > ALGORAND_TX_MAX_SEGMENTS))
     return 2;
-  if (msgPackTx->currentMsgLen == 0)
-    return 2;
-
-  // We sign from prefix (included), leaving out the rest of the blank header
-  payloadPointer = msgPackTx->msgBuffer + BLANK_MSGPACK_HEADER - ALGORAND_TRANSACTION_PREFIX_BYTES;
-  payloadBytes = msgPackTx->currentMsgLen + ALGORAND_TRANSACTION_PREFIX_BYTES;
 
-  // Add prefix to messagepack; we purposedly left a blank header, with length BLANK_MSGPACK_HEADER
-  payloadPointer[0] = 'T';
-  payloadPointer[1] = 'X';
+  prefixedTx[0].data = (const uint8_t*)ALGORAND_TRANSACTION_PREFIX;
+  prefixedTx[0].len = ALGORAND_TRANSACTION_PREFIX_BYTES;
+  memcpy((void*)&(prefixedTx[1]), (const void*)txSegments, nSegments * sizeof(mpkSegment));
 
-  // Sign pack+prefix
-  Ed25519::sign(signature, m_privateKey, m_senderAddressBytes, payloadPointer, payloadBytes);
+  // Sign prefix+pack
+  // Sign with the key expanded in begin()
+  AlgoEd25519::signExpandedPrehashed(signature, nonceHash, m_signingKey, m_senderAddressBytes, prefixedTx, nSegments + 1);
 
   return 0;
 }
 
 
-// Add signature to MessagePack. We reserved a blank space header for this purpose
-// To be called AFTER signMessagePackAddingPrefix()
+// Writes the signed transaction header, which the transaction MessagePack has to follow
+// Its size does not depend on the signature value, so a dry run may be done before signing
 // Returns error code (0 = OK)
-int AlgoIoT::createSignedBinaryTransaction(msgPack mPack, const uint8_t signature[ALGORAND_SIG_BYTES])
+template <class TSink>
+int AlgoIoT::createSignedBinaryTransaction(MpkWriter<TSink>& mPack, const uint8_t signature[ALGORAND_SIG_BYTES])
 {
-  int iErr = 0;
   // When adding the m_signature "sig" field, the messagepack has to be changed into a 2-level structure,
   // with a "txn" node holding existing fields and a new "sig" field directly in root
   // The JSON equivalent would be something like:
@@ -1101,62 +2439,21 @@ int AlgoIoT::createSignedBinaryTransaction(msgPack mPack, const uint8_t signatur
   }
   */
 
-  // We reset internal msgpack pointer, since we now start from the beginning of the messagepack (filling the blank space)
-  iErr = msgPackModifyCurrentPosition(mPack, 0);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d resetting position\n\n");
-    #endif
-
-    return 5;
-  }
+  // Caller reserved room for the whole header (exact size from a dry run): unchecked stores
 
   // Add a Map holding 2 fields (sig and txn)
-  iErr = msgpackAddShortMap(mPack, 2);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding map\n\n");
-    #endif
-
-    return 5;
-  }
+  mPack.putShortMap(2);
   
   // Add "sig" label
-  iErr = msgpackAddShortString(mPack, "sig");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding sign label\n\n");
-    #endif
-
-    return 5;
-  }
+  mPack.putShortString("sig", 3);
 
   // Add m_signature, which is a 64-bytes byte array 
-  iErr = msgpackAddShortByteArray(mPack, signature, (const uint8_t)ALGORAND_SIG_BYTES);
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding m_signature\n\n");
-    #endif
-
-    return 5;
-  }
+  mPack.putShortByteArray(signature, (const uint8_t)ALGORAND_SIG_BYTES);
 
   // Add "txn" label
-  iErr = msgpackAddShortString(mPack, "txn");
-  if (iErr)
-  {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.printf("\n createSignedBinaryTransaction(): ERROR %d adding txn label\n\n");
-    #endif
-
-    return 5;
-  }
+  mPack.putShortString("txn", 3);
 
-  // The rest stays as it is
+  // Transaction MessagePack follows as the "txn" value
 
   return 0;
 }
@@ -1165,80 +2462,273 @@ int AlgoIoT::createSignedBinaryTransaction(msgPack mPack, const uint8_t signatur
 // Submits transaction messagepack to algod
 // Last method to be called, after all the others
 // Returns http response code (200 = OK) or AlgoIoT error code
-// TODO: On error codes 5xx (server error), maybe we should retry after 5s?
-int AlgoIoT::submitTransaction(msgPack msgPackTx)
+// Reuses the connection of getAlgorandTxParams(), and leaves it open for the next transaction
+int AlgoIoT::submitTransaction(const mpkSegment* signedTxSegments, const uint8_t nSegments)
+{
+  AlgoIoTSegmentStream signedTx(signedTxSegments, nSegments);
+
+  return submitTransaction(&signedTx, signedTx.length());
+}
+
+
+int AlgoIoT::submitTransaction(Stream* signedTx, const uint32_t length)
 {
-  String httpRequest = m_httpBaseURL + POST_TRANSACTION;
+  int iResult = 0;
           
-  // Configure server and url               
-  m_httpClient.begin(httpRequest);
-  
-  // Configure MIME type
-  m_httpClient.addHeader("Content-Type", ALGORAND_POST_MIME_TYPE);
+  // Best endpoint; signed transaction streamed into the request body (Content-Length = total, MIME type ALGORAND_POST_MIME_TYPE)
+  int httpResponseCode = sendRequest(POST_TRANSACTION, "POST", signedTx, length, HTTP_QUERY_TIMEOUT_S * 1000UL);
 
-  int httpResponseCode = m_httpClient.POST(msgPackTx->msgBuffer, msgPackTx->currentMsgLen);
-      
-  // httpResponseCode will be negative on error
+  // httpResponseCode will be negative on error (connection closed already)
   if (httpResponseCode < 0)
+    return httpResponseCode;
+
+  iResult = httpResponseCode;
+  switch (httpResponseCode)
   {
-    #ifdef LIB_DEBUGMODE
-    DEBUG_SERIAL.print("\n[HTTP] POST failed, error: "); DEBUG_SERIAL.println(m_httpClient.errorToString(httpResponseCode).c_str());
-    #endif
+    case 200:
+    {   // No error: transaction ID read from the response as it arrives
+      int iErr = parseTransactionID(NULL);
+
+      if (iErr == ALGOIOT_NETWORK_ERROR)
+        iResult = ALGOIOT_HTTP_ERROR_CONNECTION_LOST;  // Posted again: algod then tells it has it already
+      else if (iErr)
+        iResult = ALGOIOT_INTERNAL_GENERIC_ERROR;
+    }
+    break;
+    case 204:
+    {   // No error, but no data available from server
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.println("\nServer returned no data");
+      #endif
+      iResult = ALGOIOT_NETWORK_ERROR;
+    }
+    break;
+    case 400:
+    {   // Refused: malformed, or already there (a retry of a transaction accepted after all: that is success)
+      int iErr = parseDuplicateTransaction(NULL);
+
+      if (iErr == ALGOIOT_NO_ERROR)
+      {
+        iResult = 200;
+        break;
+      }
+      if (iErr == ALGOIOT_NETWORK_ERROR)
+      { // Body cut short: may have said it is there already. Posted again (not signed again) to know
+        iResult = ALGOIOT_HTTP_ERROR_CONNECTION_LOST;
+        break;
+      }
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.println("\nTransaction format error");
+      #endif
+      iResult = ALGOIOT_TRANSACTION_ERROR;
+    }
+    break;
+    default:
+    {   // Returned as it is: 5xx, for one, is worth a retry (see AlgoIoTRetryScheduler::classify())
+      #ifdef LIB_DEBUGMODE
+      DEBUG_SERIAL.print("\nUnmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
+      #endif
+    }
+    break;
   }
+  
+  // Every path that got a response ends here: unread response bytes are discarded, connection is kept
+  // (unless the body was cut short: connection in unknown state)
+  if (iResult < 0)
+    m_transport->close();
   else
+    m_transport->end();
+
+  return iResult;
+}
+
+
+// AlgoIoTSegmentStream
+
+AlgoIoTSegmentStream::AlgoIoTSegmentStream(const mpkSegment* segments, const uint8_t nSegments)
+{
+  m_segments = segments;
+  m_nSegments = (segments == NULL) ? 0 : nSegments;
+  m_segment = 0;
+  m_offset = 0;
+  m_remaining = 0;
+  for (uint8_t i = 0; i < m_nSegments; i++)
+  {
+    m_remaining += m_segments[i].len;
+  }
+}
+
+
+uint32_t AlgoIoTSegmentStream::length() const
+{
+  uint32_t len = 0;
+
+  for (uint8_t i = 0; i < m_nSegments; i++)
+  {
+    len += m_segments[i].len;
+  }
+
+  return len;
+}
+
+
+int AlgoIoTSegmentStream::available()
+{
+  return (int)m_remaining;
+}
+
+
+int AlgoIoTSegmentStream::peek()
+{
+  // Skip exhausted (or empty) segments
+  while ((m_segment < m_nSegments) && (m_offset >= m_segments[m_segment].len))
+  {
+    m_segment++;
+    m_offset = 0;
+  }
+  if (m_segment >= m_nSegments)
+    return -1;
+
+  return m_segments[m_segment].data[m_offset];
+}
+
+
+int AlgoIoTSegmentStream::read()
+{
+  int value = peek();
+
+  if (value >= 0)
+  {
+    m_offset++;
+    m_remaining--;
+  }
+
+  return value;
+}
+
+
+// Copies a whole run of each segment at once: the transport reads in chunks
+size_t AlgoIoTSegmentStream::readBytes(char* buffer, size_t len)
+{
+  size_t copied = 0;
+
+  while ((copied < len) && (peek() >= 0))
+  {
+    uint32_t chunk = m_segments[m_segment].len - m_offset;
+    if (chunk > len - copied)
+      chunk = len - copied;
+    memcpy((void*)&(buffer[copied]), (const void*)&(m_segments[m_segment].data[m_offset]), chunk);
+    m_offset += chunk;
+    m_remaining -= chunk;
+    copied += chunk;
+  }
+
+  return copied;
+}
+
+
+size_t AlgoIoTSegmentStream::write(uint8_t data)
+{
+  (void)data;
+
+  return 0;
+}
+
+
+///////////////////////////////
+// Group request body
+///////////////////////////////
+
+AlgoIoTGroupStream::AlgoIoTGroupStream(AlgoIoT& algoIoT, uint8_t* recordBuffer, const uint8_t count, const uint64_t fv, const uint64_t fee, const uint8_t groupID[ALGORAND_TX_HASH_BYTES], const uint32_t length)
+  : m_algoIoT(algoIoT), m_current(NULL, 0)
+{
+  m_record = recordBuffer;
+  m_count = count;
+  m_fv = fv;
+  m_fee = fee;
+  m_groupID = groupID;
+  m_length = length;
+}
+
+
+uint32_t AlgoIoTGroupStream::length() const
+{
+  return m_length;
+}
+
+
+uint8_t AlgoIoTGroupStream::failed() const
+{
+  return m_failed;
+}
+
+
+uint8_t AlgoIoTGroupStream::fill()
+{
+  while (!m_failed && (m_current.available() == 0) && (m_next < m_count))
   {
-    switch (httpResponseCode)
+    const uint8_t* note = NULL;
+    uint16_t noteLen = 0;
+
+    // Same record, parameters and group ID as measured: same bytes
+    if ((m_algoIoT.readQueuedNote(m_next, m_record, &note, &noteLen) != ALGOIOT_NO_ERROR) ||
+        (m_algoIoT.signPayment(m_fv, m_fee, (const char*)note, noteLen, m_groupID, &m_payment) != ALGOIOT_NO_ERROR))
     {
-      case 200:
-      {   // No error: let's get the response for debug purposes
-        String payload = m_httpClient.getString();
-        StaticJsonDocument<ALGORAND_MAX_RESPONSE_LEN> JSONResDoc;
-                        
-        DeserializationError error = deserializeJson(JSONResDoc, payload);                
-        if (error) 
-        {
-          #ifdef LIB_DEBUGMODE
-          DEBUG_SERIAL.println("JSON response parsing failed!");
-          #endif
-          return ALGOIOT_INTERNAL_GENERIC_ERROR;
-        }
-        else
-        { // Fetch interesting fields                  
-          strncpy(m_transactionID, JSONResDoc["txId"], 64);
-        }
-      }
-      break;
-      case 204:
-      {   // No error, but no data available from server
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("\nServer returned no data");
-        #endif
-        return ALGOIOT_NETWORK_ERROR;
-      }
-      break;
-      case 400:
-      {   // Malformed request
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.println("\nTransaction format error");
-        DEBUG_SERIAL.println("Server response:");
-        String payload = m_httpClient.getString();
-        DEBUG_SERIAL.println(payload);
-        #endif
-        return ALGOIOT_TRANSACTION_ERROR;
-      }
-      break;
-      default:
-      {
-        #ifdef LIB_DEBUGMODE
-        DEBUG_SERIAL.print("\nUnmanaged HTTP response code "); DEBUG_SERIAL.println(httpResponseCode);
-        #endif
-        return ALGOIOT_INTERNAL_GENERIC_ERROR;
-      }
+      m_failed = 1;
       break;
     }
-  }        
-  
-  m_httpClient.end();
+    m_current = AlgoIoTSegmentStream(m_payment.segments, m_payment.nSegments);
+    m_next++;
+  }
 
-  return httpResponseCode;
+  return (!m_failed && (m_current.available() > 0));
+}
+
+
+int AlgoIoTGroupStream::available()
+{
+  if (!fill())
+    return m_failed ? -1 : 0;
+
+  return m_current.available();
+}
+
+
+int AlgoIoTGroupStream::peek()
+{
+  if (!fill())
+    return -1;
+
+  return m_current.peek();
+}
+
+
+int AlgoIoTGroupStream::read()
+{
+  if (!fill())
+    return -1;
+
+  return m_current.read();
+}
+
+
+// Copies across member boundaries, signing the next member as needed
+size_t AlgoIoTGroupStream::readBytes(char* buffer, size_t len)
+{
+  size_t copied = 0;
+
+  while ((copied < len) && fill())
+  {
+    copied += m_current.readBytes(&(buffer[copied]), len - copied);
+  }
+
+  return copied;
+}
+
+
+size_t AlgoIoTGroupStream::write(uint8_t data)
+{
+  (void)data;
+
+  return 0;
 }
@@ -3,15 +3,11 @@
 
 // requires "minmpk" MessagePack library (included)
 // requires ArduinoJSON by Benoit Blanchon
-// requires Crypto library
-// requires HTTPClient (ESP32)
+// requires Crypto library (Arduino)
+// requires HTTPClient (ESP32); on a POSIX host (Linux), POSIX sockets instead, and OpenSSL for https (see algoiottransport.h)
 // requires Base64 by Densaugeo https://github.com/Densaugeo/base64_arduino
 
-// v20240415-1
-
-// TODO:
-// API endpoint URL setter (AlgoNode may have to be replaced at some point)
-// API token setter (AlgoNode does not require one for Testnet)
+// v20261018-3
 
 /* By Fernando Carello for GT50
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -31,33 +27,52 @@
 #ifndef __ALGOIOT_H
 #define __ALGOIOT_H
 
-#include <Arduino.h>
 #include <stdint.h>
-#include <HTTPClient.h>   // https://github.com/espressif/arduino-esp32/blob/master/libraries/HTTPClient/src/HTTPClient.h
+#include "algoiotplatform.h"  // Arduino core, or what AlgoIoT needs of it on a POSIX host
+#if defined(ARDUINO)
+  #include <WiFiClient.h>
+  #include <WiFiClientSecure.h>
+#endif
 #include <ArduinoJson.h>  // JSON needed for Algorand transactions. ArduinoJson because: https://arduinojson.org/news/2019/11/19/arduinojson-vs-arduino_json/
-#include "minmpk.h"
+#include "minmpkwriter.h"
+#include "algoed25519.h"
+#include "algoiotkeycache.h"
+#include "algoiotoutbox.h"
+#include "algoiothttp.h"
+#include "algoiottransport.h"
+#include "algoiotretry.h"
+#include "algoiotendpoints.h"
+#include "algoiotjson.h"
 // #include "algoiot_user_config.h"
 
-#define BLANK_MSGPACK_HEADER 75  // We leave this space at the head of the buffer, so we can add the m_signature later
 #define JSON_ENCODING_MARGIN 64
 #define ALGORAND_POST_MIME_TYPE "application/msgpack"
-#define ALGORAND_MAX_RESPONSE_LEN 320      // For Algorand transaction params. Max measured = 250, but ArduinoJSON apparently needs quite a margin (272 bytes proved too small)
-#define ALGORAND_MAX_TX_MSGPACK_SIZE 1280  // 1253 max measured for payment transaction   
+#define ALGORAND_MAX_MESSAGE_CHARS 191     // algod error "message" read from a refusal: longer ones are cut (see parseDuplicateTransaction())
+#define ALGORAND_TX_SCRATCH_SIZE 256      // Transaction MessagePack bytes, note excluded (referenced in place). Exact size is computed by a dry run (~210 bytes, 36 more in a group)
+#define ALGORAND_TX_MAX_SEGMENTS 4        // Transaction MessagePack segments: fields, note, fields
+#define ALGORAND_SIGNED_TX_HEADER_BYTES 75 // "sig" and "txn" map, preceding the transaction MessagePack
 #define ALGORAND_MAX_NOTES_SIZE 1000
+#define ALGORAND_SIGNED_TX_MAX_BYTES (ALGORAND_SIGNED_TX_HEADER_BYTES + ALGORAND_TX_SCRATCH_SIZE + ALGORAND_MAX_NOTES_SIZE)
 #define ALGORAND_TRANSACTION_PREFIX "TX"
 #define ALGORAND_TRANSACTION_PREFIX_BYTES 2
 #define ALGORAND_TRANSACTIONID_SIZE 64
+#define ALGORAND_TX_HASH_BYTES 32         // Transaction ID, group ID: SHA-512/256
+#define ALGORAND_GROUP_PREFIX "TG"
+#define ALGORAND_GROUP_PREFIX_BYTES 2
+#define ALGORAND_MAX_GROUP_TXNS 16        // algod accepts several signed transactions per POST only as one group, of at most 16
 #define ALGORAND_TESTNET 0
 #define ALGORAND_MAINNET 1
 #define ALGORAND_NETWORK_ID_CHARS 12
-#define ALGORAND_API_ENDPOINT_CHARS 128
-#define ALGORAND_API_TOKEN_CHARS 32
+#define ALGORAND_API_ENDPOINT_CHARS ALGOIOT_ENDPOINT_URL_CHARS
+#define ALGORAND_API_TOKEN_CHARS ALGOIOT_ENDPOINT_TOKEN_CHARS
+#define ALGORAND_API_TOKEN_HEADER "X-Algo-API-Token"
+#define ALGORAND_API_PATH_CHARS 96    // Longest request path: pending transaction, ID included
 #define ALGORAND_TESTNET_ID "testnet-v1.0"
 #define ALGORAND_TESTNET_HASH "SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI="
 #define ALGORAND_TESTNET_API_ENDPOINT "https://testnet-api.algonode.cloud"  // Algonode Testnet API
 #define ALGORAND_MAINNET_ID "mainnet-v1.0"
 #define ALGORAND_MAINNET_HASH "wGHE2Pwdvd7S12BL5FaOP20EGYesN73ktiC1qzkkit8="
-#define ALGORAND_MAINNET_API_ENDPOINT "https://mainnet-api.algonode.cloud"  // Algonode Testnet API
+#define ALGORAND_MAINNET_API_ENDPOINT "https://mainnet-api.algonode.cloud"  // Algonode Mainnet API
 #define ALGORAND_PAYMENT_TRANSACTION_MIN_FIELDS 9 // without "note", otherwise 10 (not counting "sig" which is separate from txn Map)
 #define ALGORAND_ADDRESS_BYTES 32
 #define ALGORAND_KEY_BYTES 32
@@ -70,16 +85,29 @@
 #define DAPP_NAME_MAX_LEN NOTE_LABEL_MAX_LEN
 #define GET_TRANSACTION_PARAMS "/v2/transactions/params"
 #define POST_TRANSACTION "/v2/transactions"
+#define GET_PENDING_TRANSACTION "/pending/"   // After POST_TRANSACTION, followed by the transaction ID
+#define GET_STATUS_AFTER_ROUND "/v2/status/wait-for-block-after/"  // Followed by a round: answers once a later round is there
 #define ALGORAND_MAX_WAIT_ROUNDS 1000
 #define ALGORAND_MIN_PAYMENT_MICROALGOS 1 
+#define ALGORAND_MIN_FEE_MICROALGOS 1000  // Used when signing offline before any "min-fee" was received
 #ifndef RECEIVER_ADDRESS
   #define RECEIVER_ADDRESS ""
 #endif  
 
 #define PAYMENT_AMOUNT_MICROALGOS 100000	// Please check vs. ALGORAND_MIN_PAYMENT_MICROALGOS in .ino
 
+#define ALGORAND_PARAMS_MAX_AGE_MS 60000UL  // Transaction parameters cache: default max age (see setTxParamsMaxAge())
+#define ALGORAND_ROUND_ESTIMATE_MS 4000UL   // Round time assumed by the cache; real rounds are shorter (about 2.8 s)
+#define ALGORAND_ROUND_FAST_MS 2000UL       // Round time assumed by retry deadlines: shorter than real ones, so that "lv" is not passed
+#define ALGORAND_DEADLINE_MARGIN_ROUNDS 10  // Retry deadline: rounds kept before "lv", as the current round may be estimated
+#define ALGORAND_DUPLICATE_TX_MESSAGE "transaction already in ledger: "  // algod response to a transaction posted twice
+
 #define HTTP_CONNECT_TIMEOUT_MS 5000UL
 #define HTTP_QUERY_TIMEOUT_S 5
+#define HTTP_WAIT_BLOCK_TIMEOUT_MS 15000  // Round long poll: a round takes about 2.8 s, algod answers after 1 min at most
+
+#define ALGOIOT_MAX_TRACKED_TXNS 16         // Transactions waiting for confirmation (see setConfirmationTracking())
+#define ALGOIOT_CONFIRMATION_MAX_MISSES 3   // Rounds a tracked transaction may be unknown to algod before being given up
 
 
 // Error codes
@@ -94,77 +122,420 @@
 #define ALGOIOT_SIGNATURE_ERROR 8
 #define ALGOIOT_TRANSACTION_ERROR 9
 #define ALGOIOT_DATA_STRUCTURE_TOO_LONG 10
+#define ALGOIOT_TRANSACTION_QUEUED 11   // Not a failure: algod unreachable, transaction signed and kept in the outbox
+#define ALGOIOT_OUTBOX_ERROR 12         // Outbox full, or storage error
+#define ALGOIOT_IN_PROGRESS 13          // Asynchronous submission not finished yet (see poll())
+#define ALGOIOT_BUSY 14                 // beginSubmit() while a submission is in progress
+
+// Submission modes (see signAndSubmitPayment())
+#define ALGOIOT_SUBMIT_POST 0
+#define ALGOIOT_SUBMIT_POST_OR_QUEUE 1
+#define ALGOIOT_SUBMIT_QUEUE 2
+
+// Asynchronous submission steps (see beginSubmit() and submitState())
+#define ALGOIOT_ASYNC_IDLE 0
+#define ALGOIOT_ASYNC_CONNECT 1   // Connecting to algod (parameters request, or post)
+#define ALGOIOT_ASYNC_PARAMS 2    // Transaction parameters requested, waiting for algod
+#define ALGOIOT_ASYNC_ENCODE 3    // MessagePack encoding (and nonce hash)
+#define ALGOIOT_ASYNC_SIGN 4
+#define ALGOIOT_ASYNC_POST 5      // Signed transaction posted, waiting for algod
+#define ALGOIOT_ASYNC_PARSE 6     // algod response
+#define ALGOIOT_ASYNC_BACKOFF 7   // Request failed with a retriable error: waiting to try again (see setRetryPolicy())
+
+// Called once per asynchronous submission, from poll(), with the final result
+typedef void (*AlgoIoTSubmitCallback)(const int result, void* context);
+
+// Confirmation states
+#define ALGOIOT_CONFIRMATION_PENDING 0
+#define ALGOIOT_CONFIRMATION_CONFIRMED 1  // In a block: "confirmedRound"
+#define ALGOIOT_CONFIRMATION_FAILED 2     // Evicted from the transaction pool by algod ("pool-error")
+#define ALGOIOT_CONFIRMATION_EXPIRED 3    // Last valid round passed, never seen confirmed
+#define ALGOIOT_CONFIRMATION_UNKNOWN 4    // algod does not know it (ALGOIOT_CONFIRMATION_MAX_MISSES rounds in a row)
+
+// A submitted transaction, tracked until confirmed (see setConfirmationTracking())
+typedef struct AlgoIoTConfirmation
+{
+  char txID[ALGORAND_TRANSACTIONID_SIZE + 1];
+  uint64_t lastValid;
+  uint64_t confirmedRound;  // 0 unless confirmed
+  uint32_t sampleMillis;    // millis() when its data were sampled (see setSampleTime())
+  uint32_t latencyMs;       // Sample to confirmation (seen by waitForConfirmations(), in the round after)
+  uint8_t misses;           // Consecutive rounds unknown to algod
+  uint8_t state;            // ALGOIOT_CONFIRMATION_*
+} AlgoIoTConfirmation;
+
+// Called once per tracked transaction, from waitForConfirmations(), when its state is final
+typedef void (*AlgoIoTConfirmationCallback)(const AlgoIoTConfirmation* confirmation, void* context);
+
+
+// Reads a list of segments as one Stream, so the transport can POST a message assembled by reference
+// (see MpkScatterSink) without flattening it into a buffer first. Segments are not owned
+class AlgoIoTSegmentStream : public Stream
+{
+  private:
+  const mpkSegment* m_segments;
+  uint8_t m_nSegments;
+  uint8_t m_segment;
+  uint32_t m_offset;
+  uint32_t m_remaining;
+
+  public:
+  AlgoIoTSegmentStream(const mpkSegment* segments, const uint8_t nSegments);
+
+  // Total bytes to be read
+  uint32_t length() const;
+
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+  virtual size_t readBytes(char* buffer, size_t len);
+  using Stream::readBytes;
+  virtual size_t write(uint8_t data);   // Read-only: always 0
+};
+
+
+// A signed payment transaction, assembled by reference (see MpkScatterSink): header segment first, then the
+// transaction segments (fields in "scratch", note referenced where it is). Valid as long as the note is
+// Filled in two steps: encoding (transaction segments, and nonce hash), then signing (header)
+typedef struct AlgoIoTSignedPayment
+{
+  uint8_t header[ALGORAND_SIGNED_TX_HEADER_BYTES];
+  uint8_t scratch[ALGORAND_TX_SCRATCH_SIZE];
+  mpkSegment segments[ALGORAND_TX_MAX_SEGMENTS + 1];
+  uint8_t nSegments;
+  uint32_t headerLen;         // Measured while encoding
+  AlgoEd25519Hash nonceHash;  // Fed "TX" and the transaction while encoding
+} AlgoIoTSignedPayment;
+
+
+class AlgoIoT;
+
+// Request body of a transaction group built from queued records (see AlgoIoT::flushOutbox()): each member is
+// read back from the outbox and signed while the transport reads the previous one, so a single signed transaction
+// is in memory at a time instead of the whole group
+class AlgoIoTGroupStream : public Stream
+{
+  private:
+  AlgoIoT& m_algoIoT;
+  uint8_t* m_record;          // Caller buffer, ALGORAND_SIGNED_TX_MAX_BYTES: record of the member being read
+  uint64_t m_fv;
+  uint64_t m_fee;
+  const uint8_t* m_groupID;
+  uint32_t m_length;
+  uint8_t m_count;
+  uint8_t m_next = 0;         // Next member to sign
+  uint8_t m_failed = 0;
+  AlgoIoTSignedPayment m_payment;
+  AlgoIoTSegmentStream m_current;
+
+  // Signs the next member once the current one is read. Returns 1 if bytes are available
+  uint8_t fill();
+
+  public:
+  // Members are the oldest "count" pending records; "length" is the total, as measured by the caller
+  AlgoIoTGroupStream(AlgoIoT& algoIoT, uint8_t* recordBuffer, const uint8_t count, const uint64_t fv, const uint64_t fee, const uint8_t groupID[ALGORAND_TX_HASH_BYTES], const uint32_t length);
+
+  // Total bytes to be read
+  uint32_t length() const;
+
+  // A member could not be read back or signed: the body is incomplete
+  uint8_t failed() const;
+
+  virtual int available();  // -1 once failed: the transport then stops sending
+  virtual int read();
+  virtual int peek();
+  virtual size_t readBytes(char* buffer, size_t len);
+  using Stream::readBytes;
+  virtual size_t write(uint8_t data);   // Read-only: always 0
+};
 
 
 // AlgoIoT class
 class AlgoIoT
 {
+  friend class AlgoIoTGroupStream;
+
   private:
   // Private vars
-  HTTPClient m_httpClient;
+  // Requests of the blocking API (see setTransport()): HTTPClient on Arduino, sockets on a POSIX host
+#if defined(ARDUINO)
+  AlgoIoTHttpClientTransport m_defaultTransport;
+#else
+  AlgoIoTSocketTransport m_defaultTransport;
+#endif
+  AlgoIoTTransport* m_transport = &m_defaultTransport;
   char m_appName[DAPP_NAME_MAX_LEN + 1] = "";
-  String m_httpBaseURL = ALGORAND_TESTNET_API_ENDPOINT;
-  char APItoken[ALGORAND_API_TOKEN_CHARS + 1] = "";
+  // algod servers (see addAlgodEndpoint()): by default, the AlgoNode one of the current network
+  AlgoIoTEndpointPool m_endpoints;
+  uint8_t m_customEndpoints = 0;   // Set by the sketch: kept on network change
   StaticJsonDocument <ALGORAND_MAX_NOTES_SIZE + JSON_ENCODING_MARGIN>m_noteJDoc;  // TO BE TESTED with complete 1000-bytes note field
   char m_transactionID[ALGORAND_TRANSACTIONID_SIZE + 1] = "";
   uint8_t m_networkType = ALGORAND_TESTNET;
-  uint8_t m_privateKey[ALGORAND_KEY_BYTES];
+  const char* m_mnemonics = NULL;  // Not copied: decoded by begin(), or fingerprinted to validate cached keys
+  uint8_t m_initialized = 0;       // begin() completed
+  int m_initError = ALGOIOT_NO_ERROR; // Constructor parameter error, returned by begin()
+  uint8_t m_receiverSet = 0;       // setDestinationAddress() called: begin() keeps that address
+  uint8_t m_signingKey[ED25519_EXPANDED_KEY_BYTES]; // Private key, expanded once by begin() (see AlgoEd25519::expandPrivateKey())
   uint8_t m_senderAddressBytes[ALGORAND_KEY_BYTES]; // = public key
-  uint8_t* m_pvtKey = NULL;
-  uint8_t* m_receiverAddressBytes = NULL;
-  uint8_t* m_netHash = NULL;
+  uint8_t m_receiverAddressBytes[ALGORAND_ADDRESS_BYTES];
+  uint8_t m_netHash[ALGORAND_NET_HASH_BYTES];
+  uint8_t m_netHashValid = 0; // m_netHash decoded for current m_networkType
   uint16_t m_noteOffset = 0;
   uint16_t m_noteLen = 0;
+  // Transaction parameters cache (see getTxParams())
+  uint64_t m_paramsRound = 0;      // "last-round" received from algod...
+  uint32_t m_paramsMillis = 0;     // ...at this time (millis())
+  uint64_t m_paramsMinFee = 0;
+  uint8_t m_paramsValid = 0;
+  uint32_t m_paramsMaxAgeMs = ALGORAND_PARAMS_MAX_AGE_MS;
+  AlgoIoTOutbox* m_outbox = NULL;  // Not owned; NULL = no outbox
+  // Oldest "m_resignCount" records, signed again with these parameters, posted without an answer (see flushOutbox())
+  uint64_t m_resignFv = 0;
+  uint64_t m_resignFee = 0;
+  uint8_t m_resignCount = 0;       // 0 = none
+  AlgoIoTRetryStats m_retryStats = {};
+  AlgoIoTRetryScheduler m_retry = AlgoIoTRetryScheduler(m_retryStats);  // Requests of the blocking API (see setRetryPolicy())
+  // Asynchronous submission (see beginSubmit()): its own connection, as the transport blocks
+#if defined(ARDUINO)
+  WiFiClient m_asyncPlainClient;
+  WiFiClientSecure m_asyncTlsClient;
+#else
+  AlgoIoTSocketClient m_asyncPlainClient = AlgoIoTSocketClient(0);
+  AlgoIoTSocketClient m_asyncTlsClient = AlgoIoTSocketClient(1);
+#endif
+  AlgoIoTHttpExchange m_asyncHttp;
+  char m_asyncURL[ALGORAND_API_ENDPOINT_CHARS + ALGORAND_API_PATH_CHARS + 1];  // Kept for the exchange (see AlgoIoTHttpExchange::begin())
+  uint8_t m_asyncEndpoint = ALGOIOT_ENDPOINT_NONE;
+  uint32_t m_asyncRequestMillis = 0;
+  uint8_t m_asyncState = ALGOIOT_ASYNC_IDLE;
+  uint8_t m_asyncRequested = 0;    // HTTP request of the current step started
+  uint8_t m_asyncMode = ALGOIOT_SUBMIT_POST;
+  uint8_t m_asyncEstimated = 0;    // Parameters from cache
+  uint8_t m_asyncRetried = 0;      // Rejected once with cached parameters
+  uint8_t m_asyncRetryState = ALGOIOT_ASYNC_IDLE;  // Step to go back to after ALGOIOT_ASYNC_BACKOFF
+  AlgoIoTRetryScheduler m_asyncRetry = AlgoIoTRetryScheduler(m_retryStats);
+  int m_asyncHttpCode = 0;
+  int m_asyncResult = ALGOIOT_NO_ERROR;
+  uint32_t m_asyncParamsMillis = 0;
+  uint64_t m_asyncFv = 0;
+  uint64_t m_asyncFee = 0;
+  char m_asyncNote[ALGORAND_MAX_NOTES_SIZE + 1];
+  uint16_t m_asyncNoteLen = 0;
+  AlgoIoTSignedPayment m_asyncPayment;
+  AlgoIoTSegmentStream m_asyncBody = AlgoIoTSegmentStream(NULL, 0);
+  AlgoIoTSubmitCallback m_asyncCallback = NULL;
+  void* m_asyncContext = NULL;
+  uint32_t m_asyncSampleMillis = 0;
+  // Confirmation tracking (see setConfirmationTracking())
+  uint32_t m_sampleMillis = 0;     // setSampleTime()...
+  uint8_t m_sampleSet = 0;         // ...for the next transaction
+  AlgoIoTConfirmationCallback m_confirmationCallback = NULL;  // NULL = not tracking
+  void* m_confirmationContext = NULL;
+  AlgoIoTConfirmation m_tracked[ALGOIOT_MAX_TRACKED_TXNS];
+  uint8_t m_trackedCount = 0;
+  uint64_t m_statusRound = 0;      // Last round seen by waitForConfirmations()
   
   // Decodes Base32 Algorand address to 32-byte binary address suitable for our functions
-  // outBinaryAddress allocated internally, has to be freed by caller
+  // Checksum verified; outBinaryAddress (caller buffer) written only if address is valid
   // Returns error code (0 = OK)
-  int decodeAlgorandAddress(const char* addressB32, uint8_t*& outBinaryAddress);
+  int decodeAlgorandAddress(const char* addressB32, uint8_t outBinaryAddress[ALGORAND_ADDRESS_BYTES]);
 
 
   // Decodes Base64 Algorand network hash to 32-byte binary buffer suitable for our functions
-  // outBinaryHash allocated internally, has to be freed by caller
+  // outBinaryHash passed by caller
   // Returns error code (0 = OK)
-  int decodeAlgorandNetHash(const char* hashB64, uint8_t*& outBinaryHash);
+  int decodeAlgorandNetHash(const char* hashB64, uint8_t outBinaryHash[ALGORAND_NET_HASH_BYTES]);
 
 
   // Accepts a C string containing space-delimited mnemonic words (25 words)
-  // outm_privateKey allocated internally, has to be freed by caller
-  // Returns error code (0 = OK)
+  // Parsed in place, without heap allocation; words are looked up in constant time (binary search on sorted list)
+  // The 25th word is checked against the key (SHA512/256 checksum), so a mistyped valid word is refused
+  // Returns error code (0 = OK, 7 = checksum mismatch)
   int decodePrivateKeyFromMnemonics(const char* mnemonicWords, uint8_t out_privateKey[ALGORAND_KEY_BYTES]);
 
 
+  // Writes the ARC-2 note ("<app-name>:j" and the JSON data fields) into "notes" (ALGORAND_MAX_NOTES_SIZE + 1 chars)
+  // Returns error code (0 = OK)
+  int buildNote(char* notes, uint16_t* notesLen);
+
   // 1. Retrieves current Algorand transaction parameters
   // Returns HTTP response code (200 = OK)
-  int getAlgorandTxParams(uint32_t* round, uint16_t* minFee);
+  int getAlgorandTxParams(uint64_t* round, uint64_t* minFee);
+
+  // Response body "response" (NULL: the transport's, read from the connection as it arrives) written to "scanner"
+  // Returns error code (0 = OK; ALGOIOT_NETWORK_ERROR: body cut short; ALGOIOT_JSON_ERROR: not a whole JSON object)
+  int scanResponse(AlgoIoTJsonScanner* scanner, const char* response);
+
+  // Reads "last-round" and "min-fee" from a transaction parameters response ("response" as for scanResponse())
+  // Returns error code (0 = OK)
+  int parseTxParams(const char* response, uint64_t* round, uint64_t* minFee);
+
+  // Reads "txId" from a transaction submission response into m_transactionID ("response" as for scanResponse())
+  // Returns error code (0 = OK)
+  int parseTransactionID(const char* response);
+
+  // Reads the transaction ID from a "transaction already in ledger" refusal into m_transactionID ("response" as for
+  // scanResponse()). Returns error code (0 = OK: the transaction posted was already accepted; ALGOIOT_NETWORK_ERROR
+  // if the body was cut short, so that it is not known)
+  int parseDuplicateTransaction(const char* response);
+
+  // Deadline for retrying the submission of a transaction valid up to round "lastValid", "round" being the
+  // current one (maybe estimated). Returns milliseconds (at least 1: no retries once too close to "lv")
+  uint32_t validityMs(const uint64_t round, const uint64_t lastValid);
+
+  // Transaction parameters from cache, round estimated from elapsed time. Returns 1 if the cache is recent enough
+  uint8_t cachedTxParams(uint64_t* round, uint64_t* minFee);
+
+  // Caches parameters received for a request sent at "requestMillis"
+  void storeTxParams(const uint64_t round, const uint64_t minFee, const uint32_t requestMillis);
+
+  // Transaction parameters from cache (round estimated from elapsed time), or from getAlgorandTxParams()
+  // "estimated" set to 1 if values come from cache
+  // Returns error code (0 = OK)
+  int getTxParams(uint64_t* round, uint64_t* minFee, uint8_t* estimated);
 
-  // msgPack passed by caller (not allocated internally):
+  // Parameters to sign with while algod cannot be reached (outbox): last ones received, round extrapolated
+  void estimateOfflineTxParams(uint64_t* round, uint64_t* minFee);
+
+  // Steps 2 to 6 below for one set of parameters: encodes, signs and posts the payment transaction
+  // "submitMode": ALGOIOT_SUBMIT_POST, ALGOIOT_SUBMIT_POST_OR_QUEUE or ALGOIOT_SUBMIT_QUEUE (outbox)
+  // "rejected" set to 1 if algod refused the transaction (HTTP 400)
+  // Returns error code (0 = OK, ALGOIOT_TRANSACTION_QUEUED if kept in the outbox)
+  int signAndSubmitPayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, uint8_t* rejected, const uint8_t submitMode);
+
+  // Steps 2 to 5: encodes and signs a payment transaction, member of group "group" unless NULL
+  // Returns error code (0 = OK)
+  int signPayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, const uint8_t* group, AlgoIoTSignedPayment* payment);
+
+  // signPayment() in two steps. Steps 2 and 3: transaction segments and nonce hash
+  // Returns error code (0 = OK)
+  int encodePayment(const uint64_t fv, const uint64_t fee, const char* notes, const uint16_t notesLen, const uint8_t* group, AlgoIoTSignedPayment* payment);
+
+  // Steps 4 and 5: signature, and header. Returns error code (0 = OK)
+  int signEncodedPayment(AlgoIoTSignedPayment* payment);
+
+  // Sample time of the transaction being submitted now: setSampleTime() value, if any, or now
+  uint32_t takeSampleMillis();
+
+  // Adds a transaction just accepted by algod (m_transactionID) to the tracked ones, if tracking
+  void trackTransaction(const uint64_t lastValid, const uint32_t sampleMillis);
+
+  // Best endpoint for the next request (see AlgoIoTEndpointPool::select()): its URL followed by "path" written to
+  // "url" (ALGORAND_API_ENDPOINT_CHARS + ALGORAND_API_PATH_CHARS + 1 chars). Returns its index
+  uint8_t selectEndpoint(char* url, const char* path);
+
+  // Sends a blocking request to the best endpoint, on the transport (API token added), and waits for the response
+  // status; its body is then read by scanResponse(), and the transport ended (or closed, after an error)
+  // "body": "bodyLength" bytes of ALGORAND_POST_MIME_TYPE, NULL if none; "timeoutMs": for the response
+  // Outcome reported to the endpoint pool. "timed": response time is a latency sample (not for long polls)
+  // Returns HTTP response code, or negative error code if no response (connection then closed)
+  int sendRequest(const char* path, const char* method, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs, const uint8_t timed = 1);
+
+  // GET "path" from the best endpoint, response body (if 200) written to "scanner", fields watched already
+  // Returns HTTP response code (200 = OK; negative if no response, or body cut short), or AlgoIoT error code if the
+  // body is not JSON. "timeoutMs": for the response; "timed" as for endRequest()
+  int httpGet(const char* path, AlgoIoTJsonScanner* scanner, const uint16_t timeoutMs, const uint8_t timed = 1);
+
+  // Waits for a round after "afterRound" (long poll), returned in "round"
+  // Returns HTTP response code (200 = OK), or AlgoIoT error code if the response is unusable
+  int getAlgorandRoundAfter(const uint64_t afterRound, uint64_t* round);
+
+  // Pending status of transaction "txID": "confirmedRound" (0 if not yet), "poolError" (1 if evicted)
+  // Returns HTTP response code (200 = OK, 404 = unknown), or AlgoIoT error code if the response is unusable
+  int getPendingTransaction(const char* txID, uint64_t* confirmedRound, uint8_t* poolError);
+
+  // Client for the asynchronous submission to "url" (TLS or not)
+  Client* asyncClient(const char* url);
+
+  // Starts a request of the asynchronous submission to the best endpoint (URL in m_asyncURL, API token set)
+  // Returns error code (0 = OK; negative, as AlgoIoTHttpExchange::begin())
+  int beginAsyncRequest(const char* path, const char* method, const char* contentType, Stream* body, const uint32_t bodyLength);
+
+  // Outcome of the asynchronous request, reported to the endpoint pool
+  void endAsyncRequest(const int httpCode);
+
+  // Ends the asynchronous submission with "result": callback called. Returns "result"
+  int finishSubmit(const int result);
+
+  // Appends a signed transaction (as submitted) to the outbox
+  // Returns error code (ALGOIOT_TRANSACTION_QUEUED = OK)
+  int queueSignedTransaction(const mpkSegment* signedTxSegments, const uint8_t nSegments, const uint64_t lastValid);
+
+  // Signs the note of a queued (expired) signed transaction again, with parameters "fv" and "fee", and posts it
+  // Returns error code (0 = OK)
+  int resubmitQueuedNote(const uint8_t* signedTx, const uint32_t signedTxLen, const uint64_t fv, const uint64_t fee, uint8_t* rejected);
+
+  // Reads the queued record "index" (0 = oldest) into "signedTx" (ALGORAND_SIGNED_TX_MAX_BYTES) and finds its note
+  // Returns error code (0 = OK, ALGOIOT_TRANSACTION_ERROR if the record is not a signed transaction)
+  int readQueuedNote(const uint32_t index, uint8_t* signedTx, const uint8_t** note, uint16_t* noteLen);
+
+  // ID (binary) of a queued note signed again with "fv", "fee" and "group" (NULL if none), without signing it
+  // Returns error code (0 = OK)
+  int resignedTransactionID(const uint8_t* note, const uint16_t noteLen, const uint64_t fv, const uint64_t fee, const uint8_t* group, uint8_t txID[ALGORAND_TX_HASH_BYTES]);
+
+  // Group ID of the "count" oldest queued notes signed again with "fv" and "fee", and length of the group
+  // "signedTx": caller buffer, ALGORAND_SIGNED_TX_MAX_BYTES
+  // Returns error code (0 = OK, ALGOIOT_TRANSACTION_ERROR if a record is not a signed transaction)
+  int queuedGroupID(uint8_t* signedTx, const uint8_t count, const uint64_t fv, const uint64_t fee, uint8_t groupID[ALGORAND_TX_HASH_BYTES], uint32_t* bodyLen);
+
+  // Signs the "count" oldest queued notes again, with "fv" and "fee", as one group (up to ALGORAND_MAX_GROUP_TXNS)
+  // and posts the group in a single request. Records are not popped
+  // "signedTx": caller buffer, ALGORAND_SIGNED_TX_MAX_BYTES
+  // "rejected" set to 1 if algod refused the group, or a record cannot be grouped: to be sent one at a time
+  // Returns error code (0 = OK)
+  int submitQueuedGroup(uint8_t* signedTx, const uint8_t count, const uint64_t fv, const uint64_t fee, uint8_t* rejected);
+
+  // Number of expired records (last valid round not after "round") at the head of the outbox, up to
+  // ALGORAND_MAX_GROUP_TXNS. "signedTx": caller buffer, ALGORAND_SIGNED_TX_MAX_BYTES
+  uint8_t expiredQueued(uint8_t* signedTx, const uint64_t round);
+
+  // Whether the oldest record ("signedTx", expired) is confirmed already, as last posted (see flushOutbox())
+  // "signedTx" is overwritten. Returns error code (0 = OK: "settled" set)
+  int queuedSettled(uint8_t* signedTx, const uint32_t signedTxLen, const uint64_t round, uint8_t* settled);
+
+  // Pops the "count" oldest records. Returns error code (0 = OK)
+  int popQueued(uint8_t* signedTx, const uint8_t count);
+
+  // MessagePack writer passed by caller (not allocated internally)
+  // Writers are templated on their sink (see minmpkwriter.h): a counting sink measures, a buffer sink writes
 
   // 2. Fills Algorand transaction MessagePack
+  // Unchecked stores: caller reserves room for the whole transaction first (see MpkWriter::reserve())
   // Returns error code (0 = OK)
   // "notes" max 1000 bytes
-  int prepareTransactionMessagePack(msgPack msgPackTx,
-                                  const uint32_t lastRound, 
-                                  const uint16_t fee, 
-                                  const uint32_t paymentAmountMicroAlgos,
+  // "group": group ID (ALGORAND_TX_HASH_BYTES), or NULL if the transaction is not part of a group
+  template <class TSink>
+  int prepareTransactionMessagePack(MpkWriter<TSink>& msgPackTx,
+                                  const uint64_t lastRound, 
+                                  const uint64_t fee, 
+                                  const uint64_t paymentAmountMicroAlgos,
                                   const char* notes,
-                                  const uint16_t notesLen);
+                                  const uint16_t notesLen,
+                                  const uint8_t* group = NULL);
 
   // 4. Gets Ed25519 m_signature of binary pack (to which it internally prepends "TX" prefix)
+  // Transaction MessagePack is passed as segments (max ALGORAND_TX_MAX_SEGMENTS), as built by a MpkScatterSink
+  // "nonceHash" was started by AlgoEd25519::beginNonceHash() and fed "TX" and the MessagePack while encoding
   // Caller passes a 64-bytes buffer in "signature"
   // Returns error code (0 = OK)
-  int signMessagePackAddingPrefix(msgPack msgPackTx, uint8_t signature[ALGORAND_SIG_BYTES]);
+  int signMessagePackAddingPrefix(AlgoEd25519Hash& nonceHash, const mpkSegment* txSegments, const uint8_t nSegments, uint8_t signature[ALGORAND_SIG_BYTES]);
 
 
-  // 5. Adds signature to transaction and modifies messagepack accordingly
+  // 5. Writes signed transaction header ("sig" and "txn" map), to be followed by the transaction MessagePack
+  // Unchecked stores: caller reserves room for the whole header first
   // Returns error code (0 = OK)
-  int createSignedBinaryTransaction(msgPack msgPackTx, const uint8_t signature[ALGORAND_SIG_BYTES]);
+  template <class TSink>
+  int createSignedBinaryTransaction(MpkWriter<TSink>& msgPackTx, const uint8_t signature[ALGORAND_SIG_BYTES]);
 
 
-  // 6. Submits transaction to algod
+  // 6. Submits signed transaction to algod
+  // Signed transaction is passed as segments (header, then transaction), streamed in order into a single POST
   // Last method to be called, after all the others
   // Returns HTTP response code (200 = OK)
-  int submitTransaction(msgPack msgPackTx); 
+  int submitTransaction(const mpkSegment* signedTxSegments, const uint8_t nSegments); 
+
+  // As above, for a request body of "length" bytes read from "signedTx" (e.g. several signed transactions of a group)
+  int submitTransaction(Stream* signedTx, const uint32_t length);
 
 
   public:
@@ -176,8 +547,17 @@ class AlgoIoT
   // Constructor
   // "appName" not null and 31 chars max
   // "algoAccountWords" is a string containing the 25 words which encode the Algorand account private key in BIP-39
+  // "algoAccountWords" is not copied: it has to stay valid (e.g. a literal) at least until begin()
+  // Only stores parameters (cheap at static initialization time): see begin()
   AlgoIoT(const char* appName, const char* algoAccountWords);
 
+  // Derives the account keys from the mnemonic words. Call from setup()
+  // If not called, submitTransactionToAlgorand() calls it (without key cache) the first time
+  // "keyCache" (optional) keeps derived keys across boots, e.g. AlgoIoTNvsKeyCache on the ESP32 or
+  // AlgoIoTFileKeyCache on Linux: on later boots keys are read back instead of derived (see algoiotkeycache.h)
+  // Return: error code (0 = OK)
+  int begin(AlgoIoTKeyCache* keyCache = NULL);
+
   // By default, destination address = this device address (transaction to self). This saves transaction fee
   // User may need a different destination address (Smart Contract, collector address, ...)
   // "algorandAddress" not null and precisely 58 chars long
@@ -191,6 +571,68 @@ class AlgoIoT
   // Return: error code (0 = OK)
   int setAlgorandNetwork(const uint8_t networkType);
 
+  // algod servers the requests go to. By default, the AlgoNode one of the network set (see setAlgorandNetwork());
+  // the first endpoint added replaces it, and endpoints added are kept on network change: all of them have to be
+  // on the network set. Up to ALGOIOT_MAX_ENDPOINTS
+  // "url": "https://host[:port]" or "http://host[:port]"; "apiToken": sent as X-Algo-API-Token, NULL if none
+  // (AlgoNode needs none). Both copied
+  // Each request goes to the endpoint expected to answer first (average latency, weighed by its error rate); one
+  // failing is set aside for a while and the request is sent again at once to the next best (see algoiotendpoints.h)
+  // Return: error code (0 = OK)
+  int addAlgodEndpoint(const char* url, const char* apiToken = NULL);
+
+  // Back to the default endpoint
+  void clearAlgodEndpoints();
+
+  // Endpoints in use, and statistics of endpoint "index" (in the order added)
+  uint8_t algodEndpointCount();
+  // Return: error code (0 = OK)
+  int getAlgodEndpointStats(const uint8_t index, AlgoIoTEndpointStats* stats);
+
+  // The connection to the algod server is kept open (HTTP keep-alive) and reused by the parameters request
+  // and the submission, and by the following transactions: one TCP/TLS handshake instead of two per transaction
+  // It is dropped, and opened again on next request, after any network error or on network change
+  // Call this before switching WiFi off or entering deep sleep, so the server sees a clean close
+  // Also closes the connection of the asynchronous submission: one in progress then fails (or is queued)
+  void closeConnection();
+
+  // Transport of the blocking API requests (see algoiottransport.h), not owned: e.g. AlgoIoTClientTransport over
+  // other Clients, or a test double. NULL = default one: HTTPClient on Arduino, AlgoIoTSocketTransport on a POSIX
+  // host. The open connection, if any, is closed first
+  void setTransport(AlgoIoTTransport* transport);
+
+  // Transaction parameters (current round, minimum fee) are cached: while younger than "maxAgeMs",
+  // the round is estimated from elapsed time and algod is not asked, saving one round trip per transaction
+  // The cache is also dropped when a transaction is rejected (after one retry with fresh parameters)
+  // Default ALGORAND_PARAMS_MAX_AGE_MS; 0 = no cache, parameters requested for every transaction
+  void setTxParamsMaxAge(const uint32_t maxAgeMs);
+
+  // Next transaction requests fresh parameters
+  void invalidateTxParams();
+
+  // Optional outbox (see algoiotoutbox.h): when algod cannot be reached, submitTransactionToAlgorand() signs the
+  // transaction anyway, keeps it in non-volatile storage and returns ALGOIOT_TRANSACTION_QUEUED
+  // Queued transactions are submitted first, in order, by the next submitTransactionToAlgorand() or by
+  // flushOutbox(); those expired meanwhile (past their last valid round) are signed again with fresh rounds
+  // Outbox is not owned, and is opened here. NULL = no outbox (default)
+  // Return: error code (0 = OK)
+  int setOutbox(AlgoIoTOutbox* outbox);
+
+  // Submits queued transactions, oldest first, until the outbox is empty or a network error occurs
+  // Still valid ones are posted as they were signed, one request each: should algod have one already (an earlier
+  // post got no answer), it says so, and the same reading is not written twice. They are not grouped, as that
+  // would mean signing them again under a new ID, and algod could then accept both copies
+  // Grouping applies only to expired ones, which have to be signed again anyway: as groups of up to
+  // ALGORAND_MAX_GROUP_TXNS, each posted in a single request on the kept-alive connection, so an expired backlog
+  // of hundreds drains in tens of round trips. A group is accepted or refused as a whole: if refused, its
+  // transactions are sent one at a time. Before an expired transaction is signed again, algod is asked whether it
+  // got it after all. Signed again, it keeps the parameters used until it is accepted (in RAM: not across a reset)
+  // Return: error code (0 = OK: outbox empty)
+  int flushOutbox();
+
+  // Transactions waiting in the outbox
+  uint32_t outboxPending();
+
   // Returns the ID of the transaction submitted to the Algorand blockchain (if successfully submitted), or an empty string
   const char* getTransactionID();
 
@@ -224,8 +666,65 @@ class AlgoIoT
   int dataAddShortStringField(const char* label, char* shortCString);
 
   // Submit transaction to Algorand network
-  // Return: error code (0 = OK)
+  // Return: error code (0 = OK; with an outbox, ALGOIOT_TRANSACTION_QUEUED if algod could not be reached)
   int submitTransactionToAlgorand();
+
+  // Asynchronous submitTransactionToAlgorand(): runs in short steps, advanced by poll(), so that loop() keeps
+  // sampling while algod answers. Steps: connect, parameters (skipped while cached), encode, sign, post, parse
+  // Each poll() does one of them, or reads what algod sent so far; only connecting blocks (TCP and TLS handshake,
+  // bounded by the connect timeout), and the connection is kept open for the next submission (see algoiothttp.h)
+  // The note is taken as it is now: data fields may be set for the next transaction right after this call
+  // With an outbox: as submitTransactionToAlgorand(), but queued transactions are not submitted here (see
+  // flushOutbox(), which blocks): while any is queued, the new one is queued behind it
+  // "callback" (optional) is called once, from poll(), with the final result
+  // Return: error code (0 = started, ALGOIOT_BUSY if a submission is in progress)
+  int beginSubmit(AlgoIoTSubmitCallback callback = NULL, void* context = NULL);
+
+  // Advances the asynchronous submission by one step. Call often, e.g. on every loop()
+  // Return: ALGOIOT_IN_PROGRESS, then the final result once (as submitTransactionToAlgorand()); 0 while idle
+  int poll();
+
+  // Current step of the asynchronous submission: ALGOIOT_ASYNC_* (ALGOIOT_ASYNC_IDLE when finished)
+  uint8_t submitState();
+
+  // Result of the last asynchronous submission (ALGOIOT_IN_PROGRESS while running)
+  int submitResult();
+
+  // Requests to algod failing with a retriable error (no response, 408, 429, 5xx) are attempted again, up to
+  // "maxAttempts" in total, after delays doubling from "baseDelayMs" up to "maxDelayMs", with jitter; no attempt
+  // is started later than "budgetMs" after the first one, nor, for a submission, too close to the transaction
+  // last valid round. Fatal errors (e.g. transaction refused) are not retried (see algoiotretry.h)
+  // The blocking API waits between attempts; the asynchronous one waits in ALGOIOT_ASYNC_BACKOFF
+  // A submission still failing is then queued if it was not sent at all and there is an outbox, otherwise
+  // ALGOIOT_NETWORK_ERROR is returned: the next transaction may succeed, the sketch can carry on
+  // Defaults: ALGOIOT_RETRY_MAX_ATTEMPTS, ALGOIOT_RETRY_BASE_DELAY_MS, ALGOIOT_RETRY_MAX_DELAY_MS, ALGOIOT_RETRY_BUDGET_MS
+  // "maxAttempts" = 1: no retries
+  void setRetryPolicy(const uint8_t maxAttempts, const uint32_t baseDelayMs, const uint32_t maxDelayMs, const uint32_t budgetMs);
+
+  // Attempts and latency of the requests to algod, blocking and asynchronous, since start or last reset
+  void getRetryStats(AlgoIoTRetryStats* stats);
+  void resetRetryStats();
+
+  // Confirmation tracking: algod accepting a transaction (submitTransactionToAlgorand() returning 0) only means
+  // it is in the transaction pool. When tracking, each transaction accepted is kept (up to ALGOIOT_MAX_TRACKED_TXNS,
+  // later ones are not tracked) until waitForConfirmations() sees it in a block, evicted, or expired; "callback"
+  // is then called with its confirmed round and sample-to-confirmation latency
+  // Transactions queued in the outbox are not tracked. NULL = no tracking (default); tracked ones are forgotten
+  void setConfirmationTracking(AlgoIoTConfirmationCallback callback, void* context = NULL);
+
+  // millis() when the data of the next transaction were sampled, for its confirmation latency
+  // By default, the time it is submitted (submitTransactionToAlgorand() or beginSubmit() called)
+  void setSampleTime(const uint32_t sampleMillis);
+
+  // Blocks until algod has a new round (one long poll, answered as the block is there: about 2.8 s), then
+  // checks all tracked transactions at once, one short request each on the kept-alive connection
+  // Nothing is asked while no transaction is tracked. Each call waits for the round after the last one seen:
+  // calling it in a loop wakes the device exactly once per round
+  // Return: error code (0 = OK)
+  int waitForConfirmations();
+
+  // Tracked transactions not confirmed yet
+  uint8_t confirmationsPending();
 };
 
 #endif
@@ -0,0 +1,95 @@
+/**
+ *  AlgoIoT benchmark for ESP32
+ *
+ *  Measures the cost of the signing steps used by "AlgoIoT", Algorand lightweight library for ESP32
+ *  No WiFi and no Algorand account needed: a fixed test key and a transaction-sized message are used
+ *  Results (CPU cycles, signatures per second) are printed on Serial Monitor
+ *  For Linux hosts see extras/benchmark/ed25519_benchmark.cpp
+ *
+ *  Last mod 20261018-2
+ *
+ *  By Fernando Carello for GT50
+ *  Released under Apache license
+ *  Copyright 2023 GT50 S.r.l.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+
+#include <AlgoIoT.h>
+#include <algoed25519.h>
+
+
+#define SERIAL_BAUDRATE 115200
+#define BENCH_ROUNDS 20
+#define BENCH_MESSAGE_BYTES 256   // About the size of a payment transaction with a short note
+
+
+uint8_t g_seed[ED25519_KEY_BYTES];
+uint8_t g_expandedKey[ED25519_EXPANDED_KEY_BYTES];
+uint8_t g_publicKey[ED25519_KEY_BYTES];
+uint8_t g_message[BENCH_MESSAGE_BYTES];
+uint8_t g_signature[ED25519_SIG_BYTES];
+mpkSegment g_segment;
+
+
+// Average cycles of one call, over BENCH_ROUNDS calls
+#define BENCH(label, call) \
+  { \
+    uint32_t startCycles = ESP.getCycleCount(); \
+    for (uint16_t i = 0; i < BENCH_ROUNDS; i++) \
+    { \
+      call; \
+    } \
+    uint32_t avgCycles = (ESP.getCycleCount() - startCycles) / BENCH_ROUNDS; \
+    Serial.printf("%-36s %10u cycles (%u us, %u/s)\n", label, avgCycles, avgCycles / ESP.getCpuFreqMHz(), \
+                  (ESP.getCpuFreqMHz() * 1000000UL) / avgCycles); \
+  }
+
+
+void setup()
+{
+  Serial.begin(SERIAL_BAUDRATE);
+  while (!Serial);
+  delay(1000);
+
+  for (uint16_t i = 0; i < ED25519_KEY_BYTES; i++)
+  {
+    g_seed[i] = (uint8_t)i;
+  }
+  for (uint16_t i = 0; i < BENCH_MESSAGE_BYTES; i++)
+  {
+    g_message[i] = (uint8_t)(i * 7);
+  }
+  g_segment.data = g_message;
+  g_segment.len = BENCH_MESSAGE_BYTES;
+
+  AlgoEd25519::expandPrivateKey(g_expandedKey, g_seed);
+  AlgoEd25519::derivePublicKeyExpanded(g_publicKey, g_expandedKey);
+  // Warm-up: with ALGOED25519_BASE_TABLE_NONE, builds base point multiples on first use
+  AlgoEd25519::signExpanded(g_signature, g_expandedKey, g_publicKey, &g_segment, 1);
+
+  Serial.printf("\nAlgoIoT benchmark, %u-byte message, %u MHz CPU, 1 core\n", BENCH_MESSAGE_BYTES, ESP.getCpuFreqMHz());
+  Serial.printf("Ed25519 backend: %s, base table tier %d\n\n", ALGOED25519_BACKEND_NAME, ALGOED25519_BASE_TABLE);
+
+  // Saving of the key cached by AlgoIoT = first line minus second line
+  BENCH("sign(), seed expanded each time", AlgoEd25519::sign(g_signature, g_seed, g_publicKey, &g_segment, 1));
+  BENCH("signExpanded(), cached key", AlgoEd25519::signExpanded(g_signature, g_expandedKey, g_publicKey, &g_segment, 1));
+  BENCH("expandPrivateKey()", AlgoEd25519::expandPrivateKey(g_expandedKey, g_seed));
+}
+
+
+void loop()
+{
+  delay(1000);
+}
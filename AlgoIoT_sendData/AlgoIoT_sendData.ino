@@ -3,7 +3,7 @@
  * 
  *  Example for "AlgoIoT", Algorand lightweight library for ESP32
  * 
- *  Last mod 20231221-1
+ *  Last mod 20261018-5
  *
  *  By Fernando Carello for GT50
  *  Released under Apache license
@@ -42,6 +42,12 @@
 #define NODE_ACCOUNT_MNEMONICS "shadow market lounge gauge battle small crash funny supreme regular obtain require control oil lend reward galaxy tuition elder owner flavor rural expose absent sniff"  
 #define RECEIVER_ADDRESS "" 				// Leave "" to send to self (default, no fee to be paid) or insert a valid Algorand destination address
 #define USE_TESTNET	                // Comment out to use Mainnet  *** BEWARE: Mainnet is the "real thing" and will cost you real Algos! ***
+// Optional algod servers of your own, instead of AlgoNode (must be on the network above). Requests go to the
+// one answering fastest; one failing is skipped at once. Token: your node's algod.token ("" if none)
+// #define ALGOD_ENDPOINT_1 "http://192.168.1.10:8080"
+// #define ALGOD_TOKEN_1 "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+// #define ALGOD_ENDPOINT_2 "https://testnet-api.algonode.cloud"
+// #define ALGOD_TOKEN_2 ""
 
 // Assign your node serial number (will be added to Note data):
 #define NODE_SERIAL_NUMBER 1234567890UL
@@ -91,6 +97,10 @@ const uint16_t FAKE_P_MBAR = 1018;
 
 // Globals
 AlgoIoT g_algoIoT(DAPP_NAME, NODE_ACCOUNT_MNEMONICS);
+AlgoIoTNvsKeyCache g_keyCache;  // Keys derived on first boot are kept in NVS: later boots (e.g. after deep sleep) skip derivation
+AlgoIoTPartitionOutboxStorage g_outboxStorage;  // "algoiot" flash partition: see partitions.csv in this folder
+AlgoIoTOutbox g_outbox(g_outboxStorage);        // Transactions signed while offline, submitted when back online
+uint8_t g_outboxReady = 0;
 WiFiMulti g_wifiMulti;
 #ifndef FAKE_TPH_SENSOR
 Bme280TwoWire g_BMEsensor;
@@ -107,6 +117,9 @@ Bme280TwoWire g_BMEsensor;
 
 void waitForever();
 
+// Called by g_algoIoT.waitForConfirmations() once a transaction is in a block (or given up)
+void onConfirmation(const AlgoIoTConfirmation* confirmation, void* context);
+
 void initializeBME280();
 
 // Read sensors data (real of fake depending on #define in user_config.h)
@@ -147,6 +160,39 @@ void setup()
   #endif
 
 
+  // Derive (or read back from NVS) the node account keys
+  iErr = g_algoIoT.begin(&g_keyCache);
+  if (iErr != ALGOIOT_NO_ERROR)
+  {
+    #ifdef SERIAL_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Error %d initializing AlgoIoT: please check mnemonic words\n\n", iErr);
+    #endif
+
+    waitForever();
+  }
+
+
+  // Outbox: readings keep being signed and stored while WiFi or algod are down
+  iErr = g_algoIoT.setOutbox(&g_outbox);
+  if (iErr == ALGOIOT_NO_ERROR)
+  {
+    g_outboxReady = 1;
+    #ifdef SERIAL_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Outbox ready: %u transactions pending\n\n", g_algoIoT.outboxPending());
+    #endif
+  }
+  else
+  { // Not fatal: transactions are just not kept while offline
+    #ifdef SERIAL_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Error %d opening outbox: no \"algoiot\" partition? Offline readings will be lost\n\n", iErr);
+    #endif
+  }
+
+
+  // Transactions accepted by algod are followed until they are in a block (see loop())
+  g_algoIoT.setConfirmationTracking(onConfirmation);
+
+
   // Change data receiver address and Algorand network type if needed
   if (RECEIVER_ADDRESS != "")
   {
@@ -172,6 +218,22 @@ void setup()
     waitForever();
   }
   #endif
+
+  #ifdef ALGOD_ENDPOINT_1
+  iErr = g_algoIoT.addAlgodEndpoint(ALGOD_ENDPOINT_1, ALGOD_TOKEN_1);
+  #ifdef ALGOD_ENDPOINT_2
+  if (iErr == ALGOIOT_NO_ERROR)
+    iErr = g_algoIoT.addAlgodEndpoint(ALGOD_ENDPOINT_2, ALGOD_TOKEN_2);
+  #endif
+  if (iErr != ALGOIOT_NO_ERROR)
+  {
+    #ifdef SERIAL_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Error %d adding algod endpoint: please check its URL and token\n\n", iErr);
+    #endif
+
+    waitForever();
+  }
+  #endif
 }
 
 
@@ -192,12 +254,20 @@ void loop()
   DEBUG_SERIAL.print("Trying to connect to WiFi network "); DEBUG_SERIAL.println(MYWIFI_SSID); DEBUG_SERIAL.println();
   #endif
   
-  if((g_wifiMulti.run() == WL_CONNECTED)) 
+  // With the outbox, data are read and signed on schedule even without WiFi: they are queued
+  if ((g_wifiMulti.run() == WL_CONNECTED) || g_outboxReady) 
   {
     int iErr = 0;
 
     #ifdef SERIAL_DEBUGMODE
+    if (WiFi.status() == WL_CONNECTED)
+    {
       DEBUG_SERIAL.print("Connected to "); DEBUG_SERIAL.println(MYWIFI_SSID); DEBUG_SERIAL.println();
+    }
+    else
+    {
+      DEBUG_SERIAL.println("Not connected: transaction will be queued\n");
+    }
     #endif
 
     iErr = readSensors(&tempC, &rhPct, &pmbar);
@@ -306,7 +376,23 @@ void loop()
 
       // Data added to structure. Now we can submit our transaction to the blockchain
       iErr = g_algoIoT.submitTransactionToAlgorand();
-      if (iErr)
+      if (iErr == ALGOIOT_TRANSACTION_QUEUED)
+      { // Offline: signed and kept in the outbox, submitted with the next transaction once online
+        #ifdef SERIAL_DEBUGMODE
+        DEBUG_SERIAL.printf("\t*** Algorand transaction queued: %u pending ***\n\n", g_algoIoT.outboxPending());
+        #endif
+      }
+      else if (iErr == ALGOIOT_NETWORK_ERROR)
+      { // algod unreachable or failing, retries included: lost (no outbox), next reading may get through
+        AlgoIoTRetryStats retryStats;
+
+        g_algoIoT.getRetryStats(&retryStats);
+        #ifdef SERIAL_DEBUGMODE
+        DEBUG_SERIAL.printf("Network error submitting transaction: trying again with next reading (%u of %u requests given up)\n",
+                            retryStats.gaveUp, retryStats.requests);
+        #endif
+      }
+      else if (iErr)
       {
         #ifdef SERIAL_DEBUGMODE
         DEBUG_SERIAL.printf("Error %d submitting transaction to Algorand blockchain\n", iErr);
@@ -320,6 +406,13 @@ void loop()
         #endif
       }
     }
+    // One long poll per round until the transaction is confirmed (usually the next round), instead of polling
+    while ((g_algoIoT.confirmationsPending() > 0) && (millis() - currentMillis < DATA_SEND_INTERVAL))
+    {
+      if (g_algoIoT.waitForConfirmations() != ALGOIOT_NO_ERROR)
+        break;
+    }
+
     // Wait for next data upload
     delay(DATA_SEND_INTERVAL);
   }
@@ -341,6 +434,18 @@ void waitForever()
 }
 
 
+void onConfirmation(const AlgoIoTConfirmation* confirmation, void* context)
+{
+  #ifdef SERIAL_DEBUGMODE
+  if (confirmation->state == ALGOIOT_CONFIRMATION_CONFIRMED)
+    DEBUG_SERIAL.printf("\t*** Transaction %s confirmed in round %llu, %u ms after sampling ***\n\n",
+                        confirmation->txID, confirmation->confirmedRound, confirmation->latencyMs);
+  else
+    DEBUG_SERIAL.printf("Transaction %s not confirmed (state %u)\n", confirmation->txID, confirmation->state);
+  #endif
+}
+
+
 #ifndef FAKE_TPH_SENSOR
 void initializeBME280()
 {
@@ -0,0 +1,219 @@
+/**
+ *  AlgoIoT asynchronous example for ESP32
+ *
+ *  Example for "AlgoIoT", Algorand lightweight library for ESP32
+ *  Sensors are sampled every second while transactions are being submitted: submission runs in short
+ *  steps (beginSubmit(), then poll() on every loop()), so loop() never waits for algod
+ *
+ *  Last mod 20261018-1
+ *
+ *  By Fernando Carello for GT50
+ *  Released under Apache license
+ *  Copyright 2023 GT50 S.r.l.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+
+#include <WiFi.h>
+#include <WiFiMulti.h>
+#include <AlgoIoT.h>
+
+
+///////////////////////////
+// USER-DEFINED SETTINGS
+///////////////////////////
+// Please edit accordingly
+#define MYWIFI_SSID "My_WiFi_SSID"
+#define MYWIFI_PWD "My_WiFi_Password"
+
+// Assign a name to your IoT app:
+#define DAPP_NAME "AlgoIoT_MyTest1" // Keep it short; 31 chars = absolute max length
+// Mnemonic words (25 BIP-39 words) representing device account. Beware, this is a PRIVATE KEY and should not be shared!
+// Please replace demo mnemonic words with your own:
+#define NODE_ACCOUNT_MNEMONICS "shadow market lounge gauge battle small crash funny supreme regular obtain require control oil lend reward galaxy tuition elder owner flavor rural expose absent sniff"
+
+// Assign your node serial number (will be added to Note data):
+#define NODE_SERIAL_NUMBER 1234567890UL
+
+// Sample labels for your data:
+#define SN_LABEL "NodeSerialNum"
+#define T_LABEL "Temperature(°C)"
+#define TMIN_LABEL "TMin(°C)"
+#define TMAX_LABEL "TMax(°C)"
+#define N_LABEL "Samples"
+
+#define SAMPLE_INTERVAL_MS 1000UL
+#define DATA_SEND_INTERVAL_MINS 10
+
+// Uncomment to get debug prints on Serial Monitor
+#define SERIAL_DEBUGMODE
+
+//////////////////////////////////
+// END OF USER-DEFINED SETTINGS
+//////////////////////////////////
+
+
+#define DEBUG_SERIAL Serial
+#define DATA_SEND_INTERVAL (( DATA_SEND_INTERVAL_MINS ) * 60 * 1000UL)
+
+
+// Globals
+AlgoIoT g_algoIoT(DAPP_NAME, NODE_ACCOUNT_MNEMONICS);
+AlgoIoTNvsKeyCache g_keyCache;
+WiFiMulti g_wifiMulti;
+uint32_t g_lastSampleMillis = 0;
+uint32_t g_lastSendMillis = 0;
+// Statistics over the current send interval
+float g_tSum = 0.0f;
+float g_tMin = 0.0f;
+float g_tMax = 0.0f;
+uint32_t g_nSamples = 0;
+// End globals
+
+
+
+//////////////////////////////////////////////
+//
+// Forward Declarations for local functions
+//
+//////////////////////////////////////////////
+
+void waitForever();
+
+// Fake temperature sensor: a slow wave around 25 °C
+float readTemperature();
+
+// Called by g_algoIoT.poll() when a submission is over
+void onSubmitted(const int result, void* context);
+
+
+
+//////////
+// SETUP
+//////////
+
+void setup()
+{
+  int iErr = 0;
+
+  #ifdef SERIAL_DEBUGMODE
+  DEBUG_SERIAL.begin(115200);
+  while (!DEBUG_SERIAL)
+  {
+  }
+  delay(1000);
+  DEBUG_SERIAL.println();
+  #endif
+
+  g_wifiMulti.addAP(MYWIFI_SSID, MYWIFI_PWD);
+
+  // Key derivation is the slow part of initialization: done here, not in loop()
+  iErr = g_algoIoT.begin(&g_keyCache);
+  if (iErr != ALGOIOT_NO_ERROR)
+  {
+    #ifdef SERIAL_DEBUGMODE
+    DEBUG_SERIAL.printf("\n Error %d initializing AlgoIoT: please check mnemonic words\n\n", iErr);
+    #endif
+
+    waitForever();
+  }
+
+  g_lastSendMillis = millis();
+}
+
+
+/////////
+// LOOP
+/////////
+
+void loop()
+{
+  uint32_t currentMillis = millis();
+
+  // Sampling: on schedule, whatever the submission is doing
+  if (currentMillis - g_lastSampleMillis >= SAMPLE_INTERVAL_MS)
+  {
+    float t = readTemperature();
+
+    g_lastSampleMillis = currentMillis;
+    if ((g_nSamples == 0) || (t < g_tMin))
+      g_tMin = t;
+    if ((g_nSamples == 0) || (t > g_tMax))
+      g_tMax = t;
+    g_tSum += t;
+    g_nSamples++;
+  }
+
+  // A new transaction every DATA_SEND_INTERVAL, if the previous one is over
+  if ((currentMillis - g_lastSendMillis >= DATA_SEND_INTERVAL) && (g_nSamples > 0) &&
+      (g_algoIoT.submitState() == ALGOIOT_ASYNC_IDLE) && (g_wifiMulti.run() == WL_CONNECTED))
+  {
+    int iErr = g_algoIoT.dataAddUInt32Field(SN_LABEL, NODE_SERIAL_NUMBER);
+    if (!iErr)
+      iErr = g_algoIoT.dataAddFloatField(T_LABEL, g_tSum / g_nSamples);
+    if (!iErr)
+      iErr = g_algoIoT.dataAddFloatField(TMIN_LABEL, g_tMin);
+    if (!iErr)
+      iErr = g_algoIoT.dataAddFloatField(TMAX_LABEL, g_tMax);
+    if (!iErr)
+      iErr = g_algoIoT.dataAddUInt32Field(N_LABEL, g_nSamples);
+    // Data are taken by beginSubmit(): a new interval starts right away
+    if (!iErr)
+      iErr = g_algoIoT.beginSubmit(onSubmitted, NULL);
+    if (iErr)
+    {
+      #ifdef SERIAL_DEBUGMODE
+      DEBUG_SERIAL.printf("Error %d starting transaction\n", iErr);
+      #endif
+    }
+    g_lastSendMillis = currentMillis;
+    g_tSum = 0.0f;
+    g_nSamples = 0;
+  }
+
+  // One short step of the submission in progress, if any
+  g_algoIoT.poll();
+}
+
+
+////////////////////
+//
+// Implementations
+//
+////////////////////
+
+void waitForever()
+{
+  while(1)
+    delay(ULONG_MAX);
+}
+
+
+float readTemperature()
+{
+  return 25.0f + 2.0f * sinf((float)millis() / 600000.0f);
+}
+
+
+void onSubmitted(const int result, void* context)
+{
+  (void)context;
+
+  #ifdef SERIAL_DEBUGMODE
+  if (result == ALGOIOT_NO_ERROR)
+    DEBUG_SERIAL.printf("\t*** Algorand transaction successfully submitted with ID = %s ***\n\n", g_algoIoT.getTransactionID());
+  else
+    DEBUG_SERIAL.printf("Error %d submitting transaction to Algorand blockchain: next one at next interval\n", result);
+  #endif
+}
@@ -0,0 +1,90 @@
+// algoaddress.cpp
+// Algorand address encoding and validation
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "algoaddress.h"
+#include "algosha512.h"
+#include "base32decode.h"
+
+#define ALGOADDRESS_BYTES (ALGOADDRESS_KEY_BYTES + ALGOADDRESS_CHECKSUM_BYTES)
+
+
+// Checksum = last 4 bytes of SHA-512/256(public key)
+static void addressChecksum(const uint8_t publicKey[ALGOADDRESS_KEY_BYTES], uint8_t checksum[ALGOADDRESS_CHECKSUM_BYTES])
+{
+  AlgoSHA512 hash;
+  uint8_t digest[SHA512_256_HASH_BYTES];
+
+  hash.resetSHA512_256();
+  hash.update(publicKey, ALGOADDRESS_KEY_BYTES);
+  hash.finalize(digest, SHA512_256_HASH_BYTES);
+  memcpy(checksum, &(digest[SHA512_256_HASH_BYTES - ALGOADDRESS_CHECKSUM_BYTES]), ALGOADDRESS_CHECKSUM_BYTES);
+}
+
+
+int AlgoAddress::decode(const char* addressB32, uint8_t outPublicKey[ALGOADDRESS_KEY_BYTES])
+{
+  uint8_t decoded[ALGOADDRESS_BYTES];
+  uint8_t checksum[ALGOADDRESS_CHECKSUM_BYTES];
+  uint8_t len = 0;
+
+  if ((addressB32 == NULL) || (outPublicKey == NULL))
+    return ALGOADDRESS_NULL_POINTER;
+
+  // Bounded length check: never scans past 59 chars
+  while ((len <= ALGOADDRESS_B32_LEN) && (addressB32[len] != '\0'))
+    len++;
+  if (len != ALGOADDRESS_B32_LEN)
+    return ALGOADDRESS_BAD_LENGTH;
+
+  // 58 chars = 290 bits: 36 bytes, unless some char is invalid or ignored (as a space would be)
+  if (Base32::decode(addressB32, ALGOADDRESS_B32_LEN, decoded, ALGOADDRESS_BYTES) != ALGOADDRESS_BYTES)
+    return ALGOADDRESS_BAD_CHAR;
+
+  memcpy(outPublicKey, decoded, ALGOADDRESS_KEY_BYTES);
+  addressChecksum(decoded, checksum);
+  if (memcmp(checksum, &(decoded[ALGOADDRESS_KEY_BYTES]), ALGOADDRESS_CHECKSUM_BYTES) != 0)
+    return ALGOADDRESS_BAD_CHECKSUM;
+
+  return ALGOADDRESS_NO_ERROR;
+}
+
+
+int AlgoAddress::encode(const uint8_t publicKey[ALGOADDRESS_KEY_BYTES], char outAddress[ALGOADDRESS_B32_LEN + 1])
+{
+  uint8_t address[ALGOADDRESS_BYTES];
+
+  if ((publicKey == NULL) || (outAddress == NULL))
+    return ALGOADDRESS_NULL_POINTER;
+
+  memcpy(address, publicKey, ALGOADDRESS_KEY_BYTES);
+  addressChecksum(publicKey, &(address[ALGOADDRESS_KEY_BYTES]));
+  Base32::encode(address, ALGOADDRESS_BYTES, outAddress, ALGOADDRESS_B32_LEN + 1);
+
+  return ALGOADDRESS_NO_ERROR;
+}
+
+
+bool AlgoAddress::isValid(const char* addressB32)
+{
+  uint8_t publicKey[ALGOADDRESS_KEY_BYTES];
+
+  return (decode(addressB32, publicKey) == ALGOADDRESS_NO_ERROR);
+}
@@ -0,0 +1,62 @@
+// algoaddress.h
+// header for Algorand address encoding and validation
+// v20261018-1
+
+// An Algorand address is the 32-byte public key followed by a 4-byte checksum (last 4 bytes of the
+// SHA-512/256 of the key), Base32-encoded without padding: 58 chars
+// No heap, no global state
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOADDRESS_H
+#define __ALGOADDRESS_H
+
+#include <stdint.h>
+
+#define ALGOADDRESS_KEY_BYTES 32
+#define ALGOADDRESS_CHECKSUM_BYTES 4
+#define ALGOADDRESS_B32_LEN 58  // Terminator excluded
+
+// Error codes of decode()
+#define ALGOADDRESS_NO_ERROR 0
+#define ALGOADDRESS_NULL_POINTER 1
+#define ALGOADDRESS_BAD_LENGTH 2
+#define ALGOADDRESS_BAD_CHAR 3
+#define ALGOADDRESS_BAD_CHECKSUM 4
+
+
+class AlgoAddress
+{
+  public:
+    /// @brief Decodes and fully validates an address: length, Base32 alphabet, checksum
+    /// @param addressB32 null-terminated address (58 chars)
+    /// @param outPublicKey 32-byte output buffer (written even if the checksum does not match)
+    /// @return error code (ALGOADDRESS_NO_ERROR = OK)
+    static int decode(const char* addressB32, uint8_t outPublicKey[ALGOADDRESS_KEY_BYTES]);
+
+    /// @brief Encodes a public key as an address, checksum included
+    /// @param publicKey 32-byte public key
+    /// @param outAddress output buffer, receives the null-terminated address
+    /// @return error code (ALGOADDRESS_NO_ERROR = OK)
+    static int encode(const uint8_t publicKey[ALGOADDRESS_KEY_BYTES], char outAddress[ALGOADDRESS_B32_LEN + 1]);
+
+    /// @brief Checks an address as decode() does, discarding the key
+    /// @param addressB32 null-terminated address
+    /// @return true if valid
+    static bool isValid(const char* addressB32);
+};
+
+#endif
@@ -0,0 +1,565 @@
+// algobulkcodec.cpp
+// Bulk Base64 / Base32 encoding and decoding, vectorized on x86 hosts
+// v20261018-1
+
+// SIMD steps work on whole blocks (Base64: 12 bytes <-> 16 chars, Base32: 10 bytes <-> 16 chars), so
+// the bit stream is aligned at every block boundary and the scalar code simply carries on where
+// vector code stops: at the tail, or at the first block needing the scalar rules (padding, invalid or
+// ignored chars, lower case Base32). Vector stores write whole registers, so vector loops also stop
+// when the output buffer has no room for a full register
+// Base64 vector algorithms: W. Mula, D. Lemire, "Faster Base64 Encoding and Decoding using AVX2 Instructions"
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <limits.h>
+#include "algobulkcodec.h"
+#include "base32decode.h"
+
+#if ALGOBULK_X86
+  #include <immintrin.h>
+  // Per-function targets: the library needs no special compiler flags, and runs on any x86 CPU
+  #define ALGOBULK_TARGET_SSE41 __attribute__((target("sse4.1")))
+  #define ALGOBULK_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#define BASE64_INVALID 0xFF
+#define BASE32_SCALAR_CHUNK (5UL << 24)  // Bytes per Base32::encode() call: a multiple of 5 bytes (8 chars)
+
+
+static const char BASE64_ALPHABET[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Symbol value (0..63) of every input char, or BASE64_INVALID
+static const uint8_t BASE64_DECODE_TABLE[256] =
+{
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x00
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x10
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,  // 0x20
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x30
+  0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,  // 0x40
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x50
+  0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,  // 0x60
+  0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x70
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x80
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x90
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xa0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xb0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xc0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xd0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xe0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff  // 0xf0
+};
+
+
+static uint8_t detectSimdLevel()
+{
+#if ALGOBULK_X86
+  __builtin_cpu_init();  // May run before main(), from a static initializer
+  if (__builtin_cpu_supports("avx2"))
+    return ALGOBULK_AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return ALGOBULK_SSE41;
+#endif
+  return ALGOBULK_SCALAR;
+}
+
+// Zero (scalar) until initialized, so calls from other static initializers are safe anyway
+static uint8_t s_simdLevel = detectSimdLevel();
+
+
+// ---- Scalar code
+
+// Writes ALGOBULK_BASE64_ENCODED_LEN(length) chars, no terminator
+static void base64EncodeScalar(const uint8_t* in, const size_t length, char* out)
+{
+  size_t i = 0;
+  uint32_t value = 0;
+
+  for (; i + 3 <= length; i += 3)
+  {
+    value = ((uint32_t)in[i] << 16) | ((uint32_t)in[i + 1] << 8) | in[i + 2];
+    *out++ = BASE64_ALPHABET[value >> 18];
+    *out++ = BASE64_ALPHABET[(value >> 12) & 0x3F];
+    *out++ = BASE64_ALPHABET[(value >> 6) & 0x3F];
+    *out++ = BASE64_ALPHABET[value & 0x3F];
+  }
+  if (i < length)
+  {
+    value = (uint32_t)in[i] << 16;
+    if (i + 1 < length)
+      value |= (uint32_t)in[i + 1] << 8;
+    *out++ = BASE64_ALPHABET[value >> 18];
+    *out++ = BASE64_ALPHABET[(value >> 12) & 0x3F];
+    *out++ = (i + 1 < length) ? BASE64_ALPHABET[(value >> 6) & 0x3F] : '=';
+    *out++ = '=';
+  }
+}
+
+// Decodes "length" chars, padding excluded, into (length * 3) / 4 bytes
+// Returns false on invalid char or length (a last group of 1 char)
+static bool base64DecodeScalar(const char* in, const size_t length, uint8_t* out)
+{
+  size_t i = 0;
+  uint32_t value = 0;
+  uint8_t invalid = 0;
+
+  for (; i + 4 <= length; i += 4)
+  {
+    const uint8_t a = BASE64_DECODE_TABLE[(uint8_t)in[i]];
+    const uint8_t b = BASE64_DECODE_TABLE[(uint8_t)in[i + 1]];
+    const uint8_t c = BASE64_DECODE_TABLE[(uint8_t)in[i + 2]];
+    const uint8_t d = BASE64_DECODE_TABLE[(uint8_t)in[i + 3]];
+
+    if ((a | b | c | d) == BASE64_INVALID)
+      return false;
+    value = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+    *out++ = (uint8_t)(value >> 16);
+    *out++ = (uint8_t)(value >> 8);
+    *out++ = (uint8_t)value;
+  }
+
+  switch (length - i)
+  {
+    case 0:
+      return true;
+    case 1:
+      return false;
+    default:
+      value = 0;
+      for (uint8_t j = 0; j < 4; j++)
+      {
+        const uint8_t symbol = (i + j < length) ? BASE64_DECODE_TABLE[(uint8_t)in[i + j]] : 0;
+        invalid |= (symbol == BASE64_INVALID);
+        value = (value << 6) | symbol;
+      }
+      if (invalid)
+        return false;
+      *out++ = (uint8_t)(value >> 16);
+      if (length - i == 3)
+        *out++ = (uint8_t)(value >> 8);
+      return true;
+  }
+}
+
+
+#if ALGOBULK_X86
+
+// ---- SSE4.1 code: one 128-bit register per step
+
+// Base64 encoding of 12 bytes per step; reads 16. Returns bytes consumed
+ALGOBULK_TARGET_SSE41
+static size_t base64EncodeSse41(const uint8_t* in, const size_t length, char* out)
+{
+  const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  size_t done = 0;
+
+  while (done + 16 <= length)
+  {
+    // 3 bytes per 32-bit lane, then the four 6-bit indices moved to one byte each
+    const __m128i bytes = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(in + done)), shuffle);
+    const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t0, t1);
+
+    // Index range -> offset to add: 0..25 -> 13 ('A'), 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    _mm_storeu_si128((__m128i*)out, _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range)));
+
+    out += 16;
+    done += 12;
+  }
+
+  return done;
+}
+
+// Base64 decoding of 16 chars per step; writes 16 bytes (12 valid). Stops at the first block that is not
+// 16 valid symbols. Returns chars consumed
+ALGOBULK_TARGET_SSE41
+static size_t base64DecodeSse41(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  // Nibble-indexed classes: a char is valid if its low and high nibble classes share no bit
+  const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i mask2F = _mm_set1_epi8(0x2F);
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  size_t done = 0;
+  size_t produced = 0;
+
+  while ((done + 16 <= length) && (produced + 16 <= outSize))
+  {
+    const __m128i chars = _mm_loadu_si128((const __m128i*)(in + done));
+    const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+    const __m128i classes = _mm_and_si128(_mm_shuffle_epi8(lutLo, _mm_and_si128(chars, mask2F)), _mm_shuffle_epi8(lutHi, hiNibbles));
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(classes, _mm_setzero_si128())) != 0)
+      break;
+
+    // Char -> symbol value ('/' shares its high nibble with '+': told apart by the compare)
+    const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(chars, mask2F), hiNibbles));
+    const __m128i symbols = _mm_add_epi8(chars, roll);
+
+    // 4 x 6 bits -> 24 bits per 32-bit lane, then 3 bytes per lane, big-endian
+    const __m128i pairs = _mm_maddubs_epi16(symbols, _mm_set1_epi32(0x01400140));
+    const __m128i triplets = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    _mm_storeu_si128((__m128i*)(out + produced), _mm_shuffle_epi8(triplets, pack));
+
+    done += 16;
+    produced += 12;
+  }
+
+  return done;
+}
+
+// Base32 encoding of 10 bytes per step; reads 16. Returns bytes consumed
+ALGOBULK_TARGET_SSE41
+static size_t base32EncodeSse41(const uint8_t* in, const size_t length, char* out)
+{
+  const __m128i spread = _mm_setr_epi8(4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1);
+  size_t done = 0;
+
+  while (done + 16 <= length)
+  {
+    // 5 bytes -> 40-bit value per 64-bit lane, then halved at every step: 2 x 20, 4 x 10, 8 x 5 bits
+    const __m128i x40 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(in + done)), spread);
+    const __m128i x20 = _mm_or_si128(_mm_srli_epi64(x40, 20), _mm_slli_epi64(_mm_and_si128(x40, _mm_set1_epi64x(0xFFFFF)), 32));
+    const __m128i x10 = _mm_or_si128(_mm_srli_epi32(x20, 10), _mm_slli_epi32(_mm_and_si128(x20, _mm_set1_epi32(0x3FF)), 16));
+    const __m128i x5 = _mm_or_si128(_mm_srli_epi16(x10, 5), _mm_slli_epi16(_mm_and_si128(x10, _mm_set1_epi16(0x1F)), 8));
+
+    // 0..25 -> 'A'..'Z', 26..31 -> '2'..'7'
+    const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(x5, _mm_set1_epi8(25)), _mm_set1_epi8('2' - 26 - 'A'));
+    _mm_storeu_si128((__m128i*)out, _mm_add_epi8(_mm_add_epi8(x5, _mm_set1_epi8('A')), digits));
+
+    out += 16;
+    done += 10;
+  }
+
+  return done;
+}
+
+// Base32 decoding of 16 chars per step; writes 16 bytes (10 valid). Stops at the first block that is not
+// 16 upper case symbols. Returns chars consumed
+ALGOBULK_TARGET_SSE41
+static size_t base32DecodeSse41(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  const __m128i pack = _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+  size_t done = 0;
+  size_t produced = 0;
+
+  while ((done + 16 <= length) && (produced + 16 <= outSize))
+  {
+    // Signed compares: chars >= 0x80 are negative, so they fail both ranges
+    const __m128i chars = _mm_loadu_si128((const __m128i*)(in + done));
+    const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), chars));
+    const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('2' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('7' + 1), chars));
+    if (_mm_movemask_epi8(_mm_or_si128(isLetter, isDigit)) != 0xFFFF)
+      break;
+    const __m128i symbols = _mm_sub_epi8(chars, _mm_or_si128(_mm_and_si128(isLetter, _mm_set1_epi8('A')),
+                                                             _mm_and_si128(isDigit, _mm_set1_epi8('2' - 26))));
+
+    // 8 x 5 bits -> 40 bits per 64-bit lane, merging 2 x 5, 2 x 10, 2 x 20 bits; then 5 bytes per lane, big-endian
+    const __m128i x10 = _mm_maddubs_epi16(symbols, _mm_set1_epi16(0x0120));
+    const __m128i x20 = _mm_madd_epi16(x10, _mm_set1_epi32(0x00010400));
+    const __m128i x40 = _mm_or_si128(_mm_srli_epi64(_mm_slli_epi64(x20, 32), 12), _mm_srli_epi64(x20, 32));
+    _mm_storeu_si128((__m128i*)(out + produced), _mm_shuffle_epi8(x40, pack));
+
+    done += 16;
+    produced += 10;
+  }
+
+  return done;
+}
+
+
+// ---- AVX2 code: same steps as SSE4.1 on two 128-bit lanes, one block each (shuffles do not cross lanes)
+
+// Loads 16 bytes at "lo" in the low lane, 16 bytes at "hi" in the high lane
+#define ALGOBULK_LOAD_LANES(lo, hi) \
+  _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(lo))), _mm_loadu_si128((const __m128i*)(hi)), 1)
+
+ALGOBULK_TARGET_AVX2
+static size_t base64EncodeAvx2(const uint8_t* in, const size_t length, char* out)
+{
+  const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                           1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                           '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                           'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                           '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  size_t done = 0;
+
+  while (done + 28 <= length)
+  {
+    const __m256i bytes = _mm256_shuffle_epi8(ALGOBULK_LOAD_LANES(in + done, in + done + 12), shuffle);
+    const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+    const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t0, t1);
+
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+    _mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range)));
+
+    out += 32;
+    done += 24;
+  }
+
+  return done;
+}
+
+// Writes 32 bytes (24 valid)
+ALGOBULK_TARGET_AVX2
+static size_t base64DecodeAvx2(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                         0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                         0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i mask2F = _mm256_set1_epi8(0x2F);
+  const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  const __m256i joinLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);  // 12 + 12 bytes made contiguous
+  size_t done = 0;
+  size_t produced = 0;
+
+  while ((done + 32 <= length) && (produced + 32 <= outSize))
+  {
+    const __m256i chars = _mm256_loadu_si256((const __m256i*)(in + done));
+    const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask2F);
+    const __m256i classes = _mm256_and_si256(_mm256_shuffle_epi8(lutLo, _mm256_and_si256(chars, mask2F)), _mm256_shuffle_epi8(lutHi, hiNibbles));
+    if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(classes, _mm256_setzero_si256())) != 0)
+      break;
+
+    const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(chars, mask2F), hiNibbles));
+    const __m256i symbols = _mm256_add_epi8(chars, roll);
+
+    const __m256i pairs = _mm256_maddubs_epi16(symbols, _mm256_set1_epi32(0x01400140));
+    const __m256i triplets = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    _mm256_storeu_si256((__m256i*)(out + produced), _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triplets, pack), joinLanes));
+
+    done += 32;
+    produced += 24;
+  }
+
+  return done;
+}
+
+ALGOBULK_TARGET_AVX2
+static size_t base32EncodeAvx2(const uint8_t* in, const size_t length, char* out)
+{
+  const __m256i spread = _mm256_setr_epi8(4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1,
+                                          4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1);
+  size_t done = 0;
+
+  while (done + 26 <= length)
+  {
+    const __m256i x40 = _mm256_shuffle_epi8(ALGOBULK_LOAD_LANES(in + done, in + done + 10), spread);
+    const __m256i x20 = _mm256_or_si256(_mm256_srli_epi64(x40, 20), _mm256_slli_epi64(_mm256_and_si256(x40, _mm256_set1_epi64x(0xFFFFF)), 32));
+    const __m256i x10 = _mm256_or_si256(_mm256_srli_epi32(x20, 10), _mm256_slli_epi32(_mm256_and_si256(x20, _mm256_set1_epi32(0x3FF)), 16));
+    const __m256i x5 = _mm256_or_si256(_mm256_srli_epi16(x10, 5), _mm256_slli_epi16(_mm256_and_si256(x10, _mm256_set1_epi16(0x1F)), 8));
+
+    const __m256i digits = _mm256_and_si256(_mm256_cmpgt_epi8(x5, _mm256_set1_epi8(25)), _mm256_set1_epi8('2' - 26 - 'A'));
+    _mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(_mm256_add_epi8(x5, _mm256_set1_epi8('A')), digits));
+
+    out += 32;
+    done += 20;
+  }
+
+  return done;
+}
+
+// Writes 26 bytes (20 valid): each lane's 10 bytes stored separately
+ALGOBULK_TARGET_AVX2
+static size_t base32DecodeAvx2(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  const __m256i pack = _mm256_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+                                        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+  size_t done = 0;
+  size_t produced = 0;
+
+  while ((done + 32 <= length) && (produced + 26 <= outSize))
+  {
+    const __m256i chars = _mm256_loadu_si256((const __m256i*)(in + done));
+    const __m256i isLetter = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), chars));
+    const __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('2' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('7' + 1), chars));
+    if (_mm256_movemask_epi8(_mm256_or_si256(isLetter, isDigit)) != -1)
+      break;
+    const __m256i symbols = _mm256_sub_epi8(chars, _mm256_or_si256(_mm256_and_si256(isLetter, _mm256_set1_epi8('A')),
+                                                                   _mm256_and_si256(isDigit, _mm256_set1_epi8('2' - 26))));
+
+    const __m256i x10 = _mm256_maddubs_epi16(symbols, _mm256_set1_epi16(0x0120));
+    const __m256i x20 = _mm256_madd_epi16(x10, _mm256_set1_epi32(0x00010400));
+    const __m256i x40 = _mm256_or_si256(_mm256_srli_epi64(_mm256_slli_epi64(x20, 32), 12), _mm256_srli_epi64(x20, 32));
+    const __m256i bytes = _mm256_shuffle_epi8(x40, pack);
+    _mm_storeu_si128((__m128i*)(out + produced), _mm256_castsi256_si128(bytes));
+    _mm_storeu_si128((__m128i*)(out + produced + 10), _mm256_extracti128_si256(bytes, 1));
+
+    done += 32;
+    produced += 20;
+  }
+
+  return done;
+}
+
+#endif // ALGOBULK_X86
+
+
+// ---- Public interface
+
+uint8_t AlgoBulkCodec::simdLevel()
+{
+  return s_simdLevel;
+}
+
+
+uint8_t AlgoBulkCodec::setSimdLevel(const uint8_t level)
+{
+  const uint8_t supported = detectSimdLevel();
+
+  s_simdLevel = (level < supported) ? level : supported;
+
+  return s_simdLevel;
+}
+
+
+const char* AlgoBulkCodec::simdLevelName(const uint8_t level)
+{
+  switch (level)
+  {
+    case ALGOBULK_AVX2:
+      return "AVX2";
+    case ALGOBULK_SSE41:
+      return "SSE4.1";
+    default:
+      return "scalar";
+  }
+}
+
+
+size_t AlgoBulkCodec::base64Encode(const uint8_t* in, const size_t length, char* out, const size_t outSize)
+{
+  const size_t encodedLen = ALGOBULK_BASE64_ENCODED_LEN(length);
+  size_t done = 0;  // Bytes, always a multiple of 3
+
+  if ((in == NULL) || (out == NULL) || (outSize < encodedLen + 1))
+    return 0;
+
+#if ALGOBULK_X86
+  if (s_simdLevel >= ALGOBULK_AVX2)
+    done = base64EncodeAvx2(in, length, out);
+  if (s_simdLevel >= ALGOBULK_SSE41)
+    done += base64EncodeSse41(in + done, length - done, out + (done / 3) * 4);
+#endif
+  base64EncodeScalar(in + done, length - done, out + (done / 3) * 4);
+  out[encodedLen] = '\0';
+
+  return encodedLen;
+}
+
+
+size_t AlgoBulkCodec::base64Decode(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  size_t symbols = length;
+  size_t decodedLen = 0;
+  size_t done = 0;  // Chars, always a multiple of 16
+
+  if ((in == NULL) || (out == NULL) || (length == 0))
+    return 0;
+
+  // Up to 2 padding chars, only completing the last group of 4
+  while ((symbols > 0) && (length - symbols < 2) && (in[symbols - 1] == '='))
+    symbols--;
+  if ((symbols < length) && ((length % 4) != 0))
+    return 0;
+  decodedLen = (symbols / 4) * 3 + (((symbols % 4) > 1) ? (symbols % 4) - 1 : 0);
+  if (outSize < decodedLen)
+    return 0;
+
+#if ALGOBULK_X86
+  if (s_simdLevel >= ALGOBULK_AVX2)
+    done = base64DecodeAvx2(in, symbols, out, outSize);
+  if (s_simdLevel >= ALGOBULK_SSE41)
+    done += base64DecodeSse41(in + done, symbols - done, out + (done / 4) * 3, outSize - (done / 4) * 3);
+#endif
+  if (!base64DecodeScalar(in + done, symbols - done, out + (done / 4) * 3))
+    return 0;
+
+  return decodedLen;
+}
+
+
+size_t AlgoBulkCodec::base32Encode(const uint8_t* in, const size_t length, char* out, const size_t outSize)
+{
+  const size_t encodedLen = BASE32_ENCODED_LEN(length);
+  size_t done = 0;  // Bytes, always a multiple of 5
+
+  if ((in == NULL) || (out == NULL) || (outSize < encodedLen + 1))
+    return 0;
+
+#if ALGOBULK_X86
+  if (s_simdLevel >= ALGOBULK_AVX2)
+    done = base32EncodeAvx2(in, length, out);
+  if (s_simdLevel >= ALGOBULK_SSE41)
+    done += base32EncodeSse41(in + done, length - done, out + (done / 5) * 8);
+#endif
+  // Base32::encode() takes int lengths: chunks of whole 5-byte groups
+  while (done < length)
+  {
+    const size_t chunk = ((length - done) < BASE32_SCALAR_CHUNK) ? (length - done) : BASE32_SCALAR_CHUNK;
+
+    Base32::encode(in + done, (int)chunk, out + (done / 5) * 8, (int)BASE32_ENCODED_LEN(chunk) + 1);
+    done += chunk;
+  }
+  out[encodedLen] = '\0';
+
+  return encodedLen;
+}
+
+
+size_t AlgoBulkCodec::base32Decode(const char* in, const size_t length, uint8_t* out, const size_t outSize)
+{
+  size_t done = 0;  // Chars, always a multiple of 16
+  int tailLen = 0;
+
+  if ((in == NULL) || (out == NULL) || (length == 0) || (length > INT_MAX))
+    return 0;
+
+#if ALGOBULK_X86
+  if (s_simdLevel >= ALGOBULK_AVX2)
+    done = base32DecodeAvx2(in, length, out, outSize);
+  if (s_simdLevel >= ALGOBULK_SSE41)
+    done += base32DecodeSse41(in + done, length - done, out + (done / 16) * 10, outSize - (done / 16) * 10);
+#endif
+  if (done == length)
+    return (done / 16) * 10;
+
+  // Base32::decode() returns 0 both on error and for input decoding to nothing (e.g. 1 symbol, or "===="):
+  // giving it the last vector block as well, a valid tail always decodes to something
+  if (done > 0)
+    done -= 16;
+  const size_t produced = (done / 16) * 10;
+  const size_t room = outSize - produced;
+  tailLen = Base32::decode(in + done, (int)(length - done), out + produced, (room > INT_MAX) ? INT_MAX : (int)room);
+  if (tailLen == 0)
+    return 0;
+
+  return produced + tailLen;
+}
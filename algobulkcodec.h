@@ -0,0 +1,100 @@
+// algobulkcodec.h
+// header for bulk Base64 / Base32 encoding and decoding, vectorized on x86 hosts
+// v20261018-1
+
+// For host-side batch processing (e.g. aggregators converting many addresses and payloads)
+// On x86 / x86-64 with GCC or Clang, SSE4.1 and AVX2 code paths are compiled in and the best one
+// supported by the CPU is chosen at run time; elsewhere (ESP32 included) only the scalar code exists
+// Results are the same whatever the path. Caller buffers only: no heap, no per-call setup
+//
+// Base64: RFC 4648 standard alphabet, encoded with '=' padding; padding optional when decoding
+// Base32: RFC 4648 alphabet, as Base32::encode() / Base32::decode() (base32decode.h), which are
+// also the scalar path: encoded upper case without padding; decoding accepts what Base32::decode() does
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOBULKCODEC_H
+#define __ALGOBULKCODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Code paths, from slowest
+#define ALGOBULK_SCALAR 0
+#define ALGOBULK_SSE41 1  // 16 chars per step
+#define ALGOBULK_AVX2 2   // 32 chars per step
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && !defined(ARDUINO)
+  #define ALGOBULK_X86 1
+#else
+  #define ALGOBULK_X86 0
+#endif
+
+// Buffer sizes: encoded length of "n" bytes (without terminator), longest decoding of "n" chars
+#define ALGOBULK_BASE64_ENCODED_LEN(n) ((((n) + 2) / 3) * 4)
+#define ALGOBULK_BASE64_DECODED_MAX_LEN(n) ((((n) + 3) / 4) * 3)
+
+
+class AlgoBulkCodec
+{
+  public:
+    /// @brief Code path in use: the best one supported by the CPU, unless lowered by setSimdLevel()
+    /// @return ALGOBULK_SCALAR, ALGOBULK_SSE41 or ALGOBULK_AVX2
+    static uint8_t simdLevel();
+
+    /// @brief Selects a code path (e.g. to compare them). Levels not supported by the CPU are lowered
+    /// Not thread-safe: call before starting threads that use the codec
+    /// @param level ALGOBULK_SCALAR, ALGOBULK_SSE41 or ALGOBULK_AVX2
+    /// @return level actually selected
+    static uint8_t setSimdLevel(const uint8_t level);
+
+    /// @brief Name of a code path, for logs
+    static const char* simdLevelName(const uint8_t level);
+
+    /// @brief Encodes to Base64, with padding
+    /// @param in data to encode
+    /// @param length data length
+    /// @param out output buffer, receives a null-terminated string
+    /// @param outSize output buffer size: at least ALGOBULK_BASE64_ENCODED_LEN(length) + 1
+    /// @return number of chars written, terminator excluded (0 if error occurred)
+    static size_t base64Encode(const uint8_t* in, const size_t length, char* out, const size_t outSize);
+
+    /// @brief Decodes from Base64. Invalid chars (whitespace included) are errors
+    /// @param in Base64 chars, '=' padding optional
+    /// @param length number of chars
+    /// @param out output buffer
+    /// @param outSize output buffer size: ALGOBULK_BASE64_DECODED_MAX_LEN(length) is always enough
+    /// @return length of decoded data (0 if error occurred: invalid input or output buffer too small)
+    static size_t base64Decode(const char* in, const size_t length, uint8_t* out, const size_t outSize);
+
+    /// @brief Encodes to Base32, as Base32::encode()
+    /// @param in data to encode
+    /// @param length data length
+    /// @param out output buffer, receives a null-terminated string
+    /// @param outSize output buffer size: at least BASE32_ENCODED_LEN(length) + 1
+    /// @return number of chars written, terminator excluded (0 if error occurred)
+    static size_t base32Encode(const uint8_t* in, const size_t length, char* out, const size_t outSize);
+
+    /// @brief Decodes from Base32, as Base32::decode(); fastest on upper case input without separators
+    /// @param in Base32 chars
+    /// @param length number of chars (up to INT_MAX)
+    /// @param out output buffer
+    /// @param outSize output buffer size: BASE32_DECODED_MAX_LEN(length) is always enough
+    /// @return length of decoded data (0 if error occurred: invalid char or output buffer too small)
+    static size_t base32Decode(const char* in, const size_t length, uint8_t* out, const size_t outSize);
+};
+
+#endif
@@ -0,0 +1,622 @@
+// algoed25519.cpp
+// Ed25519 signatures over segmented messages
+// v20261018-6
+
+// The Crypto library Ed25519 class only signs a contiguous buffer, so a transaction assembled by
+// reference (header, copied fields, note in place...) would have to be flattened first just to be signed.
+// Here the message is hashed segment by segment instead. Curve arithmetic follows the reference
+// implementation by Bernstein et al. ("ref10", public domain): extended twisted Edwards coordinates,
+// constant-time fixed-base multiplication. Field elements come from the backend
+// (algoed25519fe32.h: radix 2^25.5 for MCUs, algoed25519fe64.h: radix 2^51 for 64-bit hosts)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "algoed25519.h"
+
+// Backend: field arithmetic and SHA-512 implementation (algoed25519.h), selected at compile time (no indirection)
+#if ALGOED25519_BACKEND == ALGOED25519_BACKEND_HOST64
+  #include "algoed25519fe64.h"
+#else
+  #include "algoed25519fe32.h"
+#endif
+typedef AlgoEd25519Hash Ed25519Hash;
+
+
+/////////////////////////////
+// Field arithmetic mod 2^255 - 19, common to all backends
+/////////////////////////////
+
+static const uint8_t FE_D2_BYTES[32] =  // 2 * d, d = -121665/121666
+{
+  0x59, 0xf1, 0xb2, 0x26, 0x94, 0x9b, 0xd6, 0xeb, 0x56, 0xb1, 0x83, 0x82, 0x9a, 0x14, 0xe0, 0x00,
+  0x30, 0xd1, 0xf3, 0xee, 0xf2, 0x80, 0x8e, 0x19, 0xe7, 0xfc, 0xdf, 0x56, 0xdc, 0xd9, 0x06, 0x24
+};
+
+static const uint8_t GE_BASE_X_BYTES[32] =
+{
+  0x1a, 0xd5, 0x25, 0x8f, 0x60, 0x2d, 0x56, 0xc9, 0xb2, 0xa7, 0x25, 0x95, 0x60, 0xc7, 0x2c, 0x69,
+  0x5c, 0xdc, 0xd6, 0xfd, 0x31, 0xe2, 0xa4, 0xc0, 0xfe, 0x53, 0x6e, 0xcd, 0xd3, 0x36, 0x69, 0x21
+};
+
+static const uint8_t GE_BASE_Y_BYTES[32] =
+{
+  0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+};
+
+static void feNeg(fe h, const fe f)
+{
+  fe zero;
+
+  feZero(zero);
+  feSub(h, zero, f);
+}
+
+// h = f^(2^n)
+static void feSqN(fe h, const fe f, uint16_t n)
+{
+  feSq(h, f);
+  while (--n)
+  {
+    feSq(h, h);
+  }
+}
+
+// h = z^(p - 2) = 1/z
+static void feInvert(fe h, const fe z)
+{
+  fe t0, t1, t2, t3;
+
+  feSq(t0, z);              // 2
+  feSqN(t1, t0, 2);         // 8
+  feMul(t1, z, t1);         // 9
+  feMul(t0, t0, t1);        // 11
+  feSq(t2, t0);             // 22
+  feMul(t1, t1, t2);        // 2^5 - 1
+  feSqN(t2, t1, 5);
+  feMul(t1, t2, t1);        // 2^10 - 1
+  feSqN(t2, t1, 10);
+  feMul(t2, t2, t1);        // 2^20 - 1
+  feSqN(t3, t2, 20);
+  feMul(t2, t3, t2);        // 2^40 - 1
+  feSqN(t2, t2, 10);
+  feMul(t1, t2, t1);        // 2^50 - 1
+  feSqN(t2, t1, 50);
+  feMul(t2, t2, t1);        // 2^100 - 1
+  feSqN(t3, t2, 100);
+  feMul(t2, t3, t2);        // 2^200 - 1
+  feSqN(t2, t2, 50);
+  feMul(t1, t2, t1);        // 2^250 - 1
+  feSqN(t1, t1, 5);         // 2^255 - 32
+  feMul(h, t1, t0);         // 2^255 - 21
+}
+
+static uint8_t feIsNegative(const fe f)
+{
+  uint8_t s[32];
+
+  feToBytes(s, f);
+
+  return s[0] & 1;
+}
+
+
+/////////////////////////////
+// Group: points on the twisted Edwards curve -x^2 + y^2 = 1 + d x^2 y^2
+/////////////////////////////
+
+// Extended coordinates: x = X/Z, y = Y/Z, x * y = T/Z
+typedef struct
+{
+  fe X;
+  fe Y;
+  fe Z;
+  fe T;
+} gePoint;
+
+static void geIdentity(gePoint* p)
+{
+  feZero(p->X);
+  feOne(p->Y);
+  feOne(p->Z);
+  feZero(p->T);
+}
+
+// r = 2p ("dbl-2008-hwcd", 4 squarings and 4 multiplications)
+static void geDouble(gePoint* r, const gePoint* p)
+{
+  fe a, b, c, e, f, g, h;
+
+  feSq(a, p->X);
+  feSq(b, p->Y);
+  feSq(c, p->Z);
+  feAdd(c, c, c);
+  feAdd(h, b, a);
+  feAdd(e, p->X, p->Y);
+  feSq(e, e);
+  feSub(e, e, h);
+  feSub(g, b, a);
+  feSub(f, c, g);
+  feMul(r->X, e, f);
+  feMul(r->Y, h, g);
+  feMul(r->Z, g, f);
+  feMul(r->T, e, h);
+}
+
+static void geToBytes(uint8_t s[32], const gePoint* p)
+{
+  fe recip, x, y;
+
+  feInvert(recip, p->Z);
+  feMul(x, p->X, recip);
+  feMul(y, p->Y, recip);
+  feToBytes(s, y);
+  s[31] ^= feIsNegative(x) << 7;
+}
+
+static uint8_t ctEqual(const uint8_t a, const uint8_t b)
+{
+  return (uint8_t)((((uint32_t)(a ^ b)) - 1) >> 31);
+}
+
+// Scalar (little endian, a[31] <= 127) as 64 signed 4-bit digits: a = sum(e[i] * 16^i), e[i] in -8..8
+static void scRecode(int8_t e[64], const uint8_t a[32])
+{
+  int8_t carry = 0;
+
+  for (uint8_t i = 0; i < 32; i++)
+  {
+    e[2 * i] = a[i] & 15;
+    e[2 * i + 1] = (a[i] >> 4) & 15;
+  }
+  // Digits 0..15 become -8..7
+  for (uint8_t i = 0; i < 63; i++)
+  {
+    e[i] += carry;
+    carry = (e[i] + 8) >> 4;
+    e[i] -= carry << 4;
+  }
+  e[63] += carry;
+}
+
+
+#if ALGOED25519_BASE_TABLE == ALGOED25519_BASE_TABLE_NONE
+
+// Addend form, as in ref10: saves work when the same point is added many times
+typedef struct
+{
+  fe YplusX;
+  fe YminusX;
+  fe Z;
+  fe T2d;
+} geCached;
+
+static void geCachedIdentity(geCached* c)
+{
+  feOne(c->YplusX);
+  feOne(c->YminusX);
+  feOne(c->Z);
+  feZero(c->T2d);
+}
+
+static void geToCached(geCached* c, const gePoint* p)
+{
+  fe d2;
+
+  feFromBytes(d2, FE_D2_BYTES);
+  feAdd(c->YplusX, p->Y, p->X);
+  feSub(c->YminusX, p->Y, p->X);
+  feCopy(c->Z, p->Z);
+  feMul(c->T2d, p->T, d2);
+}
+
+// r = p + q ("add-2008-hwcd-3", 8 multiplications)
+static void geAdd(gePoint* r, const gePoint* p, const geCached* q)
+{
+  fe a, b, c, d, e, f, g, h;
+
+  feSub(a, p->Y, p->X);
+  feMul(a, a, q->YminusX);
+  feAdd(b, p->Y, p->X);
+  feMul(b, b, q->YplusX);
+  feMul(c, p->T, q->T2d);
+  feMul(d, p->Z, q->Z);
+  feAdd(d, d, d);
+  feSub(e, b, a);
+  feSub(f, d, c);
+  feAdd(g, d, c);
+  feAdd(h, b, a);
+  feMul(r->X, e, f);
+  feMul(r->Y, h, g);
+  feMul(r->Z, g, f);
+  feMul(r->T, e, h);
+}
+
+// Multiples 1B..8B of the base point, for the 4-bit signed window. Built once, on first use
+static geCached s_baseMultiples[8];
+static uint8_t s_baseMultiplesReady = 0;
+
+static void geBuildBaseMultiples()
+{
+  gePoint base, multiple;
+
+  if (s_baseMultiplesReady)
+    return;
+
+  feFromBytes(base.X, GE_BASE_X_BYTES);
+  feFromBytes(base.Y, GE_BASE_Y_BYTES);
+  feOne(base.Z);
+  feMul(base.T, base.X, base.Y);
+
+  geToCached(&(s_baseMultiples[0]), &base);
+  multiple = base;
+  for (uint8_t i = 1; i < 8; i++)
+  {
+    geAdd(&multiple, &multiple, &(s_baseMultiples[0]));
+    geToCached(&(s_baseMultiples[i]), &multiple);
+  }
+
+  s_baseMultiplesReady = 1;
+}
+
+// Constant time: t = b * B, b in -8..8. Every table entry is read, whatever b is
+static void geSelectBaseMultiple(geCached* t, const int8_t b)
+{
+  const uint8_t negative = ((uint8_t)b) >> 7;
+  const uint8_t absB = (uint8_t)(b - ((-negative & b) << 1));
+  geCached minusT;
+
+  geCachedIdentity(t);
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    const uint8_t hit = ctEqual(absB, i + 1);
+    feCMov(t->YplusX, s_baseMultiples[i].YplusX, hit);
+    feCMov(t->YminusX, s_baseMultiples[i].YminusX, hit);
+    feCMov(t->Z, s_baseMultiples[i].Z, hit);
+    feCMov(t->T2d, s_baseMultiples[i].T2d, hit);
+  }
+
+  // -(x, y) = (-x, y): swap Y+X with Y-X, negate T
+  feCopy(minusT.YplusX, t->YminusX);
+  feCopy(minusT.YminusX, t->YplusX);
+  feCopy(minusT.Z, t->Z);
+  feNeg(minusT.T2d, t->T2d);
+  feCMov(t->YplusX, minusT.YplusX, negative);
+  feCMov(t->YminusX, minusT.YminusX, negative);
+  feCMov(t->T2d, minusT.T2d, negative);
+}
+
+// h = a * B, a = scalar (little endian, a[31] <= 127)
+// Digits processed from the top: 4 doublings and one addition each
+static void geScalarMultBase(gePoint* h, const uint8_t a[32])
+{
+  int8_t e[64];
+  geCached t;
+
+  geBuildBaseMultiples();
+  scRecode(e, a);
+
+  geIdentity(h);
+  for (int8_t i = 63; i >= 0; i--)
+  {
+    if (i != 63)
+    {
+      geDouble(h, h);
+      geDouble(h, h);
+      geDouble(h, h);
+      geDouble(h, h);
+    }
+    geSelectBaseMultiple(&t, e[i]);
+    geAdd(h, h, &t);
+  }
+}
+
+#else // Precomputed table in flash
+
+#include "algoed25519basetable.h"
+
+// Table entry in field form: affine point (Z = 1) as in ref10 "precomp"
+typedef struct
+{
+  fe YplusX;
+  fe YminusX;
+  fe XY2d;
+} geNiels;
+
+// r = p + q, q affine (7 multiplications)
+static void geAddNiels(gePoint* r, const gePoint* p, const geNiels* q)
+{
+  fe a, b, c, d, e, f, g, h;
+
+  feSub(a, p->Y, p->X);
+  feMul(a, a, q->YminusX);
+  feAdd(b, p->Y, p->X);
+  feMul(b, b, q->YplusX);
+  feMul(c, p->T, q->XY2d);
+  feAdd(d, p->Z, p->Z);
+  feSub(e, b, a);
+  feSub(f, d, c);
+  feAdd(g, d, c);
+  feAdd(h, b, a);
+  feMul(r->X, e, f);
+  feMul(r->Y, h, g);
+  feMul(r->Z, g, f);
+  feMul(r->T, e, h);
+}
+
+// Constant time: t = b * 16^i * B from table row i, b in -8..8
+// The whole row is read, whatever b is; selection is done on the stored bytes, then decoded once
+static void geSelectNiels(geNiels* t, const uint8_t row[8][96], const int8_t b)
+{
+  const uint8_t negative = ((uint8_t)b) >> 7;
+  const uint8_t absB = (uint8_t)(b - ((-negative & b) << 1));
+  uint8_t entry[96];
+  fe swapped;
+  fe minusXY2d;
+
+  // Identity: (1, 1, 0)
+  memset(entry, 0, sizeof(entry));
+  entry[0] = 1;
+  entry[32] = 1;
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    const uint8_t mask = (uint8_t)(0 - ctEqual(absB, i + 1));
+    for (uint8_t k = 0; k < 96; k++)
+    {
+      entry[k] ^= mask & (entry[k] ^ row[i][k]);
+    }
+  }
+
+  // -(x, y) = (-x, y): swap Y+X with Y-X, negate 2dxy
+  // Fixed offsets, then conditional moves: neither the bytes read nor the branches depend on the sign
+  feFromBytes(t->YplusX, &(entry[0]));
+  feFromBytes(t->YminusX, &(entry[32]));
+  feFromBytes(t->XY2d, &(entry[64]));
+  feCopy(swapped, t->YplusX);
+  feCMov(t->YplusX, t->YminusX, negative);
+  feCMov(t->YminusX, swapped, negative);
+  feNeg(minusXY2d, t->XY2d);
+  feCMov(t->XY2d, minusXY2d, negative);
+}
+
+// h = a * B, a = scalar (little endian, a[31] <= 127)
+// a * B = sum over o < spacing of 16^o * sum over rows i of e[i * spacing + o] * (16^(i * spacing) * B):
+// inner sums come straight from the table, outer one costs 4 doublings per step
+static void geScalarMultBase(gePoint* h, const uint8_t a[32])
+{
+  int8_t e[64];
+  geNiels t;
+
+  scRecode(e, a);
+
+  geIdentity(h);
+  for (int8_t o = ALGOED25519_BASE_SPACING - 1; o >= 0; o--)
+  {
+    if (o != ALGOED25519_BASE_SPACING - 1)
+    {
+      geDouble(h, h);
+      geDouble(h, h);
+      geDouble(h, h);
+      geDouble(h, h);
+    }
+    for (uint8_t i = 0; i < 64 / ALGOED25519_BASE_SPACING; i++)
+    {
+      geSelectNiels(&t, ED25519_BASE_TABLE[i], e[i * ALGOED25519_BASE_SPACING + o]);
+      geAddNiels(h, h, &t);
+    }
+  }
+}
+
+#endif
+
+
+/////////////////////////////
+// Scalars mod L = 2^252 + 27742317777372353535851937790883648493
+/////////////////////////////
+
+static const int64_t SC_L[32] =
+{
+  0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x10
+};
+
+// r = x mod L; x holds 64 byte-sized (possibly larger, signed) digits and is destroyed
+// Same reduction as TweetNaCl (public domain)
+static void scModL(uint8_t r[32], int64_t x[64])
+{
+  int64_t carry = 0;
+
+  for (int8_t i = 63; i >= 32; i--)
+  {
+    carry = 0;
+    int8_t j = i - 32;
+    for (; j < i - 12; j++)
+    {
+      x[j] += carry - 16 * x[i] * SC_L[j - (i - 32)];
+      carry = (x[j] + 128) >> 8;
+      x[j] -= carry * 256;
+    }
+    x[j] += carry;
+    x[i] = 0;
+  }
+  carry = 0;
+  for (uint8_t j = 0; j < 32; j++)
+  {
+    x[j] += carry - (x[31] >> 4) * SC_L[j];
+    carry = x[j] >> 8;
+    x[j] &= 255;
+  }
+  for (uint8_t j = 0; j < 32; j++)
+  {
+    x[j] -= carry * SC_L[j];
+  }
+  for (uint8_t i = 0; i < 32; i++)
+  {
+    x[i + 1] += x[i] >> 8;
+    r[i] = (uint8_t)(x[i] & 255);
+  }
+}
+
+// s = s mod L (s is 64 bytes, result in the first 32)
+static void scReduce(uint8_t s[64])
+{
+  int64_t x[64];
+
+  for (uint8_t i = 0; i < 64; i++)
+  {
+    x[i] = s[i];
+  }
+  scModL(s, x);
+}
+
+// s = (a * b + c) mod L
+static void scMulAdd(uint8_t s[32], const uint8_t a[32], const uint8_t b[32], const uint8_t c[32])
+{
+  int64_t x[64];
+
+  for (uint8_t i = 0; i < 64; i++)
+  {
+    x[i] = (i < 32) ? c[i] : 0;
+  }
+  for (uint8_t i = 0; i < 32; i++)
+  {
+    for (uint8_t j = 0; j < 32; j++)
+    {
+      x[i + j] += (int64_t)a[i] * b[j];
+    }
+  }
+  scModL(s, x);
+}
+
+
+/////////////////////////////
+// Ed25519 (RFC 8032)
+/////////////////////////////
+
+static void hashSegments(Ed25519Hash& hash, const mpkSegment* segments, const uint8_t nSegments)
+{
+  for (uint8_t i = 0; i < nSegments; i++)
+  {
+    if (segments[i].len > 0)
+      hash.update(segments[i].data, segments[i].len);
+  }
+}
+
+
+// SHA-512 of the private key: clamped scalar in the first half, nonce prefix in the second
+void AlgoEd25519::expandPrivateKey(uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES], const uint8_t privateKey[ED25519_KEY_BYTES])
+{
+  Ed25519Hash hash;
+
+  hash.reset();
+  hash.update(privateKey, ED25519_KEY_BYTES);
+  hash.finalize(expandedKey, ED25519_EXPANDED_KEY_BYTES);
+  expandedKey[0] &= 248;
+  expandedKey[31] &= 127;
+  expandedKey[31] |= 64;
+}
+
+
+void AlgoEd25519::derivePublicKeyExpanded(uint8_t publicKey[ED25519_KEY_BYTES], const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES])
+{
+  gePoint A;
+
+  geScalarMultBase(&A, expandedKey);
+  geToBytes(publicKey, &A);
+}
+
+
+void AlgoEd25519::derivePublicKey(uint8_t publicKey[ED25519_KEY_BYTES], const uint8_t privateKey[ED25519_KEY_BYTES])
+{
+  uint8_t expanded[ED25519_EXPANDED_KEY_BYTES];
+
+  expandPrivateKey(expanded, privateKey);
+  derivePublicKeyExpanded(publicKey, expanded);
+
+  memset(expanded, 0, sizeof(expanded));
+}
+
+
+void AlgoEd25519::sign(uint8_t signature[ED25519_SIG_BYTES],
+                       const uint8_t privateKey[ED25519_KEY_BYTES],
+                       const uint8_t publicKey[ED25519_KEY_BYTES],
+                       const mpkSegment* segments,
+                       const uint8_t nSegments)
+{
+  uint8_t expanded[ED25519_EXPANDED_KEY_BYTES];
+
+  expandPrivateKey(expanded, privateKey);
+  signExpanded(signature, expanded, publicKey, segments, nSegments);
+
+  memset(expanded, 0, sizeof(expanded));
+}
+
+
+// r = SHA512(prefix || M) mod L;  R = rB;  k = SHA512(R || A || M) mod L;  S = r + k * a mod L
+// The message is read twice, segment by segment: segments have to stay unchanged in between
+void AlgoEd25519::signExpanded(uint8_t signature[ED25519_SIG_BYTES],
+                               const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES],
+                               const uint8_t publicKey[ED25519_KEY_BYTES],
+                               const mpkSegment* segments,
+                               const uint8_t nSegments)
+{
+  Ed25519Hash nonceHash;
+
+  beginNonceHash(nonceHash, expandedKey);
+  hashSegments(nonceHash, segments, nSegments);
+  signExpandedPrehashed(signature, nonceHash, expandedKey, publicKey, segments, nSegments);
+}
+
+
+// First half of r = SHA512(prefix || M): the caller adds M
+void AlgoEd25519::beginNonceHash(Ed25519Hash& nonceHash, const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES])
+{
+  nonceHash.reset();
+  nonceHash.update(&(expandedKey[32]), 32);
+}
+
+
+void AlgoEd25519::signExpandedPrehashed(uint8_t signature[ED25519_SIG_BYTES],
+                                        Ed25519Hash& nonceHash,
+                                        const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES],
+                                        const uint8_t publicKey[ED25519_KEY_BYTES],
+                                        const mpkSegment* segments,
+                                        const uint8_t nSegments)
+{
+  uint8_t nonce[64];
+  uint8_t k[64];
+  Ed25519Hash hash;
+  gePoint R;
+
+  nonceHash.finalize(nonce, 64);
+  scReduce(nonce);
+
+  geScalarMultBase(&R, nonce);
+  geToBytes(signature, &R);
+
+  hash.reset();
+  hash.update(signature, 32);
+  hash.update(publicKey, ED25519_KEY_BYTES);
+  hashSegments(hash, segments, nSegments);
+  hash.finalize(k, 64);
+  scReduce(k);
+
+  scMulAdd(&(signature[32]), k, expandedKey, nonce);
+
+  memset(nonce, 0, sizeof(nonce));
+}
@@ -0,0 +1,155 @@
+// algoed25519.h
+// header for Ed25519 signatures over segmented messages
+// v20261018-5
+
+// Same signatures as the Crypto library Ed25519 class (RFC 8032), but the message does not need
+// to be contiguous: it is passed as an ordered list of segments, hashed one after the other
+// requires Crypto library (SHA512) with the MCU backend
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOED25519_H
+#define __ALGOED25519_H
+
+#include <stdint.h>
+#include "minmpk.h" // mpkSegment
+
+#define ED25519_KEY_BYTES 32
+#define ED25519_SIG_BYTES 64
+#define ED25519_EXPANDED_KEY_BYTES 64  // Clamped scalar (32 bytes) followed by nonce prefix (32 bytes)
+
+// Crypto backends: field arithmetic + SHA-512. Exactly one is compiled in, so calls are direct
+// Signatures are identical whichever backend is used
+#define ALGOED25519_BACKEND_MCU 1     // Radix 2^25.5 (32x32->64 bit products), Crypto library SHA512. Any CPU
+#define ALGOED25519_BACKEND_HOST64 2  // Radix 2^51 (64x64->128 bit products), portable SHA-512 (algosha512.h). 64-bit GCC/Clang
+
+// Define ALGOED25519_BACKEND (e.g. as a compiler flag) to force one; otherwise 64-bit non-Arduino builds get HOST64
+#ifndef ALGOED25519_BACKEND
+  #if defined(__SIZEOF_INT128__) && !defined(ARDUINO)
+    #define ALGOED25519_BACKEND ALGOED25519_BACKEND_HOST64
+  #else
+    #define ALGOED25519_BACKEND ALGOED25519_BACKEND_MCU
+  #endif
+#endif
+
+#if ALGOED25519_BACKEND == ALGOED25519_BACKEND_HOST64
+  #define ALGOED25519_BACKEND_NAME "host64 (radix 2^51)"
+#else
+  #define ALGOED25519_BACKEND_NAME "mcu (radix 2^25.5)"
+#endif
+
+// SHA-512 of the backend, exposed so that callers can feed the nonce hash themselves (see beginNonceHash())
+#if ALGOED25519_BACKEND == ALGOED25519_BACKEND_HOST64
+  #include "algosha512.h"
+  typedef AlgoSHA512 AlgoEd25519Hash;
+#else
+  #include <Crypto.h>
+  #include <SHA512.h>
+  typedef SHA512 AlgoEd25519Hash;
+#endif
+
+// Fixed-base multiplication (every signature, and public key derivation) uses precomputed multiples of
+// the base point. Tiers trade flash (const table, algoed25519basetable.h) for signing time:
+#define ALGOED25519_BASE_TABLE_NONE 0    // No flash table: 8 multiples built in RAM (1.3-1.6 KB) at first use; 252 doublings
+#define ALGOED25519_BASE_TABLE_SMALL 1   // 6 KB flash, 8 rows; 28 doublings
+#define ALGOED25519_BASE_TABLE_MEDIUM 2  // 24 KB flash, 32 rows; 4 doublings
+#define ALGOED25519_BASE_TABLE_LARGE 3   // 48 KB flash, 64 rows; no doublings
+// All tiers do 64 additions, with constant-time table lookups
+
+// Define ALGOED25519_BASE_TABLE (e.g. as a compiler flag) to pick a tier per product
+#ifndef ALGOED25519_BASE_TABLE
+  #define ALGOED25519_BASE_TABLE ALGOED25519_BASE_TABLE_MEDIUM
+#endif
+
+// Table rows are 16^i * B for i multiple of the spacing; 4 * (spacing - 1) doublings per multiplication
+#if ALGOED25519_BASE_TABLE == ALGOED25519_BASE_TABLE_SMALL
+  #define ALGOED25519_BASE_SPACING 8
+#elif ALGOED25519_BASE_TABLE == ALGOED25519_BASE_TABLE_MEDIUM
+  #define ALGOED25519_BASE_SPACING 2
+#elif ALGOED25519_BASE_TABLE == ALGOED25519_BASE_TABLE_LARGE
+  #define ALGOED25519_BASE_SPACING 1
+#endif
+
+
+class AlgoEd25519
+{
+  public:
+    /// @brief Signs a message given as a list of segments
+    /// @param signature 64-byte output buffer
+    /// @param privateKey 32-byte private key (seed)
+    /// @param publicKey 32-byte public key matching privateKey
+    /// @param segments message segments, hashed in order
+    /// @param nSegments number of segments
+    static void sign(uint8_t signature[ED25519_SIG_BYTES],
+                     const uint8_t privateKey[ED25519_KEY_BYTES],
+                     const uint8_t publicKey[ED25519_KEY_BYTES],
+                     const mpkSegment* segments,
+                     const uint8_t nSegments);
+
+    /// @brief Expands private key (seed) into the signing key proper: SHA-512, then scalar clamping
+    /// The result depends only on the seed, so it may be computed once and kept for all signatures
+    /// Holds secret key material, as the seed does
+    /// @param expandedKey 64-byte output buffer
+    /// @param privateKey 32-byte private key (seed)
+    static void expandPrivateKey(uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES], const uint8_t privateKey[ED25519_KEY_BYTES]);
+
+    /// @brief As sign(), with a key already expanded by expandPrivateKey(): saves one SHA-512 per signature
+    /// @param signature 64-byte output buffer
+    /// @param expandedKey 64-byte expanded private key
+    /// @param publicKey 32-byte public key matching expandedKey
+    /// @param segments message segments, hashed in order
+    /// @param nSegments number of segments
+    static void signExpanded(uint8_t signature[ED25519_SIG_BYTES],
+                             const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES],
+                             const uint8_t publicKey[ED25519_KEY_BYTES],
+                             const mpkSegment* segments,
+                             const uint8_t nSegments);
+
+    /// @brief Starts the nonce hash of a signature: the first of the two passes over the message
+    /// The message can then be fed to nonceHash while it is produced (e.g. through a MpkHashSink, minmpkwriter.h),
+    /// so that signing only needs the second pass. See signExpandedPrehashed()
+    /// nonceHash holds secret-derived state until finalized: call clear() on it if the signature is abandoned
+    /// @param nonceHash hash to start
+    /// @param expandedKey 64-byte expanded private key
+    static void beginNonceHash(AlgoEd25519Hash& nonceHash, const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES]);
+
+    /// @brief As signExpanded(), for a message already fed to nonceHash after beginNonceHash()
+    /// Segments are read once (challenge hash) and have to hold exactly the bytes fed to nonceHash
+    /// @param signature 64-byte output buffer
+    /// @param nonceHash hash started by beginNonceHash() and fed with the whole message; finalized here
+    /// @param expandedKey 64-byte expanded private key, the one passed to beginNonceHash()
+    /// @param publicKey 32-byte public key matching expandedKey
+    /// @param segments message segments, hashed in order
+    /// @param nSegments number of segments
+    static void signExpandedPrehashed(uint8_t signature[ED25519_SIG_BYTES],
+                                      AlgoEd25519Hash& nonceHash,
+                                      const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES],
+                                      const uint8_t publicKey[ED25519_KEY_BYTES],
+                                      const mpkSegment* segments,
+                                      const uint8_t nSegments);
+
+    /// @brief Derives public key from an expanded private key
+    /// @param publicKey 32-byte output buffer
+    /// @param expandedKey 64-byte expanded private key
+    static void derivePublicKeyExpanded(uint8_t publicKey[ED25519_KEY_BYTES], const uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES]);
+
+    /// @brief Derives public key from private key (seed)
+    /// @param publicKey 32-byte output buffer
+    /// @param privateKey 32-byte private key
+    static void derivePublicKey(uint8_t publicKey[ED25519_KEY_BYTES], const uint8_t privateKey[ED25519_KEY_BYTES]);
+};
+
+#endif
@@ -0,0 +1,206 @@
+// algoed25519fe32.h
+// Field arithmetic mod 2^255 - 19 for 32-bit CPUs (ALGOED25519_BACKEND_MCU)
+// v20261018-1
+
+// Included only by algoed25519.cpp, which selects one field backend at compile time
+// Every backend defines type "fe" and the same static functions:
+//   feZero, feOne, feCopy, feAdd, feSub, feMul, feSq, feCMov, feFromBytes, feToBytes
+// Results may always be passed as inputs to any other function (no caller-side carries)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOED25519FE32_H
+#define __ALGOED25519FE32_H
+
+#include <stdint.h>
+#include <string.h>
+
+// 10 signed limbs, alternately 26 and 25 bits wide: value = sum(f[i] * 2^ceil(25.5 * i))
+// Every function returns carried limbs (|f[i]| just above 2^25), so any result may feed a multiplication
+typedef int32_t fe[10];
+
+static inline uint8_t feLimbBits(const uint8_t i)
+{
+  return (i & 1) ? 25 : 26;
+}
+
+// Carries 64-bit accumulators into limbs, in the order used by ref10 (keeps every carry in range)
+static void feCarry(fe h, int64_t t[10])
+{
+  static const uint8_t order[12] = {0, 4, 1, 5, 2, 6, 3, 7, 4, 8, 9, 0};
+
+  for (uint8_t k = 0; k < 12; k++)
+  {
+    uint8_t i = order[k];
+    uint8_t bits = feLimbBits(i);
+    int64_t carry = (t[i] + ((int64_t)1 << (bits - 1))) >> bits;
+    t[i] -= carry << bits;
+    if (i == 9)
+      t[0] += carry * 19;   // 2^255 = 19 mod p
+    else
+      t[i + 1] += carry;
+  }
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    h[i] = (int32_t)t[i];
+  }
+}
+
+static void feZero(fe h)
+{
+  memset(h, 0, sizeof(fe));
+}
+
+static void feOne(fe h)
+{
+  feZero(h);
+  h[0] = 1;
+}
+
+static void feCopy(fe h, const fe f)
+{
+  memcpy(h, f, sizeof(fe));
+}
+
+static void feAdd(fe h, const fe f, const fe g)
+{
+  int64_t t[10];
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    t[i] = (int64_t)f[i] + g[i];
+  }
+  feCarry(h, t);
+}
+
+static void feSub(fe h, const fe f, const fe g)
+{
+  int64_t t[10];
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    t[i] = (int64_t)f[i] - g[i];
+  }
+  feCarry(h, t);
+}
+
+// Schoolbook product: terms wrapping past 2^255 are multiplied by 19,
+// products of two odd (25-bit) limbs are doubled because their weights add up to an extra half bit
+static void feMul(fe h, const fe f, const fe g)
+{
+  int64_t t[10] = {0};
+  int32_t g19[10];
+  int32_t f2[10];
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    g19[i] = 19 * g[i];
+    f2[i] = (i & 1) ? 2 * f[i] : f[i];
+  }
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    for (uint8_t j = 0; j < 10; j++)
+    {
+      const int32_t fi = (i & j & 1) ? f2[i] : f[i];
+      if (i + j < 10)
+        t[i + j] += (int64_t)fi * g[j];
+      else
+        t[i + j - 10] += (int64_t)fi * g19[j];
+    }
+  }
+  feCarry(h, t);
+}
+
+static void feSq(fe h, const fe f)
+{
+  feMul(h, f, f);
+}
+
+// Constant time: f = g if b == 1, unchanged if b == 0
+static void feCMov(fe f, const fe g, const uint8_t b)
+{
+  const int32_t mask = -(int32_t)b;
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    f[i] ^= mask & (f[i] ^ g[i]);
+  }
+}
+
+// Top bit of s is ignored
+static void feFromBytes(fe h, const uint8_t s[32])
+{
+  uint64_t acc = 0;
+  uint8_t accBits = 0;
+  uint8_t pos = 0;
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    const uint8_t bits = feLimbBits(i);
+    while (accBits < bits)
+    {
+      acc |= ((uint64_t)s[pos++]) << accBits;
+      accBits += 8;
+    }
+    h[i] = (int32_t)(acc & ((1UL << bits) - 1));
+    acc >>= bits;
+    accBits -= bits;
+  }
+}
+
+// Fully reduced (canonical) little-endian encoding
+static void feToBytes(uint8_t s[32], const fe f)
+{
+  int32_t h[10];
+  int32_t q = 0;
+  uint64_t acc = 0;
+  uint8_t accBits = 0;
+  uint8_t pos = 0;
+
+  feCopy(h, f);
+
+  // q = 1 if h >= p, 0 otherwise
+  q = (19 * h[9] + (((int32_t)1) << 24)) >> 25;
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    q = (h[i] + q) >> feLimbBits(i);
+  }
+
+  // h - q * p, then drop 2^255
+  h[0] += 19 * q;
+  for (uint8_t i = 0; i < 9; i++)
+  {
+    const int32_t carry = h[i] >> feLimbBits(i);
+    h[i + 1] += carry;
+    h[i] -= carry * (((int32_t)1) << feLimbBits(i));
+  }
+  h[9] &= (((int32_t)1) << 25) - 1;
+
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    acc |= ((uint64_t)(uint32_t)h[i]) << accBits;
+    accBits += feLimbBits(i);
+    while (accBits >= 8)
+    {
+      s[pos++] = (uint8_t)acc;
+      acc >>= 8;
+      accBits -= 8;
+    }
+  }
+  s[pos] = (uint8_t)acc;  // Last 7 bits
+}
+
+#endif
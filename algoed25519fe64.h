@@ -0,0 +1,231 @@
+// algoed25519fe64.h
+// Field arithmetic mod 2^255 - 19 for 64-bit CPUs (ALGOED25519_BACKEND_HOST64)
+// v20261018-1
+
+// Included only by algoed25519.cpp, which selects one field backend at compile time
+// Same functions as algoed25519fe32.h, on 5 limbs of 51 bits: a product is 25 64x64->128 bit
+// multiplications instead of 100 32x32->64 bit ones. Requires unsigned __int128 (GCC, Clang)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOED25519FE64_H
+#define __ALGOED25519FE64_H
+
+#include <stdint.h>
+#include <string.h>
+
+// 5 unsigned limbs of 51 bits: value = sum(f[i] * 2^(51 * i))
+// Every function returns carried limbs (f[i] just above 2^51), so any result may feed a multiplication
+typedef uint64_t fe[5];
+
+typedef unsigned __int128 feWide;
+
+#define FE51_MASK ((((uint64_t)1) << 51) - 1)
+
+// One carry pass, top carry folded back into limb 0 (2^255 = 19 mod p)
+static inline void feCarry(fe h)
+{
+  uint64_t carry = 0;
+
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    carry = h[i] >> 51;
+    h[i] &= FE51_MASK;
+    h[i + 1] += carry;
+  }
+  carry = h[4] >> 51;
+  h[4] &= FE51_MASK;
+  h[0] += carry * 19;
+  carry = h[0] >> 51;
+  h[0] &= FE51_MASK;
+  h[1] += carry;
+}
+
+static void feZero(fe h)
+{
+  memset(h, 0, sizeof(fe));
+}
+
+static void feOne(fe h)
+{
+  feZero(h);
+  h[0] = 1;
+}
+
+static void feCopy(fe h, const fe f)
+{
+  memcpy(h, f, sizeof(fe));
+}
+
+static void feAdd(fe h, const fe f, const fe g)
+{
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    h[i] = f[i] + g[i];
+  }
+  feCarry(h);
+}
+
+// 2p is added first, so limbs never go negative
+static void feSub(fe h, const fe f, const fe g)
+{
+  h[0] = (f[0] + 0xFFFFFFFFFFFDAULL) - g[0];
+  for (uint8_t i = 1; i < 5; i++)
+  {
+    h[i] = (f[i] + 0xFFFFFFFFFFFFEULL) - g[i];
+  }
+  feCarry(h);
+}
+
+// Products wrapping past 2^255 are multiplied by 19
+static void feMul(fe h, const fe f, const fe g)
+{
+  const uint64_t g1_19 = 19 * g[1];
+  const uint64_t g2_19 = 19 * g[2];
+  const uint64_t g3_19 = 19 * g[3];
+  const uint64_t g4_19 = 19 * g[4];
+  feWide t0, t1, t2, t3, t4;
+  uint64_t carry = 0;
+
+  t0 = (feWide)f[0] * g[0] + (feWide)f[1] * g4_19 + (feWide)f[2] * g3_19 + (feWide)f[3] * g2_19 + (feWide)f[4] * g1_19;
+  t1 = (feWide)f[0] * g[1] + (feWide)f[1] * g[0] + (feWide)f[2] * g4_19 + (feWide)f[3] * g3_19 + (feWide)f[4] * g2_19;
+  t2 = (feWide)f[0] * g[2] + (feWide)f[1] * g[1] + (feWide)f[2] * g[0] + (feWide)f[3] * g4_19 + (feWide)f[4] * g3_19;
+  t3 = (feWide)f[0] * g[3] + (feWide)f[1] * g[2] + (feWide)f[2] * g[1] + (feWide)f[3] * g[0] + (feWide)f[4] * g4_19;
+  t4 = (feWide)f[0] * g[4] + (feWide)f[1] * g[3] + (feWide)f[2] * g[2] + (feWide)f[3] * g[1] + (feWide)f[4] * g[0];
+
+  t1 += (uint64_t)(t0 >> 51);
+  h[0] = (uint64_t)t0 & FE51_MASK;
+  t2 += (uint64_t)(t1 >> 51);
+  h[1] = (uint64_t)t1 & FE51_MASK;
+  t3 += (uint64_t)(t2 >> 51);
+  h[2] = (uint64_t)t2 & FE51_MASK;
+  t4 += (uint64_t)(t3 >> 51);
+  h[3] = (uint64_t)t3 & FE51_MASK;
+  carry = (uint64_t)(t4 >> 51);
+  h[4] = (uint64_t)t4 & FE51_MASK;
+  h[0] += carry * 19;
+  h[1] += h[0] >> 51;
+  h[0] &= FE51_MASK;
+}
+
+// Symmetric products computed once and doubled: 15 multiplications instead of 25
+static void feSq(fe h, const fe f)
+{
+  const uint64_t f0_2 = 2 * f[0];
+  const uint64_t f1_2 = 2 * f[1];
+  const uint64_t f1_38 = 38 * f[1];
+  const uint64_t f2_38 = 38 * f[2];
+  const uint64_t f3_38 = 38 * f[3];
+  const uint64_t f3_19 = 19 * f[3];
+  const uint64_t f4_19 = 19 * f[4];
+  feWide t0, t1, t2, t3, t4;
+  uint64_t carry = 0;
+
+  t0 = (feWide)f[0] * f[0] + (feWide)f1_38 * f[4] + (feWide)f2_38 * f[3];
+  t1 = (feWide)f0_2 * f[1] + (feWide)f2_38 * f[4] + (feWide)f3_19 * f[3];
+  t2 = (feWide)f0_2 * f[2] + (feWide)f[1] * f[1] + (feWide)f3_38 * f[4];
+  t3 = (feWide)f0_2 * f[3] + (feWide)f1_2 * f[2] + (feWide)f4_19 * f[4];
+  t4 = (feWide)f0_2 * f[4] + (feWide)f1_2 * f[3] + (feWide)f[2] * f[2];
+
+  t1 += (uint64_t)(t0 >> 51);
+  h[0] = (uint64_t)t0 & FE51_MASK;
+  t2 += (uint64_t)(t1 >> 51);
+  h[1] = (uint64_t)t1 & FE51_MASK;
+  t3 += (uint64_t)(t2 >> 51);
+  h[2] = (uint64_t)t2 & FE51_MASK;
+  t4 += (uint64_t)(t3 >> 51);
+  h[3] = (uint64_t)t3 & FE51_MASK;
+  carry = (uint64_t)(t4 >> 51);
+  h[4] = (uint64_t)t4 & FE51_MASK;
+  h[0] += carry * 19;
+  h[1] += h[0] >> 51;
+  h[0] &= FE51_MASK;
+}
+
+// Constant time: f = g if b == 1, unchanged if b == 0
+static void feCMov(fe f, const fe g, const uint8_t b)
+{
+  const uint64_t mask = (uint64_t)0 - b;
+
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    f[i] ^= mask & (f[i] ^ g[i]);
+  }
+}
+
+// Top bit of s is ignored
+static void feFromBytes(fe h, const uint8_t s[32])
+{
+  uint64_t acc = 0;
+  uint8_t accBits = 0;
+  uint8_t pos = 0;
+
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    while (accBits < 51)
+    {
+      acc |= ((uint64_t)s[pos++]) << accBits;
+      accBits += 8;
+    }
+    h[i] = acc & FE51_MASK;
+    acc >>= 51;
+    accBits -= 51;
+  }
+}
+
+// Fully reduced (canonical) little-endian encoding
+static void feToBytes(uint8_t s[32], const fe f)
+{
+  uint64_t h[5];
+  uint64_t q = 0;
+  uint64_t acc = 0;
+  uint8_t accBits = 0;
+  uint8_t pos = 0;
+
+  feCopy(h, f);
+  feCarry(h);
+
+  // q = 1 if h >= p, 0 otherwise
+  q = (h[0] + 19) >> 51;
+  for (uint8_t i = 1; i < 5; i++)
+  {
+    q = (h[i] + q) >> 51;
+  }
+
+  // h - q * p, then drop 2^255
+  h[0] += 19 * q;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    h[i + 1] += h[i] >> 51;
+    h[i] &= FE51_MASK;
+  }
+  h[4] &= FE51_MASK;
+
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    acc |= h[i] << accBits;
+    accBits += 51;
+    while (accBits >= 8)
+    {
+      s[pos++] = (uint8_t)acc;
+      acc >>= 8;
+      accBits -= 8;
+    }
+  }
+  s[pos] = (uint8_t)acc;  // Last 7 bits
+}
+
+#endif
@@ -0,0 +1,187 @@
+// algoiotendpoints.cpp
+// AlgoIoT endpoint pool
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include "algoiotendpoints.h"
+#include "algoiotretry.h"
+
+
+int AlgoIoTEndpointPool::add(const char* url, const char* apiToken)
+{
+  AlgoIoTEndpoint* endpoint = NULL;
+  const char* host = NULL;
+  uint32_t urlLen = 0;
+
+  if (url == NULL)
+    return ALGOIOT_ENDPOINT_BAD_PARAM;
+  if (strncasecmp(url, "https://", 8) == 0)
+    host = url + 8;
+  else if (strncasecmp(url, "http://", 7) == 0)
+    host = url + 7;
+  else
+    return ALGOIOT_ENDPOINT_BAD_PARAM;
+  if ((*host == '\0') || (*host == '/'))
+    return ALGOIOT_ENDPOINT_BAD_PARAM;
+  urlLen = strlen(url);
+  while (url[urlLen - 1] == '/')
+    urlLen--;  // Request paths start with one
+  if (urlLen > ALGOIOT_ENDPOINT_URL_CHARS)
+    return ALGOIOT_ENDPOINT_BAD_PARAM;
+  if ((apiToken != NULL) && (strlen(apiToken) > ALGOIOT_ENDPOINT_TOKEN_CHARS))
+    return ALGOIOT_ENDPOINT_BAD_PARAM;
+  if (m_count >= ALGOIOT_MAX_ENDPOINTS)
+    return ALGOIOT_ENDPOINT_FULL;
+
+  endpoint = &(m_endpoints[m_count]);
+  memset((void*)endpoint, 0, sizeof(AlgoIoTEndpoint));
+  memcpy(endpoint->url, url, urlLen);
+  endpoint->url[urlLen] = '\0';
+  if (apiToken != NULL)
+    strcpy(endpoint->apiToken, apiToken);
+  m_count++;
+
+  return ALGOIOT_ENDPOINT_OK;
+}
+
+
+void AlgoIoTEndpointPool::clear()
+{
+  m_count = 0;
+}
+
+
+uint8_t AlgoIoTEndpointPool::count() const
+{
+  return m_count;
+}
+
+
+void AlgoIoTEndpointPool::updateCooldowns()
+{
+  uint32_t nowMillis = millis();
+
+  for (uint8_t i = 0; i < m_count; i++)
+  {
+    if (m_endpoints[i].stats.coolingDown && (nowMillis - m_endpoints[i].failedMillis >= ALGOIOT_ENDPOINT_COOLDOWN_MS))
+      m_endpoints[i].stats.coolingDown = 0;
+  }
+}
+
+
+uint32_t AlgoIoTEndpointPool::score(const AlgoIoTEndpoint* endpoint) const
+{
+  uint64_t latencyMs = endpoint->stats.latencyMs;
+
+  if (endpoint->stats.requests == 0)
+    return 0;  // Not measured yet: first
+  if (latencyMs == 0)
+    latencyMs = ALGOIOT_ENDPOINT_UNMEASURED_MS;  // Only failures so far
+
+  return (uint32_t)((latencyMs * (ALGOIOT_ENDPOINT_ERROR_RATE_ONE + ALGOIOT_ENDPOINT_ERROR_PENALTY * (uint64_t)endpoint->stats.errorRate)) /
+                    ALGOIOT_ENDPOINT_ERROR_RATE_ONE);
+}
+
+
+// Best among those not cooling down; if all are, best overall
+uint8_t AlgoIoTEndpointPool::select()
+{
+  uint8_t best = ALGOIOT_ENDPOINT_NONE;
+  uint32_t bestScore = 0;
+
+  updateCooldowns();
+  for (uint8_t pass = 0; (pass < 2) && (best == ALGOIOT_ENDPOINT_NONE); pass++)
+  {
+    for (uint8_t i = 0; i < m_count; i++)
+    {
+      uint32_t s = 0;
+
+      if ((pass == 0) && m_endpoints[i].stats.coolingDown)
+        continue;
+      s = score(&(m_endpoints[i]));
+      if ((best == ALGOIOT_ENDPOINT_NONE) || (s < bestScore))
+      {
+        best = i;
+        bestScore = s;
+      }
+    }
+  }
+
+  return best;
+}
+
+
+const AlgoIoTEndpoint* AlgoIoTEndpointPool::get(const uint8_t index) const
+{
+  if (index >= m_count)
+    return NULL;
+
+  return &(m_endpoints[index]);
+}
+
+
+void AlgoIoTEndpointPool::report(const uint8_t index, const int httpCode, const uint32_t latencyMs)
+{
+  AlgoIoTEndpointStats* stats = NULL;
+  int32_t errorSample = 0;
+
+  if (index >= m_count)
+    return;  // Pool changed while the request was in progress
+  stats = &(m_endpoints[index].stats);
+
+  stats->requests++;
+  if (isEndpointError(httpCode))
+  {
+    stats->errors++;
+    stats->coolingDown = 1;
+    m_endpoints[index].failedMillis = millis();
+    errorSample = ALGOIOT_ENDPOINT_ERROR_RATE_ONE;
+  }
+  else if (latencyMs != ALGOIOT_ENDPOINT_NO_LATENCY)
+  {
+    int32_t sample = (latencyMs > 0) ? (int32_t)latencyMs : 1;  // 0 would read as "not measured"
+
+    if (stats->latencyMs == 0)
+      stats->latencyMs = (uint32_t)sample;  // First sample taken as it is
+    else
+      stats->latencyMs = (uint32_t)((int32_t)stats->latencyMs + ((sample - (int32_t)stats->latencyMs) >> ALGOIOT_ENDPOINT_LATENCY_SHIFT));
+  }
+  stats->errorRate = (uint16_t)((int32_t)stats->errorRate + ((errorSample - (int32_t)stats->errorRate) >> ALGOIOT_ENDPOINT_ERROR_SHIFT));
+}
+
+
+uint8_t AlgoIoTEndpointPool::failover()
+{
+  updateCooldowns();
+  for (uint8_t i = 0; i < m_count; i++)
+  {
+    if (!m_endpoints[i].stats.coolingDown)
+      return 1;
+  }
+
+  return 0;
+}
+
+
+// Retriable errors are the server's (or the path to it); 401 and 403 are this endpoint refusing our token
+uint8_t AlgoIoTEndpointPool::isEndpointError(const int httpCode)
+{
+  return (AlgoIoTRetryScheduler::classify(httpCode) == ALGOIOT_RETRY_RETRIABLE) || (httpCode == 401) || (httpCode == 403);
+}
@@ -0,0 +1,113 @@
+// algoiotendpoints.h
+// header for AlgoIoT endpoint pool: several algod servers, each request sent to the best one
+// v20261018-2
+
+// Endpoints are algod base URLs ("https://host[:port]"), each with its own optional API token (sent as
+// X-Algo-API-Token). Every request reports its outcome to the pool, which keeps per endpoint a moving
+// average of the response time and of the error rate (exponentially weighted: recent requests count most)
+// Requests go to the endpoint with the lowest expected response time, i.e. average latency inflated by
+// the error rate. An endpoint never asked yet comes first, so that each one gets measured
+// An endpoint failing (no response, 408, 429, 5xx; also 401/403: token refused) is set aside for a
+// cooldown: the very next request, retries included, goes to another one without waiting. When all of them
+// are cooling down, the best one is used anyway, and the retry backoff does the waiting
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTENDPOINTS_H
+#define __ALGOIOTENDPOINTS_H
+
+#include "algoiotplatform.h"
+#include <stdint.h>
+
+#define ALGOIOT_MAX_ENDPOINTS 4
+#define ALGOIOT_ENDPOINT_URL_CHARS 128
+#define ALGOIOT_ENDPOINT_TOKEN_CHARS 64           // algod API tokens are 64 hex chars
+#define ALGOIOT_ENDPOINT_COOLDOWN_MS 30000UL      // An endpoint failing is not asked again for this long (unless no other one is left)
+#define ALGOIOT_ENDPOINT_LATENCY_SHIFT 2          // Moving average weights: last sample counts 1/4 for latency...
+#define ALGOIOT_ENDPOINT_ERROR_SHIFT 3            // ...and 1/8 for error rate
+#define ALGOIOT_ENDPOINT_ERROR_PENALTY 4          // Expected time = latency * (1 + penalty * error rate)
+#define ALGOIOT_ENDPOINT_UNMEASURED_MS 1000UL     // Latency assumed for an endpoint that never answered
+#define ALGOIOT_ENDPOINT_NO_LATENCY 0xFFFFFFFFUL  // report(): outcome only, e.g. a long poll, slow by design
+#define ALGOIOT_ENDPOINT_NONE 0xFF
+
+// Error codes of pool operations
+#define ALGOIOT_ENDPOINT_OK 0
+#define ALGOIOT_ENDPOINT_FULL 1
+#define ALGOIOT_ENDPOINT_BAD_PARAM 2
+
+#define ALGOIOT_ENDPOINT_ERROR_RATE_ONE 1024      // Error rate unit: 1024 = every request failed
+
+
+// Statistics of an endpoint, since it was added
+typedef struct AlgoIoTEndpointStats
+{
+  uint32_t requests;     // Outcomes reported
+  uint32_t errors;       // Of which failures
+  uint32_t latencyMs;    // Moving average, over answered requests (0 = none yet)
+  uint16_t errorRate;    // Moving average of failures, in 1/ALGOIOT_ENDPOINT_ERROR_RATE_ONE
+  uint8_t coolingDown;   // Failed less than ALGOIOT_ENDPOINT_COOLDOWN_MS ago (as of last selection)
+} AlgoIoTEndpointStats;
+
+
+typedef struct AlgoIoTEndpoint
+{
+  char url[ALGOIOT_ENDPOINT_URL_CHARS + 1];         // "scheme://host[:port]", no trailing slash
+  char apiToken[ALGOIOT_ENDPOINT_TOKEN_CHARS + 1];  // "" = none
+  uint32_t failedMillis;                            // Last failure
+  AlgoIoTEndpointStats stats;
+} AlgoIoTEndpoint;
+
+
+class AlgoIoTEndpointPool
+{
+  private:
+  AlgoIoTEndpoint m_endpoints[ALGOIOT_MAX_ENDPOINTS];
+  uint8_t m_count = 0;
+
+  // Cooldown flag of each endpoint brought up to date
+  void updateCooldowns();
+
+  // Expected response time of an endpoint, for comparison only
+  uint32_t score(const AlgoIoTEndpoint* endpoint) const;
+
+  public:
+  // "url": "http://host[:port]" or "https://host[:port]" (a trailing slash is dropped); "apiToken": NULL or "" if none
+  // Both copied. Returns ALGOIOT_ENDPOINT_* error code
+  int add(const char* url, const char* apiToken);
+
+  // All endpoints removed
+  void clear();
+
+  uint8_t count() const;
+
+  // Index of the endpoint the next request is to go to (ALGOIOT_ENDPOINT_NONE if the pool is empty)
+  uint8_t select();
+
+  // Endpoint "index" (NULL if out of range)
+  const AlgoIoTEndpoint* get(const uint8_t index) const;
+
+  // Outcome of a request sent to endpoint "index": HTTP status code, or negative error code if no response
+  // was received; "latencyMs": request sent to response complete (or ALGOIOT_ENDPOINT_NO_LATENCY)
+  void report(const uint8_t index, const int httpCode, const uint32_t latencyMs);
+
+  // 1 if some endpoint is not cooling down: after a failure, the request can be sent again at once
+  uint8_t failover();
+
+  // 1 if "httpCode" (as for report()) counts as a failure of the endpoint
+  static uint8_t isEndpointError(const int httpCode);
+};
+
+#endif
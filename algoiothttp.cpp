@@ -0,0 +1,463 @@
+// algoiothttp.cpp
+// AlgoIoT non-blocking HTTP/1.1 exchange
+// v20261018-3
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "algoiothttp.h"
+
+#define HTTP_SCHEME_SEPARATOR "://"
+#define HTTP_DEFAULT_PORT 80
+#define HTTPS_DEFAULT_PORT 443
+
+
+// Case-insensitive "prefix" at start of "line"
+static uint8_t startsWithNoCase(const char* line, const char* prefix)
+{
+  while (*prefix != '\0')
+  {
+    if (tolower((unsigned char)*line) != tolower((unsigned char)*prefix))
+      return 0;
+    line++;
+    prefix++;
+  }
+
+  return 1;
+}
+
+
+// Case-insensitive "word" anywhere in "text"
+static uint8_t containsNoCase(const char* text, const char* word)
+{
+  for (; *text != '\0'; text++)
+  {
+    if (startsWithNoCase(text, word))
+      return 1;
+  }
+
+  return 0;
+}
+
+
+uint8_t AlgoIoTHttpExchange::isSecureURL(const char* url)
+{
+  return (url != NULL) && startsWithNoCase(url, "https://");
+}
+
+
+int AlgoIoTHttpExchange::begin(Client* client, const char* url, const char* method, const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs)
+{
+  const char* host = NULL;
+  const char* hostEnd = NULL;
+  const char* path = NULL;
+  uint16_t port = isSecureURL(url) ? HTTPS_DEFAULT_PORT : HTTP_DEFAULT_PORT;
+
+  if ((client == NULL) || (url == NULL) || (method == NULL) || ((body == NULL) && (bodyLength > 0)))
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+  if ((m_state != ALGOIOT_HTTP_IDLE) && (m_state != ALGOIOT_HTTP_DONE))
+    close();  // Previous exchange abandoned: its response would be read as ours
+
+  // "scheme://host[:port]/path"
+  host = strstr(url, HTTP_SCHEME_SEPARATOR);
+  if (host == NULL)
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+  host += strlen(HTTP_SCHEME_SEPARATOR);
+  path = strchr(host, '/');
+  hostEnd = (path != NULL) ? path : host + strlen(host);
+  if (path == NULL)
+    path = "/";
+  for (const char* c = host; c < hostEnd; c++)
+  {
+    if (*c == ':')
+    {
+      port = (uint16_t)atoi(c + 1);
+      hostEnd = c;
+      break;
+    }
+  }
+  if ((hostEnd == host) || ((uint32_t)(hostEnd - host) > ALGOIOT_HTTP_HOST_CHARS) || (port == 0))
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+
+  // Open connection reused only if it goes to the same server, through the same client
+  if ((client != m_client) || (port != m_port) || (strncmp(m_host, host, hostEnd - host) != 0) ||
+      (m_host[hostEnd - host] != '\0'))
+  {
+    close();
+    memcpy(m_host, host, hostEnd - host);
+    m_host[hostEnd - host] = '\0';
+    m_port = port;
+    m_client = client;
+  }
+
+  m_method = method;
+  m_path = path;
+  m_contentType = contentType;
+  m_headerName = NULL;
+  m_headerValue = NULL;
+  m_body = body;
+  m_bodyLen = bodyLength;
+  m_bodySink = NULL;
+  m_timeoutMs = timeoutMs;
+  m_status = 0;
+  m_keepAlive = 1;  // HTTP/1.1 default
+  m_chunked = 0;
+  m_hasLength = 0;
+  m_remaining = 0;
+  m_lineLen = 0;
+  m_lineCR = 0;
+  m_responseLen = 0;
+  m_response[0] = '\0';
+  m_truncated = 0;
+  m_state = m_client->connected() ? ALGOIOT_HTTP_SEND : ALGOIOT_HTTP_CONNECT;
+
+  return 0;
+}
+
+
+void AlgoIoTHttpExchange::addHeader(const char* name, const char* value)
+{
+  if ((name == NULL) || (value == NULL))
+    return;
+  m_headerName = name;
+  m_headerValue = value;
+}
+
+
+int AlgoIoTHttpExchange::sendRequest()
+{
+  char number[12];
+  uint8_t chunk[ALGOIOT_HTTP_SEND_CHUNK];
+  uint32_t sent = 0;
+
+  // Request line and headers, a few small writes: the client buffers them into as many segments
+  m_client->print(m_method);
+  m_client->print(' ');
+  m_client->print(m_path);
+  m_client->print(" HTTP/1.1\r\nHost: ");
+  m_client->print(m_host);
+  m_client->print("\r\nConnection: keep-alive\r\n");
+  if (m_headerName != NULL)
+  {
+    m_client->print(m_headerName);
+    m_client->print(": ");
+    m_client->print(m_headerValue);
+    m_client->print("\r\n");
+  }
+  if (m_body != NULL)
+  {
+    if (m_contentType != NULL)
+    {
+      m_client->print("Content-Type: ");
+      m_client->print(m_contentType);
+      m_client->print("\r\n");
+    }
+    snprintf(number, sizeof(number), "%lu", (unsigned long)m_bodyLen);
+    m_client->print("Content-Length: ");
+    m_client->print(number);
+    m_client->print("\r\n");
+  }
+  if (m_client->print("\r\n") != 2)
+    return ALGOIOT_HTTP_ERROR_SEND;
+
+  while (sent < m_bodyLen)
+  {
+    uint32_t len = m_bodyLen - sent;
+    if (len > ALGOIOT_HTTP_SEND_CHUNK)
+      len = ALGOIOT_HTTP_SEND_CHUNK;
+    len = m_body->readBytes((char*)chunk, len);
+    if ((len == 0) || (m_client->write(chunk, len) != len))
+      return ALGOIOT_HTTP_ERROR_SEND;
+    sent += len;
+  }
+  m_client->flush();
+
+  return 0;
+}
+
+
+uint8_t AlgoIoTHttpExchange::lineByte(const char c)
+{
+  if (c == '\n')
+  {
+    m_line[m_lineLen] = '\0';
+    m_lineLen = 0;
+    m_lineCR = 0;
+    return 1;
+  }
+  if (m_lineCR && (m_lineLen < ALGOIOT_HTTP_LINE_CHARS))
+    m_line[m_lineLen++] = '\r';  // Lone CR: part of the line
+  m_lineCR = (c == '\r');
+  if (!m_lineCR && (m_lineLen < ALGOIOT_HTTP_LINE_CHARS))
+    m_line[m_lineLen++] = c;
+
+  return 0;
+}
+
+
+int AlgoIoTHttpExchange::statusLine()
+{
+  // "HTTP/1.x SSS Reason"
+  if (!startsWithNoCase(m_line, "HTTP/1.") || (strlen(m_line) < 12) || (m_line[8] != ' '))
+    return ALGOIOT_HTTP_ERROR_PROTOCOL;
+  m_status = atoi(&(m_line[9]));
+  if ((m_status < 100) || (m_status > 599))
+    return ALGOIOT_HTTP_ERROR_PROTOCOL;
+  if (m_line[7] == '0')
+    m_keepAlive = 0;  // HTTP/1.0 closes, unless told otherwise
+
+  return 0;
+}
+
+
+void AlgoIoTHttpExchange::headerLine()
+{
+  if (startsWithNoCase(m_line, "content-length:"))
+  {
+    m_remaining = (uint32_t)strtoul(&(m_line[15]), NULL, 10);
+    m_hasLength = 1;
+  }
+  else if (startsWithNoCase(m_line, "transfer-encoding:"))
+  {
+    m_chunked = containsNoCase(&(m_line[18]), "chunked");
+  }
+  else if (startsWithNoCase(m_line, "connection:"))
+  {
+    if (containsNoCase(&(m_line[11]), "close"))
+      m_keepAlive = 0;
+    else if (containsNoCase(&(m_line[11]), "keep-alive"))
+      m_keepAlive = 1;
+  }
+}
+
+
+void AlgoIoTHttpExchange::setBodyStream(Stream* sink)
+{
+  m_bodySink = sink;
+}
+
+
+void AlgoIoTHttpExchange::keepBody(const uint8_t* data, const uint32_t len)
+{
+  uint32_t kept = len;
+
+  if (m_bodySink != NULL)
+  {
+    m_bodySink->write(data, len);
+    return;
+  }
+
+  if (kept > (uint32_t)(ALGOIOT_HTTP_RESPONSE_CHARS - m_responseLen))
+  {
+    kept = ALGOIOT_HTTP_RESPONSE_CHARS - m_responseLen;
+    m_truncated = 1;
+  }
+  memcpy(&(m_response[m_responseLen]), data, kept);
+  m_responseLen += kept;
+  m_response[m_responseLen] = '\0';
+}
+
+
+int AlgoIoTHttpExchange::fail(const int error)
+{
+  close();
+
+  return error;
+}
+
+
+int AlgoIoTHttpExchange::poll()
+{
+  uint8_t data[ALGOIOT_HTTP_SEND_CHUNK];
+
+  switch (m_state)
+  {
+    case ALGOIOT_HTTP_IDLE:
+      return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+
+    case ALGOIOT_HTTP_DONE:
+      return m_status;
+
+    case ALGOIOT_HTTP_CONNECT:
+    {
+      if (!m_client->connect(m_host, m_port))
+        return fail(ALGOIOT_HTTP_ERROR_CONNECT);
+      m_state = ALGOIOT_HTTP_SEND;
+      return 0;
+    }
+
+    case ALGOIOT_HTTP_SEND:
+    {
+      if (sendRequest() != 0)
+        return fail(ALGOIOT_HTTP_ERROR_SEND);
+      m_startMillis = millis();  // Response timeout counts from here
+      m_state = ALGOIOT_HTTP_STATUS;
+      return 0;
+    }
+
+    default:
+    break;
+  }
+
+  // Receiving: whatever has arrived, without waiting for more
+  while (m_client->available() > 0)
+  {
+    switch (m_state)
+    {
+      case ALGOIOT_HTTP_STATUS:
+      case ALGOIOT_HTTP_HEADERS:
+      case ALGOIOT_HTTP_CHUNK_SIZE:
+      case ALGOIOT_HTTP_CHUNK_END:
+      case ALGOIOT_HTTP_TRAILERS:
+      {
+        int c = m_client->read();
+        if (c < 0)
+          return 0;  // Announced but not there: next time
+        if (!lineByte((char)c))
+          continue;
+
+        if (m_state == ALGOIOT_HTTP_STATUS)
+        {
+          if (statusLine() != 0)
+            return fail(ALGOIOT_HTTP_ERROR_PROTOCOL);
+          m_state = ALGOIOT_HTTP_HEADERS;
+        }
+        else if (m_state == ALGOIOT_HTTP_HEADERS)
+        {
+          if (m_line[0] != '\0')
+          {
+            headerLine();
+            continue;
+          }
+          // End of headers
+          if ((m_status == 204) || (m_status == 304) || (m_status < 200) || (!m_chunked && m_hasLength && (m_remaining == 0)))
+            m_state = ALGOIOT_HTTP_DONE;
+          else
+          { // Body follows: status and headers known, a body stream can be set before it is read
+            m_state = m_chunked ? ALGOIOT_HTTP_CHUNK_SIZE : ALGOIOT_HTTP_BODY;
+            return 0;
+          }
+        }
+        else if (m_state == ALGOIOT_HTTP_CHUNK_SIZE)
+        { // Hex size, optionally followed by extensions
+          char* end = NULL;
+          m_remaining = (uint32_t)strtoul(m_line, &end, 16);
+          if (end == m_line)
+            return fail(ALGOIOT_HTTP_ERROR_PROTOCOL);
+          m_state = (m_remaining == 0) ? ALGOIOT_HTTP_TRAILERS : ALGOIOT_HTTP_CHUNK_DATA;
+        }
+        else if (m_state == ALGOIOT_HTTP_CHUNK_END)
+        {
+          m_state = ALGOIOT_HTTP_CHUNK_SIZE;
+        }
+        else if (m_line[0] == '\0')
+        { // Empty line after trailers
+          m_state = ALGOIOT_HTTP_DONE;
+        }
+      }
+      break;
+
+      case ALGOIOT_HTTP_BODY:
+      case ALGOIOT_HTTP_CHUNK_DATA:
+      {
+        uint32_t len = sizeof(data);
+        if ((m_hasLength || (m_state == ALGOIOT_HTTP_CHUNK_DATA)) && (len > m_remaining))
+          len = m_remaining;
+        int got = m_client->read(data, len);
+        if (got <= 0)
+          return 0;
+        keepBody(data, (uint32_t)got);
+        if (m_hasLength || (m_state == ALGOIOT_HTTP_CHUNK_DATA))
+        {
+          m_remaining -= (uint32_t)got;
+          if (m_remaining == 0)
+            m_state = (m_state == ALGOIOT_HTTP_BODY) ? ALGOIOT_HTTP_DONE : ALGOIOT_HTTP_CHUNK_END;
+        }
+      }
+      break;
+
+      default:
+      break;
+    }
+
+    if (m_state == ALGOIOT_HTTP_DONE)
+      break;
+  }
+
+  if (m_state == ALGOIOT_HTTP_DONE)
+  {
+    if (!m_keepAlive)
+      m_client->stop();
+    return m_status;
+  }
+
+  if (!m_client->connected())
+  { // Body without length ends with the connection; anything else is cut short
+    if ((m_state == ALGOIOT_HTTP_BODY) && !m_hasLength)
+    {
+      m_state = ALGOIOT_HTTP_DONE;
+      m_client->stop();
+      return m_status;
+    }
+    return fail(ALGOIOT_HTTP_ERROR_CONNECTION_LOST);
+  }
+  if ((millis() - m_startMillis) > m_timeoutMs)
+    return fail(ALGOIOT_HTTP_ERROR_TIMEOUT);
+
+  return 0;
+}
+
+
+int AlgoIoTHttpExchange::status() const
+{
+  return m_status;
+}
+
+
+uint8_t AlgoIoTHttpExchange::state() const
+{
+  return m_state;
+}
+
+
+const char* AlgoIoTHttpExchange::response() const
+{
+  return m_response;
+}
+
+
+uint16_t AlgoIoTHttpExchange::responseLength() const
+{
+  return m_responseLen;
+}
+
+
+uint8_t AlgoIoTHttpExchange::truncated() const
+{
+  return m_truncated;
+}
+
+
+void AlgoIoTHttpExchange::close()
+{
+  if (m_client != NULL)
+    m_client->stop();
+  m_state = ALGOIOT_HTTP_IDLE;
+}
@@ -0,0 +1,149 @@
+// algoiothttp.h
+// header for AlgoIoT non-blocking HTTP/1.1 exchange
+// v20261018-3
+
+// The blocking API waits for each response (see algoiottransport.h). For the asynchronous
+// submission (see AlgoIoT::beginSubmit()), the request is instead written on an Arduino Client (WiFiClient,
+// WiFiClientSecure; AlgoIoTSocketClient on a POSIX host) and the response is read as it arrives, whatever is available at each poll(): the sketch
+// loop() keeps running while algod answers
+// Connecting (TCP, and TLS handshake) is the one step that blocks, up to the client connect timeout: the
+// connection is kept open (keep-alive), so this happens once, not per request
+// One request at a time. Responses as algod sends them: status line, headers, then a body with Content-Length,
+// chunked, or up to connection close. Body kept in a fixed buffer (no heap); longer bodies are truncated
+// Or written to a Stream as it arrives (see setBodyStream()): the blocking transport of a POSIX host reads
+// responses so, in full, whatever their length (see algoiottransport.h)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTHTTP_H
+#define __ALGOIOTHTTP_H
+
+#include "algoiotplatform.h"
+#include <stdint.h>
+
+#define ALGOIOT_HTTP_HOST_CHARS 63
+#define ALGOIOT_HTTP_LINE_CHARS 95        // Status line and headers: longer ones are truncated (only the start matters)
+#define ALGOIOT_HTTP_RESPONSE_CHARS 511   // Response body kept; the rest is read and discarded
+#define ALGOIOT_HTTP_SEND_CHUNK 128       // Request body bytes copied to the client at once
+
+// Exchange states
+#define ALGOIOT_HTTP_IDLE 0
+#define ALGOIOT_HTTP_CONNECT 1
+#define ALGOIOT_HTTP_SEND 2
+#define ALGOIOT_HTTP_STATUS 3       // Waiting for the status line
+#define ALGOIOT_HTTP_HEADERS 4
+#define ALGOIOT_HTTP_BODY 5
+#define ALGOIOT_HTTP_CHUNK_SIZE 6
+#define ALGOIOT_HTTP_CHUNK_DATA 7
+#define ALGOIOT_HTTP_CHUNK_END 8    // CRLF after chunk data
+#define ALGOIOT_HTTP_TRAILERS 9
+#define ALGOIOT_HTTP_DONE 10
+
+// Error codes (negative, as HTTPClient ones)
+#define ALGOIOT_HTTP_ERROR_CONNECT -1
+#define ALGOIOT_HTTP_ERROR_SEND -2
+#define ALGOIOT_HTTP_ERROR_TIMEOUT -3
+#define ALGOIOT_HTTP_ERROR_CONNECTION_LOST -4
+#define ALGOIOT_HTTP_ERROR_PROTOCOL -5
+#define ALGOIOT_HTTP_ERROR_BAD_PARAM -6
+
+
+class AlgoIoTHttpExchange
+{
+  private:
+  Client* m_client = NULL;
+  char m_host[ALGOIOT_HTTP_HOST_CHARS + 1] = "";  // Server the client is connected to
+  uint16_t m_port = 0;
+  const char* m_method = NULL;
+  const char* m_path = NULL;
+  const char* m_contentType = NULL;
+  const char* m_headerName = NULL;   // Extra header, if any (see addHeader())
+  const char* m_headerValue = NULL;
+  Stream* m_body = NULL;
+  uint32_t m_bodyLen = 0;
+  Stream* m_bodySink = NULL;         // Response body written here instead of kept (see setBodyStream())
+  uint32_t m_timeoutMs = 0;
+  uint32_t m_startMillis = 0;
+  uint8_t m_state = ALGOIOT_HTTP_IDLE;
+  int m_status = 0;
+  uint8_t m_keepAlive = 0;
+  uint8_t m_chunked = 0;
+  uint8_t m_hasLength = 0;
+  uint32_t m_remaining = 0;   // Body (or chunk) bytes still to be read
+  char m_line[ALGOIOT_HTTP_LINE_CHARS + 1];
+  uint16_t m_lineLen = 0;
+  uint8_t m_lineCR = 0;
+  char m_response[ALGOIOT_HTTP_RESPONSE_CHARS + 1];
+  uint16_t m_responseLen = 0;
+  uint8_t m_truncated = 0;
+
+  // Sends request line, headers and body. Returns error code (0 = OK)
+  int sendRequest();
+
+  // Adds a received byte to the current line. Returns 1 when the line is complete (CRLF or LF removed)
+  uint8_t lineByte(const char c);
+
+  // Handles a complete status or header line. Returns error code (0 = OK)
+  int statusLine();
+  void headerLine();
+
+  // Keeps (or discards, past the buffer) received body bytes, or writes them to the body stream
+  void keepBody(const uint8_t* data, const uint32_t len);
+
+  // Ends the exchange with an error: connection closed, as its state is unknown. Returns "error"
+  int fail(const int error);
+
+  public:
+  // Starts a request on "client" (not owned). "url": "http://host[:port]/path" or "https://...", not copied:
+  // it has to stay valid until the exchange is over; same for "contentType" and "body" ("bodyLength" bytes; NULL if none)
+  // An open connection to the same server is reused; otherwise, it is closed and a new one is opened
+  // "timeoutMs": from request sent to response complete
+  // Returns error code (0 = OK)
+  int begin(Client* client, const char* url, const char* method, const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs);
+
+  // One more request header (e.g. an API token), after begin() and before the first poll(). Not copied, as "url"
+  void addHeader(const char* name, const char* value);
+
+  // Response body written to "sink" (not owned) as it arrives, instead of being kept (response() stays empty)
+  // Set once the headers are read (state() past ALGOIOT_HTTP_HEADERS), e.g. according to status(); poll() returns
+  // as soon as they are, before reading any body byte. Reset by begin()
+  void setBodyStream(Stream* sink);
+
+  // Advances the exchange by one step: connect, or send, or read what has arrived (never waits for more)
+  // Returns 0 while in progress, then the HTTP status code once the response is complete, or a negative error code
+  int poll();
+
+  // HTTP status code, once the status line is read (0 before)
+  int status() const;
+
+  // ALGOIOT_HTTP_* state
+  uint8_t state() const;
+
+  // Response body (null-terminated), once complete
+  const char* response() const;
+  uint16_t responseLength() const;
+
+  // Body was longer than ALGOIOT_HTTP_RESPONSE_CHARS
+  uint8_t truncated() const;
+
+  // Closes the connection (e.g. before deep sleep). An exchange in progress is abandoned
+  void close();
+
+  // Scheme of "url" is https
+  static uint8_t isSecureURL(const char* url);
+};
+
+#endif
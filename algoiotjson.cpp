@@ -0,0 +1,321 @@
+// algoiotjson.cpp
+// AlgoIoT JSON scanner
+// v20261018-2
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "algoiotjson.h"
+
+
+static uint8_t isJsonSpace(const char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+
+
+int8_t AlgoIoTJsonScanner::watch(const char* key, char* value, const uint16_t size)
+{
+  AlgoIoTJsonField* field = NULL;
+
+  if ((key == NULL) || (value == NULL) || (size == 0) || (m_nFields >= ALGOIOT_JSON_MAX_FIELDS))
+    return -1;
+
+  field = &(m_fields[m_nFields]);
+  field->key = key;
+  field->value = value;
+  field->size = size;
+  field->len = 0;
+  field->found = 0;
+  field->truncated = 0;
+  value[0] = '\0';
+
+  return (int8_t)(m_nFields++);
+}
+
+
+void AlgoIoTJsonScanner::keyChar(const char c)
+{
+  if (m_keyLen < ALGOIOT_JSON_KEY_CHARS)
+    m_key[m_keyLen++] = c;
+  else
+    m_keyOverflow = 1;
+}
+
+
+void AlgoIoTJsonScanner::valueChar(const char c)
+{
+  AlgoIoTJsonField* field = NULL;
+
+  if (m_capture < 0)
+    return;
+  field = &(m_fields[m_capture]);
+  if (field->len < field->size - 1)
+    field->value[field->len++] = c;
+  else
+    field->truncated = 1;
+}
+
+
+void AlgoIoTJsonScanner::startValue()
+{
+  m_capture = -1;
+  if (m_keyOverflow)
+    return;
+  for (uint8_t i = 0; i < m_nFields; i++)
+  {
+    if (strcmp(m_key, m_fields[i].key) == 0)
+    {
+      m_capture = (int8_t)i;
+      m_fields[i].len = 0;  // Key repeated: last value wins, as for most parsers
+      m_fields[i].truncated = 0;
+      m_fields[i].found = 0;
+      break;
+    }
+  }
+}
+
+
+void AlgoIoTJsonScanner::endValue()
+{
+  if (m_capture < 0)
+    return;
+  m_fields[m_capture].value[m_fields[m_capture].len] = '\0';
+  m_fields[m_capture].found = 1;
+  m_capture = -1;
+}
+
+
+// Top-level object only: the scanner follows its keys and values; anything nested is counted, not read
+size_t AlgoIoTJsonScanner::write(uint8_t data)
+{
+  char c = (char)data;
+
+  switch (m_state)
+  {
+    case ALGOIOT_JSON_SCAN_START:
+      if (c == '{')
+        m_state = ALGOIOT_JSON_SCAN_KEY_EXPECTED;
+      else if (!isJsonSpace(c))
+        m_state = ALGOIOT_JSON_SCAN_ERROR;  // e.g. an HTML error page from a proxy
+      break;
+
+    case ALGOIOT_JSON_SCAN_KEY_EXPECTED:
+      if (c == '"')
+      {
+        m_keyLen = 0;
+        m_keyOverflow = 0;
+        m_state = ALGOIOT_JSON_SCAN_KEY;
+      }
+      else if (c == '}')
+        m_state = ALGOIOT_JSON_SCAN_DONE;
+      else if (!isJsonSpace(c))
+        m_state = ALGOIOT_JSON_SCAN_ERROR;
+      break;
+
+    case ALGOIOT_JSON_SCAN_KEY:
+      if (m_escape)
+      {
+        m_escape = 0;
+        keyChar(c);
+      }
+      else if (c == '\\')
+        m_escape = 1;
+      else if (c == '"')
+      {
+        m_key[m_keyLen] = '\0';
+        m_state = ALGOIOT_JSON_SCAN_COLON;
+      }
+      else
+        keyChar(c);
+      break;
+
+    case ALGOIOT_JSON_SCAN_COLON:
+      if (c == ':')
+      {
+        startValue();
+        m_state = ALGOIOT_JSON_SCAN_VALUE_EXPECTED;
+      }
+      else if (!isJsonSpace(c))
+        m_state = ALGOIOT_JSON_SCAN_ERROR;
+      break;
+
+    case ALGOIOT_JSON_SCAN_VALUE_EXPECTED:
+      if (isJsonSpace(c))
+        break;
+      if (c == '"')
+        m_state = ALGOIOT_JSON_SCAN_STRING_VALUE;
+      else if ((c == '{') || (c == '['))
+      { // Not a value AlgoIoT reads: skipped
+        m_capture = -1;
+        m_depth = 1;
+        m_inString = 0;
+        m_state = ALGOIOT_JSON_SCAN_NESTED;
+      }
+      else if ((c == ',') || (c == '}') || (c == ']') || (c == ':'))
+        m_state = ALGOIOT_JSON_SCAN_ERROR;
+      else
+      {
+        m_state = ALGOIOT_JSON_SCAN_BARE_VALUE;
+        valueChar(c);
+      }
+      break;
+
+    case ALGOIOT_JSON_SCAN_STRING_VALUE:
+      if (m_escape)
+      {
+        m_escape = 0;
+        valueChar(c);
+      }
+      else if (c == '\\')
+        m_escape = 1;
+      else if (c == '"')
+      {
+        endValue();
+        m_state = ALGOIOT_JSON_SCAN_AFTER_VALUE;
+      }
+      else
+        valueChar(c);
+      break;
+
+    case ALGOIOT_JSON_SCAN_BARE_VALUE:
+      if (c == ',')
+      {
+        endValue();
+        m_state = ALGOIOT_JSON_SCAN_KEY_EXPECTED;
+      }
+      else if (c == '}')
+      {
+        endValue();
+        m_state = ALGOIOT_JSON_SCAN_DONE;
+      }
+      else if (isJsonSpace(c))
+      {
+        endValue();
+        m_state = ALGOIOT_JSON_SCAN_AFTER_VALUE;
+      }
+      else
+        valueChar(c);
+      break;
+
+    case ALGOIOT_JSON_SCAN_NESTED:
+      if (m_inString)
+      {
+        if (m_escape)
+          m_escape = 0;
+        else if (c == '\\')
+          m_escape = 1;
+        else if (c == '"')
+          m_inString = 0;
+      }
+      else if (c == '"')
+        m_inString = 1;
+      else if ((c == '{') || (c == '['))
+        m_depth++;
+      else if ((c == '}') || (c == ']'))
+      {
+        m_depth--;
+        if (m_depth == 0)
+          m_state = ALGOIOT_JSON_SCAN_AFTER_VALUE;
+      }
+      break;
+
+    case ALGOIOT_JSON_SCAN_AFTER_VALUE:
+      if (c == ',')
+        m_state = ALGOIOT_JSON_SCAN_KEY_EXPECTED;
+      else if (c == '}')
+        m_state = ALGOIOT_JSON_SCAN_DONE;
+      else if (!isJsonSpace(c))
+        m_state = ALGOIOT_JSON_SCAN_ERROR;
+      break;
+
+    default:  // ALGOIOT_JSON_SCAN_DONE, ALGOIOT_JSON_SCAN_ERROR
+      break;
+  }
+
+  return 1;
+}
+
+
+size_t AlgoIoTJsonScanner::write(const uint8_t* buffer, size_t len)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    write(buffer[i]);
+  }
+
+  return len;
+}
+
+
+int AlgoIoTJsonScanner::available()
+{
+  return 0;
+}
+
+
+int AlgoIoTJsonScanner::read()
+{
+  return -1;
+}
+
+
+int AlgoIoTJsonScanner::peek()
+{
+  return -1;
+}
+
+
+uint8_t AlgoIoTJsonScanner::found(const int8_t index) const
+{
+  return (index >= 0) && (index < m_nFields) && m_fields[index].found;
+}
+
+
+uint8_t AlgoIoTJsonScanner::truncated(const int8_t index) const
+{
+  return (index >= 0) && (index < m_nFields) && m_fields[index].truncated;
+}
+
+
+uint8_t AlgoIoTJsonScanner::complete() const
+{
+  return m_state == ALGOIOT_JSON_SCAN_DONE;
+}
+
+
+uint8_t AlgoIoTJsonScanner::toUInt64(const char* text, uint64_t* value)
+{
+  uint64_t v = 0;
+  uint8_t n = 0;
+
+  if ((text == NULL) || (value == NULL))
+    return 0;
+  for (n = 0; text[n] != '\0'; n++)
+  {
+    if ((text[n] < '0') || (text[n] > '9') || (n >= ALGOIOT_JSON_NUMBER_CHARS))
+      return 0;
+    if (v > (0xFFFFFFFFFFFFFFFFULL - (uint64_t)(text[n] - '0')) / 10)
+      return 0;  // Overflow
+    v = v * 10 + (uint64_t)(text[n] - '0');
+  }
+  if (n == 0)
+    return 0;
+  *value = v;
+
+  return 1;
+}
@@ -0,0 +1,113 @@
+// algoiotjson.h
+// header for AlgoIoT JSON scanner: a few fields read from algod responses as they stream in
+// v20261018-3
+
+// algod responses are JSON objects of which AlgoIoT needs one or two top-level fields ("last-round", "min-fee",
+// "txId", ...). Instead of keeping the whole body and parsing it into a document sized by trial and error, the
+// body is written to the scanner byte by byte (it is a write-only Stream: the transport feeds it, chunked or not,
+// see AlgoIoTTransport::readBody()), and only the values of the watched keys are copied, each into a buffer
+// of the caller
+// Fixed memory, whatever the response size: the current key, and the state of the scan. Nested objects and arrays
+// (e.g. the whole transaction in a pending transaction response) are skipped, so their keys never match
+// A value counts as found only once it is complete (closing quote, or delimiter after a number): a body cut short
+// never yields a partial value. Escapes are kept as the escaped char (\" gives "): enough for algod's fields
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTJSON_H
+#define __ALGOIOTJSON_H
+
+#include "algoiotplatform.h"
+#include <stdint.h>
+
+#define ALGOIOT_JSON_MAX_FIELDS 4
+#define ALGOIOT_JSON_KEY_CHARS 31       // Longer keys are not watched ones: skipped
+#define ALGOIOT_JSON_NUMBER_CHARS 20    // Digits of a uint64_t
+
+// Scan states
+#define ALGOIOT_JSON_SCAN_START 0       // Before the opening brace
+#define ALGOIOT_JSON_SCAN_KEY_EXPECTED 1
+#define ALGOIOT_JSON_SCAN_KEY 2
+#define ALGOIOT_JSON_SCAN_COLON 3
+#define ALGOIOT_JSON_SCAN_VALUE_EXPECTED 4
+#define ALGOIOT_JSON_SCAN_STRING_VALUE 5
+#define ALGOIOT_JSON_SCAN_BARE_VALUE 6  // Number, true, false, null
+#define ALGOIOT_JSON_SCAN_NESTED 7      // Object or array value, skipped
+#define ALGOIOT_JSON_SCAN_AFTER_VALUE 8
+#define ALGOIOT_JSON_SCAN_DONE 9        // Closing brace seen: later bytes ignored
+#define ALGOIOT_JSON_SCAN_ERROR 10      // Not a JSON object: later bytes ignored
+
+
+typedef struct AlgoIoTJsonField
+{
+  const char* key;     // Not copied
+  char* value;         // Caller buffer of "size" chars, null-terminated
+  uint16_t size;
+  uint16_t len;
+  uint8_t found;
+  uint8_t truncated;   // Value longer than the buffer: the start of it is kept
+} AlgoIoTJsonField;
+
+
+class AlgoIoTJsonScanner : public Stream
+{
+  private:
+  AlgoIoTJsonField m_fields[ALGOIOT_JSON_MAX_FIELDS];
+  uint8_t m_nFields = 0;
+  char m_key[ALGOIOT_JSON_KEY_CHARS + 1];
+  uint8_t m_keyLen = 0;
+  uint8_t m_keyOverflow = 0;
+  uint8_t m_state = ALGOIOT_JSON_SCAN_START;
+  uint8_t m_escape = 0;
+  uint8_t m_inString = 0;        // ALGOIOT_JSON_SCAN_NESTED: inside a string, where braces do not count
+  uint16_t m_depth = 0;          // ALGOIOT_JSON_SCAN_NESTED: nesting level of the skipped value
+  int8_t m_capture = -1;         // Field whose value is being read (-1 = none)
+
+  void keyChar(const char c);
+  void valueChar(const char c);
+
+  // Value of the current key starts (field found by key), or ends (field found)
+  void startValue();
+  void endValue();
+
+  public:
+  // Value of top-level "key" (not copied) to be copied into "value" ("size" chars, null included) as it streams in
+  // "value" is "" until the key is met, and valid once found() (a value cut short is left unterminated)
+  // Returns its index for found(), or -1 if ALGOIOT_JSON_MAX_FIELDS are watched already
+  int8_t watch(const char* key, char* value, const uint16_t size);
+
+  // Body bytes, in order. Always accepted (returns "len"): the scanner never stops a stream
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t* buffer, size_t len);
+  using Print::write;
+
+  // Write-only: nothing to read
+  virtual int available();
+  virtual int read();
+  virtual int peek();
+
+  // Value of watched field "index" read completely
+  uint8_t found(const int8_t index) const;
+  uint8_t truncated(const int8_t index) const;
+
+  // Whole object read (closing brace seen)
+  uint8_t complete() const;
+
+  // Decimal unsigned integer "text" (as from a field) into "value". Returns 1 if valid
+  static uint8_t toUInt64(const char* text, uint64_t* value);
+};
+
+#endif
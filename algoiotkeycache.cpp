@@ -0,0 +1,254 @@
+// algoiotkeycache.cpp
+// AlgoIoT key material cache
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "algoiotkeycache.h"
+#include "algosha512.h"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #define ALGOIOT_KEY_CACHE_POSIX
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <Preferences.h>
+  #define ALGOIOT_KEY_CACHE_NVS_KEY "keys"
+#endif
+
+#define ALGOIOT_KEY_CACHE_TMP_SUFFIX ".tmp"
+
+
+// Check: SHA-512/256 of every field before it
+static void keyRecordCheck(const AlgoIoTKeyRecord* record, uint8_t check[ALGOIOT_KEY_CHECK_BYTES])
+{
+  AlgoSHA512 hash;
+  uint8_t digest[SHA512_256_HASH_BYTES];
+
+  hash.resetSHA512_256();
+  hash.update(record, offsetof(AlgoIoTKeyRecord, check));
+  hash.finalize(digest, SHA512_256_HASH_BYTES);
+  memcpy(check, digest, ALGOIOT_KEY_CHECK_BYTES);
+}
+
+
+static void keyFingerprint(const char* mnemonicWords, uint8_t fingerprint[ALGOIOT_KEY_FINGERPRINT_BYTES])
+{
+  AlgoSHA512 hash;
+
+  hash.resetSHA512_256();
+  hash.update(mnemonicWords, strlen(mnemonicWords));
+  hash.finalize(fingerprint, ALGOIOT_KEY_FINGERPRINT_BYTES);
+}
+
+
+void AlgoIoTKeyCache::seal(AlgoIoTKeyRecord* record, const char* mnemonicWords)
+{
+  record->version = ALGOIOT_KEY_RECORD_VERSION;
+  keyFingerprint(mnemonicWords, record->fingerprint);
+  keyRecordCheck(record, record->check);
+}
+
+
+bool AlgoIoTKeyCache::isValidFor(const AlgoIoTKeyRecord* record, const char* mnemonicWords)
+{
+  uint8_t expected[ALGOIOT_KEY_FINGERPRINT_BYTES];
+  uint8_t diff = 0;
+
+  if ((record == NULL) || (mnemonicWords == NULL) || (record->version != ALGOIOT_KEY_RECORD_VERSION))
+    return false;
+
+  keyRecordCheck(record, expected);
+  if (memcmp(expected, record->check, ALGOIOT_KEY_CHECK_BYTES) != 0)
+    return false;
+
+  // Fingerprint of the mnemonic words is secret-derived: compared without early exit
+  keyFingerprint(mnemonicWords, expected);
+  for (uint8_t i = 0; i < ALGOIOT_KEY_FINGERPRINT_BYTES; i++)
+  {
+    diff |= expected[i] ^ record->fingerprint[i];
+  }
+  memset(expected, 0, sizeof(expected));
+
+  return (diff == 0);
+}
+
+
+///////////////////////////////
+// File cache
+///////////////////////////////
+
+AlgoIoTFileKeyCache::AlgoIoTFileKeyCache(const char* path)
+{
+  m_path[0] = '\0';
+  if ((path != NULL) && (strlen(path) <= ALGOIOT_KEY_CACHE_PATH_CHARS))
+    strcpy(m_path, path);
+}
+
+
+int AlgoIoTFileKeyCache::load(AlgoIoTKeyRecord* record)
+{
+  FILE* file = NULL;
+  size_t readBytes = 0;
+
+  if ((record == NULL) || (m_path[0] == '\0'))
+    return ALGOIOT_KEY_CACHE_NOT_FOUND;
+
+  file = fopen(m_path, "rb");
+  if (file == NULL)
+    return ALGOIOT_KEY_CACHE_NOT_FOUND;
+  readBytes = fread(record, 1, sizeof(AlgoIoTKeyRecord), file);
+  fclose(file);
+
+  return (readBytes == sizeof(AlgoIoTKeyRecord)) ? ALGOIOT_KEY_CACHE_OK : ALGOIOT_KEY_CACHE_NOT_FOUND;
+}
+
+
+int AlgoIoTFileKeyCache::store(const AlgoIoTKeyRecord* record)
+{
+  char tmpPath[ALGOIOT_KEY_CACHE_PATH_CHARS + sizeof(ALGOIOT_KEY_CACHE_TMP_SUFFIX)];
+  FILE* file = NULL;
+  int iErr = 0;
+
+  if ((record == NULL) || (m_path[0] == '\0'))
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+
+  strcpy(tmpPath, m_path);
+  strcat(tmpPath, ALGOIOT_KEY_CACHE_TMP_SUFFIX);
+
+#ifdef ALGOIOT_KEY_CACHE_POSIX
+  // Created owner-only from the start: no window in which the key is readable by others
+  int fd = open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0)
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  file = fdopen(fd, "wb");
+  if (file == NULL)
+  {
+    close(fd);
+    remove(tmpPath);
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  }
+#else
+  file = fopen(tmpPath, "wb");
+  if (file == NULL)
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+#endif
+
+  if (fwrite(record, 1, sizeof(AlgoIoTKeyRecord), file) != sizeof(AlgoIoTKeyRecord))
+    iErr = ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  if (fflush(file) != 0)
+    iErr = ALGOIOT_KEY_CACHE_WRITE_ERROR;
+#ifdef ALGOIOT_KEY_CACHE_POSIX
+  if (fsync(fileno(file)) != 0)
+    iErr = ALGOIOT_KEY_CACHE_WRITE_ERROR;
+#endif
+  if (fclose(file) != 0)
+    iErr = ALGOIOT_KEY_CACHE_WRITE_ERROR;
+
+  if ((iErr == 0) && (rename(tmpPath, m_path) != 0))
+    iErr = ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  if (iErr)
+    remove(tmpPath);
+
+  return iErr;
+}
+
+
+int AlgoIoTFileKeyCache::erase()
+{
+  FILE* file = NULL;
+
+  if (m_path[0] == '\0')
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  if (remove(m_path) == 0)
+    return ALGOIOT_KEY_CACHE_OK;
+
+  // Not removed: fine if there was no file
+  file = fopen(m_path, "rb");
+  if (file == NULL)
+    return ALGOIOT_KEY_CACHE_OK;
+  fclose(file);
+
+  return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+}
+
+
+///////////////////////////////
+// NVS cache (ESP32)
+///////////////////////////////
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+AlgoIoTNvsKeyCache::AlgoIoTNvsKeyCache(const char* nvsNamespace)
+{
+  m_namespace = nvsNamespace;
+}
+
+
+int AlgoIoTNvsKeyCache::load(AlgoIoTKeyRecord* record)
+{
+  Preferences prefs;
+  size_t readBytes = 0;
+
+  if (record == NULL)
+    return ALGOIOT_KEY_CACHE_NOT_FOUND;
+
+  // Read-only open fails if the namespace was never written
+  if (!prefs.begin(m_namespace, true))
+    return ALGOIOT_KEY_CACHE_NOT_FOUND;
+  readBytes = prefs.getBytes(ALGOIOT_KEY_CACHE_NVS_KEY, record, sizeof(AlgoIoTKeyRecord));
+  prefs.end();
+
+  return (readBytes == sizeof(AlgoIoTKeyRecord)) ? ALGOIOT_KEY_CACHE_OK : ALGOIOT_KEY_CACHE_NOT_FOUND;
+}
+
+
+int AlgoIoTNvsKeyCache::store(const AlgoIoTKeyRecord* record)
+{
+  Preferences prefs;
+  size_t writtenBytes = 0;
+
+  if (record == NULL)
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+
+  if (!prefs.begin(m_namespace, false))
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  writtenBytes = prefs.putBytes(ALGOIOT_KEY_CACHE_NVS_KEY, record, sizeof(AlgoIoTKeyRecord));
+  prefs.end();
+
+  return (writtenBytes == sizeof(AlgoIoTKeyRecord)) ? ALGOIOT_KEY_CACHE_OK : ALGOIOT_KEY_CACHE_WRITE_ERROR;
+}
+
+
+int AlgoIoTNvsKeyCache::erase()
+{
+  Preferences prefs;
+
+  if (!prefs.begin(m_namespace, false))
+    return ALGOIOT_KEY_CACHE_WRITE_ERROR;
+  prefs.remove(ALGOIOT_KEY_CACHE_NVS_KEY);
+  prefs.end();
+
+  return ALGOIOT_KEY_CACHE_OK;
+}
+
+#endif
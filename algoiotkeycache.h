@@ -0,0 +1,114 @@
+// algoiotkeycache.h
+// header for AlgoIoT key material cache
+// v20261018-1
+
+// Deriving the keys from the mnemonic words (word lookup, SHA-512, one scalar multiplication) is most of
+// AlgoIoT::begin() time. A key cache keeps the derived public key and expanded signing key in non-volatile
+// storage, so that later boots (e.g. every wake-up from deep sleep) just read them back
+// Records are bound to the mnemonic words (fingerprint) and checksummed: a record saved for other words,
+// or corrupted, is ignored and replaced
+// NOTE: records hold the signing key in clear, as the mnemonic words in the sketch are. On production
+// devices, enable flash / NVS encryption; on Linux, the file is created readable by its owner only
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTKEYCACHE_H
+#define __ALGOIOTKEYCACHE_H
+
+#include <stdint.h>
+#include "algoed25519.h"
+
+#define ALGOIOT_KEY_RECORD_VERSION 1
+#define ALGOIOT_KEY_FINGERPRINT_BYTES 32
+#define ALGOIOT_KEY_CHECK_BYTES 8
+#define ALGOIOT_KEY_CACHE_PATH_CHARS 127
+#define ALGOIOT_KEY_CACHE_NVS_NAMESPACE "algoiot"
+
+// Error codes of cache operations
+#define ALGOIOT_KEY_CACHE_OK 0
+#define ALGOIOT_KEY_CACHE_NOT_FOUND 1
+#define ALGOIOT_KEY_CACHE_WRITE_ERROR 2
+
+
+// Derived key material, as stored by a key cache. Byte arrays only (plus one word): no padding
+typedef struct AlgoIoTKeyRecord
+{
+  uint32_t version;                                     // ALGOIOT_KEY_RECORD_VERSION
+  uint8_t fingerprint[ALGOIOT_KEY_FINGERPRINT_BYTES];   // SHA-512/256 of the mnemonic words
+  uint8_t publicKey[ED25519_KEY_BYTES];
+  uint8_t signingKey[ED25519_EXPANDED_KEY_BYTES];       // See AlgoEd25519::expandPrivateKey()
+  uint8_t check[ALGOIOT_KEY_CHECK_BYTES];               // SHA-512/256 of the fields above, truncated
+} AlgoIoTKeyRecord;
+
+
+// Storage of one key record. Implementations only move bytes: validation is done here, once for all
+class AlgoIoTKeyCache
+{
+  public:
+  virtual ~AlgoIoTKeyCache() {}
+
+  // Reads the record, if any. Returns error code (ALGOIOT_KEY_CACHE_OK = a record was read)
+  virtual int load(AlgoIoTKeyRecord* record) = 0;
+
+  // Writes (replaces) the record. Returns error code (ALGOIOT_KEY_CACHE_OK = OK)
+  virtual int store(const AlgoIoTKeyRecord* record) = 0;
+
+  // Deletes the record. Returns error code (ALGOIOT_KEY_CACHE_OK = OK)
+  virtual int erase() = 0;
+
+  // Fills version, fingerprint and check of a record whose keys are set
+  static void seal(AlgoIoTKeyRecord* record, const char* mnemonicWords);
+
+  // True if record was sealed for these mnemonic words, and is intact
+  static bool isValidFor(const AlgoIoTKeyRecord* record, const char* mnemonicWords);
+};
+
+
+// Record in a file: on Linux, or on the ESP32 with a mounted file system (SPIFFS, LittleFS, SD)
+// Replaced atomically (temporary file, then rename)
+class AlgoIoTFileKeyCache : public AlgoIoTKeyCache
+{
+  private:
+  char m_path[ALGOIOT_KEY_CACHE_PATH_CHARS + 1];
+
+  public:
+  // "path" max ALGOIOT_KEY_CACHE_PATH_CHARS chars (longer paths make every operation fail)
+  AlgoIoTFileKeyCache(const char* path);
+
+  virtual int load(AlgoIoTKeyRecord* record);
+  virtual int store(const AlgoIoTKeyRecord* record);
+  virtual int erase();
+};
+
+
+#if defined(ARDUINO_ARCH_ESP32)
+// Record in NVS (ESP32 non-volatile storage, via the Preferences library), one blob in its own namespace
+class AlgoIoTNvsKeyCache : public AlgoIoTKeyCache
+{
+  private:
+  const char* m_namespace;
+
+  public:
+  // "nvsNamespace" max 15 chars; string not copied
+  AlgoIoTNvsKeyCache(const char* nvsNamespace = ALGOIOT_KEY_CACHE_NVS_NAMESPACE);
+
+  virtual int load(AlgoIoTKeyRecord* record);
+  virtual int store(const AlgoIoTKeyRecord* record);
+  virtual int erase();
+};
+#endif
+
+#endif
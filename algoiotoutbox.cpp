@@ -0,0 +1,504 @@
+// algoiotoutbox.cpp
+// AlgoIoT outbox: signed transactions kept in non-volatile storage until submitted
+// v20261018-3
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "algoiotoutbox.h"
+#include "algosha512.h"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #define ALGOIOT_OUTBOX_POSIX
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32)
+  #include <esp_partition.h>
+#endif
+
+#define ALGOIOT_OUTBOX_READ_CHUNK 256  // Payload bytes hashed per storage read, when checking a record
+
+
+// Checksum fields, as hashed: sequence, lastValid and length are contiguous in the header
+#define OUTBOX_HASHED_FIELDS_OFFSET offsetof(AlgoIoTOutboxHeader, sequence)
+#define OUTBOX_HASHED_FIELDS_BYTES (offsetof(AlgoIoTOutboxHeader, check) - offsetof(AlgoIoTOutboxHeader, sequence))
+
+
+///////////////////////////////
+// File storage (POSIX)
+///////////////////////////////
+
+#ifdef ALGOIOT_OUTBOX_POSIX
+
+AlgoIoTFileOutboxStorage::AlgoIoTFileOutboxStorage(const char* path, const uint32_t slots)
+{
+  m_path[0] = '\0';
+  if ((path != NULL) && (strlen(path) <= ALGOIOT_OUTBOX_PATH_CHARS))
+    strcpy(m_path, path);
+  m_slots = slots;
+  m_fd = -1;
+  m_map = NULL;
+}
+
+
+AlgoIoTFileOutboxStorage::~AlgoIoTFileOutboxStorage()
+{
+  if (m_map != NULL)
+    munmap(m_map, (size_t)m_slots * ALGOIOT_OUTBOX_SLOT_BYTES);
+  if (m_fd >= 0)
+    close(m_fd);
+}
+
+
+int AlgoIoTFileOutboxStorage::map()
+{
+  struct stat fileStat;
+  const size_t size = (size_t)m_slots * ALGOIOT_OUTBOX_SLOT_BYTES;
+  void* mapped = NULL;
+
+  if (m_map != NULL)
+    return ALGOIOT_OUTBOX_OK;
+  if ((m_path[0] == '\0') || (m_slots == 0))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  m_fd = open(m_path, O_RDWR | O_CREAT, 0600);
+  if (m_fd < 0)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  // A new (or shorter) file is extended with zeros: no valid magic, so those slots read as free
+  if ((fstat(m_fd, &fileStat) != 0) ||
+      (((size_t)fileStat.st_size < size) && (ftruncate(m_fd, (off_t)size) != 0)))
+  {
+    close(m_fd);
+    m_fd = -1;
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  }
+
+  mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (mapped == MAP_FAILED)
+  {
+    close(m_fd);
+    m_fd = -1;
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  }
+  m_map = (uint8_t*)mapped;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+uint32_t AlgoIoTFileOutboxStorage::slotCount()
+{
+  return (map() == ALGOIOT_OUTBOX_OK) ? m_slots : 0;
+}
+
+
+int AlgoIoTFileOutboxStorage::eraseSlot(const uint32_t slot)
+{
+  uint8_t* slotStart = NULL;
+
+  if ((map() != ALGOIOT_OUTBOX_OK) || (slot >= m_slots))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  // Slots are page-aligned (4 KB), so a slot can be synced on its own
+  slotStart = m_map + (size_t)slot * ALGOIOT_OUTBOX_SLOT_BYTES;
+  memset(slotStart, 0xFF, ALGOIOT_OUTBOX_SLOT_BYTES);
+  if (msync(slotStart, ALGOIOT_OUTBOX_SLOT_BYTES, MS_SYNC) != 0)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTFileOutboxStorage::write(const uint32_t slot, const uint32_t offset, const void* data, const uint32_t len)
+{
+  uint8_t* slotStart = NULL;
+
+  if ((map() != ALGOIOT_OUTBOX_OK) || (slot >= m_slots) || (data == NULL) ||
+      (offset > ALGOIOT_OUTBOX_SLOT_BYTES) || (len > ALGOIOT_OUTBOX_SLOT_BYTES - offset))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  slotStart = m_map + (size_t)slot * ALGOIOT_OUTBOX_SLOT_BYTES;
+  memcpy(slotStart + offset, data, len);
+  if (msync(slotStart, ALGOIOT_OUTBOX_SLOT_BYTES, MS_SYNC) != 0)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTFileOutboxStorage::read(const uint32_t slot, const uint32_t offset, void* data, const uint32_t len)
+{
+  if ((map() != ALGOIOT_OUTBOX_OK) || (slot >= m_slots) || (data == NULL) ||
+      (offset > ALGOIOT_OUTBOX_SLOT_BYTES) || (len > ALGOIOT_OUTBOX_SLOT_BYTES - offset))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  memcpy(data, m_map + (size_t)slot * ALGOIOT_OUTBOX_SLOT_BYTES + offset, len);
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+#endif
+
+
+///////////////////////////////
+// Partition storage (ESP32)
+///////////////////////////////
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+AlgoIoTPartitionOutboxStorage::AlgoIoTPartitionOutboxStorage(const char* label)
+{
+  m_label = label;
+  m_partition = NULL;
+}
+
+
+// An encrypted partition cannot take the single-byte state commits
+int AlgoIoTPartitionOutboxStorage::find()
+{
+  if (m_partition == NULL)
+    m_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, m_label);
+  if ((m_partition != NULL) && ((const esp_partition_t*)m_partition)->encrypted)
+    m_partition = NULL;
+
+  return (m_partition != NULL) ? ALGOIOT_OUTBOX_OK : ALGOIOT_OUTBOX_STORAGE_ERROR;
+}
+
+
+uint32_t AlgoIoTPartitionOutboxStorage::slotCount()
+{
+  if (find() != ALGOIOT_OUTBOX_OK)
+    return 0;
+
+  return ((const esp_partition_t*)m_partition)->size / ALGOIOT_OUTBOX_SLOT_BYTES;
+}
+
+
+int AlgoIoTPartitionOutboxStorage::eraseSlot(const uint32_t slot)
+{
+  if ((find() != ALGOIOT_OUTBOX_OK) || (slot >= slotCount()))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  if (esp_partition_erase_range((const esp_partition_t*)m_partition, slot * ALGOIOT_OUTBOX_SLOT_BYTES, ALGOIOT_OUTBOX_SLOT_BYTES) != ESP_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTPartitionOutboxStorage::write(const uint32_t slot, const uint32_t offset, const void* data, const uint32_t len)
+{
+  if ((find() != ALGOIOT_OUTBOX_OK) || (slot >= slotCount()) || (data == NULL) ||
+      (offset > ALGOIOT_OUTBOX_SLOT_BYTES) || (len > ALGOIOT_OUTBOX_SLOT_BYTES - offset))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  if (esp_partition_write((const esp_partition_t*)m_partition, slot * ALGOIOT_OUTBOX_SLOT_BYTES + offset, data, len) != ESP_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTPartitionOutboxStorage::read(const uint32_t slot, const uint32_t offset, void* data, const uint32_t len)
+{
+  if ((find() != ALGOIOT_OUTBOX_OK) || (slot >= slotCount()) || (data == NULL) ||
+      (offset > ALGOIOT_OUTBOX_SLOT_BYTES) || (len > ALGOIOT_OUTBOX_SLOT_BYTES - offset))
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  if (esp_partition_read((const esp_partition_t*)m_partition, slot * ALGOIOT_OUTBOX_SLOT_BYTES + offset, data, len) != ESP_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+#endif
+
+
+///////////////////////////////
+// Outbox
+///////////////////////////////
+
+AlgoIoTOutbox::AlgoIoTOutbox(AlgoIoTOutboxStorage& storage) : m_storage(storage)
+{
+}
+
+
+uint8_t AlgoIoTOutbox::readRecordHeader(const uint32_t slot, AlgoIoTOutboxHeader* header, const uint8_t checkPayload)
+{
+  AlgoSHA512 hash;
+  uint8_t chunk[ALGOIOT_OUTBOX_READ_CHUNK];
+  uint8_t digest[SHA512_256_HASH_BYTES];
+  uint32_t done = 0;
+
+  if (m_storage.read(slot, 0, header, sizeof(AlgoIoTOutboxHeader)) != ALGOIOT_OUTBOX_OK)
+    return 0;
+  if ((header->magic != ALGOIOT_OUTBOX_MAGIC) || (header->length > ALGOIOT_OUTBOX_MAX_RECORD_BYTES))
+    return 0;
+  if ((header->state != ALGOIOT_OUTBOX_STATE_PENDING) && (header->state != ALGOIOT_OUTBOX_STATE_SENT))
+    return 0;  // Erased, or written but never committed
+  if (!checkPayload)
+    return 1;
+
+  hash.resetSHA512_256();
+  hash.update((const uint8_t*)header + OUTBOX_HASHED_FIELDS_OFFSET, OUTBOX_HASHED_FIELDS_BYTES);
+  while (done < header->length)
+  {
+    uint32_t len = header->length - done;
+    if (len > ALGOIOT_OUTBOX_READ_CHUNK)
+      len = ALGOIOT_OUTBOX_READ_CHUNK;
+    if (m_storage.read(slot, sizeof(AlgoIoTOutboxHeader) + done, chunk, len) != ALGOIOT_OUTBOX_OK)
+    {
+      hash.clear();
+      return 0;
+    }
+    hash.update(chunk, len);
+    done += len;
+  }
+  hash.finalize(digest, SHA512_256_HASH_BYTES);
+
+  return (memcmp(digest, header->check, ALGOIOT_OUTBOX_CHECK_BYTES) == 0);
+}
+
+
+// Slot order is not record order once the ring has wrapped: the sequence numbers give it
+// Pending records are always the newest ones, in consecutive slots (records are popped in order)
+int AlgoIoTOutbox::open()
+{
+  AlgoIoTOutboxHeader header;
+  uint8_t found = 0;
+  uint8_t foundPending = 0;
+  uint32_t newestSequence = 0;
+  uint32_t oldestPendingSequence = 0;
+
+  m_opened = 0;
+  m_slots = m_storage.slotCount();
+  if (m_slots == 0)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  m_head = 0;
+  m_tail = 0;
+  m_pending = 0;
+  m_nextSequence = 0;
+
+  for (uint32_t slot = 0; slot < m_slots; slot++)
+  {
+    // Payload checked for pending records only: sent ones just give their sequence number
+    if (!readRecordHeader(slot, &header, 1))
+    {
+      if (!readRecordHeader(slot, &header, 0) || (header.state != ALGOIOT_OUTBOX_STATE_SENT))
+        continue;
+    }
+
+    if (!found || ((int32_t)(header.sequence - newestSequence) > 0))
+    {
+      newestSequence = header.sequence;
+      m_head = (slot + 1) % m_slots;
+      found = 1;
+    }
+    if (header.state == ALGOIOT_OUTBOX_STATE_PENDING)
+    {
+      m_pending++;
+      if (!foundPending || ((int32_t)(header.sequence - oldestPendingSequence) < 0))
+      {
+        oldestPendingSequence = header.sequence;
+        m_tail = slot;
+        foundPending = 1;
+      }
+    }
+  }
+
+  if (found)
+    m_nextSequence = newestSequence + 1;
+  if (!foundPending)
+    m_tail = m_head;
+  m_opened = 1;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+uint32_t AlgoIoTOutbox::pending() const
+{
+  return m_pending;
+}
+
+
+uint32_t AlgoIoTOutbox::capacity() const
+{
+  return m_slots;
+}
+
+
+// Payload and header are written with the state byte erased; committing is the last, single-byte write
+int AlgoIoTOutbox::push(const mpkSegment* segments, const uint8_t nSegments, const uint64_t lastValid)
+{
+  AlgoIoTOutboxHeader header;
+  AlgoSHA512 hash;
+  uint8_t digest[SHA512_256_HASH_BYTES];
+  const uint8_t committed = ALGOIOT_OUTBOX_STATE_PENDING;
+  uint32_t length = 0;
+
+  if (!m_opened)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  if ((segments == NULL) || (nSegments == 0))
+    return ALGOIOT_OUTBOX_BAD_PARAM;
+  if ((m_pending > 0) && (m_head == m_tail))
+    return ALGOIOT_OUTBOX_FULL;  // Next slot holds the oldest pending record
+
+  for (uint8_t i = 0; i < nSegments; i++)
+  {
+    if (segments[i].len > ALGOIOT_OUTBOX_MAX_RECORD_BYTES - length)
+      return ALGOIOT_OUTBOX_BAD_PARAM;
+    length += segments[i].len;
+  }
+
+  memset(&header, 0xFF, sizeof(header));
+  header.magic = ALGOIOT_OUTBOX_MAGIC;
+  header.sequence = m_nextSequence;
+  header.lastValid = lastValid;
+  header.length = length;
+
+  if (m_storage.eraseSlot(m_head) != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  hash.resetSHA512_256();
+  hash.update((const uint8_t*)&header + OUTBOX_HASHED_FIELDS_OFFSET, OUTBOX_HASHED_FIELDS_BYTES);
+  length = 0;
+  for (uint8_t i = 0; i < nSegments; i++)
+  {
+    if (segments[i].len == 0)
+      continue;
+    if (m_storage.write(m_head, sizeof(AlgoIoTOutboxHeader) + length, segments[i].data, segments[i].len) != ALGOIOT_OUTBOX_OK)
+    {
+      hash.clear();
+      return ALGOIOT_OUTBOX_STORAGE_ERROR;
+    }
+    hash.update(segments[i].data, segments[i].len);
+    length += segments[i].len;
+  }
+  hash.finalize(digest, SHA512_256_HASH_BYTES);
+  memcpy(header.check, digest, ALGOIOT_OUTBOX_CHECK_BYTES);
+
+  if (m_storage.write(m_head, 0, &header, sizeof(header)) != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  if (m_storage.write(m_head, offsetof(AlgoIoTOutboxHeader, state), &committed, 1) != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  if (m_pending == 0)
+    m_tail = m_head;
+  m_pending++;
+  m_nextSequence++;
+  m_head = (m_head + 1) % m_slots;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTOutbox::peek(uint8_t* buffer, const uint32_t bufferLen, uint32_t* len, uint64_t* lastValid)
+{
+  AlgoIoTOutboxHeader header;
+
+  if (!m_opened)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  if (m_pending == 0)
+    return ALGOIOT_OUTBOX_EMPTY;
+  if ((buffer == NULL) || (len == NULL) || (lastValid == NULL))
+    return ALGOIOT_OUTBOX_BAD_PARAM;
+
+  // Records found damaged by open() are not counted as pending, but may sit among pending ones: skipped
+  for (uint32_t i = 0; ; i++)
+  {
+    if (i == m_slots)
+    { // Damaged since open()
+      m_pending = 0;
+      m_tail = m_head;
+      return ALGOIOT_OUTBOX_EMPTY;
+    }
+    if (readRecordHeader(m_tail, &header, 1) && (header.state == ALGOIOT_OUTBOX_STATE_PENDING))
+      break;
+    m_tail = (m_tail + 1) % m_slots;
+  }
+  if (header.length > bufferLen)
+    return ALGOIOT_OUTBOX_BAD_PARAM;
+  if (m_storage.read(m_tail, sizeof(AlgoIoTOutboxHeader), buffer, header.length) != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  *len = header.length;
+  *lastValid = header.lastValid;
+
+  return ALGOIOT_OUTBOX_OK;
+}
+
+
+int AlgoIoTOutbox::peekAt(const uint32_t index, uint8_t* buffer, const uint32_t bufferLen, uint32_t* len, uint64_t* lastValid)
+{
+  AlgoIoTOutboxHeader header;
+  uint32_t slot = m_tail;
+  uint32_t found = 0;
+
+  if (!m_opened)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  if (index >= m_pending)
+    return ALGOIOT_OUTBOX_EMPTY;
+  if ((buffer == NULL) || (len == NULL) || (lastValid == NULL))
+    return ALGOIOT_OUTBOX_BAD_PARAM;
+
+  // Pending records follow the oldest one in slot order, possibly with damaged ones in between
+  for (uint32_t i = 0; i < m_slots; i++, slot = (slot + 1) % m_slots)
+  {
+    if (!readRecordHeader(slot, &header, 1) || (header.state != ALGOIOT_OUTBOX_STATE_PENDING))
+      continue;
+    if (found++ < index)
+      continue;
+
+    if (header.length > bufferLen)
+      return ALGOIOT_OUTBOX_BAD_PARAM;
+    if (m_storage.read(slot, sizeof(AlgoIoTOutboxHeader), buffer, header.length) != ALGOIOT_OUTBOX_OK)
+      return ALGOIOT_OUTBOX_STORAGE_ERROR;
+    *len = header.length;
+    *lastValid = header.lastValid;
+
+    return ALGOIOT_OUTBOX_OK;
+  }
+
+  return ALGOIOT_OUTBOX_EMPTY;  // Damaged since open()
+}
+
+
+int AlgoIoTOutbox::pop()
+{
+  const uint8_t sent = ALGOIOT_OUTBOX_STATE_SENT;
+
+  if (!m_opened)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+  if (m_pending == 0)
+    return ALGOIOT_OUTBOX_EMPTY;
+
+  if (m_storage.write(m_tail, offsetof(AlgoIoTOutboxHeader, state), &sent, 1) != ALGOIOT_OUTBOX_OK)
+    return ALGOIOT_OUTBOX_STORAGE_ERROR;
+
+  m_pending--;
+  m_tail = (m_pending == 0) ? m_head : (m_tail + 1) % m_slots;
+
+  return ALGOIOT_OUTBOX_OK;
+}
@@ -0,0 +1,196 @@
+// algoiotoutbox.h
+// header for AlgoIoT outbox: signed transactions kept in non-volatile storage until submitted
+// v20261018-3
+
+// When algod cannot be reached, AlgoIoT::submitTransactionToAlgorand() signs the transaction anyway
+// and appends it here; queued transactions are then submitted in order once the network is back
+// (see AlgoIoT::setOutbox() and AlgoIoT::flushOutbox())
+//
+// Storage is a ring of fixed-size slots, one record per slot, written in sequence: each slot is erased
+// and written once per lap, so flash wear is spread evenly over the whole area. A record is:
+//   - written (payload, then header) into an erased slot, then committed by its state byte (0xFF -> 0x7F)
+//   - marked as sent by clearing its state byte (0x7F -> 0x00)
+// State changes only clear bits, as NOR flash allows without erasing. After a crash or power loss,
+// a record is either committed and intact (checksum) or ignored: the outbox never returns a torn record
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTOUTBOX_H
+#define __ALGOIOTOUTBOX_H
+
+#include <stdint.h>
+#include "minmpk.h" // mpkSegment
+
+#define ALGOIOT_OUTBOX_SLOT_BYTES 4096  // One flash sector: a record is erased and written on its own
+#define ALGOIOT_OUTBOX_MAGIC 0x314F4241UL  // "ABO1" little-endian
+#define ALGOIOT_OUTBOX_CHECK_BYTES 8
+#define ALGOIOT_OUTBOX_PATH_CHARS 127
+#define ALGOIOT_OUTBOX_PARTITION_LABEL "algoiot"
+
+// Record states (state byte: only bits cleared, from one to the next)
+#define ALGOIOT_OUTBOX_STATE_ERASED 0xFF
+#define ALGOIOT_OUTBOX_STATE_PENDING 0x7F
+#define ALGOIOT_OUTBOX_STATE_SENT 0x00
+
+// Error codes of outbox operations
+#define ALGOIOT_OUTBOX_OK 0
+#define ALGOIOT_OUTBOX_EMPTY 1
+#define ALGOIOT_OUTBOX_FULL 2
+#define ALGOIOT_OUTBOX_STORAGE_ERROR 3
+#define ALGOIOT_OUTBOX_BAD_PARAM 4
+
+
+// Slot header, followed by "length" payload bytes. Same layout on every target: no padding
+typedef struct AlgoIoTOutboxHeader
+{
+  uint32_t magic;                              // ALGOIOT_OUTBOX_MAGIC
+  uint32_t sequence;                           // Increases by one per record: gives the order across slots
+  uint64_t lastValid;                          // "lv" round of the transaction: after it, it has to be signed again
+  uint32_t length;                             // Payload bytes
+  uint8_t check[ALGOIOT_OUTBOX_CHECK_BYTES];   // SHA-512/256 of sequence, lastValid, length and payload, truncated
+  uint8_t state;                               // ALGOIOT_OUTBOX_STATE_*
+  uint8_t reserved[3];                         // Left erased
+} AlgoIoTOutboxHeader;
+
+#define ALGOIOT_OUTBOX_MAX_RECORD_BYTES (ALGOIOT_OUTBOX_SLOT_BYTES - sizeof(AlgoIoTOutboxHeader))
+
+
+// Slot storage. As NOR flash: erasing sets all bytes of a slot to 0xFF, writing may only clear bits
+// (callers only write erased bytes, or clear bits of the state byte)
+class AlgoIoTOutboxStorage
+{
+  public:
+  virtual ~AlgoIoTOutboxStorage() {}
+
+  // Number of slots of ALGOIOT_OUTBOX_SLOT_BYTES bytes (0 if the storage is not available)
+  virtual uint32_t slotCount() = 0;
+
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  virtual int eraseSlot(const uint32_t slot) = 0;
+
+  // Data is durable when the call returns. Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  virtual int write(const uint32_t slot, const uint32_t offset, const void* data, const uint32_t len) = 0;
+
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  virtual int read(const uint32_t slot, const uint32_t offset, void* data, const uint32_t len) = 0;
+};
+
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+// Slots in a memory-mapped file (Linux, or any POSIX host), created readable by its owner only
+// Writes are synced to disk (msync) before returning
+class AlgoIoTFileOutboxStorage : public AlgoIoTOutboxStorage
+{
+  private:
+  char m_path[ALGOIOT_OUTBOX_PATH_CHARS + 1];
+  uint32_t m_slots;
+  int m_fd;
+  uint8_t* m_map;
+
+  // Opens and maps the file at first use. Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  int map();
+
+  public:
+  // "path" max ALGOIOT_OUTBOX_PATH_CHARS chars; file size is "slots" * ALGOIOT_OUTBOX_SLOT_BYTES
+  AlgoIoTFileOutboxStorage(const char* path, const uint32_t slots);
+  virtual ~AlgoIoTFileOutboxStorage();
+
+  virtual uint32_t slotCount();
+  virtual int eraseSlot(const uint32_t slot);
+  virtual int write(const uint32_t slot, const uint32_t offset, const void* data, const uint32_t len);
+  virtual int read(const uint32_t slot, const uint32_t offset, void* data, const uint32_t len);
+};
+#endif
+
+
+#if defined(ARDUINO_ARCH_ESP32)
+// Slots in a flash data partition (ESP32), one per 4 KB sector. The partition table has to provide it,
+// e.g. in a partitions.csv next to the sketch:   algoiot, data, 0x40, , 0x40000,   (64 slots)
+// Flash is used raw, and stays in clear even with flash encryption on: records only hold signed transactions,
+// which algod makes public anyway, and a record altered no longer matches its signature. The partition must not
+// have the "encrypted" flag: encrypted writes go by 16-byte blocks, while the record state is committed one byte
+// at a time, in place (see AlgoIoTOutbox::push() and pop()). Such a partition is refused
+class AlgoIoTPartitionOutboxStorage : public AlgoIoTOutboxStorage
+{
+  private:
+  const char* m_label;
+  const void* m_partition;  // esp_partition_t, found at first use
+
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  int find();
+
+  public:
+  // "label": partition name in the partition table; string not copied
+  AlgoIoTPartitionOutboxStorage(const char* label = ALGOIOT_OUTBOX_PARTITION_LABEL);
+
+  virtual uint32_t slotCount();
+  virtual int eraseSlot(const uint32_t slot);
+  virtual int write(const uint32_t slot, const uint32_t offset, const void* data, const uint32_t len);
+  virtual int read(const uint32_t slot, const uint32_t offset, void* data, const uint32_t len);
+};
+#endif
+
+
+// FIFO of records over a slot storage. Records are popped in the order they were pushed
+// Positions are rebuilt from the slot headers by open(): nothing else is kept in storage
+class AlgoIoTOutbox
+{
+  private:
+  AlgoIoTOutboxStorage& m_storage;
+  uint32_t m_slots = 0;
+  uint32_t m_head = 0;          // Next slot to write
+  uint32_t m_tail = 0;          // Oldest pending record
+  uint32_t m_pending = 0;
+  uint32_t m_nextSequence = 0;
+  uint8_t m_opened = 0;
+
+  // Reads and checks the record header (and payload checksum, if "checkPayload") of a slot
+  // Returns 1 if the slot holds a committed record
+  uint8_t readRecordHeader(const uint32_t slot, AlgoIoTOutboxHeader* header, const uint8_t checkPayload);
+
+  public:
+  explicit AlgoIoTOutbox(AlgoIoTOutboxStorage& storage);
+
+  // Scans the storage: finds pending records, and where to write next. To be called once, before anything else
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  int open();
+
+  // Records waiting to be submitted
+  uint32_t pending() const;
+
+  // Max number of pending records
+  uint32_t capacity() const;
+
+  // Appends a record, given as segments (e.g. a signed transaction as submitted)
+  // Max ALGOIOT_OUTBOX_MAX_RECORD_BYTES bytes; "lastValid" is kept with it
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK, ALGOIOT_OUTBOX_FULL if all slots hold pending records)
+  int push(const mpkSegment* segments, const uint8_t nSegments, const uint64_t lastValid);
+
+  // Reads the oldest pending record, which stays pending
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK, ALGOIOT_OUTBOX_EMPTY, ALGOIOT_OUTBOX_BAD_PARAM if "buffer" is too short)
+  int peek(uint8_t* buffer, const uint32_t bufferLen, uint32_t* len, uint64_t* lastValid);
+
+  // Reads the pending record "index" places after the oldest one (0 = oldest), which stays pending
+  // Unlike peek(), damaged records are skipped without being forgotten, so this may be called for any index
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK, ALGOIOT_OUTBOX_EMPTY if fewer records are pending, ALGOIOT_OUTBOX_BAD_PARAM if "buffer" is too short)
+  int peekAt(const uint32_t index, uint8_t* buffer, const uint32_t bufferLen, uint32_t* len, uint64_t* lastValid);
+
+  // Marks the oldest pending record as sent
+  // Returns error code (ALGOIOT_OUTBOX_OK = OK)
+  int pop();
+};
+
+#endif
@@ -0,0 +1,321 @@
+// algoiotplatform.cpp
+// AlgoIoT platform layer (POSIX host)
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include "algoiotplatform.h"
+
+#if !defined(ARDUINO)
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+
+#define PRINT_NUMBER_CHARS 32   // Longest number printed: 20 digits and sign, or a double with 2 decimals
+#define PRINTF_BUFFER_CHARS 256 // Longer printf() output is truncated
+
+
+///////////////////////////////
+// Time
+///////////////////////////////
+
+static uint64_t monotonicMicros()
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)(now.tv_nsec / 1000);
+}
+
+
+// Time origin taken at first call, as an Arduino counts from boot
+static uint64_t elapsedMicros()
+{
+  static uint64_t originMicros = monotonicMicros();
+
+  return monotonicMicros() - originMicros;
+}
+
+
+uint32_t millis()
+{
+  return (uint32_t)(elapsedMicros() / 1000);
+}
+
+
+uint32_t micros()
+{
+  return (uint32_t)elapsedMicros();
+}
+
+
+void delay(const uint32_t ms)
+{
+  struct timespec wait;
+
+  wait.tv_sec = ms / 1000;
+  wait.tv_nsec = (long)(ms % 1000) * 1000000L;
+  while ((nanosleep(&wait, &wait) != 0) && (errno == EINTR))
+  {
+  }
+}
+
+
+///////////////////////////////
+// Print
+///////////////////////////////
+
+size_t Print::write(const uint8_t* buffer, size_t len)
+{
+  size_t n = 0;
+
+  while ((n < len) && (write(buffer[n]) == 1))
+  {
+    n++;
+  }
+
+  return n;
+}
+
+
+size_t Print::write(const char* str)
+{
+  if (str == NULL)
+    return 0;
+
+  return write((const uint8_t*)str, strlen(str));
+}
+
+
+size_t Print::write(const char* buffer, size_t len)
+{
+  return write((const uint8_t*)buffer, len);
+}
+
+
+size_t Print::print(const char* str)
+{
+  return write(str);
+}
+
+
+size_t Print::print(const char c)
+{
+  return write((uint8_t)c);
+}
+
+
+size_t Print::print(const int value)
+{
+  return print((long long)value);
+}
+
+
+size_t Print::print(const unsigned int value)
+{
+  return print((unsigned long long)value);
+}
+
+
+size_t Print::print(const long value)
+{
+  return print((long long)value);
+}
+
+
+size_t Print::print(const unsigned long value)
+{
+  return print((unsigned long long)value);
+}
+
+
+size_t Print::print(const long long value)
+{
+  char number[PRINT_NUMBER_CHARS];
+
+  snprintf(number, sizeof(number), "%lld", value);
+
+  return write(number);
+}
+
+
+size_t Print::print(const unsigned long long value)
+{
+  char number[PRINT_NUMBER_CHARS];
+
+  snprintf(number, sizeof(number), "%llu", value);
+
+  return write(number);
+}
+
+
+// Two decimals, as Arduino's default
+size_t Print::print(const double value)
+{
+  char number[PRINT_NUMBER_CHARS];
+
+  snprintf(number, sizeof(number), "%.2f", value);
+
+  return write(number);
+}
+
+
+size_t Print::println()
+{
+  return write("\r\n");
+}
+
+
+size_t Print::println(const char* str)
+{
+  size_t n = print(str);
+
+  return n + println();
+}
+
+
+size_t Print::println(const char c)
+{
+  size_t n = print(c);
+
+  return n + println();
+}
+
+
+size_t Print::println(const int value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const unsigned int value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const long value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const unsigned long value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const long long value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const unsigned long long value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::println(const double value)
+{
+  size_t n = print(value);
+
+  return n + println();
+}
+
+
+size_t Print::printf(const char* format, ...)
+{
+  char text[PRINTF_BUFFER_CHARS];
+  va_list args;
+  int len = 0;
+
+  va_start(args, format);
+  len = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  if (len < 0)
+    return 0;
+  if ((size_t)len >= sizeof(text))
+    len = sizeof(text) - 1;
+
+  return write((const uint8_t*)text, (size_t)len);
+}
+
+
+///////////////////////////////
+// Stream
+///////////////////////////////
+
+size_t Stream::readBytes(char* buffer, size_t len)
+{
+  size_t n = 0;
+
+  while (n < len)
+  {
+    int c = read();
+    if (c < 0)
+      break;
+    buffer[n++] = (char)c;
+  }
+
+  return n;
+}
+
+
+size_t Stream::readBytes(uint8_t* buffer, size_t len)
+{
+  return readBytes((char*)buffer, len);
+}
+
+
+///////////////////////////////
+// Console
+///////////////////////////////
+
+AlgoIoTConsole AlgoIoTDebugConsole;
+
+
+size_t AlgoIoTConsole::write(uint8_t data)
+{
+  return write(&data, 1);
+}
+
+
+size_t AlgoIoTConsole::write(const uint8_t* buffer, size_t len)
+{
+  return fwrite(buffer, 1, len, stderr);
+}
+
+#endif
@@ -0,0 +1,124 @@
+// algoiotplatform.h
+// header for AlgoIoT platform layer: Arduino core, or its few parts AlgoIoT uses on a POSIX host
+// v20261018-1
+
+// On Arduino (ESP32) this is just <Arduino.h>. On Linux (or any POSIX host, built without ARDUINO defined),
+// AlgoIoT needs only: Print, Stream and Client as the Arduino core declares them (same virtual methods, so that
+// code written against them builds unchanged), millis(), micros() and delay(), and a console for debug output
+// No String: AlgoIoT does not use it
+// Network access on a POSIX host is in algoiotsocket.h (Client over a socket, optionally TLS)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTPLATFORM_H
+#define __ALGOIOTPLATFORM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(ARDUINO)
+
+#include <Arduino.h>
+#include <Client.h>
+
+#else
+
+// Milliseconds and microseconds since first call (monotonic clock); wrap around as on Arduino (32 bits)
+uint32_t millis();
+uint32_t micros();
+void delay(const uint32_t ms);
+
+
+class Print
+{
+  public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t data) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t len);
+  size_t write(const char* str);
+  size_t write(const char* buffer, size_t len);
+  virtual void flush() {}
+
+  size_t print(const char* str);
+  size_t print(const char c);
+  size_t print(const int value);
+  size_t print(const unsigned int value);
+  size_t print(const long value);
+  size_t print(const unsigned long value);
+  size_t print(const long long value);
+  size_t print(const unsigned long long value);
+  size_t print(const double value);
+  size_t println();
+  size_t println(const char* str);
+  size_t println(const char c);
+  size_t println(const int value);
+  size_t println(const unsigned int value);
+  size_t println(const long value);
+  size_t println(const unsigned long value);
+  size_t println(const long long value);
+  size_t println(const unsigned long long value);
+  size_t println(const double value);
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+
+class Stream : public Print
+{
+  public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  // Up to "len" bytes, as long as read() gives them (no waiting, unlike Arduino's timed version)
+  virtual size_t readBytes(char* buffer, size_t len);
+  size_t readBytes(uint8_t* buffer, size_t len);
+};
+
+
+class Client : public Stream
+{
+  public:
+  // Returns 1 if connected
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual size_t write(uint8_t data) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t len) = 0;
+  using Print::write;
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int read(uint8_t* buffer, size_t len) = 0;
+  virtual int peek() = 0;
+  virtual void flush() = 0;
+  virtual void stop() = 0;
+  virtual uint8_t connected() = 0;
+  virtual operator bool() = 0;
+};
+
+
+// Debug output (standard error), in place of Serial
+class AlgoIoTConsole : public Print
+{
+  public:
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t* buffer, size_t len);
+  using Print::write;
+};
+
+extern AlgoIoTConsole AlgoIoTDebugConsole;
+
+#endif
+
+#endif
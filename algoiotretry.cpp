@@ -0,0 +1,143 @@
+// algoiotretry.cpp
+// AlgoIoT retry scheduler
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include "algoiotretry.h"
+
+
+AlgoIoTRetryScheduler::AlgoIoTRetryScheduler(AlgoIoTRetryStats& stats) : m_stats(stats)
+{
+}
+
+
+void AlgoIoTRetryScheduler::setPolicy(const uint8_t maxAttempts, const uint32_t baseDelayMs, const uint32_t maxDelayMs, const uint32_t budgetMs)
+{
+  m_maxAttempts = (maxAttempts > 0) ? maxAttempts : 1;
+  m_baseDelayMs = baseDelayMs;
+  m_maxDelayMs = (maxDelayMs > baseDelayMs) ? maxDelayMs : baseDelayMs;
+  m_budgetMs = budgetMs;
+}
+
+
+void AlgoIoTRetryScheduler::seed(const uint32_t seed)
+{
+  m_random ^= seed;
+  if (m_random == 0)
+    m_random = 0x2545F491UL;
+}
+
+
+void AlgoIoTRetryScheduler::start(const uint32_t deadlineMs)
+{
+  m_startMillis = millis();
+  m_dueMillis = m_startMillis;
+  m_attempts = 0;
+  m_deadlineMs = ((deadlineMs > 0) && (deadlineMs < m_budgetMs)) ? deadlineMs : m_budgetMs;
+}
+
+
+void AlgoIoTRetryScheduler::attempt()
+{
+  if (m_attempts < 0xFF)
+    m_attempts++;
+}
+
+
+// Delay before attempt n+1 (after n failed ones): base * 2^(n-1), capped, then "equal jitter": half of it
+// fixed, half random. Attempts stay spaced, yet devices failing together spread their retries
+uint8_t AlgoIoTRetryScheduler::retry(const int httpCode)
+{
+  uint8_t resultClass = classify(httpCode);
+  uint32_t delayMs = m_baseDelayMs;
+  uint32_t nowMillis = 0;
+
+  if (resultClass != ALGOIOT_RETRY_RETRIABLE)
+  {
+    finish(resultClass);
+    return 0;
+  }
+
+  m_stats.retriableErrors++;
+  if (m_attempts >= m_maxAttempts)
+  {
+    finish(resultClass);
+    return 0;
+  }
+
+  for (uint8_t i = 1; (i < m_attempts) && (delayMs < m_maxDelayMs); i++)
+  {
+    delayMs <<= 1;
+  }
+  if (delayMs > m_maxDelayMs)
+    delayMs = m_maxDelayMs;
+  // xorshift32: statistical quality is all that jitter needs
+  m_random ^= m_random << 13;
+  m_random ^= m_random >> 17;
+  m_random ^= m_random << 5;
+  delayMs = delayMs / 2 + m_random % (delayMs - delayMs / 2 + 1);
+
+  nowMillis = millis();
+  if ((nowMillis - m_startMillis) + delayMs > m_deadlineMs)
+  { // Next attempt would start too late
+    finish(resultClass);
+    return 0;
+  }
+  m_dueMillis = nowMillis + delayMs;
+
+  return 1;
+}
+
+
+uint32_t AlgoIoTRetryScheduler::waitMs() const
+{
+  int32_t leftMs = (int32_t)(m_dueMillis - millis());
+
+  return (leftMs > 0) ? (uint32_t)leftMs : 0;
+}
+
+
+uint8_t AlgoIoTRetryScheduler::classify(const int httpCode)
+{
+  if ((httpCode >= 200) && (httpCode < 300))
+    return ALGOIOT_RETRY_SUCCESS;
+  if ((httpCode < 0) || (httpCode == 408) || (httpCode == 429) || ((httpCode >= 500) && (httpCode < 600)))
+    return ALGOIOT_RETRY_RETRIABLE;
+
+  return ALGOIOT_RETRY_FATAL;
+}
+
+
+void AlgoIoTRetryScheduler::finish(const uint8_t resultClass)
+{
+  uint32_t latencyMs = millis() - m_startMillis;
+
+  m_stats.requests++;
+  m_stats.attempts += m_attempts;
+  if (m_attempts > m_stats.maxAttempts)
+    m_stats.maxAttempts = m_attempts;
+  if (resultClass == ALGOIOT_RETRY_FATAL)
+    m_stats.fatalErrors++;
+  else if (resultClass == ALGOIOT_RETRY_RETRIABLE)
+    m_stats.gaveUp++;
+  m_stats.lastLatencyMs = latencyMs;
+  if (latencyMs > m_stats.maxLatencyMs)
+    m_stats.maxLatencyMs = latencyMs;
+  m_stats.totalLatencyMs += latencyMs;
+  m_attempts = 0;
+}
@@ -0,0 +1,108 @@
+// algoiotretry.h
+// header for AlgoIoT retry scheduler: failed requests to algod retried with exponential backoff
+// v20261018-2
+
+// A request to algod (transaction parameters, submission) failing with a retriable error is attempted again
+// after a delay doubling at each attempt, from a base delay up to a max delay, randomized ("jitter") so that
+// devices failing together do not retry together. Retriable: no response at all (connection refused or lost,
+// timeout), 408 (request timeout), 429 (too many requests), 5xx (server or gateway error). Anything else
+// (e.g. 400: transaction refused, 401/403: API token) is fatal: the same request would fail again
+// Attempts stop at the max number of attempts, or when the next one would start past the deadline: the
+// time budget of the request, shortened for a submission to what is left of the transaction validity ("lv")
+// The scheduler only decides: the caller waits (blocking API) or polls until due (asynchronous API)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTRETRY_H
+#define __ALGOIOTRETRY_H
+
+#include "algoiotplatform.h"
+#include <stdint.h>
+
+#define ALGOIOT_RETRY_MAX_ATTEMPTS 5        // Defaults (see AlgoIoT::setRetryPolicy())
+#define ALGOIOT_RETRY_BASE_DELAY_MS 500UL
+#define ALGOIOT_RETRY_MAX_DELAY_MS 8000UL
+#define ALGOIOT_RETRY_BUDGET_MS 30000UL     // From first attempt to last one started
+
+// Result classes
+#define ALGOIOT_RETRY_SUCCESS 0
+#define ALGOIOT_RETRY_RETRIABLE 1
+#define ALGOIOT_RETRY_FATAL 2
+
+
+// Statistics since start (or last reset: zero the struct). A request is counted once, however many attempts it took
+typedef struct AlgoIoTRetryStats
+{
+  uint32_t requests;          // Requests ended: succeeded, failed (fatal error) or given up
+  uint32_t attempts;          // Over all requests: attempts - requests = retries
+  uint32_t retriableErrors;   // Attempts failed with a retriable error
+  uint32_t fatalErrors;       // Requests ended by a fatal error
+  uint32_t gaveUp;            // Requests ended by a retriable error, no attempt left before the deadline
+  uint32_t maxAttempts;       // Most attempts taken by one request
+  uint32_t lastLatencyMs;     // Last request: first attempt to final result, backoff included
+  uint32_t maxLatencyMs;
+  uint64_t totalLatencyMs;    // Average latency = totalLatencyMs / requests
+} AlgoIoTRetryStats;
+
+
+class AlgoIoTRetryScheduler
+{
+  private:
+  uint8_t m_maxAttempts = ALGOIOT_RETRY_MAX_ATTEMPTS;
+  uint32_t m_baseDelayMs = ALGOIOT_RETRY_BASE_DELAY_MS;
+  uint32_t m_maxDelayMs = ALGOIOT_RETRY_MAX_DELAY_MS;
+  uint32_t m_budgetMs = ALGOIOT_RETRY_BUDGET_MS;
+  uint32_t m_random = 0x2545F491UL;   // xorshift32 state, never 0
+  // Request in progress
+  uint32_t m_startMillis = 0;
+  uint32_t m_deadlineMs = 0;          // From m_startMillis
+  uint32_t m_dueMillis = 0;           // Next attempt
+  uint8_t m_attempts = 0;
+  AlgoIoTRetryStats& m_stats;
+
+  // Ends the request in progress: statistics updated
+  void finish(const uint8_t resultClass);
+
+  public:
+  // Statistics go to "stats" (not owned): schedulers may share one
+  explicit AlgoIoTRetryScheduler(AlgoIoTRetryStats& stats);
+
+  // "maxAttempts": 1 = no retries. Delays doubled from "baseDelayMs" up to "maxDelayMs"
+  // "budgetMs": no attempt started later than this after the first one
+  void setPolicy(const uint8_t maxAttempts, const uint32_t baseDelayMs, const uint32_t maxDelayMs, const uint32_t budgetMs);
+
+  // Jitter source. Any value: e.g. something unique to the device, so that devices do not share delays
+  void seed(const uint32_t seed);
+
+  // Starts a request, before its first attempt. "deadlineMs" (0 = none): max time from now to its last attempt,
+  // further limited by the budget
+  void start(const uint32_t deadlineMs);
+
+  // To be called just before each attempt
+  void attempt();
+
+  // Result of the attempt: HTTP status code, or negative error code if no response was received
+  // Returns 1 if the request is to be attempted again (when waitMs() is 0); 0 if it is over, statistics updated
+  uint8_t retry(const int httpCode);
+
+  // Milliseconds before the next attempt is due (0 = now)
+  uint32_t waitMs() const;
+
+  // ALGOIOT_RETRY_* class of an HTTP status code (negative: no response). AlgoIoT error codes (below 100) are fatal
+  static uint8_t classify(const int httpCode);
+};
+
+#endif
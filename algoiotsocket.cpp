@@ -0,0 +1,462 @@
+// algoiotsocket.cpp
+// AlgoIoT socket client (POSIX host)
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "algoiotsocket.h"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#ifdef ALGOIOT_SOCKET_TLS
+  #include <openssl/ssl.h>
+  #include <openssl/err.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0  // macOS: SO_NOSIGPIPE set on the socket instead
+#endif
+
+
+#ifdef ALGOIOT_SOCKET_TLS
+// One context for all TLS clients, created at first use: system CA store, TLS 1.2 at least
+static SSL_CTX* tlsContext()
+{
+  static SSL_CTX* context = NULL;
+  struct sigaction current;
+
+  if (context != NULL)
+    return context;
+
+  // OpenSSL writes with write(): a server closing first would raise SIGPIPE, which kills the process by default
+  if ((sigaction(SIGPIPE, NULL, &current) == 0) && (current.sa_handler == SIG_DFL))
+    signal(SIGPIPE, SIG_IGN);
+
+  context = SSL_CTX_new(TLS_client_method());
+  if (context == NULL)
+    return NULL;
+  SSL_CTX_set_min_proto_version(context, TLS1_2_VERSION);
+  SSL_CTX_set_default_verify_paths(context);
+  SSL_CTX_set_verify(context, SSL_VERIFY_PEER, NULL);
+
+  return context;
+}
+#endif
+
+
+AlgoIoTSocketClient::AlgoIoTSocketClient(const uint8_t tls)
+{
+  m_tls = tls;
+}
+
+
+AlgoIoTSocketClient::~AlgoIoTSocketClient()
+{
+  stop();
+}
+
+
+void AlgoIoTSocketClient::setInsecure()
+{
+  m_insecure = 1;
+}
+
+
+void AlgoIoTSocketClient::setConnectTimeout(const uint32_t timeoutMs)
+{
+  m_timeoutMs = timeoutMs;
+}
+
+
+uint8_t AlgoIoTSocketClient::waitSocket(const uint8_t forWrite, const uint32_t timeoutMs)
+{
+  struct pollfd pfd;
+  int ready = 0;
+
+  pfd.fd = m_fd;
+  pfd.events = forWrite ? POLLOUT : POLLIN;
+  pfd.revents = 0;
+  do
+  {
+    ready = poll(&pfd, 1, (int)timeoutMs);
+  } while ((ready < 0) && (errno == EINTR));
+
+  return (ready > 0);
+}
+
+
+uint8_t AlgoIoTSocketClient::connectTcp(const char* host, const uint16_t port)
+{
+  struct addrinfo hints;
+  struct addrinfo* addresses = NULL;
+  char portText[6];
+  uint32_t startMillis = millis();
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  snprintf(portText, sizeof(portText), "%u", (unsigned)port);
+  // Name resolution is not bounded by the timeout (resolver settings apply)
+  if (getaddrinfo(host, portText, &hints, &addresses) != 0)
+    return 0;
+
+  for (struct addrinfo* address = addresses; address != NULL; address = address->ai_next)
+  {
+    uint32_t elapsedMs = millis() - startMillis;
+    int one = 1;
+    int error = 0;
+    socklen_t errorLen = sizeof(error);
+
+    if (elapsedMs >= m_timeoutMs)
+      break;
+    m_fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (m_fd < 0)
+      continue;
+    fcntl(m_fd, F_SETFD, FD_CLOEXEC);
+    fcntl(m_fd, F_SETFL, fcntl(m_fd, F_GETFL, 0) | O_NONBLOCK);
+    setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    #ifdef SO_NOSIGPIPE
+    setsockopt(m_fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+    #endif
+
+    if ((::connect(m_fd, address->ai_addr, address->ai_addrlen) == 0) ||
+        ((errno == EINPROGRESS) && waitSocket(1, m_timeoutMs - elapsedMs) &&
+         (getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &error, &errorLen) == 0) && (error == 0)))
+    {
+      freeaddrinfo(addresses);
+      return 1;
+    }
+    close(m_fd);
+    m_fd = -1;
+  }
+  freeaddrinfo(addresses);
+
+  return 0;
+}
+
+
+uint8_t AlgoIoTSocketClient::connectTls(const char* host)
+{
+#ifdef ALGOIOT_SOCKET_TLS
+  SSL_CTX* context = tlsContext();
+  SSL* ssl = NULL;
+  uint32_t startMillis = millis();
+
+  if (context == NULL)
+    return 0;
+  ssl = SSL_new(context);
+  if (ssl == NULL)
+    return 0;
+  m_ssl = ssl;
+  SSL_set_fd(ssl, m_fd);
+  SSL_set_tlsext_host_name(ssl, host);  // SNI
+  if (m_insecure)
+    SSL_set_verify(ssl, SSL_VERIFY_NONE, NULL);
+  else
+    SSL_set1_host(ssl, host);
+
+  // Non-blocking socket: the handshake goes on as the socket allows
+  for (;;)
+  {
+    int result = SSL_connect(ssl);
+    int error = 0;
+    uint32_t elapsedMs = millis() - startMillis;
+
+    if (result == 1)
+      return 1;
+    error = SSL_get_error(ssl, result);
+    if (((error != SSL_ERROR_WANT_READ) && (error != SSL_ERROR_WANT_WRITE)) || (elapsedMs >= m_timeoutMs) ||
+        !waitSocket(error == SSL_ERROR_WANT_WRITE, m_timeoutMs - elapsedMs))
+    {
+      ERR_clear_error();
+      return 0;
+    }
+  }
+#else
+  (void)host;
+  return 0;  // Built without TLS
+#endif
+}
+
+
+int AlgoIoTSocketClient::connect(const char* host, uint16_t port)
+{
+  stop();
+  if ((host == NULL) || (strlen(host) > ALGOIOT_SOCKET_HOST_CHARS))
+    return 0;
+  if (!connectTcp(host, port))
+    return 0;
+  if (m_tls && !connectTls(host))
+  {
+    stop();
+    return 0;
+  }
+
+  return 1;
+}
+
+
+uint8_t AlgoIoTSocketClient::fill()
+{
+  int got = 0;
+
+  if (m_fd < 0)
+    return 0;
+  if (m_inStart == m_inEnd)
+  {
+    m_inStart = 0;
+    m_inEnd = 0;
+  }
+  else if (m_inEnd == sizeof(m_in))
+  {
+    memmove(m_in, &(m_in[m_inStart]), m_inEnd - m_inStart);
+    m_inEnd -= m_inStart;
+    m_inStart = 0;
+  }
+  if (m_eof || (m_inEnd == sizeof(m_in)))
+    return 1;
+
+#ifdef ALGOIOT_SOCKET_TLS
+  if (m_ssl != NULL)
+  {
+    got = SSL_read((SSL*)m_ssl, &(m_in[m_inEnd]), sizeof(m_in) - m_inEnd);
+    if (got <= 0)
+    {
+      int error = SSL_get_error((SSL*)m_ssl, got);
+      if ((error == SSL_ERROR_WANT_READ) || (error == SSL_ERROR_WANT_WRITE))
+        return 1;
+      ERR_clear_error();
+      m_eof = 1;  // Closed (cleanly or not): what was received stays readable
+      return (error == SSL_ERROR_ZERO_RETURN);
+    }
+    m_inEnd += (uint16_t)got;
+    return 1;
+  }
+#endif
+
+  got = (int)recv(m_fd, &(m_in[m_inEnd]), sizeof(m_in) - m_inEnd, MSG_DONTWAIT);
+  if (got > 0)
+  {
+    m_inEnd += (uint16_t)got;
+    return 1;
+  }
+  if ((got < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)))
+    return 1;
+  m_eof = 1;
+
+  return (got == 0);
+}
+
+
+uint8_t AlgoIoTSocketClient::flushOut()
+{
+  uint16_t sent = 0;
+  uint32_t startMillis = millis();
+
+  while (sent < m_outLen)
+  {
+    int n = 0;
+    uint8_t waitWrite = 1;
+    uint32_t elapsedMs = millis() - startMillis;
+
+#ifdef ALGOIOT_SOCKET_TLS
+    if (m_ssl != NULL)
+    {
+      n = SSL_write((SSL*)m_ssl, &(m_out[sent]), m_outLen - sent);
+      if (n <= 0)
+      {
+        int error = SSL_get_error((SSL*)m_ssl, n);
+        if ((error != SSL_ERROR_WANT_READ) && (error != SSL_ERROR_WANT_WRITE))
+        {
+          ERR_clear_error();
+          break;
+        }
+        waitWrite = (error == SSL_ERROR_WANT_WRITE);
+        n = 0;
+      }
+    }
+    else
+#endif
+    {
+      n = (int)send(m_fd, &(m_out[sent]), m_outLen - sent, MSG_NOSIGNAL);
+      if (n < 0)
+      {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+          break;
+        n = 0;
+      }
+    }
+
+    sent += (uint16_t)n;
+    if ((n == 0) && ((elapsedMs >= m_timeoutMs) || !waitSocket(waitWrite, m_timeoutMs - elapsedMs)))
+      break;
+  }
+
+  if (sent < m_outLen)
+  { // Connection lost, or server not reading
+    m_outLen = 0;
+    m_eof = 1;
+    return 0;
+  }
+  m_outLen = 0;
+
+  return 1;
+}
+
+
+size_t AlgoIoTSocketClient::write(uint8_t data)
+{
+  return write(&data, 1);
+}
+
+
+size_t AlgoIoTSocketClient::write(const uint8_t* buffer, size_t len)
+{
+  size_t written = 0;
+
+  if ((m_fd < 0) || m_eof)
+    return 0;
+  while (written < len)
+  {
+    size_t n = len - written;
+
+    if (n > sizeof(m_out) - m_outLen)
+      n = sizeof(m_out) - m_outLen;
+    memcpy(&(m_out[m_outLen]), &(buffer[written]), n);
+    m_outLen += (uint16_t)n;
+    written += n;
+    if ((m_outLen == sizeof(m_out)) && !flushOut())
+      return 0;
+  }
+
+  return written;
+}
+
+
+void AlgoIoTSocketClient::flush()
+{
+  if ((m_fd >= 0) && (m_outLen > 0))
+    flushOut();
+}
+
+
+int AlgoIoTSocketClient::available()
+{
+  if (m_inStart == m_inEnd)
+    fill();
+
+  return m_inEnd - m_inStart;
+}
+
+
+int AlgoIoTSocketClient::read()
+{
+  if (available() <= 0)
+    return -1;
+
+  return m_in[m_inStart++];
+}
+
+
+int AlgoIoTSocketClient::read(uint8_t* buffer, size_t len)
+{
+  int n = available();
+
+  if (n <= 0)
+    return -1;
+  if ((size_t)n > len)
+    n = (int)len;
+  memcpy(buffer, &(m_in[m_inStart]), n);
+  m_inStart += (uint16_t)n;
+
+  return n;
+}
+
+
+int AlgoIoTSocketClient::peek()
+{
+  if (available() <= 0)
+    return -1;
+
+  return m_in[m_inStart];
+}
+
+
+uint8_t AlgoIoTSocketClient::waitAvailable(const uint32_t timeoutMs)
+{
+  if ((m_fd < 0) || m_eof || (m_inStart != m_inEnd))
+    return 1;
+#ifdef ALGOIOT_SOCKET_TLS
+  if ((m_ssl != NULL) && (SSL_pending((SSL*)m_ssl) > 0))
+    return 1;
+#endif
+
+  return waitSocket(0, timeoutMs);
+}
+
+
+void AlgoIoTSocketClient::stop()
+{
+#ifdef ALGOIOT_SOCKET_TLS
+  if (m_ssl != NULL)
+  {
+    SSL_shutdown((SSL*)m_ssl);  // close_notify, not waiting for the server's
+    SSL_free((SSL*)m_ssl);
+    ERR_clear_error();
+  }
+#endif
+  m_ssl = NULL;
+  if (m_fd >= 0)
+    close(m_fd);
+  m_fd = -1;
+  m_eof = 0;
+  m_inStart = 0;
+  m_inEnd = 0;
+  m_outLen = 0;
+}
+
+
+// A kept-alive connection the server closed meanwhile is seen here, before a request is sent on it
+uint8_t AlgoIoTSocketClient::connected()
+{
+  if (m_fd < 0)
+    return 0;
+  if (m_inStart == m_inEnd)
+    fill();
+
+  return !m_eof || (m_inStart != m_inEnd);
+}
+
+
+AlgoIoTSocketClient::operator bool()
+{
+  return connected();
+}
+
+#endif
@@ -0,0 +1,104 @@
+// algoiotsocket.h
+// header for AlgoIoT socket client: Arduino Client over a POSIX TCP socket, optionally TLS (OpenSSL)
+// v20261018-1
+
+// What WiFiClient and WiFiClientSecure are on the ESP32, for a Linux (or any POSIX) host: AlgoIoT requests
+// (see algoiottransport.h) and the asynchronous submission (see algoiothttp.h) run on it unchanged
+// Never blocks reading: available() and read() return what has arrived. Connecting (TCP, and TLS handshake)
+// blocks up to the connect timeout; writes are buffered (request line and headers are many small writes) and
+// sent by flush(), or when the buffer is full, blocking up to the same timeout. TCP_NODELAY: a request
+// goes out as soon as it is flushed
+// TLS needs OpenSSL: define ALGOIOT_SOCKET_TLS (e.g. -DALGOIOT_SOCKET_TLS, linking -lssl -lcrypto). The server
+// certificate is verified against the system CA store, host name included, unless setInsecure() is called
+// Without ALGOIOT_SOCKET_TLS, a TLS client fails to connect. A process using TLS ignores SIGPIPE (set at first
+// connection, if not handled already), as OpenSSL writes to a socket the server may have closed
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTSOCKET_H
+#define __ALGOIOTSOCKET_H
+
+#include <stdint.h>
+#include "algoiotplatform.h"
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+
+#define ALGOIOT_SOCKET_HOST_CHARS 63
+#define ALGOIOT_SOCKET_BUFFER_BYTES 1024       // Each way
+#define ALGOIOT_SOCKET_CONNECT_TIMEOUT_MS 5000UL
+
+
+class AlgoIoTSocketClient : public Client
+{
+  private:
+  int m_fd = -1;
+  void* m_ssl = NULL;               // SSL*, TLS only
+  uint8_t m_tls;
+  uint8_t m_insecure = 0;
+  uint8_t m_eof = 0;                // Server closed its side: buffered bytes are still readable
+  uint32_t m_timeoutMs = ALGOIOT_SOCKET_CONNECT_TIMEOUT_MS;
+  uint8_t m_in[ALGOIOT_SOCKET_BUFFER_BYTES];
+  uint16_t m_inStart = 0;
+  uint16_t m_inEnd = 0;
+  uint8_t m_out[ALGOIOT_SOCKET_BUFFER_BYTES];
+  uint16_t m_outLen = 0;
+
+  // TCP connection to "host", one address after the other. Returns 1 if connected
+  uint8_t connectTcp(const char* host, const uint16_t port);
+
+  // TLS handshake on the TCP connection. Returns 1 if done
+  uint8_t connectTls(const char* host);
+
+  // Waits for the socket to be readable ("forWrite" = 0) or writable, up to "timeoutMs". Returns 1 if it is
+  uint8_t waitSocket(const uint8_t forWrite, const uint32_t timeoutMs);
+
+  // Receives what has arrived into the input buffer, without waiting. Returns 0 if the connection failed
+  uint8_t fill();
+
+  // Sends the output buffer, waiting up to the timeout. Returns 0 if the connection failed
+  uint8_t flushOut();
+
+  public:
+  // "tls": 1 for a TLS client (https)
+  AlgoIoTSocketClient(const uint8_t tls = 0);
+  virtual ~AlgoIoTSocketClient();
+
+  // Server certificate not verified (as WiFiClientSecure::setInsecure()). TLS only
+  void setInsecure();
+
+  // Bounds connecting and each blocking write. Default ALGOIOT_SOCKET_CONNECT_TIMEOUT_MS
+  void setConnectTimeout(const uint32_t timeoutMs);
+
+  // Waits up to "timeoutMs" for bytes to read (or for the connection to end). Returns 1 if available() may be > 0
+  uint8_t waitAvailable(const uint32_t timeoutMs);
+
+  virtual int connect(const char* host, uint16_t port);
+  virtual size_t write(uint8_t data);
+  virtual size_t write(const uint8_t* buffer, size_t len);
+  using Print::write;
+  virtual int available();
+  virtual int read();
+  virtual int read(uint8_t* buffer, size_t len);
+  virtual int peek();
+  virtual void flush();
+  virtual void stop();
+  virtual uint8_t connected();
+  virtual operator bool();
+};
+
+#endif
+
+#endif
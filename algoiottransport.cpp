@@ -0,0 +1,257 @@
+// algoiottransport.cpp
+// AlgoIoT transports
+// v20261018-2
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "algoiottransport.h"
+
+
+///////////////////////////////
+// HTTPClient (Arduino)
+///////////////////////////////
+
+#if defined(ARDUINO)
+
+// HTTPClient error codes turned into ALGOIOT_HTTP_ERROR_* ones, which tell whether the request may have reached
+// the server: only ALGOIOT_HTTP_ERROR_CONNECT and ALGOIOT_HTTP_ERROR_SEND say it did not (whole body not sent)
+static int httpClientError(const int result)
+{
+  switch (result)
+  {
+    case HTTPC_ERROR_CONNECTION_REFUSED:
+      return ALGOIOT_HTTP_ERROR_CONNECT;
+    case HTTPC_ERROR_SEND_HEADER_FAILED:
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED:
+      return ALGOIOT_HTTP_ERROR_SEND;
+    case HTTPC_ERROR_NOT_CONNECTED:   // Checked once the request is sent, too
+    case HTTPC_ERROR_CONNECTION_LOST:
+      return ALGOIOT_HTTP_ERROR_CONNECTION_LOST;
+    case HTTPC_ERROR_READ_TIMEOUT:
+      return ALGOIOT_HTTP_ERROR_TIMEOUT;
+    default:
+    break;
+  }
+
+  return (result < 0) ? ALGOIOT_HTTP_ERROR_PROTOCOL : result;
+}
+
+
+AlgoIoTHttpClientTransport::AlgoIoTHttpClientTransport()
+{
+  m_httpClient.setReuse(true);
+}
+
+
+void AlgoIoTHttpClientTransport::setConnectTimeout(const uint32_t timeoutMs)
+{
+  m_httpClient.setConnectTimeout((int32_t)timeoutMs);
+}
+
+
+int AlgoIoTHttpClientTransport::request(const char* url, const char* method, const char* headerName, const char* headerValue,
+                                        const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs)
+{
+  const char* host = NULL;
+  const char* path = NULL;
+  uint32_t serverLen = 0;
+
+  if ((url == NULL) || (method == NULL) || ((host = strstr(url, "://")) == NULL))
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+  path = strchr(host + 3, '/');
+  serverLen = (path != NULL) ? (uint32_t)(path - url) : strlen(url);
+  if (serverLen > ALGOIOT_TRANSPORT_SERVER_CHARS)
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;
+
+  if ((strncmp(m_server, url, serverLen) != 0) || (m_server[serverLen] != '\0'))
+  { // Another server: its connection is not the open one
+    close();
+    memcpy(m_server, url, serverLen);
+    m_server[serverLen] = '\0';
+  }
+
+  m_httpClient.begin(url);
+  if ((headerName != NULL) && (headerValue != NULL))
+    m_httpClient.addHeader(headerName, headerValue);
+  if ((body != NULL) && (contentType != NULL))
+    m_httpClient.addHeader("Content-Type", contentType);
+  m_httpClient.setTimeout(timeoutMs);
+
+  // Body, if any, streamed into the request (Content-Length = "bodyLength")
+  if (body != NULL)
+    return httpClientError(m_httpClient.sendRequest(method, body, bodyLength));
+
+  return httpClientError(m_httpClient.sendRequest(method, (uint8_t*)NULL, 0));
+}
+
+
+int AlgoIoTHttpClientTransport::readBody(Stream* sink)
+{
+  int result = m_httpClient.writeToStream(sink);
+
+  return (result < 0) ? httpClientError(result) : 0;
+}
+
+
+void AlgoIoTHttpClientTransport::end()
+{
+  m_httpClient.end();
+}
+
+
+// HTTPClient::end() keeps a reusable connection open: reuse is turned off just for this call, to really close it
+void AlgoIoTHttpClientTransport::close()
+{
+  m_httpClient.setReuse(false);
+  m_httpClient.end();
+  m_httpClient.setReuse(true);
+  m_server[0] = '\0';
+}
+
+#endif
+
+
+///////////////////////////////
+// Arduino Client
+///////////////////////////////
+
+AlgoIoTClientTransport::AlgoIoTClientTransport(Client* plainClient, Client* tlsClient)
+{
+  m_plainClient = plainClient;
+  m_tlsClient = tlsClient;
+}
+
+
+void AlgoIoTClientTransport::setConnectTimeout(const uint32_t timeoutMs)
+{
+  (void)timeoutMs;  // Clients' own
+}
+
+
+void AlgoIoTClientTransport::wait(const uint32_t maxMs)
+{
+  (void)maxMs;
+  delay(1);
+}
+
+
+int AlgoIoTClientTransport::run(const uint8_t untilHeaders)
+{
+  for (;;)
+  {
+    int result = m_exchange.poll();
+
+    if (result != 0)
+      return result;
+    if (untilHeaders && (m_exchange.state() > ALGOIOT_HTTP_HEADERS))
+      return 0;
+    if (m_exchange.state() >= ALGOIOT_HTTP_STATUS)
+      wait(ALGOIOT_TRANSPORT_WAIT_SLICE_MS);  // Timeout checked by the exchange
+  }
+}
+
+
+int AlgoIoTClientTransport::request(const char* url, const char* method, const char* headerName, const char* headerValue,
+                                    const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs)
+{
+  Client* client = AlgoIoTHttpExchange::isSecureURL(url) ? m_tlsClient : m_plainClient;
+  int result = 0;
+
+  if (client == NULL)
+    return ALGOIOT_HTTP_ERROR_CONNECT;
+  // The exchange reuses its open connection if it goes to the same server, through the same client
+  result = m_exchange.begin(client, url, method, contentType, body, bodyLength, timeoutMs);
+  if (result != 0)
+    return result;
+  m_client = client;
+  if (headerName != NULL)
+    m_exchange.addHeader(headerName, headerValue);
+
+  result = run(1);
+  if (result < 0)
+    return result;
+
+  return m_exchange.status();
+}
+
+
+int AlgoIoTClientTransport::readBody(Stream* sink)
+{
+  int result = 0;
+
+  if (m_exchange.state() == ALGOIOT_HTTP_DONE)
+    return 0;  // No body
+  if (m_exchange.state() == ALGOIOT_HTTP_IDLE)
+    return ALGOIOT_HTTP_ERROR_BAD_PARAM;  // No request, or it failed
+
+  m_exchange.setBodyStream(sink);
+  result = run(0);
+  m_exchange.setBodyStream(NULL);
+
+  return (result < 0) ? result : 0;
+}
+
+
+// A body not read is read anyway (and kept in the exchange buffer, truncated): the connection can then serve the
+// next request. Should this fail, the exchange has closed it
+void AlgoIoTClientTransport::end()
+{
+  if ((m_exchange.state() != ALGOIOT_HTTP_IDLE) && (m_exchange.state() != ALGOIOT_HTTP_DONE))
+    run(0);
+}
+
+
+void AlgoIoTClientTransport::close()
+{
+  m_exchange.close();
+}
+
+
+///////////////////////////////
+// Sockets (POSIX host)
+///////////////////////////////
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+
+// Clients are members: their addresses are valid for the base class, even before they are constructed
+AlgoIoTSocketTransport::AlgoIoTSocketTransport() : AlgoIoTClientTransport(&m_plainSocket, &m_tlsSocket), m_plainSocket(0), m_tlsSocket(1)
+{
+}
+
+
+void AlgoIoTSocketTransport::setInsecure()
+{
+  m_tlsSocket.setInsecure();
+}
+
+
+void AlgoIoTSocketTransport::setConnectTimeout(const uint32_t timeoutMs)
+{
+  m_plainSocket.setConnectTimeout(timeoutMs);
+  m_tlsSocket.setConnectTimeout(timeoutMs);
+}
+
+
+// Sleeps until the server sends something, instead of polling
+void AlgoIoTSocketTransport::wait(const uint32_t maxMs)
+{
+  if (m_client != NULL)
+    static_cast<AlgoIoTSocketClient*>(m_client)->waitAvailable(maxMs);  // One of ours
+}
+
+#endif
@@ -0,0 +1,148 @@
+// algoiottransport.h
+// header for AlgoIoT transports: the HTTP requests of the blocking API, whatever carries them
+// v20261018-2
+
+// AlgoIoT asks a transport for one request at a time (parameters, submission, status, pending transaction) and
+// reads the response body through a Stream as it arrives (see algoiotjson.h). The transport keeps the connection
+// open between requests (keep-alive) as long as they go to the same server, and bounds each of them in time
+// - AlgoIoTHttpClientTransport (Arduino, ESP32): HTTPClient, as before transports existed. Default on Arduino
+// - AlgoIoTClientTransport: AlgoIoTHttpExchange (see algoiothttp.h) over any Arduino Client, plain or TLS
+// - AlgoIoTSocketTransport (POSIX host): AlgoIoTClientTransport over AlgoIoTSocketClient (see algoiotsocket.h),
+//   waiting on the socket instead of polling. Default on Linux: the whole library runs there unchanged
+// Others (e.g. a test double) can be given to AlgoIoT::setTransport()
+// Error codes are negative: ALGOIOT_HTTP_ERROR_* (see algoiothttp.h), HTTPClient ones included. Only
+// ALGOIOT_HTTP_ERROR_CONNECT and ALGOIOT_HTTP_ERROR_SEND mean the request never reached the server
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOIOTTRANSPORT_H
+#define __ALGOIOTTRANSPORT_H
+
+#include <stdint.h>
+#include "algoiotplatform.h"
+#include "algoiothttp.h"
+#include "algoiotsocket.h"
+
+#if defined(ARDUINO)
+  #include <HTTPClient.h>   // https://github.com/espressif/arduino-esp32/blob/master/libraries/HTTPClient/src/HTTPClient.h
+#endif
+
+#define ALGOIOT_TRANSPORT_SERVER_CHARS 127    // "scheme://host[:port]" of the open connection
+#define ALGOIOT_TRANSPORT_WAIT_SLICE_MS 100UL // AlgoIoTClientTransport: longest wait between two exchange steps
+
+
+class AlgoIoTTransport
+{
+  public:
+  virtual ~AlgoIoTTransport() {}
+
+  // Bounds connecting (TCP, and TLS handshake)
+  virtual void setConnectTimeout(const uint32_t timeoutMs) = 0;
+
+  // Sends a request and waits for the response status line and headers
+  // "url": "http://host[:port]/path" or "https://..."; "headerName"/"headerValue": one more header (e.g. an API
+  // token), NULL if none; "body": "bodyLength" bytes of "contentType", NULL if none (all of them not copied: valid
+  // until end()). The open connection is reused if it goes to the same server; otherwise it is closed first
+  // "timeoutMs": request sent to response complete (body included)
+  // Returns HTTP status code, or negative error code (no response; connection then in unknown state: see close())
+  virtual int request(const char* url, const char* method, const char* headerName, const char* headerValue,
+                      const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs) = 0;
+
+  // Response body of the request written to "sink" as it arrives, up to its end
+  // Returns error code (0 = OK; negative: body cut short, or timeout)
+  virtual int readBody(Stream* sink) = 0;
+
+  // Request over: body not read is discarded, connection kept open for the next request (if the server allows)
+  virtual void end() = 0;
+
+  // Connection closed (e.g. after an error, or before deep sleep); the next request opens a new one
+  virtual void close() = 0;
+};
+
+
+#if defined(ARDUINO)
+// HTTPClient: it reuses an open connection whatever the server asked, so the transport closes it when the server changes
+class AlgoIoTHttpClientTransport : public AlgoIoTTransport
+{
+  private:
+  HTTPClient m_httpClient;
+  char m_server[ALGOIOT_TRANSPORT_SERVER_CHARS + 1] = "";  // "" = none connected
+
+  public:
+  AlgoIoTHttpClientTransport();
+
+  virtual void setConnectTimeout(const uint32_t timeoutMs);
+  virtual int request(const char* url, const char* method, const char* headerName, const char* headerValue,
+                      const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs);
+  virtual int readBody(Stream* sink);
+  virtual void end();
+  virtual void close();
+};
+#endif
+
+
+// Any Arduino Client: one for http, one for https (NULL if not needed), not owned. Connect timeout is the clients'
+// own. Between exchange steps the transport waits (see wait()): by default it sleeps 1 ms, which a subclass
+// knowing its clients can do better
+class AlgoIoTClientTransport : public AlgoIoTTransport
+{
+  protected:
+  Client* m_plainClient;
+  Client* m_tlsClient;
+  Client* m_client = NULL;          // Of the current request
+  AlgoIoTHttpExchange m_exchange;
+
+  // Runs the exchange until the response is complete, or only until its headers are read ("untilHeaders" = 1)
+  // Returns 0 (headers read), or as AlgoIoTHttpExchange::poll(): HTTP status code once complete, negative on error
+  int run(const uint8_t untilHeaders);
+
+  // Waits up to "maxMs" for the current client to have something to read
+  virtual void wait(const uint32_t maxMs);
+
+  public:
+  AlgoIoTClientTransport(Client* plainClient, Client* tlsClient);
+
+  virtual void setConnectTimeout(const uint32_t timeoutMs);
+  virtual int request(const char* url, const char* method, const char* headerName, const char* headerValue,
+                      const char* contentType, Stream* body, const uint32_t bodyLength, const uint32_t timeoutMs);
+  virtual int readBody(Stream* sink);
+  virtual void end();
+  virtual void close();
+};
+
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ARDUINO)
+// Own socket clients; https needs ALGOIOT_SOCKET_TLS (see algoiotsocket.h)
+class AlgoIoTSocketTransport : public AlgoIoTClientTransport
+{
+  private:
+  AlgoIoTSocketClient m_plainSocket;
+  AlgoIoTSocketClient m_tlsSocket;
+
+  protected:
+  virtual void wait(const uint32_t maxMs);
+
+  public:
+  AlgoIoTSocketTransport();
+
+  // Server certificate not verified (see AlgoIoTSocketClient::setInsecure())
+  void setInsecure();
+
+  virtual void setConnectTimeout(const uint32_t timeoutMs);
+};
+#endif
+
+#endif
@@ -0,0 +1,248 @@
+// algosha512.cpp
+// Portable SHA-512 and SHA-512/256 (FIPS 180-4)
+// v20261018-2
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "algosha512.h"
+
+
+static const uint64_t SHA512_K[80] =
+{
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+  0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+  0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+  0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+  0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+  0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+  0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+  0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+  0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+  0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+  0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+  0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+  0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+  0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+static const uint64_t SHA512_IV[8] =
+{
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const uint64_t SHA512_256_IV[8] =
+{
+  0x22312194fc2bf72cULL, 0x9f555fa3c84c64c2ULL, 0x2393b86b6f53b151ULL, 0x963877195940eabdULL,
+  0x96283ee2a88effe3ULL, 0xbe5e1e2553863992ULL, 0x2b0199fc2c85b8aaULL, 0x0eb72ddc81c52ca2ULL
+};
+
+
+static inline uint64_t rotr64(const uint64_t x, const uint8_t n)
+{
+  return (x >> n) | (x << (64 - n));
+}
+
+static inline uint64_t loadBE64(const uint8_t* p)
+{
+  uint64_t value = 0;
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    value = (value << 8) | p[i];
+  }
+
+  return value;
+}
+
+static inline void storeBE64(uint8_t* p, const uint64_t value)
+{
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    p[i] = (uint8_t)(value >> (56 - 8 * i));
+  }
+}
+
+
+AlgoSHA512::AlgoSHA512()
+{
+  reset();
+}
+
+
+void AlgoSHA512::reset()
+{
+  memcpy(m_state, SHA512_IV, sizeof(m_state));
+  m_blockLen = 0;
+  m_totalLen = 0;
+}
+
+
+void AlgoSHA512::resetSHA512_256()
+{
+  memcpy(m_state, SHA512_256_IV, sizeof(m_state));
+  m_blockLen = 0;
+  m_totalLen = 0;
+}
+
+
+// One round; callers rotate the roles of the 8 working variables instead of moving them
+#define SHA512_ROUND(a, b, c, d, e, f, g, h, j) \
+  { \
+    const uint64_t t1 = h + (rotr64(e, 14) ^ rotr64(e, 18) ^ rotr64(e, 41)) + ((e & f) ^ (~e & g)) + SHA512_K[t + j] + w[j]; \
+    d += t1; \
+    h = t1 + (rotr64(a, 28) ^ rotr64(a, 34) ^ rotr64(a, 39)) + ((a & b) ^ (a & c) ^ (b & c)); \
+  }
+
+// Message schedule kept as a 16-word ring, to save stack on small CPUs, updated 16 words at a time
+// Rounds unrolled by 16, so ring indexes are constants
+void AlgoSHA512::processBlock(const uint8_t block[SHA512_BLOCK_BYTES])
+{
+  uint64_t w[16];
+  uint64_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+  uint64_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+
+  for (uint8_t j = 0; j < 16; j++)
+  {
+    w[j] = loadBE64(&(block[8 * j]));
+  }
+
+  for (uint8_t t = 0; t < 80; t += 16)
+  {
+    if (t > 0)
+    {
+      // w[j] = W[t + j] from W[t + j - 16] (itself), W[t + j - 15], W[t + j - 7], W[t + j - 2]
+      for (uint8_t j = 0; j < 16; j++)
+      {
+        const uint64_t w15 = w[(j + 1) & 15];
+        const uint64_t w2 = w[(j + 14) & 15];
+        const uint64_t s0 = rotr64(w15, 1) ^ rotr64(w15, 8) ^ (w15 >> 7);
+        const uint64_t s1 = rotr64(w2, 19) ^ rotr64(w2, 61) ^ (w2 >> 6);
+        w[j] += s0 + w[(j + 9) & 15] + s1;
+      }
+    }
+
+    SHA512_ROUND(a, b, c, d, e, f, g, h, 0);
+    SHA512_ROUND(h, a, b, c, d, e, f, g, 1);
+    SHA512_ROUND(g, h, a, b, c, d, e, f, 2);
+    SHA512_ROUND(f, g, h, a, b, c, d, e, 3);
+    SHA512_ROUND(e, f, g, h, a, b, c, d, 4);
+    SHA512_ROUND(d, e, f, g, h, a, b, c, 5);
+    SHA512_ROUND(c, d, e, f, g, h, a, b, 6);
+    SHA512_ROUND(b, c, d, e, f, g, h, a, 7);
+    SHA512_ROUND(a, b, c, d, e, f, g, h, 8);
+    SHA512_ROUND(h, a, b, c, d, e, f, g, 9);
+    SHA512_ROUND(g, h, a, b, c, d, e, f, 10);
+    SHA512_ROUND(f, g, h, a, b, c, d, e, 11);
+    SHA512_ROUND(e, f, g, h, a, b, c, d, 12);
+    SHA512_ROUND(d, e, f, g, h, a, b, c, 13);
+    SHA512_ROUND(c, d, e, f, g, h, a, b, 14);
+    SHA512_ROUND(b, c, d, e, f, g, h, a, 15);
+  }
+
+  m_state[0] += a;
+  m_state[1] += b;
+  m_state[2] += c;
+  m_state[3] += d;
+  m_state[4] += e;
+  m_state[5] += f;
+  m_state[6] += g;
+  m_state[7] += h;
+}
+
+
+void AlgoSHA512::update(const void* data, size_t len)
+{
+  const uint8_t* input = (const uint8_t*)data;
+
+  m_totalLen += len;
+
+  // Complete a partial block first
+  if (m_blockLen > 0)
+  {
+    size_t chunk = SHA512_BLOCK_BYTES - m_blockLen;
+    if (chunk > len)
+      chunk = len;
+    memcpy(&(m_block[m_blockLen]), input, chunk);
+    m_blockLen += chunk;
+    input += chunk;
+    len -= chunk;
+    if (m_blockLen < SHA512_BLOCK_BYTES)
+      return;
+    processBlock(m_block);
+    m_blockLen = 0;
+  }
+
+  // Whole blocks straight from input, no copy
+  while (len >= SHA512_BLOCK_BYTES)
+  {
+    processBlock(input);
+    input += SHA512_BLOCK_BYTES;
+    len -= SHA512_BLOCK_BYTES;
+  }
+
+  if (len > 0)
+  {
+    memcpy(m_block, input, len);
+    m_blockLen = (uint8_t)len;
+  }
+}
+
+
+void AlgoSHA512::finalize(void* hash, size_t len)
+{
+  uint8_t digest[SHA512_HASH_BYTES];
+
+  // Padding: 0x80, zeros, 128-bit big-endian length in bits (upper 64 bits always 0 here)
+  m_block[m_blockLen++] = 0x80;
+  if (m_blockLen > SHA512_BLOCK_BYTES - 16)
+  {
+    memset(&(m_block[m_blockLen]), 0, SHA512_BLOCK_BYTES - m_blockLen);
+    processBlock(m_block);
+    m_blockLen = 0;
+  }
+  memset(&(m_block[m_blockLen]), 0, SHA512_BLOCK_BYTES - 8 - m_blockLen);
+  storeBE64(&(m_block[SHA512_BLOCK_BYTES - 8]), m_totalLen << 3);
+  processBlock(m_block);
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    storeBE64(&(digest[8 * i]), m_state[i]);
+  }
+  if (len > SHA512_HASH_BYTES)
+    len = SHA512_HASH_BYTES;
+  memcpy(hash, digest, len);
+
+  memset(digest, 0, sizeof(digest));
+  clear();
+}
+
+
+void AlgoSHA512::clear()
+{
+  memset(m_state, 0, sizeof(m_state));
+  memset(m_block, 0, sizeof(m_block));
+  m_blockLen = 0;
+  m_totalLen = 0;
+}
@@ -0,0 +1,69 @@
+// algosha512.h
+// header for portable SHA-512 and SHA-512/256 (FIPS 180-4)
+// v20261018-2
+
+// Same interface as the Crypto library SHA512 class (reset/update/finalize), so either one may
+// back AlgoEd25519 (see ALGOED25519_BACKEND in algoed25519.h). Used where the Crypto library is not
+// available (Linux hosts). No heap, no global state: the context is the object itself
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __ALGOSHA512_H
+#define __ALGOSHA512_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHA512_HASH_BYTES 64
+#define SHA512_BLOCK_BYTES 128
+#define SHA512_256_HASH_BYTES 32  // SHA-512/256: Algorand address checksums and transaction IDs
+
+
+class AlgoSHA512
+{
+  private:
+    uint64_t m_state[8];
+    uint8_t m_block[SHA512_BLOCK_BYTES];
+    uint8_t m_blockLen;
+    uint64_t m_totalLen;  // Bytes; messages up to 2^64 - 1 bytes are more than enough here
+
+    void processBlock(const uint8_t block[SHA512_BLOCK_BYTES]);
+
+  public:
+    AlgoSHA512();
+
+    /// @brief Starts a new hash
+    void reset();
+
+    /// @brief Starts a new SHA-512/256 hash (FIPS 180-4, 5.3.6): same algorithm, own initial state
+    /// finalize() then has to output SHA512_256_HASH_BYTES (the digest is the first 32 bytes)
+    void resetSHA512_256();
+
+    /// @brief Adds data to the hash
+    /// @param data input bytes
+    /// @param len number of bytes
+    void update(const void* data, size_t len);
+
+    /// @brief Completes the hash. A new one needs reset()
+    /// @param hash output buffer
+    /// @param len bytes to output (max 64: digest is truncated if shorter)
+    void finalize(void* hash, size_t len);
+
+    /// @brief Wipes internal state
+    void clear();
+};
+
+#endif
@@ -1,9 +1,9 @@
 /*
-Base32 Decode as in http://tools.ietf.org/html/rfc4648
+Base32 Encode/Decode as in http://tools.ietf.org/html/rfc4648
 Derived from the work of Vladimir Tarasow
 Released into the public domain.
 
-Last mod 20231003-1
+Last mod 20261018-1
 */
 
 #include "base32decode.h"
@@ -12,54 +12,122 @@ Last mod 20231003-1
 #include <stdint.h>
 
 
-int Base32::fromBase32(uint8_t* in, const int length, uint8_t*& out)
+#define B32_IGNORED 0xFE
+#define B32_INVALID 0xFF
+
+// Symbol value (0..31) of every input char, or B32_IGNORED / B32_INVALID
+// Replaces a chain of range checks per char with one lookup
+static const uint8_t BASE32_DECODE_TABLE[256] =
+{
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,  // 0x00
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x10
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x20
+  0x0e, 0x0b, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,  // 0x30
+  0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,  // 0x40
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x50
+  0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,  // 0x60
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x70
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x80
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0x90
+  0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xa0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xb0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xc0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xd0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  // 0xe0
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff  // 0xf0
+};
+
+static const char BASE32_ALPHABET[33] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+
+int Base32::decode(const char* in, const int length, uint8_t* out, const int outSize)
 {
   int result = 0; // Length of the array of decoded values.
-  int buffer = 0;
+  uint32_t buffer = 0;
   int bitsLeft = 0;
-  uint8_t* temp = NULL;
 
-  if (in == NULL)
-	return 0;
-  if (length < 1)
+  if ((in == NULL) || (out == NULL))
     return 0;
-
-  temp = (uint8_t*)malloc(length); // Allocating temporary array
-  if (temp == NULL)
+  if (length < 1)
     return 0;
 
   for (int i = 0; i < length; i++)
   {
-    uint8_t ch = in[i];
-
-    // ignoring some characters: ' ', '\t', '\r', '\n', '='
-    if (ch == 0xA0 || ch == 0x09 || ch == 0x0A || ch == 0x0D || ch == 0x3D) continue;
+    const uint8_t value = BASE32_DECODE_TABLE[(uint8_t)in[i]];
 
-    // recovering mistyped: '0' -> 'O', '1' -> 'L', '8' -> 'B'
-    if (ch == 0x30) { ch = 0x4F; } else if (ch == 0x31) { ch = 0x4C; } else if (ch == 0x38) { ch = 0x42; }
-    
-    // look up one base32 symbols: from 'A' to 'Z' or from 'a' to 'z' or from '2' to '7'
-    if ((ch >= 0x41 && ch <= 0x5A) || (ch >= 0x61 && ch <= 0x7A)) { ch = ((ch & 0x1F) - 1); }
-    else if (ch >= 0x32 && ch <= 0x37) { ch -= (0x32 - 26); }
-    else { free(temp); return 0; }
+    if (value >= B32_IGNORED)
+    {
+      if (value == B32_IGNORED)
+        continue;
+      return 0;
+    }
 
-    buffer <<= 5;    
-    buffer |= ch;
+    buffer = (buffer << 5) | value;
     bitsLeft += 5;
     if (bitsLeft >= 8)
     {
-      temp[result] = (unsigned char)((unsigned int)(buffer >> (bitsLeft - 8)) & 0xFF);
-      result++;
+      if (result >= outSize)
+        return 0;
       bitsLeft -= 8;
+      out[result++] = (uint8_t)(buffer >> bitsLeft);
+    }
+  }
+
+  return result;
+}
+
+
+int Base32::encode(const uint8_t* in, const int length, char* out, const int outSize)
+{
+  int result = 0;
+  uint32_t buffer = 0;
+  int bitsLeft = 0;
+
+  if ((in == NULL) || (out == NULL) || (length < 0))
+    return 0;
+  if (outSize < BASE32_ENCODED_LEN(length) + 1)
+    return 0;
+
+  for (int i = 0; i < length; i++)
+  {
+    buffer = (buffer << 8) | in[i];
+    bitsLeft += 8;
+    while (bitsLeft >= 5)
+    {
+      bitsLeft -= 5;
+      out[result++] = BASE32_ALPHABET[(buffer >> bitsLeft) & 0x1F];
     }
   }
+  if (bitsLeft > 0)
+  {
+    out[result++] = BASE32_ALPHABET[(buffer << (5 - bitsLeft)) & 0x1F];
+  }
+  out[result] = '\0';
+
+  return result;
+}
 
-  out = (uint8_t*)malloc(result);
+
+int Base32::fromBase32(uint8_t* in, const int length, uint8_t*& out)
+{
+  int result = 0;
+
+  if (in == NULL)
+	return 0;
+  if (length < 1)
+    return 0;
+
+  // Decoded straight into the output buffer: no temporary copy
+  out = (uint8_t*)malloc(BASE32_DECODED_MAX_LEN(length) + 1);
   if (out == NULL)
     return 0;
 
-  memcpy(out, temp, result);
-  free(temp);
+  result = decode((const char*)in, length, out, BASE32_DECODED_MAX_LEN(length));
+  if (result == 0)
+  {
+    free(out);
+    out = NULL;
+  }
 
   return result;
 }
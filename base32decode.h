@@ -1,7 +1,9 @@
 /*
-  Base32 decoding (http://tools.ietf.org/html/rfc4648)
+  Base32 encoding and decoding (http://tools.ietf.org/html/rfc4648)
   Derived from the work of Vladimir Tarasow
   Released into the public domain.
+
+  Last mod 20261018-1
 */
 
 #ifndef _Base32_h
@@ -9,6 +11,10 @@
 
 #include "stdint.h"
 
+// Buffer sizes: unpadded encoding of "n" bytes (without terminator), longest decoding of "n" chars
+#define BASE32_ENCODED_LEN(n) ((((n) * 8) + 4) / 5)
+#define BASE32_DECODED_MAX_LEN(n) (((n) * 5) / 8)
+
 class Base32
 {
   public:
@@ -18,6 +24,23 @@ class Base32
     /// @param out Decoded buffer, allocated internally (to be freed by caller)
     /// @return length of decoded buffer (0 if error occurred)
     static int fromBase32(uint8_t* in, const int length, uint8_t*& out);
+
+    /// @brief Decodes from Base32 into a caller buffer: no heap
+    /// Upper or lower case; ' ', '\t', '\r', '\n', '=' ignored; mistyped '0', '1', '8' read as 'O', 'L', 'B'
+    /// @param in Base32 chars
+    /// @param length number of chars
+    /// @param out output buffer
+    /// @param outSize output buffer size: BASE32_DECODED_MAX_LEN(length) is always enough
+    /// @return length of decoded data (0 if error occurred: invalid char or output buffer too small)
+    static int decode(const char* in, const int length, uint8_t* out, const int outSize);
+
+    /// @brief Encodes to Base32 into a caller buffer, upper case, without padding (as Algorand does)
+    /// @param in data to encode
+    /// @param length data length
+    /// @param out output buffer, receives a null-terminated string
+    /// @param outSize output buffer size: at least BASE32_ENCODED_LEN(length) + 1
+    /// @return number of chars written, terminator excluded (0 if error occurred)
+    static int encode(const uint8_t* in, const int length, char* out, const int outSize);
 };
 
 #endif
@@ -0,0 +1,113 @@
+// bip39en.cpp
+// BIP39 English wordlist lookups
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdint.h>
+#include <string.h>
+#include "bip39en.h"
+#include "bip39enwords.h" // Packed list: the only translation unit including it
+
+
+#define BIP39_PREFIX_LEN 4
+#define BIP39_SUFFIX_LEN_MASK 0x07
+
+
+// 3-byte packed entry of word "index": prefix key (20 bits) then suffix length (3 bits)
+static uint32_t bip39Entry(const uint16_t index)
+{
+  const uint8_t* entry = BIP39_EN_ENTRIES + (uint32_t)index * BIP39_EN_ENTRY_BYTES;
+
+  return ((uint32_t)entry[0] << 16) | ((uint32_t)entry[1] << 8) | entry[2];
+}
+
+
+int16_t Bip39En::wordIndex(const char* word, const uint8_t len)
+{
+  char candidate[BIP39_WORD_MAX_LEN + 1];
+  uint32_t key = 0;
+  uint16_t base = 0;
+  uint8_t diff = 0;
+
+  if (word == NULL)
+    return -1;
+  if ((len < BIP39_WORD_MIN_LEN) || (len > BIP39_WORD_MAX_LEN))
+    return -1;
+
+  // Same packing as the list. Chars other than 'a'..'z' may alias a letter: the full check rejects them
+  for (uint8_t i = 0; i < BIP39_PREFIX_LEN; i++)
+  {
+    key = (key << 5) | ((i < len) ? ((uint8_t)(word[i] - 'a' + 1) & 0x1F) : 0);
+  }
+
+  // Lower bound: after the loop, base is the first word whose prefix is not below "key" (or the last word)
+  for (uint16_t step = BIP39_EN_WORDS_NUM / 2; step > 0; step >>= 1)
+  {
+    const uint32_t probe = bip39Entry(base + step - 1) >> 3;
+    base += step & (uint16_t)(0 - (uint16_t)(probe < key));
+  }
+
+  // Full-word check: no early exit
+  memset(candidate, 0, sizeof(candidate));
+  diff = Bip39En::word(base, candidate) ^ len;
+  for (uint8_t i = 0; i < len; i++)
+  {
+    diff |= (uint8_t)(word[i] ^ candidate[i]);
+  }
+  memset(candidate, 0, sizeof(candidate));  // Words of a mnemonic are key material
+
+  return diff ? -1 : (int16_t)base;
+}
+
+
+uint8_t Bip39En::word(const uint16_t index, char outWord[BIP39_WORD_MAX_LEN + 1])
+{
+  uint32_t entry = 0;
+  uint16_t blockFirst = 0;
+  uint16_t suffixOffset = 0;
+  uint8_t suffixLen = 0;
+  uint8_t len = 0;
+
+  if ((outWord == NULL) || (index >= BIP39_EN_WORDS_NUM))
+    return 0;
+
+  entry = bip39Entry(index);
+  suffixLen = entry & BIP39_SUFFIX_LEN_MASK;
+
+  // Prefix letters; a 0 code (words of 3 letters) is written, then overwritten by the terminator
+  for (uint8_t i = 0; i < BIP39_PREFIX_LEN; i++)
+  {
+    const uint8_t code = (entry >> (3 + 5 * (BIP39_PREFIX_LEN - 1 - i))) & 0x1F;
+    outWord[len] = (char)('a' + code - 1);
+    len += (code != 0);
+  }
+
+  // Suffix offset: block offset plus the suffixes of the words before "index" in its block
+  // The whole block is always scanned, so time does not depend on the position in the block
+  blockFirst = index - (index % BIP39_EN_BLOCK_WORDS);
+  suffixOffset = BIP39_EN_SUFFIX_OFFSETS[index / BIP39_EN_BLOCK_WORDS];
+  for (uint16_t j = blockFirst; j < blockFirst + BIP39_EN_BLOCK_WORDS; j++)
+  {
+    suffixOffset += (bip39Entry(j) & BIP39_SUFFIX_LEN_MASK) & (uint16_t)(0 - (uint16_t)(j < index));
+  }
+
+  memcpy(outWord + len, BIP39_EN_SUFFIXES + suffixOffset, suffixLen);
+  len += suffixLen;
+  outWord[len] = '\0';
+
+  return len;
+}
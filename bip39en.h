@@ -0,0 +1,51 @@
+// bip39en.h
+// header for BIP39 English wordlist lookups
+// v20261018-1
+
+// Word -> index and index -> word, working directly on the packed list in bip39enwords.h
+// (no table of 2048 string pointers). No heap, no global state
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __BIP39EN_H
+#define __BIP39EN_H
+
+#include <stdint.h>
+
+#define BIP39_EN_WORDS_NUM 2048
+#define BIP39_WORD_MIN_LEN 3
+#define BIP39_WORD_MAX_LEN 8
+
+
+class Bip39En
+{
+  public:
+    /// @brief Finds a word in the BIP39 English list
+    /// Branch-free binary search (always 11 steps) then a full-word check: for valid words,
+    /// time does not depend on which word (i.e. which piece of a private key) is looked up
+    /// @param word word to look up, not necessarily null-terminated
+    /// @param len word length (chars)
+    /// @return word index (0..2047), -1 if not in the list
+    static int16_t wordIndex(const char* word, const uint8_t len);
+
+    /// @brief Gets a word of the BIP39 English list
+    /// @param index word index (0..2047)
+    /// @param outWord output buffer, receives the null-terminated word
+    /// @return word length (chars), 0 if index is out of range
+    static uint8_t word(const uint16_t index, char outWord[BIP39_WORD_MAX_LEN + 1]);
+};
+
+#endif
@@ -1,2057 +1,325 @@
+// bip39enwords.h
+// BIP39 English wordlist, packed (see bip39en.h)
+// v20261018-1
+
+// GENERATED by extras/tools/gen_bip39_packed.py: do not edit
+// Entry: 4-letter prefix, 5 bits per letter ('a' = 1, 0 = no letter), then suffix length (3 bits)
+// Suffixes (letters after the 4th) are concatenated in BIP39_EN_SUFFIXES, indexed per block of words
+// Included only by bip39en.cpp. Const data: on ESP32 it stays in flash (memory-mapped)
+
 #ifndef _BIP39ENWORDS_H
 #define _BIP39ENWORDS_H
 
-#define BIP39_EN_WORDS_NUM 2048
+#include <stdint.h>
+
+#define BIP39_EN_ENTRY_BYTES 3
+#define BIP39_EN_BLOCK_WORDS 32
+#define BIP39_EN_SUFFIXES_LEN 2979
 
-const char* BIP39_EN_Wordlist[BIP39_EN_WORDS_NUM] = {
-            "abandon",
-            "ability",
-            "able",
-            "about",
-            "above",
-            "absent",
-            "absorb",
-            "abstract",
-            "absurd",
-            "abuse",
-            "access",
-            "accident",
-            "account",
-            "accuse",
-            "achieve",
-            "acid",
-            "acoustic",
-            "acquire",
-            "across",
-            "act",
-            "action",
-            "actor",
-            "actress",
-            "actual",
-            "adapt",
-            "add",
-            "addict",
-            "address",
-            "adjust",
-            "admit",
-            "adult",
-            "advance",
-            "advice",
-            "aerobic",
-            "affair",
-            "afford",
-            "afraid",
-            "again",
-            "age",
-            "agent",
-            "agree",
-            "ahead",
-            "aim",
-            "air",
-            "airport",
-            "aisle",
-            "alarm",
-            "album",
-            "alcohol",
-            "alert",
-            "alien",
-            "all",
-            "alley",
-            "allow",
-            "almost",
-            "alone",
-            "alpha",
-            "already",
-            "also",
-            "alter",
-            "always",
-            "amateur",
-            "amazing",
-            "among",
-            "amount",
-            "amused",
-            "analyst",
-            "anchor",
-            "ancient",
-            "anger",
-            "angle",
-            "angry",
-            "animal",
-            "ankle",
-            "announce",
-            "annual",
-            "another",
-            "answer",
-            "antenna",
-            "antique",
-            "anxiety",
-            "any",
-            "apart",
-            "apology",
-            "appear",
-            "apple",
-            "approve",
-            "april",
-            "arch",
-            "arctic",
-            "area",
-            "arena",
-            "argue",
-            "arm",
-            "armed",
-            "armor",
-            "army",
-            "around",
-            "arrange",
-            "arrest",
-            "arrive",
-            "arrow",
-            "art",
-            "artefact",
-            "artist",
-            "artwork",
-            "ask",
-            "aspect",
-            "assault",
-            "asset",
-            "assist",
-            "assume",
-            "asthma",
-            "athlete",
-            "atom",
-            "attack",
-            "attend",
-            "attitude",
-            "attract",
-            "auction",
-            "audit",
-            "august",
-            "aunt",
-            "author",
-            "auto",
-            "autumn",
-            "average",
-            "avocado",
-            "avoid",
-            "awake",
-            "aware",
-            "away",
-            "awesome",
-            "awful",
-            "awkward",
-            "axis",
-            "baby",
-            "bachelor",
-            "bacon",
-            "badge",
-            "bag",
-            "balance",
-            "balcony",
-            "ball",
-            "bamboo",
-            "banana",
-            "banner",
-            "bar",
-            "barely",
-            "bargain",
-            "barrel",
-            "base",
-            "basic",
-            "basket",
-            "battle",
-            "beach",
-            "bean",
-            "beauty",
-            "because",
-            "become",
-            "beef",
-            "before",
-            "begin",
-            "behave",
-            "behind",
-            "believe",
-            "below",
-            "belt",
-            "bench",
-            "benefit",
-            "best",
-            "betray",
-            "better",
-            "between",
-            "beyond",
-            "bicycle",
-            "bid",
-            "bike",
-            "bind",
-            "biology",
-            "bird",
-            "birth",
-            "bitter",
-            "black",
-            "blade",
-            "blame",
-            "blanket",
-            "blast",
-            "bleak",
-            "bless",
-            "blind",
-            "blood",
-            "blossom",
-            "blouse",
-            "blue",
-            "blur",
-            "blush",
-            "board",
-            "boat",
-            "body",
-            "boil",
-            "bomb",
-            "bone",
-            "bonus",
-            "book",
-            "boost",
-            "border",
-            "boring",
-            "borrow",
-            "boss",
-            "bottom",
-            "bounce",
-            "box",
-            "boy",
-            "bracket",
-            "brain",
-            "brand",
-            "brass",
-            "brave",
-            "bread",
-            "breeze",
-            "brick",
-            "bridge",
-            "brief",
-            "bright",
-            "bring",
-            "brisk",
-            "broccoli",
-            "broken",
-            "bronze",
-            "broom",
-            "brother",
-            "brown",
-            "brush",
-            "bubble",
-            "buddy",
-            "budget",
-            "buffalo",
-            "build",
-            "bulb",
-            "bulk",
-            "bullet",
-            "bundle",
-            "bunker",
-            "burden",
-            "burger",
-            "burst",
-            "bus",
-            "business",
-            "busy",
-            "butter",
-            "buyer",
-            "buzz",
-            "cabbage",
-            "cabin",
-            "cable",
-            "cactus",
-            "cage",
-            "cake",
-            "call",
-            "calm",
-            "camera",
-            "camp",
-            "can",
-            "canal",
-            "cancel",
-            "candy",
-            "cannon",
-            "canoe",
-            "canvas",
-            "canyon",
-            "capable",
-            "capital",
-            "captain",
-            "car",
-            "carbon",
-            "card",
-            "cargo",
-            "carpet",
-            "carry",
-            "cart",
-            "case",
-            "cash",
-            "casino",
-            "castle",
-            "casual",
-            "cat",
-            "catalog",
-            "catch",
-            "category",
-            "cattle",
-            "caught",
-            "cause",
-            "caution",
-            "cave",
-            "ceiling",
-            "celery",
-            "cement",
-            "census",
-            "century",
-            "cereal",
-            "certain",
-            "chair",
-            "chalk",
-            "champion",
-            "change",
-            "chaos",
-            "chapter",
-            "charge",
-            "chase",
-            "chat",
-            "cheap",
-            "check",
-            "cheese",
-            "chef",
-            "cherry",
-            "chest",
-            "chicken",
-            "chief",
-            "child",
-            "chimney",
-            "choice",
-            "choose",
-            "chronic",
-            "chuckle",
-            "chunk",
-            "churn",
-            "cigar",
-            "cinnamon",
-            "circle",
-            "citizen",
-            "city",
-            "civil",
-            "claim",
-            "clap",
-            "clarify",
-            "claw",
-            "clay",
-            "clean",
-            "clerk",
-            "clever",
-            "click",
-            "client",
-            "cliff",
-            "climb",
-            "clinic",
-            "clip",
-            "clock",
-            "clog",
-            "close",
-            "cloth",
-            "cloud",
-            "clown",
-            "club",
-            "clump",
-            "cluster",
-            "clutch",
-            "coach",
-            "coast",
-            "coconut",
-            "code",
-            "coffee",
-            "coil",
-            "coin",
-            "collect",
-            "color",
-            "column",
-            "combine",
-            "come",
-            "comfort",
-            "comic",
-            "common",
-            "company",
-            "concert",
-            "conduct",
-            "confirm",
-            "congress",
-            "connect",
-            "consider",
-            "control",
-            "convince",
-            "cook",
-            "cool",
-            "copper",
-            "copy",
-            "coral",
-            "core",
-            "corn",
-            "correct",
-            "cost",
-            "cotton",
-            "couch",
-            "country",
-            "couple",
-            "course",
-            "cousin",
-            "cover",
-            "coyote",
-            "crack",
-            "cradle",
-            "craft",
-            "cram",
-            "crane",
-            "crash",
-            "crater",
-            "crawl",
-            "crazy",
-            "cream",
-            "credit",
-            "creek",
-            "crew",
-            "cricket",
-            "crime",
-            "crisp",
-            "critic",
-            "crop",
-            "cross",
-            "crouch",
-            "crowd",
-            "crucial",
-            "cruel",
-            "cruise",
-            "crumble",
-            "crunch",
-            "crush",
-            "cry",
-            "crystal",
-            "cube",
-            "culture",
-            "cup",
-            "cupboard",
-            "curious",
-            "current",
-            "curtain",
-            "curve",
-            "cushion",
-            "custom",
-            "cute",
-            "cycle",
-            "dad",
-            "damage",
-            "damp",
-            "dance",
-            "danger",
-            "daring",
-            "dash",
-            "daughter",
-            "dawn",
-            "day",
-            "deal",
-            "debate",
-            "debris",
-            "decade",
-            "december",
-            "decide",
-            "decline",
-            "decorate",
-            "decrease",
-            "deer",
-            "defense",
-            "define",
-            "defy",
-            "degree",
-            "delay",
-            "deliver",
-            "demand",
-            "demise",
-            "denial",
-            "dentist",
-            "deny",
-            "depart",
-            "depend",
-            "deposit",
-            "depth",
-            "deputy",
-            "derive",
-            "describe",
-            "desert",
-            "design",
-            "desk",
-            "despair",
-            "destroy",
-            "detail",
-            "detect",
-            "develop",
-            "device",
-            "devote",
-            "diagram",
-            "dial",
-            "diamond",
-            "diary",
-            "dice",
-            "diesel",
-            "diet",
-            "differ",
-            "digital",
-            "dignity",
-            "dilemma",
-            "dinner",
-            "dinosaur",
-            "direct",
-            "dirt",
-            "disagree",
-            "discover",
-            "disease",
-            "dish",
-            "dismiss",
-            "disorder",
-            "display",
-            "distance",
-            "divert",
-            "divide",
-            "divorce",
-            "dizzy",
-            "doctor",
-            "document",
-            "dog",
-            "doll",
-            "dolphin",
-            "domain",
-            "donate",
-            "donkey",
-            "donor",
-            "door",
-            "dose",
-            "double",
-            "dove",
-            "draft",
-            "dragon",
-            "drama",
-            "drastic",
-            "draw",
-            "dream",
-            "dress",
-            "drift",
-            "drill",
-            "drink",
-            "drip",
-            "drive",
-            "drop",
-            "drum",
-            "dry",
-            "duck",
-            "dumb",
-            "dune",
-            "during",
-            "dust",
-            "dutch",
-            "duty",
-            "dwarf",
-            "dynamic",
-            "eager",
-            "eagle",
-            "early",
-            "earn",
-            "earth",
-            "easily",
-            "east",
-            "easy",
-            "echo",
-            "ecology",
-            "economy",
-            "edge",
-            "edit",
-            "educate",
-            "effort",
-            "egg",
-            "eight",
-            "either",
-            "elbow",
-            "elder",
-            "electric",
-            "elegant",
-            "element",
-            "elephant",
-            "elevator",
-            "elite",
-            "else",
-            "embark",
-            "embody",
-            "embrace",
-            "emerge",
-            "emotion",
-            "employ",
-            "empower",
-            "empty",
-            "enable",
-            "enact",
-            "end",
-            "endless",
-            "endorse",
-            "enemy",
-            "energy",
-            "enforce",
-            "engage",
-            "engine",
-            "enhance",
-            "enjoy",
-            "enlist",
-            "enough",
-            "enrich",
-            "enroll",
-            "ensure",
-            "enter",
-            "entire",
-            "entry",
-            "envelope",
-            "episode",
-            "equal",
-            "equip",
-            "era",
-            "erase",
-            "erode",
-            "erosion",
-            "error",
-            "erupt",
-            "escape",
-            "essay",
-            "essence",
-            "estate",
-            "eternal",
-            "ethics",
-            "evidence",
-            "evil",
-            "evoke",
-            "evolve",
-            "exact",
-            "example",
-            "excess",
-            "exchange",
-            "excite",
-            "exclude",
-            "excuse",
-            "execute",
-            "exercise",
-            "exhaust",
-            "exhibit",
-            "exile",
-            "exist",
-            "exit",
-            "exotic",
-            "expand",
-            "expect",
-            "expire",
-            "explain",
-            "expose",
-            "express",
-            "extend",
-            "extra",
-            "eye",
-            "eyebrow",
-            "fabric",
-            "face",
-            "faculty",
-            "fade",
-            "faint",
-            "faith",
-            "fall",
-            "false",
-            "fame",
-            "family",
-            "famous",
-            "fan",
-            "fancy",
-            "fantasy",
-            "farm",
-            "fashion",
-            "fat",
-            "fatal",
-            "father",
-            "fatigue",
-            "fault",
-            "favorite",
-            "feature",
-            "february",
-            "federal",
-            "fee",
-            "feed",
-            "feel",
-            "female",
-            "fence",
-            "festival",
-            "fetch",
-            "fever",
-            "few",
-            "fiber",
-            "fiction",
-            "field",
-            "figure",
-            "file",
-            "film",
-            "filter",
-            "final",
-            "find",
-            "fine",
-            "finger",
-            "finish",
-            "fire",
-            "firm",
-            "first",
-            "fiscal",
-            "fish",
-            "fit",
-            "fitness",
-            "fix",
-            "flag",
-            "flame",
-            "flash",
-            "flat",
-            "flavor",
-            "flee",
-            "flight",
-            "flip",
-            "float",
-            "flock",
-            "floor",
-            "flower",
-            "fluid",
-            "flush",
-            "fly",
-            "foam",
-            "focus",
-            "fog",
-            "foil",
-            "fold",
-            "follow",
-            "food",
-            "foot",
-            "force",
-            "forest",
-            "forget",
-            "fork",
-            "fortune",
-            "forum",
-            "forward",
-            "fossil",
-            "foster",
-            "found",
-            "fox",
-            "fragile",
-            "frame",
-            "frequent",
-            "fresh",
-            "friend",
-            "fringe",
-            "frog",
-            "front",
-            "frost",
-            "frown",
-            "frozen",
-            "fruit",
-            "fuel",
-            "fun",
-            "funny",
-            "furnace",
-            "fury",
-            "future",
-            "gadget",
-            "gain",
-            "galaxy",
-            "gallery",
-            "game",
-            "gap",
-            "garage",
-            "garbage",
-            "garden",
-            "garlic",
-            "garment",
-            "gas",
-            "gasp",
-            "gate",
-            "gather",
-            "gauge",
-            "gaze",
-            "general",
-            "genius",
-            "genre",
-            "gentle",
-            "genuine",
-            "gesture",
-            "ghost",
-            "giant",
-            "gift",
-            "giggle",
-            "ginger",
-            "giraffe",
-            "girl",
-            "give",
-            "glad",
-            "glance",
-            "glare",
-            "glass",
-            "glide",
-            "glimpse",
-            "globe",
-            "gloom",
-            "glory",
-            "glove",
-            "glow",
-            "glue",
-            "goat",
-            "goddess",
-            "gold",
-            "good",
-            "goose",
-            "gorilla",
-            "gospel",
-            "gossip",
-            "govern",
-            "gown",
-            "grab",
-            "grace",
-            "grain",
-            "grant",
-            "grape",
-            "grass",
-            "gravity",
-            "great",
-            "green",
-            "grid",
-            "grief",
-            "grit",
-            "grocery",
-            "group",
-            "grow",
-            "grunt",
-            "guard",
-            "guess",
-            "guide",
-            "guilt",
-            "guitar",
-            "gun",
-            "gym",
-            "habit",
-            "hair",
-            "half",
-            "hammer",
-            "hamster",
-            "hand",
-            "happy",
-            "harbor",
-            "hard",
-            "harsh",
-            "harvest",
-            "hat",
-            "have",
-            "hawk",
-            "hazard",
-            "head",
-            "health",
-            "heart",
-            "heavy",
-            "hedgehog",
-            "height",
-            "hello",
-            "helmet",
-            "help",
-            "hen",
-            "hero",
-            "hidden",
-            "high",
-            "hill",
-            "hint",
-            "hip",
-            "hire",
-            "history",
-            "hobby",
-            "hockey",
-            "hold",
-            "hole",
-            "holiday",
-            "hollow",
-            "home",
-            "honey",
-            "hood",
-            "hope",
-            "horn",
-            "horror",
-            "horse",
-            "hospital",
-            "host",
-            "hotel",
-            "hour",
-            "hover",
-            "hub",
-            "huge",
-            "human",
-            "humble",
-            "humor",
-            "hundred",
-            "hungry",
-            "hunt",
-            "hurdle",
-            "hurry",
-            "hurt",
-            "husband",
-            "hybrid",
-            "ice",
-            "icon",
-            "idea",
-            "identify",
-            "idle",
-            "ignore",
-            "ill",
-            "illegal",
-            "illness",
-            "image",
-            "imitate",
-            "immense",
-            "immune",
-            "impact",
-            "impose",
-            "improve",
-            "impulse",
-            "inch",
-            "include",
-            "income",
-            "increase",
-            "index",
-            "indicate",
-            "indoor",
-            "industry",
-            "infant",
-            "inflict",
-            "inform",
-            "inhale",
-            "inherit",
-            "initial",
-            "inject",
-            "injury",
-            "inmate",
-            "inner",
-            "innocent",
-            "input",
-            "inquiry",
-            "insane",
-            "insect",
-            "inside",
-            "inspire",
-            "install",
-            "intact",
-            "interest",
-            "into",
-            "invest",
-            "invite",
-            "involve",
-            "iron",
-            "island",
-            "isolate",
-            "issue",
-            "item",
-            "ivory",
-            "jacket",
-            "jaguar",
-            "jar",
-            "jazz",
-            "jealous",
-            "jeans",
-            "jelly",
-            "jewel",
-            "job",
-            "join",
-            "joke",
-            "journey",
-            "joy",
-            "judge",
-            "juice",
-            "jump",
-            "jungle",
-            "junior",
-            "junk",
-            "just",
-            "kangaroo",
-            "keen",
-            "keep",
-            "ketchup",
-            "key",
-            "kick",
-            "kid",
-            "kidney",
-            "kind",
-            "kingdom",
-            "kiss",
-            "kit",
-            "kitchen",
-            "kite",
-            "kitten",
-            "kiwi",
-            "knee",
-            "knife",
-            "knock",
-            "know",
-            "lab",
-            "label",
-            "labor",
-            "ladder",
-            "lady",
-            "lake",
-            "lamp",
-            "language",
-            "laptop",
-            "large",
-            "later",
-            "latin",
-            "laugh",
-            "laundry",
-            "lava",
-            "law",
-            "lawn",
-            "lawsuit",
-            "layer",
-            "lazy",
-            "leader",
-            "leaf",
-            "learn",
-            "leave",
-            "lecture",
-            "left",
-            "leg",
-            "legal",
-            "legend",
-            "leisure",
-            "lemon",
-            "lend",
-            "length",
-            "lens",
-            "leopard",
-            "lesson",
-            "letter",
-            "level",
-            "liar",
-            "liberty",
-            "library",
-            "license",
-            "life",
-            "lift",
-            "light",
-            "like",
-            "limb",
-            "limit",
-            "link",
-            "lion",
-            "liquid",
-            "list",
-            "little",
-            "live",
-            "lizard",
-            "load",
-            "loan",
-            "lobster",
-            "local",
-            "lock",
-            "logic",
-            "lonely",
-            "long",
-            "loop",
-            "lottery",
-            "loud",
-            "lounge",
-            "love",
-            "loyal",
-            "lucky",
-            "luggage",
-            "lumber",
-            "lunar",
-            "lunch",
-            "luxury",
-            "lyrics",
-            "machine",
-            "mad",
-            "magic",
-            "magnet",
-            "maid",
-            "mail",
-            "main",
-            "major",
-            "make",
-            "mammal",
-            "man",
-            "manage",
-            "mandate",
-            "mango",
-            "mansion",
-            "manual",
-            "maple",
-            "marble",
-            "march",
-            "margin",
-            "marine",
-            "market",
-            "marriage",
-            "mask",
-            "mass",
-            "master",
-            "match",
-            "material",
-            "math",
-            "matrix",
-            "matter",
-            "maximum",
-            "maze",
-            "meadow",
-            "mean",
-            "measure",
-            "meat",
-            "mechanic",
-            "medal",
-            "media",
-            "melody",
-            "melt",
-            "member",
-            "memory",
-            "mention",
-            "menu",
-            "mercy",
-            "merge",
-            "merit",
-            "merry",
-            "mesh",
-            "message",
-            "metal",
-            "method",
-            "middle",
-            "midnight",
-            "milk",
-            "million",
-            "mimic",
-            "mind",
-            "minimum",
-            "minor",
-            "minute",
-            "miracle",
-            "mirror",
-            "misery",
-            "miss",
-            "mistake",
-            "mix",
-            "mixed",
-            "mixture",
-            "mobile",
-            "model",
-            "modify",
-            "mom",
-            "moment",
-            "monitor",
-            "monkey",
-            "monster",
-            "month",
-            "moon",
-            "moral",
-            "more",
-            "morning",
-            "mosquito",
-            "mother",
-            "motion",
-            "motor",
-            "mountain",
-            "mouse",
-            "move",
-            "movie",
-            "much",
-            "muffin",
-            "mule",
-            "multiply",
-            "muscle",
-            "museum",
-            "mushroom",
-            "music",
-            "must",
-            "mutual",
-            "myself",
-            "mystery",
-            "myth",
-            "naive",
-            "name",
-            "napkin",
-            "narrow",
-            "nasty",
-            "nation",
-            "nature",
-            "near",
-            "neck",
-            "need",
-            "negative",
-            "neglect",
-            "neither",
-            "nephew",
-            "nerve",
-            "nest",
-            "net",
-            "network",
-            "neutral",
-            "never",
-            "news",
-            "next",
-            "nice",
-            "night",
-            "noble",
-            "noise",
-            "nominee",
-            "noodle",
-            "normal",
-            "north",
-            "nose",
-            "notable",
-            "note",
-            "nothing",
-            "notice",
-            "novel",
-            "now",
-            "nuclear",
-            "number",
-            "nurse",
-            "nut",
-            "oak",
-            "obey",
-            "object",
-            "oblige",
-            "obscure",
-            "observe",
-            "obtain",
-            "obvious",
-            "occur",
-            "ocean",
-            "october",
-            "odor",
-            "off",
-            "offer",
-            "office",
-            "often",
-            "oil",
-            "okay",
-            "old",
-            "olive",
-            "olympic",
-            "omit",
-            "once",
-            "one",
-            "onion",
-            "online",
-            "only",
-            "open",
-            "opera",
-            "opinion",
-            "oppose",
-            "option",
-            "orange",
-            "orbit",
-            "orchard",
-            "order",
-            "ordinary",
-            "organ",
-            "orient",
-            "original",
-            "orphan",
-            "ostrich",
-            "other",
-            "outdoor",
-            "outer",
-            "output",
-            "outside",
-            "oval",
-            "oven",
-            "over",
-            "own",
-            "owner",
-            "oxygen",
-            "oyster",
-            "ozone",
-            "pact",
-            "paddle",
-            "page",
-            "pair",
-            "palace",
-            "palm",
-            "panda",
-            "panel",
-            "panic",
-            "panther",
-            "paper",
-            "parade",
-            "parent",
-            "park",
-            "parrot",
-            "party",
-            "pass",
-            "patch",
-            "path",
-            "patient",
-            "patrol",
-            "pattern",
-            "pause",
-            "pave",
-            "payment",
-            "peace",
-            "peanut",
-            "pear",
-            "peasant",
-            "pelican",
-            "pen",
-            "penalty",
-            "pencil",
-            "people",
-            "pepper",
-            "perfect",
-            "permit",
-            "person",
-            "pet",
-            "phone",
-            "photo",
-            "phrase",
-            "physical",
-            "piano",
-            "picnic",
-            "picture",
-            "piece",
-            "pig",
-            "pigeon",
-            "pill",
-            "pilot",
-            "pink",
-            "pioneer",
-            "pipe",
-            "pistol",
-            "pitch",
-            "pizza",
-            "place",
-            "planet",
-            "plastic",
-            "plate",
-            "play",
-            "please",
-            "pledge",
-            "pluck",
-            "plug",
-            "plunge",
-            "poem",
-            "poet",
-            "point",
-            "polar",
-            "pole",
-            "police",
-            "pond",
-            "pony",
-            "pool",
-            "popular",
-            "portion",
-            "position",
-            "possible",
-            "post",
-            "potato",
-            "pottery",
-            "poverty",
-            "powder",
-            "power",
-            "practice",
-            "praise",
-            "predict",
-            "prefer",
-            "prepare",
-            "present",
-            "pretty",
-            "prevent",
-            "price",
-            "pride",
-            "primary",
-            "print",
-            "priority",
-            "prison",
-            "private",
-            "prize",
-            "problem",
-            "process",
-            "produce",
-            "profit",
-            "program",
-            "project",
-            "promote",
-            "proof",
-            "property",
-            "prosper",
-            "protect",
-            "proud",
-            "provide",
-            "public",
-            "pudding",
-            "pull",
-            "pulp",
-            "pulse",
-            "pumpkin",
-            "punch",
-            "pupil",
-            "puppy",
-            "purchase",
-            "purity",
-            "purpose",
-            "purse",
-            "push",
-            "put",
-            "puzzle",
-            "pyramid",
-            "quality",
-            "quantum",
-            "quarter",
-            "question",
-            "quick",
-            "quit",
-            "quiz",
-            "quote",
-            "rabbit",
-            "raccoon",
-            "race",
-            "rack",
-            "radar",
-            "radio",
-            "rail",
-            "rain",
-            "raise",
-            "rally",
-            "ramp",
-            "ranch",
-            "random",
-            "range",
-            "rapid",
-            "rare",
-            "rate",
-            "rather",
-            "raven",
-            "raw",
-            "razor",
-            "ready",
-            "real",
-            "reason",
-            "rebel",
-            "rebuild",
-            "recall",
-            "receive",
-            "recipe",
-            "record",
-            "recycle",
-            "reduce",
-            "reflect",
-            "reform",
-            "refuse",
-            "region",
-            "regret",
-            "regular",
-            "reject",
-            "relax",
-            "release",
-            "relief",
-            "rely",
-            "remain",
-            "remember",
-            "remind",
-            "remove",
-            "render",
-            "renew",
-            "rent",
-            "reopen",
-            "repair",
-            "repeat",
-            "replace",
-            "report",
-            "require",
-            "rescue",
-            "resemble",
-            "resist",
-            "resource",
-            "response",
-            "result",
-            "retire",
-            "retreat",
-            "return",
-            "reunion",
-            "reveal",
-            "review",
-            "reward",
-            "rhythm",
-            "rib",
-            "ribbon",
-            "rice",
-            "rich",
-            "ride",
-            "ridge",
-            "rifle",
-            "right",
-            "rigid",
-            "ring",
-            "riot",
-            "ripple",
-            "risk",
-            "ritual",
-            "rival",
-            "river",
-            "road",
-            "roast",
-            "robot",
-            "robust",
-            "rocket",
-            "romance",
-            "roof",
-            "rookie",
-            "room",
-            "rose",
-            "rotate",
-            "rough",
-            "round",
-            "route",
-            "royal",
-            "rubber",
-            "rude",
-            "rug",
-            "rule",
-            "run",
-            "runway",
-            "rural",
-            "sad",
-            "saddle",
-            "sadness",
-            "safe",
-            "sail",
-            "salad",
-            "salmon",
-            "salon",
-            "salt",
-            "salute",
-            "same",
-            "sample",
-            "sand",
-            "satisfy",
-            "satoshi",
-            "sauce",
-            "sausage",
-            "save",
-            "say",
-            "scale",
-            "scan",
-            "scare",
-            "scatter",
-            "scene",
-            "scheme",
-            "school",
-            "science",
-            "scissors",
-            "scorpion",
-            "scout",
-            "scrap",
-            "screen",
-            "script",
-            "scrub",
-            "sea",
-            "search",
-            "season",
-            "seat",
-            "second",
-            "secret",
-            "section",
-            "security",
-            "seed",
-            "seek",
-            "segment",
-            "select",
-            "sell",
-            "seminar",
-            "senior",
-            "sense",
-            "sentence",
-            "series",
-            "service",
-            "session",
-            "settle",
-            "setup",
-            "seven",
-            "shadow",
-            "shaft",
-            "shallow",
-            "share",
-            "shed",
-            "shell",
-            "sheriff",
-            "shield",
-            "shift",
-            "shine",
-            "ship",
-            "shiver",
-            "shock",
-            "shoe",
-            "shoot",
-            "shop",
-            "short",
-            "shoulder",
-            "shove",
-            "shrimp",
-            "shrug",
-            "shuffle",
-            "shy",
-            "sibling",
-            "sick",
-            "side",
-            "siege",
-            "sight",
-            "sign",
-            "silent",
-            "silk",
-            "silly",
-            "silver",
-            "similar",
-            "simple",
-            "since",
-            "sing",
-            "siren",
-            "sister",
-            "situate",
-            "six",
-            "size",
-            "skate",
-            "sketch",
-            "ski",
-            "skill",
-            "skin",
-            "skirt",
-            "skull",
-            "slab",
-            "slam",
-            "sleep",
-            "slender",
-            "slice",
-            "slide",
-            "slight",
-            "slim",
-            "slogan",
-            "slot",
-            "slow",
-            "slush",
-            "small",
-            "smart",
-            "smile",
-            "smoke",
-            "smooth",
-            "snack",
-            "snake",
-            "snap",
-            "sniff",
-            "snow",
-            "soap",
-            "soccer",
-            "social",
-            "sock",
-            "soda",
-            "soft",
-            "solar",
-            "soldier",
-            "solid",
-            "solution",
-            "solve",
-            "someone",
-            "song",
-            "soon",
-            "sorry",
-            "sort",
-            "soul",
-            "sound",
-            "soup",
-            "source",
-            "south",
-            "space",
-            "spare",
-            "spatial",
-            "spawn",
-            "speak",
-            "special",
-            "speed",
-            "spell",
-            "spend",
-            "sphere",
-            "spice",
-            "spider",
-            "spike",
-            "spin",
-            "spirit",
-            "split",
-            "spoil",
-            "sponsor",
-            "spoon",
-            "sport",
-            "spot",
-            "spray",
-            "spread",
-            "spring",
-            "spy",
-            "square",
-            "squeeze",
-            "squirrel",
-            "stable",
-            "stadium",
-            "staff",
-            "stage",
-            "stairs",
-            "stamp",
-            "stand",
-            "start",
-            "state",
-            "stay",
-            "steak",
-            "steel",
-            "stem",
-            "step",
-            "stereo",
-            "stick",
-            "still",
-            "sting",
-            "stock",
-            "stomach",
-            "stone",
-            "stool",
-            "story",
-            "stove",
-            "strategy",
-            "street",
-            "strike",
-            "strong",
-            "struggle",
-            "student",
-            "stuff",
-            "stumble",
-            "style",
-            "subject",
-            "submit",
-            "subway",
-            "success",
-            "such",
-            "sudden",
-            "suffer",
-            "sugar",
-            "suggest",
-            "suit",
-            "summer",
-            "sun",
-            "sunny",
-            "sunset",
-            "super",
-            "supply",
-            "supreme",
-            "sure",
-            "surface",
-            "surge",
-            "surprise",
-            "surround",
-            "survey",
-            "suspect",
-            "sustain",
-            "swallow",
-            "swamp",
-            "swap",
-            "swarm",
-            "swear",
-            "sweet",
-            "swift",
-            "swim",
-            "swing",
-            "switch",
-            "sword",
-            "symbol",
-            "symptom",
-            "syrup",
-            "system",
-            "table",
-            "tackle",
-            "tag",
-            "tail",
-            "talent",
-            "talk",
-            "tank",
-            "tape",
-            "target",
-            "task",
-            "taste",
-            "tattoo",
-            "taxi",
-            "teach",
-            "team",
-            "tell",
-            "ten",
-            "tenant",
-            "tennis",
-            "tent",
-            "term",
-            "test",
-            "text",
-            "thank",
-            "that",
-            "theme",
-            "then",
-            "theory",
-            "there",
-            "they",
-            "thing",
-            "this",
-            "thought",
-            "three",
-            "thrive",
-            "throw",
-            "thumb",
-            "thunder",
-            "ticket",
-            "tide",
-            "tiger",
-            "tilt",
-            "timber",
-            "time",
-            "tiny",
-            "tip",
-            "tired",
-            "tissue",
-            "title",
-            "toast",
-            "tobacco",
-            "today",
-            "toddler",
-            "toe",
-            "together",
-            "toilet",
-            "token",
-            "tomato",
-            "tomorrow",
-            "tone",
-            "tongue",
-            "tonight",
-            "tool",
-            "tooth",
-            "top",
-            "topic",
-            "topple",
-            "torch",
-            "tornado",
-            "tortoise",
-            "toss",
-            "total",
-            "tourist",
-            "toward",
-            "tower",
-            "town",
-            "toy",
-            "track",
-            "trade",
-            "traffic",
-            "tragic",
-            "train",
-            "transfer",
-            "trap",
-            "trash",
-            "travel",
-            "tray",
-            "treat",
-            "tree",
-            "trend",
-            "trial",
-            "tribe",
-            "trick",
-            "trigger",
-            "trim",
-            "trip",
-            "trophy",
-            "trouble",
-            "truck",
-            "true",
-            "truly",
-            "trumpet",
-            "trust",
-            "truth",
-            "try",
-            "tube",
-            "tuition",
-            "tumble",
-            "tuna",
-            "tunnel",
-            "turkey",
-            "turn",
-            "turtle",
-            "twelve",
-            "twenty",
-            "twice",
-            "twin",
-            "twist",
-            "two",
-            "type",
-            "typical",
-            "ugly",
-            "umbrella",
-            "unable",
-            "unaware",
-            "uncle",
-            "uncover",
-            "under",
-            "undo",
-            "unfair",
-            "unfold",
-            "unhappy",
-            "uniform",
-            "unique",
-            "unit",
-            "universe",
-            "unknown",
-            "unlock",
-            "until",
-            "unusual",
-            "unveil",
-            "update",
-            "upgrade",
-            "uphold",
-            "upon",
-            "upper",
-            "upset",
-            "urban",
-            "urge",
-            "usage",
-            "use",
-            "used",
-            "useful",
-            "useless",
-            "usual",
-            "utility",
-            "vacant",
-            "vacuum",
-            "vague",
-            "valid",
-            "valley",
-            "valve",
-            "van",
-            "vanish",
-            "vapor",
-            "various",
-            "vast",
-            "vault",
-            "vehicle",
-            "velvet",
-            "vendor",
-            "venture",
-            "venue",
-            "verb",
-            "verify",
-            "version",
-            "very",
-            "vessel",
-            "veteran",
-            "viable",
-            "vibrant",
-            "vicious",
-            "victory",
-            "video",
-            "view",
-            "village",
-            "vintage",
-            "violin",
-            "virtual",
-            "virus",
-            "visa",
-            "visit",
-            "visual",
-            "vital",
-            "vivid",
-            "vocal",
-            "voice",
-            "void",
-            "volcano",
-            "volume",
-            "vote",
-            "voyage",
-            "wage",
-            "wagon",
-            "wait",
-            "walk",
-            "wall",
-            "walnut",
-            "want",
-            "warfare",
-            "warm",
-            "warrior",
-            "wash",
-            "wasp",
-            "waste",
-            "water",
-            "wave",
-            "way",
-            "wealth",
-            "weapon",
-            "wear",
-            "weasel",
-            "weather",
-            "web",
-            "wedding",
-            "weekend",
-            "weird",
-            "welcome",
-            "west",
-            "wet",
-            "whale",
-            "what",
-            "wheat",
-            "wheel",
-            "when",
-            "where",
-            "whip",
-            "whisper",
-            "wide",
-            "width",
-            "wife",
-            "wild",
-            "will",
-            "win",
-            "window",
-            "wine",
-            "wing",
-            "wink",
-            "winner",
-            "winter",
-            "wire",
-            "wisdom",
-            "wise",
-            "wish",
-            "witness",
-            "wolf",
-            "woman",
-            "wonder",
-            "wood",
-            "wool",
-            "word",
-            "work",
-            "world",
-            "worry",
-            "worth",
-            "wrap",
-            "wreck",
-            "wrestle",
-            "wrist",
-            "write",
-            "wrong",
-            "yard",
-            "year",
-            "yellow",
-            "you",
-            "young",
-            "youth",
-            "zebra",
-            "zero",
-            "zone",
-            "zoo"
+static const uint8_t BIP39_EN_ENTRIES[BIP39_EN_WORDS_NUM * BIP39_EN_ENTRY_BYTES] =
+{
+  0x04, 0x41, 0x73,  0x04, 0x49, 0x63,  0x04, 0x4c, 0x28,  0x04, 0x4f, 0xa9,  0x04, 0x4f, 0xb1,  0x04, 0x53, 0x2a,  0x04, 0x53, 0x7a,  0x04, 0x53, 0xa4,  // abandon ability able about above absent absorb abstract
+  0x04, 0x53, 0xaa,  0x04, 0x55, 0x99,  0x04, 0x63, 0x2a,  0x04, 0x63, 0x4c,  0x04, 0x63, 0x7b,  0x04, 0x63, 0xaa,  0x04, 0x68, 0x4b,  0x04, 0x69, 0x20,  // absurd abuse access accident account accuse achieve acid
+  0x04, 0x6f, 0xac,  0x04, 0x71, 0xab,  0x04, 0x72, 0x7a,  0x04, 0x74, 0x00,  0x04, 0x74, 0x4a,  0x04, 0x74, 0x79,  0x04, 0x74, 0x93,  0x04, 0x74, 0xaa,  // acoustic acquire across act action actor actress actual
+  0x04, 0x81, 0x81,  0x04, 0x84, 0x00,  0x04, 0x84, 0x4a,  0x04, 0x84, 0x93,  0x04, 0x8a, 0xaa,  0x04, 0x8d, 0x49,  0x04, 0x95, 0x61,  0x04, 0x96, 0x0b,  // adapt add addict address adjust admit adult advance
+  0x04, 0x96, 0x4a,  0x04, 0xb2, 0x7b,  0x04, 0xc6, 0x0a,  0x04, 0xc6, 0x7a,  0x04, 0xd2, 0x0a,  0x04, 0xe1, 0x49,  0x04, 0xe5, 0x00,  0x04, 0xe5, 0x71,  // advice aerobic affair afford afraid again age agent
+  0x04, 0xf2, 0x29,  0x05, 0x05, 0x09,  0x05, 0x2d, 0x00,  0x05, 0x32, 0x00,  0x05, 0x32, 0x83,  0x05, 0x33, 0x61,  0x05, 0x81, 0x91,  0x05, 0x82, 0xa9,  // agree ahead aim air airport aisle alarm album
+  0x05, 0x83, 0x7b,  0x05, 0x85, 0x91,  0x05, 0x89, 0x29,  0x05, 0x8c, 0x00,  0x05, 0x8c, 0x29,  0x05, 0x8c, 0x79,  0x05, 0x8d, 0x7a,  0x05, 0x8f, 0x71,  // alcohol alert alien all alley allow almost alone
+  0x05, 0x90, 0x41,  0x05, 0x92, 0x2b,  0x05, 0x93, 0x78,  0x05, 0x94, 0x29,  0x05, 0x97, 0x0a,  0x05, 0xa1, 0xa3,  0x05, 0xa1, 0xd3,  0x05, 0xaf, 0x71,  // alpha already also alter always amateur amazing among
+  0x05, 0xaf, 0xaa,  0x05, 0xb5, 0x9a,  0x05, 0xc1, 0x63,  0x05, 0xc3, 0x42,  0x05, 0xc3, 0x4b,  0x05, 0xc7, 0x29,  0x05, 0xc7, 0x61,  0x05, 0xc7, 0x91,  // amount amused analyst anchor ancient anger angle angry
+  0x05, 0xc9, 0x6a,  0x05, 0xcb, 0x61,  0x05, 0xce, 0x7c,  0x05, 0xce, 0xaa,  0x05, 0xcf, 0xa3,  0x05, 0xd3, 0xba,  0x05, 0xd4, 0x2b,  0x05, 0xd4, 0x4b,  // animal ankle announce annual another answer antenna antique
+  0x05, 0xd8, 0x4b,  0x05, 0xd9, 0x00,  0x06, 0x01, 0x91,  0x06, 0x0f, 0x63,  0x06, 0x10, 0x2a,  0x06, 0x10, 0x61,  0x06, 0x10, 0x93,  0x06, 0x12, 0x49,  // anxiety any apart apology appear apple approve april
+  0x06, 0x43, 0x40,  0x06, 0x43, 0xa2,  0x06, 0x45, 0x08,  0x06, 0x45, 0x71,  0x06, 0x47, 0xa9,  0x06, 0x4d, 0x00,  0x06, 0x4d, 0x29,  0x06, 0x4d, 0x79,  // arch arctic area arena argue arm armed armor
+  0x06, 0x4d, 0xc8,  0x06, 0x4f, 0xaa,  0x06, 0x52, 0x0b,  0x06, 0x52, 0x2a,  0x06, 0x52, 0x4a,  0x06, 0x52, 0x79,  0x06, 0x54, 0x00,  0x06, 0x54, 0x2c,  // army around arrange arrest arrive arrow art artefact
+  0x06, 0x54, 0x4a,  0x06, 0x54, 0xbb,  0x06, 0x6b, 0x00,  0x06, 0x70, 0x2a,  0x06, 0x73, 0x0b,  0x06, 0x73, 0x29,  0x06, 0x73, 0x4a,  0x06, 0x73, 0xaa,  // artist artwork ask aspect assault asset assist assume
+  0x06, 0x74, 0x42,  0x06, 0x88, 0x63,  0x06, 0x8f, 0x68,  0x06, 0x94, 0x0a,  0x06, 0x94, 0x2a,  0x06, 0x94, 0x4c,  0x06, 0x94, 0x93,  0x06, 0xa3, 0xa3,  // asthma athlete atom attack attend attitude attract auction
+  0x06, 0xa4, 0x49,  0x06, 0xa7, 0xaa,  0x06, 0xae, 0xa0,  0x06, 0xb4, 0x42,  0x06, 0xb4, 0x78,  0x06, 0xb4, 0xaa,  0x06, 0xc5, 0x93,  0x06, 0xcf, 0x1b,  // audit august aunt author auto autumn average avocado
+  0x06, 0xcf, 0x49,  0x06, 0xe1, 0x59,  0x06, 0xe1, 0x91,  0x06, 0xe1, 0xc8,  0x06, 0xe5, 0x9b,  0x06, 0xe6, 0xa9,  0x06, 0xeb, 0xbb,  0x07, 0x09, 0x98,  // avoid awake aware away awesome awful awkward axis
+  0x08, 0x22, 0xc8,  0x08, 0x23, 0x44,  0x08, 0x23, 0x79,  0x08, 0x24, 0x39,  0x08, 0x27, 0x00,  0x08, 0x2c, 0x0b,  0x08, 0x2c, 0x1b,  0x08, 0x2c, 0x60,  // baby bachelor bacon badge bag balance balcony ball
+  0x08, 0x2d, 0x12,  0x08, 0x2e, 0x0a,  0x08, 0x2e, 0x72,  0x08, 0x32, 0x00,  0x08, 0x32, 0x2a,  0x08, 0x32, 0x3b,  0x08, 0x32, 0x92,  0x08, 0x33, 0x28,  // bamboo banana banner bar barely bargain barrel base
+  0x08, 0x33, 0x49,  0x08, 0x33, 0x5a,  0x08, 0x34, 0xa2,  0x08, 0xa1, 0x19,  0x08, 0xa1, 0x70,  0x08, 0xa1, 0xaa,  0x08, 0xa3, 0x0b,  0x08, 0xa3, 0x7a,  // basic basket battle beach bean beauty because become
+  0x08, 0xa5, 0x30,  0x08, 0xa6, 0x7a,  0x08, 0xa7, 0x49,  0x08, 0xa8, 0x0a,  0x08, 0xa8, 0x4a,  0x08, 0xac, 0x4b,  0x08, 0xac, 0x79,  0x08, 0xac, 0xa0,  // beef before begin behave behind believe below belt
+  0x08, 0xae, 0x19,  0x08, 0xae, 0x2b,  0x08, 0xb3, 0xa0,  0x08, 0xb4, 0x92,  0x08, 0xb4, 0xa2,  0x08, 0xb4, 0xbb,  0x08, 0xb9, 0x7a,  0x09, 0x23, 0xcb,  // bench benefit best betray better between beyond bicycle
+  0x09, 0x24, 0x00,  0x09, 0x2b, 0x28,  0x09, 0x2e, 0x20,  0x09, 0x2f, 0x63,  0x09, 0x32, 0x20,  0x09, 0x32, 0xa1,  0x09, 0x34, 0xa2,  0x09, 0x81, 0x19,  // bid bike bind biology bird birth bitter black
+  0x09, 0x81, 0x21,  0x09, 0x81, 0x69,  0x09, 0x81, 0x73,  0x09, 0x81, 0x99,  0x09, 0x85, 0x09,  0x09, 0x85, 0x99,  0x09, 0x89, 0x71,  0x09, 0x8f, 0x79,  // blade blame blanket blast bleak bless blind blood
+  0x09, 0x8f, 0x9b,  0x09, 0x8f, 0xaa,  0x09, 0x95, 0x28,  0x09, 0x95, 0x90,  0x09, 0x95, 0x99,  0x09, 0xe1, 0x91,  0x09, 0xe1, 0xa0,  0x09, 0xe4, 0xc8,  // blossom blouse blue blur blush board boat body
+  0x09, 0xe9, 0x60,  0x09, 0xed, 0x10,  0x09, 0xee, 0x28,  0x09, 0xee, 0xa9,  0x09, 0xef, 0x58,  0x09, 0xef, 0x99,  0x09, 0xf2, 0x22,  0x09, 0xf2, 0x4a,  // boil bomb bone bonus book boost border boring
+  0x09, 0xf2, 0x92,  0x09, 0xf3, 0x98,  0x09, 0xf4, 0xa2,  0x09, 0xf5, 0x72,  0x09, 0xf8, 0x00,  0x09, 0xf9, 0x00,  0x0a, 0x41, 0x1b,  0x0a, 0x41, 0x49,  // borrow boss bottom bounce box boy bracket brain
+  0x0a, 0x41, 0x71,  0x0a, 0x41, 0x99,  0x0a, 0x41, 0xb1,  0x0a, 0x45, 0x09,  0x0a, 0x45, 0x2a,  0x0a, 0x49, 0x19,  0x0a, 0x49, 0x22,  0x0a, 0x49, 0x29,  // brand brass brave bread breeze brick bridge brief
+  0x0a, 0x49, 0x3a,  0x0a, 0x49, 0x71,  0x0a, 0x49, 0x99,  0x0a, 0x4f, 0x1c,  0x0a, 0x4f, 0x5a,  0x0a, 0x4f, 0x72,  0x0a, 0x4f, 0x79,  0x0a, 0x4f, 0xa3,  // bright bring brisk broccoli broken bronze broom brother
+  0x0a, 0x4f, 0xb9,  0x0a, 0x55, 0x99,  0x0a, 0xa2, 0x12,  0x0a, 0xa4, 0x21,  0x0a, 0xa4, 0x3a,  0x0a, 0xa6, 0x33,  0x0a, 0xa9, 0x61,  0x0a, 0xac, 0x10,  // brown brush bubble buddy budget buffalo build bulb
+  0x0a, 0xac, 0x58,  0x0a, 0xac, 0x62,  0x0a, 0xae, 0x22,  0x0a, 0xae, 0x5a,  0x0a, 0xb2, 0x22,  0x0a, 0xb2, 0x3a,  0x0a, 0xb2, 0x99,  0x0a, 0xb3, 0x00,  // bulk bullet bundle bunker burden burger burst bus
+  0x0a, 0xb3, 0x4c,  0x0a, 0xb3, 0xc8,  0x0a, 0xb4, 0xa2,  0x0a, 0xb9, 0x29,  0x0a, 0xba, 0xd0,  0x0c, 0x22, 0x13,  0x0c, 0x22, 0x49,  0x0c, 0x22, 0x61,  // business busy butter buyer buzz cabbage cabin cable
+  0x0c, 0x23, 0xa2,  0x0c, 0x27, 0x28,  0x0c, 0x2b, 0x28,  0x0c, 0x2c, 0x60,  0x0c, 0x2c, 0x68,  0x0c, 0x2d, 0x2a,  0x0c, 0x2d, 0x80,  0x0c, 0x2e, 0x00,  // cactus cage cake call calm camera camp can
+  0x0c, 0x2e, 0x09,  0x0c, 0x2e, 0x1a,  0x0c, 0x2e, 0x21,  0x0c, 0x2e, 0x72,  0x0c, 0x2e, 0x79,  0x0c, 0x2e, 0xb2,  0x0c, 0x2e, 0xca,  0x0c, 0x30, 0x0b,  // canal cancel candy cannon canoe canvas canyon capable
+  0x0c, 0x30, 0x4b,  0x0c, 0x30, 0xa3,  0x0c, 0x32, 0x00,  0x0c, 0x32, 0x12,  0x0c, 0x32, 0x20,  0x0c, 0x32, 0x39,  0x0c, 0x32, 0x82,  0x0c, 0x32, 0x91,  // capital captain car carbon card cargo carpet carry
+  0x0c, 0x32, 0xa0,  0x0c, 0x33, 0x28,  0x0c, 0x33, 0x40,  0x0c, 0x33, 0x4a,  0x0c, 0x33, 0xa2,  0x0c, 0x33, 0xaa,  0x0c, 0x34, 0x00,  0x0c, 0x34, 0x0b,  // cart case cash casino castle casual cat catalog
+  0x0c, 0x34, 0x19,  0x0c, 0x34, 0x2c,  0x0c, 0x34, 0xa2,  0x0c, 0x35, 0x3a,  0x0c, 0x35, 0x99,  0x0c, 0x35, 0xa3,  0x0c, 0x36, 0x28,  0x0c, 0xa9, 0x63,  // catch category cattle caught cause caution cave ceiling
+  0x0c, 0xac, 0x2a,  0x0c, 0xad, 0x2a,  0x0c, 0xae, 0x9a,  0x0c, 0xae, 0xa3,  0x0c, 0xb2, 0x2a,  0x0c, 0xb2, 0xa3,  0x0d, 0x01, 0x49,  0x0d, 0x01, 0x61,  // celery cement census century cereal certain chair chalk
+  0x0d, 0x01, 0x6c,  0x0d, 0x01, 0x72,  0x0d, 0x01, 0x79,  0x0d, 0x01, 0x83,  0x0d, 0x01, 0x92,  0x0d, 0x01, 0x99,  0x0d, 0x01, 0xa0,  0x0d, 0x05, 0x09,  // champion change chaos chapter charge chase chat cheap
+  0x0d, 0x05, 0x19,  0x0d, 0x05, 0x2a,  0x0d, 0x05, 0x30,  0x0d, 0x05, 0x92,  0x0d, 0x05, 0x99,  0x0d, 0x09, 0x1b,  0x0d, 0x09, 0x29,  0x0d, 0x09, 0x61,  // check cheese chef cherry chest chicken chief child
+  0x0d, 0x09, 0x6b,  0x0d, 0x0f, 0x4a,  0x0d, 0x0f, 0x7a,  0x0d, 0x12, 0x7b,  0x0d, 0x15, 0x1b,  0x0d, 0x15, 0x71,  0x0d, 0x15, 0x91,  0x0d, 0x27, 0x09,  // chimney choice choose chronic chuckle chunk churn cigar
+  0x0d, 0x2e, 0x74,  0x0d, 0x32, 0x1a,  0x0d, 0x34, 0x4b,  0x0d, 0x34, 0xc8,  0x0d, 0x36, 0x49,  0x0d, 0x81, 0x49,  0x0d, 0x81, 0x80,  0x0d, 0x81, 0x93,  // cinnamon circle citizen city civil claim clap clarify
+  0x0d, 0x81, 0xb8,  0x0d, 0x81, 0xc8,  0x0d, 0x85, 0x09,  0x0d, 0x85, 0x91,  0x0d, 0x85, 0xb2,  0x0d, 0x89, 0x19,  0x0d, 0x89, 0x2a,  0x0d, 0x89, 0x31,  // claw clay clean clerk clever click client cliff
+  0x0d, 0x89, 0x69,  0x0d, 0x89, 0x72,  0x0d, 0x89, 0x80,  0x0d, 0x8f, 0x19,  0x0d, 0x8f, 0x38,  0x0d, 0x8f, 0x99,  0x0d, 0x8f, 0xa1,  0x0d, 0x8f, 0xa9,  // climb clinic clip clock clog close cloth cloud
+  0x0d, 0x8f, 0xb9,  0x0d, 0x95, 0x10,  0x0d, 0x95, 0x69,  0x0d, 0x95, 0x9b,  0x0d, 0x95, 0xa2,  0x0d, 0xe1, 0x19,  0x0d, 0xe1, 0x99,  0x0d, 0xe3, 0x7b,  // clown club clump cluster clutch coach coast coconut
+  0x0d, 0xe4, 0x28,  0x0d, 0xe6, 0x32,  0x0d, 0xe9, 0x60,  0x0d, 0xe9, 0x70,  0x0d, 0xec, 0x63,  0x0d, 0xec, 0x79,  0x0d, 0xec, 0xaa,  0x0d, 0xed, 0x13,  // code coffee coil coin collect color column combine
+  0x0d, 0xed, 0x28,  0x0d, 0xed, 0x33,  0x0d, 0xed, 0x49,  0x0d, 0xed, 0x6a,  0x0d, 0xed, 0x83,  0x0d, 0xee, 0x1b,  0x0d, 0xee, 0x23,  0x0d, 0xee, 0x33,  // come comfort comic common company concert conduct confirm
+  0x0d, 0xee, 0x3c,  0x0d, 0xee, 0x73,  0x0d, 0xee, 0x9c,  0x0d, 0xee, 0xa3,  0x0d, 0xee, 0xb4,  0x0d, 0xef, 0x58,  0x0d, 0xef, 0x60,  0x0d, 0xf0, 0x82,  // congress connect consider control convince cook cool copper
+  0x0d, 0xf0, 0xc8,  0x0d, 0xf2, 0x09,  0x0d, 0xf2, 0x28,  0x0d, 0xf2, 0x70,  0x0d, 0xf2, 0x93,  0x0d, 0xf3, 0xa0,  0x0d, 0xf4, 0xa2,  0x0d, 0xf5, 0x19,  // copy coral core corn correct cost cotton couch
+  0x0d, 0xf5, 0x73,  0x0d, 0xf5, 0x82,  0x0d, 0xf5, 0x92,  0x0d, 0xf5, 0x9a,  0x0d, 0xf6, 0x29,  0x0d, 0xf9, 0x7a,  0x0e, 0x41, 0x19,  0x0e, 0x41, 0x22,  // country couple course cousin cover coyote crack cradle
+  0x0e, 0x41, 0x31,  0x0e, 0x41, 0x68,  0x0e, 0x41, 0x71,  0x0e, 0x41, 0x99,  0x0e, 0x41, 0xa2,  0x0e, 0x41, 0xb9,  0x0e, 0x41, 0xd1,  0x0e, 0x45, 0x09,  // craft cram crane crash crater crawl crazy cream
+  0x0e, 0x45, 0x22,  0x0e, 0x45, 0x29,  0x0e, 0x45, 0xb8,  0x0e, 0x49, 0x1b,  0x0e, 0x49, 0x69,  0x0e, 0x49, 0x99,  0x0e, 0x49, 0xa2,  0x0e, 0x4f, 0x80,  // credit creek crew cricket crime crisp critic crop
+  0x0e, 0x4f, 0x99,  0x0e, 0x4f, 0xaa,  0x0e, 0x4f, 0xb9,  0x0e, 0x55, 0x1b,  0x0e, 0x55, 0x29,  0x0e, 0x55, 0x4a,  0x0e, 0x55, 0x6b,  0x0e, 0x55, 0x72,  // cross crouch crowd crucial cruel cruise crumble crunch
+  0x0e, 0x55, 0x99,  0x0e, 0x59, 0x00,  0x0e, 0x59, 0x9b,  0x0e, 0xa2, 0x28,  0x0e, 0xac, 0xa3,  0x0e, 0xb0, 0x00,  0x0e, 0xb0, 0x14,  0x0e, 0xb2, 0x4b,  // crush cry crystal cube culture cup cupboard curious
+  0x0e, 0xb2, 0x93,  0x0e, 0xb2, 0xa3,  0x0e, 0xb2, 0xb1,  0x0e, 0xb3, 0x43,  0x0e, 0xb3, 0xa2,  0x0e, 0xb4, 0x28,  0x0f, 0x23, 0x61,  0x10, 0x24, 0x00,  // current curtain curve cushion custom cute cycle dad
+  0x10, 0x2d, 0x0a,  0x10, 0x2d, 0x80,  0x10, 0x2e, 0x19,  0x10, 0x2e, 0x3a,  0x10, 0x32, 0x4a,  0x10, 0x33, 0x40,  0x10, 0x35, 0x3c,  0x10, 0x37, 0x70,  // damage damp dance danger daring dash daughter dawn
+  0x10, 0x39, 0x00,  0x10, 0xa1, 0x60,  0x10, 0xa2, 0x0a,  0x10, 0xa2, 0x92,  0x10, 0xa3, 0x0a,  0x10, 0xa3, 0x2c,  0x10, 0xa3, 0x4a,  0x10, 0xa3, 0x63,  // day deal debate debris decade december decide decline
+  0x10, 0xa3, 0x7c,  0x10, 0xa3, 0x94,  0x10, 0xa5, 0x90,  0x10, 0xa6, 0x2b,  0x10, 0xa6, 0x4a,  0x10, 0xa6, 0xc8,  0x10, 0xa7, 0x92,  0x10, 0xac, 0x09,  // decorate decrease deer defense define defy degree delay
+  0x10, 0xac, 0x4b,  0x10, 0xad, 0x0a,  0x10, 0xad, 0x4a,  0x10, 0xae, 0x4a,  0x10, 0xae, 0xa3,  0x10, 0xae, 0xc8,  0x10, 0xb0, 0x0a,  0x10, 0xb0, 0x2a,  // deliver demand demise denial dentist deny depart depend
+  0x10, 0xb0, 0x7b,  0x10, 0xb0, 0xa1,  0x10, 0xb0, 0xaa,  0x10, 0xb2, 0x4a,  0x10, 0xb3, 0x1c,  0x10, 0xb3, 0x2a,  0x10, 0xb3, 0x4a,  0x10, 0xb3, 0x58,  // deposit depth deputy derive describe desert design desk
+  0x10, 0xb3, 0x83,  0x10, 0xb3, 0xa3,  0x10, 0xb4, 0x0a,  0x10, 0xb4, 0x2a,  0x10, 0xb6, 0x2b,  0x10, 0xb6, 0x4a,  0x10, 0xb6, 0x7a,  0x11, 0x21, 0x3b,  // despair destroy detail detect develop device devote diagram
+  0x11, 0x21, 0x60,  0x11, 0x21, 0x6b,  0x11, 0x21, 0x91,  0x11, 0x23, 0x28,  0x11, 0x25, 0x9a,  0x11, 0x25, 0xa0,  0x11, 0x26, 0x32,  0x11, 0x27, 0x4b,  // dial diamond diary dice diesel diet differ digital
+  0x11, 0x27, 0x73,  0x11, 0x2c, 0x2b,  0x11, 0x2e, 0x72,  0x11, 0x2e, 0x7c,  0x11, 0x32, 0x2a,  0x11, 0x32, 0xa0,  0x11, 0x33, 0x0c,  0x11, 0x33, 0x1c,  // dignity dilemma dinner dinosaur direct dirt disagree discover
+  0x11, 0x33, 0x2b,  0x11, 0x33, 0x40,  0x11, 0x33, 0x6b,  0x11, 0x33, 0x7c,  0x11, 0x33, 0x83,  0x11, 0x33, 0xa4,  0x11, 0x36, 0x2a,  0x11, 0x36, 0x4a,  // disease dish dismiss disorder display distance divert divide
+  0x11, 0x36, 0x7b,  0x11, 0x3a, 0xd1,  0x11, 0xe3, 0xa2,  0x11, 0xe3, 0xac,  0x11, 0xe7, 0x00,  0x11, 0xec, 0x60,  0x11, 0xec, 0x83,  0x11, 0xed, 0x0a,  // divorce dizzy doctor document dog doll dolphin domain
+  0x11, 0xee, 0x0a,  0x11, 0xee, 0x5a,  0x11, 0xee, 0x79,  0x11, 0xef, 0x90,  0x11, 0xf3, 0x28,  0x11, 0xf5, 0x12,  0x11, 0xf6, 0x28,  0x12, 0x41, 0x31,  // donate donkey donor door dose double dove draft
+  0x12, 0x41, 0x3a,  0x12, 0x41, 0x69,  0x12, 0x41, 0x9b,  0x12, 0x41, 0xb8,  0x12, 0x45, 0x09,  0x12, 0x45, 0x99,  0x12, 0x49, 0x31,  0x12, 0x49, 0x61,  // dragon drama drastic draw dream dress drift drill
+  0x12, 0x49, 0x71,  0x12, 0x49, 0x80,  0x12, 0x49, 0xb1,  0x12, 0x4f, 0x80,  0x12, 0x55, 0x68,  0x12, 0x59, 0x00,  0x12, 0xa3, 0x58,  0x12, 0xad, 0x10,  // drink drip drive drop drum dry duck dumb
+  0x12, 0xae, 0x28,  0x12, 0xb2, 0x4a,  0x12, 0xb3, 0xa0,  0x12, 0xb4, 0x19,  0x12, 0xb4, 0xc8,  0x12, 0xe1, 0x91,  0x13, 0x2e, 0x0b,  0x14, 0x27, 0x29,  // dune during dust dutch duty dwarf dynamic eager
+  0x14, 0x27, 0x61,  0x14, 0x32, 0x61,  0x14, 0x32, 0x70,  0x14, 0x32, 0xa1,  0x14, 0x33, 0x4a,  0x14, 0x33, 0xa0,  0x14, 0x33, 0xc8,  0x14, 0x68, 0x78,  // eagle early earn earth easily east easy echo
+  0x14, 0x6f, 0x63,  0x14, 0x6f, 0x73,  0x14, 0x87, 0x28,  0x14, 0x89, 0xa0,  0x14, 0x95, 0x1b,  0x14, 0xc6, 0x7a,  0x14, 0xe7, 0x00,  0x15, 0x27, 0x41,  // ecology economy edge edit educate effort egg eight
+  0x15, 0x34, 0x42,  0x15, 0x82, 0x79,  0x15, 0x84, 0x29,  0x15, 0x85, 0x1c,  0x15, 0x85, 0x3b,  0x15, 0x85, 0x6b,  0x15, 0x85, 0x84,  0x15, 0x85, 0xb4,  // either elbow elder electric elegant element elephant elevator
+  0x15, 0x89, 0xa1,  0x15, 0x93, 0x28,  0x15, 0xa2, 0x0a,  0x15, 0xa2, 0x7a,  0x15, 0xa2, 0x93,  0x15, 0xa5, 0x92,  0x15, 0xaf, 0xa3,  0x15, 0xb0, 0x62,  // elite else embark embody embrace emerge emotion employ
+  0x15, 0xb0, 0x7b,  0x15, 0xb0, 0xa1,  0x15, 0xc1, 0x12,  0x15, 0xc1, 0x19,  0x15, 0xc4, 0x00,  0x15, 0xc4, 0x63,  0x15, 0xc4, 0x7b,  0x15, 0xc5, 0x69,  // empower empty enable enact end endless endorse enemy
+  0x15, 0xc5, 0x92,  0x15, 0xc6, 0x7b,  0x15, 0xc7, 0x0a,  0x15, 0xc7, 0x4a,  0x15, 0xc8, 0x0b,  0x15, 0xca, 0x79,  0x15, 0xcc, 0x4a,  0x15, 0xcf, 0xaa,  // energy enforce engage engine enhance enjoy enlist enough
+  0x15, 0xd2, 0x4a,  0x15, 0xd2, 0x7a,  0x15, 0xd3, 0xaa,  0x15, 0xd4, 0x29,  0x15, 0xd4, 0x4a,  0x15, 0xd4, 0x91,  0x15, 0xd6, 0x2c,  0x16, 0x09, 0x9b,  // enrich enroll ensure enter entire entry envelope episode
+  0x16, 0x35, 0x09,  0x16, 0x35, 0x49,  0x16, 0x41, 0x00,  0x16, 0x41, 0x99,  0x16, 0x4f, 0x21,  0x16, 0x4f, 0x9b,  0x16, 0x52, 0x79,  0x16, 0x55, 0x81,  // equal equip era erase erode erosion error erupt
+  0x16, 0x63, 0x0a,  0x16, 0x73, 0x09,  0x16, 0x73, 0x2b,  0x16, 0x74, 0x0a,  0x16, 0x85, 0x93,  0x16, 0x88, 0x4a,  0x16, 0xc9, 0x24,  0x16, 0xc9, 0x60,  // escape essay essence estate eternal ethics evidence evil
+  0x16, 0xcf, 0x59,  0x16, 0xcf, 0x62,  0x17, 0x01, 0x19,  0x17, 0x01, 0x6b,  0x17, 0x03, 0x2a,  0x17, 0x03, 0x44,  0x17, 0x03, 0x4a,  0x17, 0x03, 0x63,  // evoke evolve exact example excess exchange excite exclude
+  0x17, 0x03, 0xaa,  0x17, 0x05, 0x1b,  0x17, 0x05, 0x94,  0x17, 0x08, 0x0b,  0x17, 0x08, 0x4b,  0x17, 0x09, 0x61,  0x17, 0x09, 0x99,  0x17, 0x09, 0xa0,  // excuse execute exercise exhaust exhibit exile exist exit
+  0x17, 0x0f, 0xa2,  0x17, 0x10, 0x0a,  0x17, 0x10, 0x2a,  0x17, 0x10, 0x4a,  0x17, 0x10, 0x63,  0x17, 0x10, 0x7a,  0x17, 0x10, 0x93,  0x17, 0x14, 0x2a,  // exotic expand expect expire explain expose express extend
+  0x17, 0x14, 0x91,  0x17, 0x25, 0x00,  0x17, 0x25, 0x13,  0x18, 0x22, 0x92,  0x18, 0x23, 0x28,  0x18, 0x23, 0xab,  0x18, 0x24, 0x28,  0x18, 0x29, 0x71,  // extra eye eyebrow fabric face faculty fade faint
+  0x18, 0x29, 0xa1,  0x18, 0x2c, 0x60,  0x18, 0x2c, 0x99,  0x18, 0x2d, 0x28,  0x18, 0x2d, 0x4a,  0x18, 0x2d, 0x7a,  0x18, 0x2e, 0x00,  0x18, 0x2e, 0x19,  // faith fall false fame family famous fan fancy
+  0x18, 0x2e, 0xa3,  0x18, 0x32, 0x68,  0x18, 0x33, 0x43,  0x18, 0x34, 0x00,  0x18, 0x34, 0x09,  0x18, 0x34, 0x42,  0x18, 0x34, 0x4b,  0x18, 0x35, 0x61,  // fantasy farm fashion fat fatal father fatigue fault
+  0x18, 0x36, 0x7c,  0x18, 0xa1, 0xa3,  0x18, 0xa2, 0x94,  0x18, 0xa4, 0x2b,  0x18, 0xa5, 0x00,  0x18, 0xa5, 0x20,  0x18, 0xa5, 0x60,  0x18, 0xad, 0x0a,  // favorite feature february federal fee feed feel female
+  0x18, 0xae, 0x19,  0x18, 0xb3, 0xa4,  0x18, 0xb4, 0x19,  0x18, 0xb6, 0x29,  0x18, 0xb7, 0x00,  0x19, 0x22, 0x29,  0x19, 0x23, 0xa3,  0x19, 0x25, 0x61,  // fence festival fetch fever few fiber fiction field
+  0x19, 0x27, 0xaa,  0x19, 0x2c, 0x28,  0x19, 0x2c, 0x68,  0x19, 0x2c, 0xa2,  0x19, 0x2e, 0x09,  0x19, 0x2e, 0x20,  0x19, 0x2e, 0x28,  0x19, 0x2e, 0x3a,  // figure file film filter final find fine finger
+  0x19, 0x2e, 0x4a,  0x19, 0x32, 0x28,  0x19, 0x32, 0x68,  0x19, 0x32, 0x99,  0x19, 0x33, 0x1a,  0x19, 0x33, 0x40,  0x19, 0x34, 0x00,  0x19, 0x34, 0x73,  // finish fire firm first fiscal fish fit fitness
+  0x19, 0x38, 0x00,  0x19, 0x81, 0x38,  0x19, 0x81, 0x69,  0x19, 0x81, 0x99,  0x19, 0x81, 0xa0,  0x19, 0x81, 0xb2,  0x19, 0x85, 0x28,  0x19, 0x89, 0x3a,  // fix flag flame flash flat flavor flee flight
+  0x19, 0x89, 0x80,  0x19, 0x8f, 0x09,  0x19, 0x8f, 0x19,  0x19, 0x8f, 0x79,  0x19, 0x8f, 0xba,  0x19, 0x95, 0x49,  0x19, 0x95, 0x99,  0x19, 0x99, 0x00,  // flip float flock floor flower fluid flush fly
+  0x19, 0xe1, 0x68,  0x19, 0xe3, 0xa9,  0x19, 0xe7, 0x00,  0x19, 0xe9, 0x60,  0x19, 0xec, 0x20,  0x19, 0xec, 0x62,  0x19, 0xef, 0x20,  0x19, 0xef, 0xa0,  // foam focus fog foil fold follow food foot
+  0x19, 0xf2, 0x19,  0x19, 0xf2, 0x2a,  0x19, 0xf2, 0x3a,  0x19, 0xf2, 0x58,  0x19, 0xf2, 0xa3,  0x19, 0xf2, 0xa9,  0x19, 0xf2, 0xbb,  0x19, 0xf3, 0x9a,  // force forest forget fork fortune forum forward fossil
+  0x19, 0xf3, 0xa2,  0x19, 0xf5, 0x71,  0x19, 0xf8, 0x00,  0x1a, 0x41, 0x3b,  0x1a, 0x41, 0x69,  0x1a, 0x45, 0x8c,  0x1a, 0x45, 0x99,  0x1a, 0x49, 0x2a,  // foster found fox fragile frame frequent fresh friend
+  0x1a, 0x49, 0x72,  0x1a, 0x4f, 0x38,  0x1a, 0x4f, 0x71,  0x1a, 0x4f, 0x99,  0x1a, 0x4f, 0xb9,  0x1a, 0x4f, 0xd2,  0x1a, 0x55, 0x49,  0x1a, 0xa5, 0x60,  // fringe frog front frost frown frozen fruit fuel
+  0x1a, 0xae, 0x00,  0x1a, 0xae, 0x71,  0x1a, 0xb2, 0x73,  0x1a, 0xb2, 0xc8,  0x1a, 0xb4, 0xaa,  0x1c, 0x24, 0x3a,  0x1c, 0x29, 0x70,  0x1c, 0x2c, 0x0a,  // fun funny furnace fury future gadget gain galaxy
+  0x1c, 0x2c, 0x63,  0x1c, 0x2d, 0x28,  0x1c, 0x30, 0x00,  0x1c, 0x32, 0x0a,  0x1c, 0x32, 0x13,  0x1c, 0x32, 0x22,  0x1c, 0x32, 0x62,  0x1c, 0x32, 0x6b,  // gallery game gap garage garbage garden garlic garment
+  0x1c, 0x33, 0x00,  0x1c, 0x33, 0x80,  0x1c, 0x34, 0x28,  0x1c, 0x34, 0x42,  0x1c, 0x35, 0x39,  0x1c, 0x3a, 0x28,  0x1c, 0xae, 0x2b,  0x1c, 0xae, 0x4a,  // gas gasp gate gather gauge gaze general genius
+  0x1c, 0xae, 0x91,  0x1c, 0xae, 0xa2,  0x1c, 0xae, 0xab,  0x1c, 0xb3, 0xa3,  0x1d, 0x0f, 0x99,  0x1d, 0x21, 0x71,  0x1d, 0x26, 0xa0,  0x1d, 0x27, 0x3a,  // genre gentle genuine gesture ghost giant gift giggle
+  0x1d, 0x2e, 0x3a,  0x1d, 0x32, 0x0b,  0x1d, 0x32, 0x60,  0x1d, 0x36, 0x28,  0x1d, 0x81, 0x20,  0x1d, 0x81, 0x72,  0x1d, 0x81, 0x91,  0x1d, 0x81, 0x99,  // ginger giraffe girl give glad glance glare glass
+  0x1d, 0x89, 0x21,  0x1d, 0x89, 0x6b,  0x1d, 0x8f, 0x11,  0x1d, 0x8f, 0x79,  0x1d, 0x8f, 0x91,  0x1d, 0x8f, 0xb1,  0x1d, 0x8f, 0xb8,  0x1d, 0x95, 0x28,  // glide glimpse globe gloom glory glove glow glue
+  0x1d, 0xe1, 0xa0,  0x1d, 0xe4, 0x23,  0x1d, 0xec, 0x20,  0x1d, 0xef, 0x20,  0x1d, 0xef, 0x99,  0x1d, 0xf2, 0x4b,  0x1d, 0xf3, 0x82,  0x1d, 0xf3, 0x9a,  // goat goddess gold good goose gorilla gospel gossip
+  0x1d, 0xf6, 0x2a,  0x1d, 0xf7, 0x70,  0x1e, 0x41, 0x10,  0x1e, 0x41, 0x19,  0x1e, 0x41, 0x49,  0x1e, 0x41, 0x71,  0x1e, 0x41, 0x81,  0x1e, 0x41, 0x99,  // govern gown grab grace grain grant grape grass
+  0x1e, 0x41, 0xb3,  0x1e, 0x45, 0x09,  0x1e, 0x45, 0x29,  0x1e, 0x49, 0x20,  0x1e, 0x49, 0x29,  0x1e, 0x49, 0xa0,  0x1e, 0x4f, 0x1b,  0x1e, 0x4f, 0xa9,  // gravity great green grid grief grit grocery group
+  0x1e, 0x4f, 0xb8,  0x1e, 0x55, 0x71,  0x1e, 0xa1, 0x91,  0x1e, 0xa5, 0x99,  0x1e, 0xa9, 0x21,  0x1e, 0xa9, 0x61,  0x1e, 0xa9, 0xa2,  0x1e, 0xae, 0x00,  // grow grunt guard guess guide guilt guitar gun
+  0x1f, 0x2d, 0x00,  0x20, 0x22, 0x49,  0x20, 0x29, 0x90,  0x20, 0x2c, 0x30,  0x20, 0x2d, 0x6a,  0x20, 0x2d, 0x9b,  0x20, 0x2e, 0x20,  0x20, 0x30, 0x81,  // gym habit hair half hammer hamster hand happy
+  0x20, 0x32, 0x12,  0x20, 0x32, 0x20,  0x20, 0x32, 0x99,  0x20, 0x32, 0xb3,  0x20, 0x34, 0x00,  0x20, 0x36, 0x28,  0x20, 0x37, 0x58,  0x20, 0x3a, 0x0a,  // harbor hard harsh harvest hat have hawk hazard
+  0x20, 0xa1, 0x20,  0x20, 0xa1, 0x62,  0x20, 0xa1, 0x91,  0x20, 0xa1, 0xb1,  0x20, 0xa4, 0x3c,  0x20, 0xa9, 0x3a,  0x20, 0xac, 0x61,  0x20, 0xac, 0x6a,  // head health heart heavy hedgehog height hello helmet
+  0x20, 0xac, 0x80,  0x20, 0xae, 0x00,  0x20, 0xb2, 0x78,  0x21, 0x24, 0x22,  0x21, 0x27, 0x40,  0x21, 0x2c, 0x60,  0x21, 0x2e, 0xa0,  0x21, 0x30, 0x00,  // help hen hero hidden high hill hint hip
+  0x21, 0x32, 0x28,  0x21, 0x33, 0xa3,  0x21, 0xe2, 0x11,  0x21, 0xe3, 0x5a,  0x21, 0xec, 0x20,  0x21, 0xec, 0x28,  0x21, 0xec, 0x4b,  0x21, 0xec, 0x62,  // hire history hobby hockey hold hole holiday hollow
+  0x21, 0xed, 0x28,  0x21, 0xee, 0x29,  0x21, 0xef, 0x20,  0x21, 0xf0, 0x28,  0x21, 0xf2, 0x70,  0x21, 0xf2, 0x92,  0x21, 0xf2, 0x99,  0x21, 0xf3, 0x84,  // home honey hood hope horn horror horse hospital
+  0x21, 0xf3, 0xa0,  0x21, 0xf4, 0x29,  0x21, 0xf5, 0x90,  0x21, 0xf6, 0x29,  0x22, 0xa2, 0x00,  0x22, 0xa7, 0x28,  0x22, 0xad, 0x09,  0x22, 0xad, 0x12,  // host hotel hour hover hub huge human humble
+  0x22, 0xad, 0x79,  0x22, 0xae, 0x23,  0x22, 0xae, 0x3a,  0x22, 0xae, 0xa0,  0x22, 0xb2, 0x22,  0x22, 0xb2, 0x91,  0x22, 0xb2, 0xa0,  0x22, 0xb3, 0x13,  // humor hundred hungry hunt hurdle hurry hurt husband
+  0x23, 0x22, 0x92,  0x24, 0x65, 0x00,  0x24, 0x6f, 0x70,  0x24, 0x85, 0x08,  0x24, 0x85, 0x74,  0x24, 0x8c, 0x28,  0x24, 0xee, 0x7a,  0x25, 0x8c, 0x00,  // hybrid ice icon idea identify idle ignore ill
+  0x25, 0x8c, 0x2b,  0x25, 0x8c, 0x73,  0x25, 0xa1, 0x39,  0x25, 0xa9, 0xa3,  0x25, 0xad, 0x2b,  0x25, 0xad, 0xaa,  0x25, 0xb0, 0x0a,  0x25, 0xb0, 0x7a,  // illegal illness image imitate immense immune impact impose
+  0x25, 0xb0, 0x93,  0x25, 0xb0, 0xab,  0x25, 0xc3, 0x40,  0x25, 0xc3, 0x63,  0x25, 0xc3, 0x7a,  0x25, 0xc3, 0x94,  0x25, 0xc4, 0x29,  0x25, 0xc4, 0x4c,  // improve impulse inch include income increase index indicate
+  0x25, 0xc4, 0x7a,  0x25, 0xc4, 0xac,  0x25, 0xc6, 0x0a,  0x25, 0xc6, 0x63,  0x25, 0xc6, 0x7a,  0x25, 0xc8, 0x0a,  0x25, 0xc8, 0x2b,  0x25, 0xc9, 0xa3,  // indoor industry infant inflict inform inhale inherit initial
+  0x25, 0xca, 0x2a,  0x25, 0xca, 0xaa,  0x25, 0xcd, 0x0a,  0x25, 0xce, 0x29,  0x25, 0xce, 0x7c,  0x25, 0xd0, 0xa9,  0x25, 0xd1, 0xab,  0x25, 0xd3, 0x0a,  // inject injury inmate inner innocent input inquiry insane
+  0x25, 0xd3, 0x2a,  0x25, 0xd3, 0x4a,  0x25, 0xd3, 0x83,  0x25, 0xd3, 0xa3,  0x25, 0xd4, 0x0a,  0x25, 0xd4, 0x2c,  0x25, 0xd4, 0x78,  0x25, 0xd6, 0x2a,  // insect inside inspire install intact interest into invest
+  0x25, 0xd6, 0x4a,  0x25, 0xd6, 0x7b,  0x26, 0x4f, 0x70,  0x26, 0x6c, 0x0a,  0x26, 0x6f, 0x63,  0x26, 0x73, 0xa9,  0x26, 0x85, 0x68,  0x26, 0xcf, 0x91,  // invite involve iron island isolate issue item ivory
+  0x28, 0x23, 0x5a,  0x28, 0x27, 0xaa,  0x28, 0x32, 0x00,  0x28, 0x3a, 0xd0,  0x28, 0xa1, 0x63,  0x28, 0xa1, 0x71,  0x28, 0xac, 0x61,  0x28, 0xb7, 0x29,  // jacket jaguar jar jazz jealous jeans jelly jewel
+  0x29, 0xe2, 0x00,  0x29, 0xe9, 0x70,  0x29, 0xeb, 0x28,  0x29, 0xf5, 0x93,  0x29, 0xf9, 0x00,  0x2a, 0xa4, 0x39,  0x2a, 0xa9, 0x19,  0x2a, 0xad, 0x80,  // job join joke journey joy judge juice jump
+  0x2a, 0xae, 0x3a,  0x2a, 0xae, 0x4a,  0x2a, 0xae, 0x58,  0x2a, 0xb3, 0xa0,  0x2c, 0x2e, 0x3c,  0x2c, 0xa5, 0x70,  0x2c, 0xa5, 0x80,  0x2c, 0xb4, 0x1b,  // jungle junior junk just kangaroo keen keep ketchup
+  0x2c, 0xb9, 0x00,  0x2d, 0x23, 0x58,  0x2d, 0x24, 0x00,  0x2d, 0x24, 0x72,  0x2d, 0x2e, 0x20,  0x2d, 0x2e, 0x3b,  0x2d, 0x33, 0x98,  0x2d, 0x34, 0x00,  // key kick kid kidney kind kingdom kiss kit
+  0x2d, 0x34, 0x1b,  0x2d, 0x34, 0x28,  0x2d, 0x34, 0xa2,  0x2d, 0x37, 0x48,  0x2d, 0xc5, 0x28,  0x2d, 0xc9, 0x31,  0x2d, 0xcf, 0x19,  0x2d, 0xcf, 0xb8,  // kitchen kite kitten kiwi knee knife knock know
+  0x30, 0x22, 0x00,  0x30, 0x22, 0x29,  0x30, 0x22, 0x79,  0x30, 0x24, 0x22,  0x30, 0x24, 0xc8,  0x30, 0x2b, 0x28,  0x30, 0x2d, 0x80,  0x30, 0x2e, 0x3c,  // lab label labor ladder lady lake lamp language
+  0x30, 0x30, 0xa2,  0x30, 0x32, 0x39,  0x30, 0x34, 0x29,  0x30, 0x34, 0x49,  0x30, 0x35, 0x39,  0x30, 0x35, 0x73,  0x30, 0x36, 0x08,  0x30, 0x37, 0x00,  // laptop large later latin laugh laundry lava law
+  0x30, 0x37, 0x70,  0x30, 0x37, 0x9b,  0x30, 0x39, 0x29,  0x30, 0x3a, 0xc8,  0x30, 0xa1, 0x22,  0x30, 0xa1, 0x30,  0x30, 0xa1, 0x91,  0x30, 0xa1, 0xb1,  // lawn lawsuit layer lazy leader leaf learn leave
+  0x30, 0xa3, 0xa3,  0x30, 0xa6, 0xa0,  0x30, 0xa7, 0x00,  0x30, 0xa7, 0x09,  0x30, 0xa7, 0x2a,  0x30, 0xa9, 0x9b,  0x30, 0xad, 0x79,  0x30, 0xae, 0x20,  // lecture left leg legal legend leisure lemon lend
+  0x30, 0xae, 0x3a,  0x30, 0xae, 0x98,  0x30, 0xaf, 0x83,  0x30, 0xb3, 0x9a,  0x30, 0xb4, 0xa2,  0x30, 0xb6, 0x29,  0x31, 0x21, 0x90,  0x31, 0x22, 0x2b,  // length lens leopard lesson letter level liar liberty
+  0x31, 0x22, 0x93,  0x31, 0x23, 0x2b,  0x31, 0x26, 0x28,  0x31, 0x26, 0xa0,  0x31, 0x27, 0x41,  0x31, 0x2b, 0x28,  0x31, 0x2d, 0x10,  0x31, 0x2d, 0x49,  // library license life lift light like limb limit
+  0x31, 0x2e, 0x58,  0x31, 0x2f, 0x70,  0x31, 0x31, 0xaa,  0x31, 0x33, 0xa0,  0x31, 0x34, 0xa2,  0x31, 0x36, 0x28,  0x31, 0x3a, 0x0a,  0x31, 0xe1, 0x20,  // link lion liquid list little live lizard load
+  0x31, 0xe1, 0x70,  0x31, 0xe2, 0x9b,  0x31, 0xe3, 0x09,  0x31, 0xe3, 0x58,  0x31, 0xe7, 0x49,  0x31, 0xee, 0x2a,  0x31, 0xee, 0x38,  0x31, 0xef, 0x80,  // loan lobster local lock logic lonely long loop
+  0x31, 0xf4, 0xa3,  0x31, 0xf5, 0x20,  0x31, 0xf5, 0x72,  0x31, 0xf6, 0x28,  0x31, 0xf9, 0x09,  0x32, 0xa3, 0x59,  0x32, 0xa7, 0x3b,  0x32, 0xad, 0x12,  // lottery loud lounge love loyal lucky luggage lumber
+  0x32, 0xae, 0x09,  0x32, 0xae, 0x19,  0x32, 0xb8, 0xaa,  0x33, 0x32, 0x4a,  0x34, 0x23, 0x43,  0x34, 0x24, 0x00,  0x34, 0x27, 0x49,  0x34, 0x27, 0x72,  // lunar lunch luxury lyrics machine mad magic magnet
+  0x34, 0x29, 0x20,  0x34, 0x29, 0x60,  0x34, 0x29, 0x70,  0x34, 0x2a, 0x79,  0x34, 0x2b, 0x28,  0x34, 0x2d, 0x6a,  0x34, 0x2e, 0x00,  0x34, 0x2e, 0x0a,  // maid mail main major make mammal man manage
+  0x34, 0x2e, 0x23,  0x34, 0x2e, 0x39,  0x34, 0x2e, 0x9b,  0x34, 0x2e, 0xaa,  0x34, 0x30, 0x61,  0x34, 0x32, 0x12,  0x34, 0x32, 0x19,  0x34, 0x32, 0x3a,  // mandate mango mansion manual maple marble march margin
+  0x34, 0x32, 0x4a,  0x34, 0x32, 0x5a,  0x34, 0x32, 0x94,  0x34, 0x33, 0x58,  0x34, 0x33, 0x98,  0x34, 0x33, 0xa2,  0x34, 0x34, 0x19,  0x34, 0x34, 0x2c,  // marine market marriage mask mass master match material
+  0x34, 0x34, 0x40,  0x34, 0x34, 0x92,  0x34, 0x34, 0xa2,  0x34, 0x38, 0x4b,  0x34, 0x3a, 0x28,  0x34, 0xa1, 0x22,  0x34, 0xa1, 0x70,  0x34, 0xa1, 0x9b,  // math matrix matter maximum maze meadow mean measure
+  0x34, 0xa1, 0xa0,  0x34, 0xa3, 0x44,  0x34, 0xa4, 0x09,  0x34, 0xa4, 0x49,  0x34, 0xac, 0x7a,  0x34, 0xac, 0xa0,  0x34, 0xad, 0x12,  0x34, 0xad, 0x7a,  // meat mechanic medal media melody melt member memory
+  0x34, 0xae, 0xa3,  0x34, 0xae, 0xa8,  0x34, 0xb2, 0x19,  0x34, 0xb2, 0x39,  0x34, 0xb2, 0x49,  0x34, 0xb2, 0x91,  0x34, 0xb3, 0x40,  0x34, 0xb3, 0x9b,  // mention menu mercy merge merit merry mesh message
+  0x34, 0xb4, 0x09,  0x34, 0xb4, 0x42,  0x35, 0x24, 0x22,  0x35, 0x24, 0x74,  0x35, 0x2c, 0x58,  0x35, 0x2c, 0x63,  0x35, 0x2d, 0x49,  0x35, 0x2e, 0x20,  // metal method middle midnight milk million mimic mind
+  0x35, 0x2e, 0x4b,  0x35, 0x2e, 0x79,  0x35, 0x2e, 0xaa,  0x35, 0x32, 0x0b,  0x35, 0x32, 0x92,  0x35, 0x33, 0x2a,  0x35, 0x33, 0x98,  0x35, 0x33, 0xa3,  // minimum minor minute miracle mirror misery miss mistake
+  0x35, 0x38, 0x00,  0x35, 0x38, 0x29,  0x35, 0x38, 0xa3,  0x35, 0xe2, 0x4a,  0x35, 0xe4, 0x29,  0x35, 0xe4, 0x4a,  0x35, 0xed, 0x00,  0x35, 0xed, 0x2a,  // mix mixed mixture mobile model modify mom moment
+  0x35, 0xee, 0x4b,  0x35, 0xee, 0x5a,  0x35, 0xee, 0x9b,  0x35, 0xee, 0xa1,  0x35, 0xef, 0x70,  0x35, 0xf2, 0x09,  0x35, 0xf2, 0x28,  0x35, 0xf2, 0x73,  // monitor monkey monster month moon moral more morning
+  0x35, 0xf3, 0x8c,  0x35, 0xf4, 0x42,  0x35, 0xf4, 0x4a,  0x35, 0xf4, 0x79,  0x35, 0xf5, 0x74,  0x35, 0xf5, 0x99,  0x35, 0xf6, 0x28,  0x35, 0xf6, 0x49,  // mosquito mother motion motor mountain mouse move movie
+  0x36, 0xa3, 0x40,  0x36, 0xa6, 0x32,  0x36, 0xac, 0x28,  0x36, 0xac, 0xa4,  0x36, 0xb3, 0x1a,  0x36, 0xb3, 0x2a,  0x36, 0xb3, 0x44,  0x36, 0xb3, 0x49,  // much muffin mule multiply muscle museum mushroom music
+  0x36, 0xb3, 0xa0,  0x36, 0xb4, 0xaa,  0x37, 0x33, 0x2a,  0x37, 0x33, 0xa3,  0x37, 0x34, 0x40,  0x38, 0x29, 0xb1,  0x38, 0x2d, 0x28,  0x38, 0x30, 0x5a,  // must mutual myself mystery myth naive name napkin
+  0x38, 0x32, 0x92,  0x38, 0x33, 0xa1,  0x38, 0x34, 0x4a,  0x38, 0x34, 0xaa,  0x38, 0xa1, 0x90,  0x38, 0xa3, 0x58,  0x38, 0xa5, 0x20,  0x38, 0xa7, 0x0c,  // narrow nasty nation nature near neck need negative
+  0x38, 0xa7, 0x63,  0x38, 0xa9, 0xa3,  0x38, 0xb0, 0x42,  0x38, 0xb2, 0xb1,  0x38, 0xb3, 0xa0,  0x38, 0xb4, 0x00,  0x38, 0xb4, 0xbb,  0x38, 0xb5, 0xa3,  // neglect neither nephew nerve nest net network neutral
+  0x38, 0xb6, 0x29,  0x38, 0xb7, 0x98,  0x38, 0xb8, 0xa0,  0x39, 0x23, 0x28,  0x39, 0x27, 0x41,  0x39, 0xe2, 0x61,  0x39, 0xe9, 0x99,  0x39, 0xed, 0x4b,  // never news next nice night noble noise nominee
+  0x39, 0xef, 0x22,  0x39, 0xf2, 0x6a,  0x39, 0xf2, 0xa1,  0x39, 0xf3, 0x28,  0x39, 0xf4, 0x0b,  0x39, 0xf4, 0x28,  0x39, 0xf4, 0x43,  0x39, 0xf4, 0x4a,  // noodle normal north nose notable note nothing notice
+  0x39, 0xf6, 0x29,  0x39, 0xf7, 0x00,  0x3a, 0xa3, 0x63,  0x3a, 0xad, 0x12,  0x3a, 0xb2, 0x99,  0x3a, 0xb4, 0x00,  0x3c, 0x2b, 0x00,  0x3c, 0x45, 0xc8,  // novel now nuclear number nurse nut oak obey
+  0x3c, 0x4a, 0x2a,  0x3c, 0x4c, 0x4a,  0x3c, 0x53, 0x1b,  0x3c, 0x53, 0x2b,  0x3c, 0x54, 0x0a,  0x3c, 0x56, 0x4b,  0x3c, 0x63, 0xa9,  0x3c, 0x65, 0x09,  // object oblige obscure observe obtain obvious occur ocean
+  0x3c, 0x74, 0x7b,  0x3c, 0x8f, 0x90,  0x3c, 0xc6, 0x00,  0x3c, 0xc6, 0x29,  0x3c, 0xc6, 0x4a,  0x3c, 0xd4, 0x29,  0x3d, 0x2c, 0x00,  0x3d, 0x61, 0xc8,  // october odor off offer office often oil okay
+  0x3d, 0x84, 0x00,  0x3d, 0x89, 0xb1,  0x3d, 0x99, 0x6b,  0x3d, 0xa9, 0xa0,  0x3d, 0xc3, 0x28,  0x3d, 0xc5, 0x00,  0x3d, 0xc9, 0x79,  0x3d, 0xcc, 0x4a,  // old olive olympic omit once one onion online
+  0x3d, 0xcc, 0xc8,  0x3e, 0x05, 0x70,  0x3e, 0x05, 0x91,  0x3e, 0x09, 0x73,  0x3e, 0x10, 0x7a,  0x3e, 0x14, 0x4a,  0x3e, 0x41, 0x72,  0x3e, 0x42, 0x49,  // only open opera opinion oppose option orange orbit
+  0x3e, 0x43, 0x43,  0x3e, 0x44, 0x29,  0x3e, 0x44, 0x4c,  0x3e, 0x47, 0x09,  0x3e, 0x49, 0x2a,  0x3e, 0x49, 0x3c,  0x3e, 0x50, 0x42,  0x3e, 0x74, 0x93,  // orchard order ordinary organ orient original orphan ostrich
+  0x3e, 0x88, 0x29,  0x3e, 0xb4, 0x23,  0x3e, 0xb4, 0x29,  0x3e, 0xb4, 0x82,  0x3e, 0xb4, 0x9b,  0x3e, 0xc1, 0x60,  0x3e, 0xc5, 0x70,  0x3e, 0xc5, 0x90,  // other outdoor outer output outside oval oven over
+  0x3e, 0xee, 0x00,  0x3e, 0xee, 0x29,  0x3f, 0x19, 0x3a,  0x3f, 0x33, 0xa2,  0x3f, 0x4f, 0x71,  0x40, 0x23, 0xa0,  0x40, 0x24, 0x22,  0x40, 0x27, 0x28,  // own owner oxygen oyster ozone pact paddle page
+  0x40, 0x29, 0x90,  0x40, 0x2c, 0x0a,  0x40, 0x2c, 0x68,  0x40, 0x2e, 0x21,  0x40, 0x2e, 0x29,  0x40, 0x2e, 0x49,  0x40, 0x2e, 0xa3,  0x40, 0x30, 0x29,  // pair palace palm panda panel panic panther paper
+  0x40, 0x32, 0x0a,  0x40, 0x32, 0x2a,  0x40, 0x32, 0x58,  0x40, 0x32, 0x92,  0x40, 0x32, 0xa1,  0x40, 0x33, 0x98,  0x40, 0x34, 0x19,  0x40, 0x34, 0x40,  // parade parent park parrot party pass patch path
+  0x40, 0x34, 0x4b,  0x40, 0x34, 0x92,  0x40, 0x34, 0xa3,  0x40, 0x35, 0x99,  0x40, 0x36, 0x28,  0x40, 0x39, 0x6b,  0x40, 0xa1, 0x19,  0x40, 0xa1, 0x72,  // patient patrol pattern pause pave payment peace peanut
+  0x40, 0xa1, 0x90,  0x40, 0xa1, 0x9b,  0x40, 0xac, 0x4b,  0x40, 0xae, 0x00,  0x40, 0xae, 0x0b,  0x40, 0xae, 0x1a,  0x40, 0xaf, 0x82,  0x40, 0xb0, 0x82,  // pear peasant pelican pen penalty pencil people pepper
+  0x40, 0xb2, 0x33,  0x40, 0xb2, 0x6a,  0x40, 0xb2, 0x9a,  0x40, 0xb4, 0x00,  0x41, 0x0f, 0x71,  0x41, 0x0f, 0xa1,  0x41, 0x12, 0x0a,  0x41, 0x19, 0x9c,  // perfect permit person pet phone photo phrase physical
+  0x41, 0x21, 0x71,  0x41, 0x23, 0x72,  0x41, 0x23, 0xa3,  0x41, 0x25, 0x19,  0x41, 0x27, 0x00,  0x41, 0x27, 0x2a,  0x41, 0x2c, 0x60,  0x41, 0x2c, 0x79,  // piano picnic picture piece pig pigeon pill pilot
+  0x41, 0x2e, 0x58,  0x41, 0x2f, 0x73,  0x41, 0x30, 0x28,  0x41, 0x33, 0xa2,  0x41, 0x34, 0x19,  0x41, 0x3a, 0xd1,  0x41, 0x81, 0x19,  0x41, 0x81, 0x72,  // pink pioneer pipe pistol pitch pizza place planet
+  0x41, 0x81, 0x9b,  0x41, 0x81, 0xa1,  0x41, 0x81, 0xc8,  0x41, 0x85, 0x0a,  0x41, 0x85, 0x22,  0x41, 0x95, 0x19,  0x41, 0x95, 0x38,  0x41, 0x95, 0x72,  // plastic plate play please pledge pluck plug plunge
+  0x41, 0xe5, 0x68,  0x41, 0xe5, 0xa0,  0x41, 0xe9, 0x71,  0x41, 0xec, 0x09,  0x41, 0xec, 0x28,  0x41, 0xec, 0x4a,  0x41, 0xee, 0x20,  0x41, 0xee, 0xc8,  // poem poet point polar pole police pond pony
+  0x41, 0xef, 0x60,  0x41, 0xf0, 0xab,  0x41, 0xf2, 0xa3,  0x41, 0xf3, 0x4c,  0x41, 0xf3, 0x9c,  0x41, 0xf3, 0xa0,  0x41, 0xf4, 0x0a,  0x41, 0xf4, 0xa3,  // pool popular portion position possible post potato pottery
+  0x41, 0xf6, 0x2b,  0x41, 0xf7, 0x22,  0x41, 0xf7, 0x29,  0x42, 0x41, 0x1c,  0x42, 0x41, 0x4a,  0x42, 0x45, 0x23,  0x42, 0x45, 0x32,  0x42, 0x45, 0x83,  // poverty powder power practice praise predict prefer prepare
+  0x42, 0x45, 0x9b,  0x42, 0x45, 0xa2,  0x42, 0x45, 0xb3,  0x42, 0x49, 0x19,  0x42, 0x49, 0x21,  0x42, 0x49, 0x6b,  0x42, 0x49, 0x71,  0x42, 0x49, 0x7c,  // present pretty prevent price pride primary print priority
+  0x42, 0x49, 0x9a,  0x42, 0x49, 0xb3,  0x42, 0x49, 0xd1,  0x42, 0x4f, 0x13,  0x42, 0x4f, 0x1b,  0x42, 0x4f, 0x23,  0x42, 0x4f, 0x32,  0x42, 0x4f, 0x3b,  // prison private prize problem process produce profit program
+  0x42, 0x4f, 0x53,  0x42, 0x4f, 0x6b,  0x42, 0x4f, 0x79,  0x42, 0x4f, 0x84,  0x42, 0x4f, 0x9b,  0x42, 0x4f, 0xa3,  0x42, 0x4f, 0xa9,  0x42, 0x4f, 0xb3,  // project promote proof property prosper protect proud provide
+  0x42, 0xa2, 0x62,  0x42, 0xa4, 0x23,  0x42, 0xac, 0x60,  0x42, 0xac, 0x80,  0x42, 0xac, 0x99,  0x42, 0xad, 0x83,  0x42, 0xae, 0x19,  0x42, 0xb0, 0x49,  // public pudding pull pulp pulse pumpkin punch pupil
+  0x42, 0xb0, 0x81,  0x42, 0xb2, 0x1c,  0x42, 0xb2, 0x4a,  0x42, 0xb2, 0x83,  0x42, 0xb2, 0x99,  0x42, 0xb3, 0x40,  0x42, 0xb4, 0x00,  0x42, 0xba, 0xd2,  // puppy purchase purity purpose purse push put puzzle
+  0x43, 0x32, 0x0b,  0x46, 0xa1, 0x63,  0x46, 0xa1, 0x73,  0x46, 0xa1, 0x93,  0x46, 0xa5, 0x9c,  0x46, 0xa9, 0x19,  0x46, 0xa9, 0xa0,  0x46, 0xa9, 0xd0,  // pyramid quality quantum quarter question quick quit quiz
+  0x46, 0xaf, 0xa1,  0x48, 0x22, 0x12,  0x48, 0x23, 0x1b,  0x48, 0x23, 0x28,  0x48, 0x23, 0x58,  0x48, 0x24, 0x09,  0x48, 0x24, 0x49,  0x48, 0x29, 0x60,  // quote rabbit raccoon race rack radar radio rail
+  0x48, 0x29, 0x70,  0x48, 0x29, 0x99,  0x48, 0x2c, 0x61,  0x48, 0x2d, 0x80,  0x48, 0x2e, 0x19,  0x48, 0x2e, 0x22,  0x48, 0x2e, 0x39,  0x48, 0x30, 0x49,  // rain raise rally ramp ranch random range rapid
+  0x48, 0x32, 0x28,  0x48, 0x34, 0x28,  0x48, 0x34, 0x42,  0x48, 0x36, 0x29,  0x48, 0x37, 0x00,  0x48, 0x3a, 0x79,  0x48, 0xa1, 0x21,  0x48, 0xa1, 0x60,  // rare rate rather raven raw razor ready real
+  0x48, 0xa1, 0x9a,  0x48, 0xa2, 0x29,  0x48, 0xa2, 0xab,  0x48, 0xa3, 0x0a,  0x48, 0xa3, 0x2b,  0x48, 0xa3, 0x4a,  0x48, 0xa3, 0x7a,  0x48, 0xa3, 0xcb,  // reason rebel rebuild recall receive recipe record recycle
+  0x48, 0xa4, 0xaa,  0x48, 0xa6, 0x63,  0x48, 0xa6, 0x7a,  0x48, 0xa6, 0xaa,  0x48, 0xa7, 0x4a,  0x48, 0xa7, 0x92,  0x48, 0xa7, 0xab,  0x48, 0xaa, 0x2a,  // reduce reflect reform refuse region regret regular reject
+  0x48, 0xac, 0x09,  0x48, 0xac, 0x2b,  0x48, 0xac, 0x4a,  0x48, 0xac, 0xc8,  0x48, 0xad, 0x0a,  0x48, 0xad, 0x2c,  0x48, 0xad, 0x4a,  0x48, 0xad, 0x7a,  // relax release relief rely remain remember remind remove
+  0x48, 0xae, 0x22,  0x48, 0xae, 0x29,  0x48, 0xae, 0xa0,  0x48, 0xaf, 0x82,  0x48, 0xb0, 0x0a,  0x48, 0xb0, 0x2a,  0x48, 0xb0, 0x63,  0x48, 0xb0, 0x7a,  // render renew rent reopen repair repeat replace report
+  0x48, 0xb1, 0xab,  0x48, 0xb3, 0x1a,  0x48, 0xb3, 0x2c,  0x48, 0xb3, 0x4a,  0x48, 0xb3, 0x7c,  0x48, 0xb3, 0x84,  0x48, 0xb3, 0xaa,  0x48, 0xb4, 0x4a,  // require rescue resemble resist resource response result retire
+  0x48, 0xb4, 0x93,  0x48, 0xb4, 0xaa,  0x48, 0xb5, 0x73,  0x48, 0xb6, 0x2a,  0x48, 0xb6, 0x4a,  0x48, 0xb7, 0x0a,  0x49, 0x19, 0xa2,  0x49, 0x22, 0x00,  // retreat return reunion reveal review reward rhythm rib
+  0x49, 0x22, 0x12,  0x49, 0x23, 0x28,  0x49, 0x23, 0x40,  0x49, 0x24, 0x28,  0x49, 0x24, 0x39,  0x49, 0x26, 0x61,  0x49, 0x27, 0x41,  0x49, 0x27, 0x49,  // ribbon rice rich ride ridge rifle right rigid
+  0x49, 0x2e, 0x38,  0x49, 0x2f, 0xa0,  0x49, 0x30, 0x82,  0x49, 0x33, 0x58,  0x49, 0x34, 0xaa,  0x49, 0x36, 0x09,  0x49, 0x36, 0x29,  0x49, 0xe1, 0x20,  // ring riot ripple risk ritual rival river road
+  0x49, 0xe1, 0x99,  0x49, 0xe2, 0x79,  0x49, 0xe2, 0xaa,  0x49, 0xe3, 0x5a,  0x49, 0xed, 0x0b,  0x49, 0xef, 0x30,  0x49, 0xef, 0x5a,  0x49, 0xef, 0x68,  // roast robot robust rocket romance roof rookie room
+  0x49, 0xf3, 0x28,  0x49, 0xf4, 0x0a,  0x49, 0xf5, 0x39,  0x49, 0xf5, 0x71,  0x49, 0xf5, 0xa1,  0x49, 0xf9, 0x09,  0x4a, 0xa2, 0x12,  0x4a, 0xa4, 0x28,  // rose rotate rough round route royal rubber rude
+  0x4a, 0xa7, 0x00,  0x4a, 0xac, 0x28,  0x4a, 0xae, 0x00,  0x4a, 0xae, 0xba,  0x4a, 0xb2, 0x09,  0x4c, 0x24, 0x00,  0x4c, 0x24, 0x22,  0x4c, 0x24, 0x73,  // rug rule run runway rural sad saddle sadness
+  0x4c, 0x26, 0x28,  0x4c, 0x29, 0x60,  0x4c, 0x2c, 0x09,  0x4c, 0x2c, 0x6a,  0x4c, 0x2c, 0x79,  0x4c, 0x2c, 0xa0,  0x4c, 0x2c, 0xaa,  0x4c, 0x2d, 0x28,  // safe sail salad salmon salon salt salute same
+  0x4c, 0x2d, 0x82,  0x4c, 0x2e, 0x20,  0x4c, 0x34, 0x4b,  0x4c, 0x34, 0x7b,  0x4c, 0x35, 0x19,  0x4c, 0x35, 0x9b,  0x4c, 0x36, 0x28,  0x4c, 0x39, 0x00,  // sample sand satisfy satoshi sauce sausage save say
+  0x4c, 0x61, 0x61,  0x4c, 0x61, 0x70,  0x4c, 0x61, 0x91,  0x4c, 0x61, 0xa3,  0x4c, 0x65, 0x71,  0x4c, 0x68, 0x2a,  0x4c, 0x68, 0x7a,  0x4c, 0x69, 0x2b,  // scale scan scare scatter scene scheme school science
+  0x4c, 0x69, 0x9c,  0x4c, 0x6f, 0x94,  0x4c, 0x6f, 0xa9,  0x4c, 0x72, 0x09,  0x4c, 0x72, 0x2a,  0x4c, 0x72, 0x4a,  0x4c, 0x72, 0xa9,  0x4c, 0xa1, 0x00,  // scissors scorpion scout scrap screen script scrub sea
+  0x4c, 0xa1, 0x92,  0x4c, 0xa1, 0x9a,  0x4c, 0xa1, 0xa0,  0x4c, 0xa3, 0x7a,  0x4c, 0xa3, 0x92,  0x4c, 0xa3, 0xa3,  0x4c, 0xa3, 0xac,  0x4c, 0xa5, 0x20,  // search season seat second secret section security seed
+  0x4c, 0xa5, 0x58,  0x4c, 0xa7, 0x6b,  0x4c, 0xac, 0x2a,  0x4c, 0xac, 0x60,  0x4c, 0xad, 0x4b,  0x4c, 0xae, 0x4a,  0x4c, 0xae, 0x99,  0x4c, 0xae, 0xa4,  // seek segment select sell seminar senior sense sentence
+  0x4c, 0xb2, 0x4a,  0x4c, 0xb2, 0xb3,  0x4c, 0xb3, 0x9b,  0x4c, 0xb4, 0xa2,  0x4c, 0xb4, 0xa9,  0x4c, 0xb6, 0x29,  0x4d, 0x01, 0x22,  0x4d, 0x01, 0x31,  // series service session settle setup seven shadow shaft
+  0x4d, 0x01, 0x63,  0x4d, 0x01, 0x91,  0x4d, 0x05, 0x20,  0x4d, 0x05, 0x61,  0x4d, 0x05, 0x93,  0x4d, 0x09, 0x2a,  0x4d, 0x09, 0x31,  0x4d, 0x09, 0x71,  // shallow share shed shell sheriff shield shift shine
+  0x4d, 0x09, 0x80,  0x4d, 0x09, 0xb2,  0x4d, 0x0f, 0x19,  0x4d, 0x0f, 0x28,  0x4d, 0x0f, 0x79,  0x4d, 0x0f, 0x80,  0x4d, 0x0f, 0x91,  0x4d, 0x0f, 0xac,  // ship shiver shock shoe shoot shop short shoulder
+  0x4d, 0x0f, 0xb1,  0x4d, 0x12, 0x4a,  0x4d, 0x12, 0xa9,  0x4d, 0x15, 0x33,  0x4d, 0x19, 0x00,  0x4d, 0x22, 0x63,  0x4d, 0x23, 0x58,  0x4d, 0x24, 0x28,  // shove shrimp shrug shuffle shy sibling sick side
+  0x4d, 0x25, 0x39,  0x4d, 0x27, 0x41,  0x4d, 0x27, 0x70,  0x4d, 0x2c, 0x2a,  0x4d, 0x2c, 0x58,  0x4d, 0x2c, 0x61,  0x4d, 0x2c, 0xb2,  0x4d, 0x2d, 0x4b,  // siege sight sign silent silk silly silver similar
+  0x4d, 0x2d, 0x82,  0x4d, 0x2e, 0x19,  0x4d, 0x2e, 0x38,  0x4d, 0x32, 0x29,  0x4d, 0x33, 0xa2,  0x4d, 0x34, 0xab,  0x4d, 0x38, 0x00,  0x4d, 0x3a, 0x28,  // simple since sing siren sister situate six size
+  0x4d, 0x61, 0xa1,  0x4d, 0x65, 0xa2,  0x4d, 0x69, 0x00,  0x4d, 0x69, 0x61,  0x4d, 0x69, 0x70,  0x4d, 0x69, 0x91,  0x4d, 0x75, 0x61,  0x4d, 0x81, 0x10,  // skate sketch ski skill skin skirt skull slab
+  0x4d, 0x81, 0x68,  0x4d, 0x85, 0x29,  0x4d, 0x85, 0x73,  0x4d, 0x89, 0x19,  0x4d, 0x89, 0x21,  0x4d, 0x89, 0x3a,  0x4d, 0x89, 0x68,  0x4d, 0x8f, 0x3a,  // slam sleep slender slice slide slight slim slogan
+  0x4d, 0x8f, 0xa0,  0x4d, 0x8f, 0xb8,  0x4d, 0x95, 0x99,  0x4d, 0xa1, 0x61,  0x4d, 0xa1, 0x91,  0x4d, 0xa9, 0x61,  0x4d, 0xaf, 0x59,  0x4d, 0xaf, 0x7a,  // slot slow slush small smart smile smoke smooth
+  0x4d, 0xc1, 0x19,  0x4d, 0xc1, 0x59,  0x4d, 0xc1, 0x80,  0x4d, 0xc9, 0x31,  0x4d, 0xcf, 0xb8,  0x4d, 0xe1, 0x80,  0x4d, 0xe3, 0x1a,  0x4d, 0xe3, 0x4a,  // snack snake snap sniff snow soap soccer social
+  0x4d, 0xe3, 0x58,  0x4d, 0xe4, 0x08,  0x4d, 0xe6, 0xa0,  0x4d, 0xec, 0x09,  0x4d, 0xec, 0x23,  0x4d, 0xec, 0x49,  0x4d, 0xec, 0xac,  0x4d, 0xec, 0xb1,  // sock soda soft solar soldier solid solution solve
+  0x4d, 0xed, 0x2b,  0x4d, 0xee, 0x38,  0x4d, 0xef, 0x70,  0x4d, 0xf2, 0x91,  0x4d, 0xf2, 0xa0,  0x4d, 0xf5, 0x60,  0x4d, 0xf5, 0x71,  0x4d, 0xf5, 0x80,  // someone song soon sorry sort soul sound soup
+  0x4d, 0xf5, 0x92,  0x4d, 0xf5, 0xa1,  0x4e, 0x01, 0x19,  0x4e, 0x01, 0x91,  0x4e, 0x01, 0xa3,  0x4e, 0x01, 0xb9,  0x4e, 0x05, 0x09,  0x4e, 0x05, 0x1b,  // source south space spare spatial spawn speak special
+  0x4e, 0x05, 0x29,  0x4e, 0x05, 0x61,  0x4e, 0x05, 0x71,  0x4e, 0x08, 0x2a,  0x4e, 0x09, 0x19,  0x4e, 0x09, 0x22,  0x4e, 0x09, 0x59,  0x4e, 0x09, 0x70,  // speed spell spend sphere spice spider spike spin
+  0x4e, 0x09, 0x92,  0x4e, 0x0c, 0x49,  0x4e, 0x0f, 0x49,  0x4e, 0x0f, 0x73,  0x4e, 0x0f, 0x79,  0x4e, 0x0f, 0x91,  0x4e, 0x0f, 0xa0,  0x4e, 0x12, 0x09,  // spirit split spoil sponsor spoon sport spot spray
+  0x4e, 0x12, 0x2a,  0x4e, 0x12, 0x4a,  0x4e, 0x19, 0x00,  0x4e, 0x35, 0x0a,  0x4e, 0x35, 0x2b,  0x4e, 0x35, 0x4c,  0x4e, 0x81, 0x12,  0x4e, 0x81, 0x23,  // spread spring spy square squeeze squirrel stable stadium
+  0x4e, 0x81, 0x31,  0x4e, 0x81, 0x39,  0x4e, 0x81, 0x4a,  0x4e, 0x81, 0x69,  0x4e, 0x81, 0x71,  0x4e, 0x81, 0x91,  0x4e, 0x81, 0xa1,  0x4e, 0x81, 0xc8,  // staff stage stairs stamp stand start state stay
+  0x4e, 0x85, 0x09,  0x4e, 0x85, 0x29,  0x4e, 0x85, 0x68,  0x4e, 0x85, 0x80,  0x4e, 0x85, 0x92,  0x4e, 0x89, 0x19,  0x4e, 0x89, 0x61,  0x4e, 0x89, 0x71,  // steak steel stem step stereo stick still sting
+  0x4e, 0x8f, 0x19,  0x4e, 0x8f, 0x6b,  0x4e, 0x8f, 0x71,  0x4e, 0x8f, 0x79,  0x4e, 0x8f, 0x91,  0x4e, 0x8f, 0xb1,  0x4e, 0x92, 0x0c,  0x4e, 0x92, 0x2a,  // stock stomach stone stool story stove strategy street
+  0x4e, 0x92, 0x4a,  0x4e, 0x92, 0x7a,  0x4e, 0x92, 0xac,  0x4e, 0x95, 0x23,  0x4e, 0x95, 0x31,  0x4e, 0x95, 0x6b,  0x4e, 0x99, 0x61,  0x4e, 0xa2, 0x53,  // strike strong struggle student stuff stumble style subject
+  0x4e, 0xa2, 0x6a,  0x4e, 0xa2, 0xba,  0x4e, 0xa3, 0x1b,  0x4e, 0xa3, 0x40,  0x4e, 0xa4, 0x22,  0x4e, 0xa6, 0x32,  0x4e, 0xa7, 0x09,  0x4e, 0xa7, 0x3b,  // submit subway success such sudden suffer sugar suggest
+  0x4e, 0xa9, 0xa0,  0x4e, 0xad, 0x6a,  0x4e, 0xae, 0x00,  0x4e, 0xae, 0x71,  0x4e, 0xae, 0x9a,  0x4e, 0xb0, 0x29,  0x4e, 0xb0, 0x82,  0x4e, 0xb0, 0x93,  // suit summer sun sunny sunset super supply supreme
+  0x4e, 0xb2, 0x28,  0x4e, 0xb2, 0x33,  0x4e, 0xb2, 0x39,  0x4e, 0xb2, 0x84,  0x4e, 0xb2, 0x94,  0x4e, 0xb2, 0xb2,  0x4e, 0xb3, 0x83,  0x4e, 0xb3, 0xa3,  // sure surface surge surprise surround survey suspect sustain
+  0x4e, 0xe1, 0x63,  0x4e, 0xe1, 0x69,  0x4e, 0xe1, 0x80,  0x4e, 0xe1, 0x91,  0x4e, 0xe5, 0x09,  0x4e, 0xe5, 0x29,  0x4e, 0xe9, 0x31,  0x4e, 0xe9, 0x68,  // swallow swamp swap swarm swear sweet swift swim
+  0x4e, 0xe9, 0x71,  0x4e, 0xe9, 0xa2,  0x4e, 0xef, 0x91,  0x4f, 0x2d, 0x12,  0x4f, 0x2d, 0x83,  0x4f, 0x32, 0xa9,  0x4f, 0x33, 0xa2,  0x50, 0x22, 0x61,  // swing switch sword symbol symptom syrup system table
+  0x50, 0x23, 0x5a,  0x50, 0x27, 0x00,  0x50, 0x29, 0x60,  0x50, 0x2c, 0x2a,  0x50, 0x2c, 0x58,  0x50, 0x2e, 0x58,  0x50, 0x30, 0x28,  0x50, 0x32, 0x3a,  // tackle tag tail talent talk tank tape target
+  0x50, 0x33, 0x58,  0x50, 0x33, 0xa1,  0x50, 0x34, 0xa2,  0x50, 0x38, 0x48,  0x50, 0xa1, 0x19,  0x50, 0xa1, 0x68,  0x50, 0xac, 0x60,  0x50, 0xae, 0x00,  // task taste tattoo taxi teach team tell ten
+  0x50, 0xae, 0x0a,  0x50, 0xae, 0x72,  0x50, 0xae, 0xa0,  0x50, 0xb2, 0x68,  0x50, 0xb3, 0xa0,  0x50, 0xb8, 0xa0,  0x51, 0x01, 0x71,  0x51, 0x01, 0xa0,  // tenant tennis tent term test text thank that
+  0x51, 0x05, 0x69,  0x51, 0x05, 0x70,  0x51, 0x05, 0x7a,  0x51, 0x05, 0x91,  0x51, 0x05, 0xc8,  0x51, 0x09, 0x71,  0x51, 0x09, 0x98,  0x51, 0x0f, 0xab,  // theme then theory there they thing this thought
+  0x51, 0x12, 0x29,  0x51, 0x12, 0x4a,  0x51, 0x12, 0x79,  0x51, 0x15, 0x69,  0x51, 0x15, 0x73,  0x51, 0x23, 0x5a,  0x51, 0x24, 0x28,  0x51, 0x27, 0x29,  // three thrive throw thumb thunder ticket tide tiger
+  0x51, 0x2c, 0xa0,  0x51, 0x2d, 0x12,  0x51, 0x2d, 0x28,  0x51, 0x2e, 0xc8,  0x51, 0x30, 0x00,  0x51, 0x32, 0x29,  0x51, 0x33, 0x9a,  0x51, 0x34, 0x61,  // tilt timber time tiny tip tired tissue title
+  0x51, 0xe1, 0x99,  0x51, 0xe2, 0x0b,  0x51, 0xe4, 0x09,  0x51, 0xe4, 0x23,  0x51, 0xe5, 0x00,  0x51, 0xe7, 0x2c,  0x51, 0xe9, 0x62,  0x51, 0xeb, 0x29,  // toast tobacco today toddler toe together toilet token
+  0x51, 0xed, 0x0a,  0x51, 0xed, 0x7c,  0x51, 0xee, 0x28,  0x51, 0xee, 0x3a,  0x51, 0xee, 0x4b,  0x51, 0xef, 0x60,  0x51, 0xef, 0xa1,  0x51, 0xf0, 0x00,  // tomato tomorrow tone tongue tonight tool tooth top
+  0x51, 0xf0, 0x49,  0x51, 0xf0, 0x82,  0x51, 0xf2, 0x19,  0x51, 0xf2, 0x73,  0x51, 0xf2, 0xa4,  0x51, 0xf3, 0x98,  0x51, 0xf4, 0x09,  0x51, 0xf5, 0x93,  // topic topple torch tornado tortoise toss total tourist
+  0x51, 0xf7, 0x0a,  0x51, 0xf7, 0x29,  0x51, 0xf7, 0x70,  0x51, 0xf9, 0x00,  0x52, 0x41, 0x19,  0x52, 0x41, 0x21,  0x52, 0x41, 0x33,  0x52, 0x41, 0x3a,  // toward tower town toy track trade traffic tragic
+  0x52, 0x41, 0x49,  0x52, 0x41, 0x74,  0x52, 0x41, 0x80,  0x52, 0x41, 0x99,  0x52, 0x41, 0xb2,  0x52, 0x41, 0xc8,  0x52, 0x45, 0x09,  0x52, 0x45, 0x28,  // train transfer trap trash travel tray treat tree
+  0x52, 0x45, 0x71,  0x52, 0x49, 0x09,  0x52, 0x49, 0x11,  0x52, 0x49, 0x19,  0x52, 0x49, 0x3b,  0x52, 0x49, 0x68,  0x52, 0x49, 0x80,  0x52, 0x4f, 0x82,  // trend trial tribe trick trigger trim trip trophy
+  0x52, 0x4f, 0xab,  0x52, 0x55, 0x19,  0x52, 0x55, 0x28,  0x52, 0x55, 0x61,  0x52, 0x55, 0x6b,  0x52, 0x55, 0x99,  0x52, 0x55, 0xa1,  0x52, 0x59, 0x00,  // trouble truck true truly trumpet trust truth try
+  0x52, 0xa2, 0x28,  0x52, 0xa9, 0xa3,  0x52, 0xad, 0x12,  0x52, 0xae, 0x08,  0x52, 0xae, 0x72,  0x52, 0xb2, 0x5a,  0x52, 0xb2, 0x70,  0x52, 0xb2, 0xa2,  // tube tuition tumble tuna tunnel turkey turn turtle
+  0x52, 0xe5, 0x62,  0x52, 0xe5, 0x72,  0x52, 0xe9, 0x19,  0x52, 0xe9, 0x70,  0x52, 0xe9, 0x99,  0x52, 0xef, 0x00,  0x53, 0x30, 0x28,  0x53, 0x30, 0x4b,  // twelve twenty twice twin twist two type typical
+  0x54, 0xec, 0xc8,  0x55, 0xa2, 0x94,  0x55, 0xc1, 0x12,  0x55, 0xc1, 0xbb,  0x55, 0xc3, 0x61,  0x55, 0xc3, 0x7b,  0x55, 0xc4, 0x29,  0x55, 0xc4, 0x78,  // ugly umbrella unable unaware uncle uncover under undo
+  0x55, 0xc6, 0x0a,  0x55, 0xc6, 0x7a,  0x55, 0xc8, 0x0b,  0x55, 0xc9, 0x33,  0x55, 0xc9, 0x8a,  0x55, 0xc9, 0xa0,  0x55, 0xc9, 0xb4,  0x55, 0xcb, 0x73,  // unfair unfold unhappy uniform unique unit universe unknown
+  0x55, 0xcc, 0x7a,  0x55, 0xd4, 0x49,  0x55, 0xd5, 0x9b,  0x55, 0xd6, 0x2a,  0x56, 0x04, 0x0a,  0x56, 0x07, 0x93,  0x56, 0x08, 0x7a,  0x56, 0x0f, 0x70,  // unlock until unusual unveil update upgrade uphold upon
+  0x56, 0x10, 0x29,  0x56, 0x13, 0x29,  0x56, 0x42, 0x09,  0x56, 0x47, 0x28,  0x56, 0x61, 0x39,  0x56, 0x65, 0x00,  0x56, 0x65, 0x20,  0x56, 0x65, 0x32,  // upper upset urban urge usage use used useful
+  0x56, 0x65, 0x63,  0x56, 0x75, 0x09,  0x56, 0x89, 0x63,  0x58, 0x23, 0x0a,  0x58, 0x23, 0xaa,  0x58, 0x27, 0xa9,  0x58, 0x2c, 0x49,  0x58, 0x2c, 0x62,  // useless usual utility vacant vacuum vague valid valley
+  0x58, 0x2c, 0xb1,  0x58, 0x2e, 0x00,  0x58, 0x2e, 0x4a,  0x58, 0x30, 0x79,  0x58, 0x32, 0x4b,  0x58, 0x33, 0xa0,  0x58, 0x35, 0x61,  0x58, 0xa8, 0x4b,  // valve van vanish vapor various vast vault vehicle
+  0x58, 0xac, 0xb2,  0x58, 0xae, 0x22,  0x58, 0xae, 0xa3,  0x58, 0xae, 0xa9,  0x58, 0xb2, 0x10,  0x58, 0xb2, 0x4a,  0x58, 0xb2, 0x9b,  0x58, 0xb2, 0xc8,  // velvet vendor venture venue verb verify version very
+  0x58, 0xb3, 0x9a,  0x58, 0xb4, 0x2b,  0x59, 0x21, 0x12,  0x59, 0x22, 0x93,  0x59, 0x23, 0x4b,  0x59, 0x23, 0xa3,  0x59, 0x24, 0x29,  0x59, 0x25, 0xb8,  // vessel veteran viable vibrant vicious victory video view
+  0x59, 0x2c, 0x63,  0x59, 0x2e, 0xa3,  0x59, 0x2f, 0x62,  0x59, 0x32, 0xa3,  0x59, 0x32, 0xa9,  0x59, 0x33, 0x08,  0x59, 0x33, 0x49,  0x59, 0x33, 0xaa,  // village vintage violin virtual virus visa visit visual
+  0x59, 0x34, 0x09,  0x59, 0x36, 0x49,  0x59, 0xe3, 0x09,  0x59, 0xe9, 0x19,  0x59, 0xe9, 0x20,  0x59, 0xec, 0x1b,  0x59, 0xec, 0xaa,  0x59, 0xf4, 0x28,  // vital vivid vocal voice void volcano volume vote
+  0x59, 0xf9, 0x0a,  0x5c, 0x27, 0x28,  0x5c, 0x27, 0x79,  0x5c, 0x29, 0xa0,  0x5c, 0x2c, 0x58,  0x5c, 0x2c, 0x60,  0x5c, 0x2c, 0x72,  0x5c, 0x2e, 0xa0,  // voyage wage wagon wait walk wall walnut want
+  0x5c, 0x32, 0x33,  0x5c, 0x32, 0x68,  0x5c, 0x32, 0x93,  0x5c, 0x33, 0x40,  0x5c, 0x33, 0x80,  0x5c, 0x33, 0xa1,  0x5c, 0x34, 0x29,  0x5c, 0x36, 0x28,  // warfare warm warrior wash wasp waste water wave
+  0x5c, 0x39, 0x00,  0x5c, 0xa1, 0x62,  0x5c, 0xa1, 0x82,  0x5c, 0xa1, 0x90,  0x5c, 0xa1, 0x9a,  0x5c, 0xa1, 0xa3,  0x5c, 0xa2, 0x00,  0x5c, 0xa4, 0x23,  // way wealth weapon wear weasel weather web wedding
+  0x5c, 0xa5, 0x5b,  0x5c, 0xa9, 0x91,  0x5c, 0xac, 0x1b,  0x5c, 0xb3, 0xa0,  0x5c, 0xb4, 0x00,  0x5d, 0x01, 0x61,  0x5d, 0x01, 0xa0,  0x5d, 0x05, 0x09,  // weekend weird welcome west wet whale what wheat
+  0x5d, 0x05, 0x29,  0x5d, 0x05, 0x70,  0x5d, 0x05, 0x91,  0x5d, 0x09, 0x80,  0x5d, 0x09, 0x9b,  0x5d, 0x24, 0x28,  0x5d, 0x24, 0xa1,  0x5d, 0x26, 0x28,  // wheel when where whip whisper wide width wife
+  0x5d, 0x2c, 0x20,  0x5d, 0x2c, 0x60,  0x5d, 0x2e, 0x00,  0x5d, 0x2e, 0x22,  0x5d, 0x2e, 0x28,  0x5d, 0x2e, 0x38,  0x5d, 0x2e, 0x58,  0x5d, 0x2e, 0x72,  // wild will win window wine wing wink winner
+  0x5d, 0x2e, 0xa2,  0x5d, 0x32, 0x28,  0x5d, 0x33, 0x22,  0x5d, 0x33, 0x28,  0x5d, 0x33, 0x40,  0x5d, 0x34, 0x73,  0x5d, 0xec, 0x30,  0x5d, 0xed, 0x09,  // winter wire wisdom wise wish witness wolf woman
+  0x5d, 0xee, 0x22,  0x5d, 0xef, 0x20,  0x5d, 0xef, 0x60,  0x5d, 0xf2, 0x20,  0x5d, 0xf2, 0x58,  0x5d, 0xf2, 0x61,  0x5d, 0xf2, 0x91,  0x5d, 0xf2, 0xa1,  // wonder wood wool word work world worry worth
+  0x5e, 0x41, 0x80,  0x5e, 0x45, 0x19,  0x5e, 0x45, 0x9b,  0x5e, 0x49, 0x99,  0x5e, 0x49, 0xa1,  0x5e, 0x4f, 0x71,  0x64, 0x32, 0x20,  0x64, 0xa1, 0x90,  // wrap wreck wrestle wrist write wrong yard year
+  0x64, 0xac, 0x62,  0x65, 0xf5, 0x00,  0x65, 0xf5, 0x71,  0x65, 0xf5, 0xa1,  0x68, 0xa2, 0x91,  0x68, 0xb2, 0x78,  0x69, 0xee, 0x28,  0x69, 0xef, 0x00  // yellow you young youth zebra zero zone zoo
 };
 
+static const uint16_t BIP39_EN_SUFFIX_OFFSETS[BIP39_EN_WORDS_NUM / BIP39_EN_BLOCK_WORDS] =
+{
+     0,   63,  108,  163,  224,  272,  316,  349,
+   399,  438,  495,  540,  601,  641,  694,  757,
+   831,  866,  913,  976, 1037, 1085, 1128, 1158,
+  1205, 1243, 1278, 1308, 1344, 1412, 1469, 1497,
+  1532, 1566, 1610, 1659, 1712, 1763, 1805, 1847,
+  1894, 1947, 1982, 2059, 2121, 2159, 2230, 2269,
+  2303, 2361, 2407, 2442, 2471, 2521, 2569, 2623,
+  2651, 2691, 2737, 2776, 2830, 2886, 2923, 2954
+};
+
+static const char BIP39_EN_SUFFIXES[BIP39_EN_SUFFIXES_LEN + 1] =
+  "donitytentrbractrdessdentuntseevesticiressonressaltctessstttncecebicirrdidntedortemmholtnywsteaa"
+  "dyryseuringgntedystorentreyaleuncealherernnaqueetytogyareovelicaedrndngestvewfactstorkctulttstme"
+  "maeteckndtudeactiontstormnageadodeeomelardelornenceonyoonaerlyainelcetlehtyusemerenvendevewhfita"
+  "yereenndcleogyherkeekettksddsomsehdsterngowomceketndsedzekgefhtgkcolienzemhernhleyetalodetleeren"
+  "ertnesserrageneusralelyoneasonbletalainonoetynolealloghgorylehteioningryntusuryalainrkpiongester"
+  "geepkserytkenfdneycesenickleknramonlezenlmifynkerkntfbickehdnpterchhtnuteeectrmnineortconanyertu"
+  "ctirmressectiderrolinceerlectonhtryleseinrtekleteherlymitkketepicschdiallseblechhtalureoardousen"
+  "taineionomegeeernghterteisdemberdeinerateeasenseneeeyverndsealistrtndsithtyveribertgnairroyilctl"
+  "opceteramondyelertalitymmaersaurctgreeoveraseissrderlayancertderceyormenthininteeyrletonaticmstl"
+  "kenghfmicreyhlyogyomyatertterwrtricantenthantatorerkdyacegeionoyweryletessrseygyrcegenenceystghc"
+  "hllrerreylopeodelpeeionrtpeyncetenalcsenceevetplessangeteudeseuteciseustbiteticndctreainseessnda"
+  "rowicltythelyusyasyionlerguetriteureuaryralleeivalhrriondreerlershtalessehorhttkrerdhsowestetune"
+  "mardilerdileeuenthndgettnentyacereetxyerygeageenicentereraluseleineurettleerffeceesepseemyeessel"
+  "laeliprnentesitytnferyptdsetarterteryorhestrdthtyehoghtoetenoryyeydayowyoreitallrnlerredryleyand"
+  "idtifyregalesseatensenectseovelseudemeeasexcateorstryntictrmleritialctrytercenttirynectdeireallc"
+  "treststtelvendateeyetaroussylneyeeleoraroohupeydomheneneklreruageopernhdryuitrerneurelndurenthar"
+  "donerlrtyarynsettidlerdterlclyerygelyageerrhrycsinecetralgeateoionalelehinneetiageerhrialixermum"
+  "owureanicladyerryionyetyagelodleightioncmumrtecleorryakedurelelfynttoreyterhlinguitoeronrtaineei"
+  "niplyleumroomcallferyeinowyonretiveecthereweorkralrteeneelealhbleingcelearerectgeurerveinousrnbe"
+  "rrcenepicnneaionseongetardrnarynntinalanichroorrutiderenerelecealcherrdentotyhentolerneenteutant"
+  "canltyilleerectitoneoseicaloicureeonteerolhaeetticesegekgetrcelariontionibletoeryrtyerrticeseict"
+  "erareenttyenteearytrityonateelemessuceitramectotefertyperectdideicingekinhlyhasetyoseelemiditytu"
+  "mtertionkeitoonroeyhomedernryonlildlliveperdcleceectrmseonetlarctxaseefinmberndveerweniratacerti"
+  "reuemblesturceonseltreeatrnionalewrdhmoneetdleallrttstetnceietehdeleraylleessdonntelesfyshieagee"
+  "eteremeolncesorspiontpenptbchonndetionrityentctnaroreenceesiceionlepnowtloweliffldteerkttlderemp"
+  "gfleingetntyerlarleenerateechltlpdereehtanhlteethkeferalrierdtioneoneydceheeialnkialdldreeereitt"
+  "lsorntyadngreezerrelleiumferspdtekleoklgkachelyetegyetkengggleentfbleeectitayessenerresteryetrly"
+  "emeaceeriseoundeyectainlowpmrttgchdoltompemelenteteoohntiskeryegghtevewbderetrerdueetccoylerther"
+  "etntorrowueghthclehadooiselistrdrkeficicnsferheltdlekgerhyblekypetthionleeleylevetyetcalellalear"
+  "eeverrirldppyormueerseowncklualilteadeldrtneulesslityntumedeyeshroustcleetorureefyionelranleanto"
+  "usoryoageageinualstalldleanomegenutareiorerthonelheringenddomeetleperhowereromessnerdyhktletegow"
+  "gha";
+
 #endif // _BIP39ENWORDS_H
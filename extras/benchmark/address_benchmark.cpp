@@ -0,0 +1,80 @@
+// address_benchmark.cpp
+// Algorand address validation and encoding throughput, on a Linux (or any POSIX) host
+// v20261018-1
+
+// Single thread. Build e.g.
+//   g++ -O2 -I../.. address_benchmark.cpp ../../algoaddress.cpp ../../base32decode.cpp ../../algosha512.cpp -o bench_address
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+#include "algoaddress.h"
+
+#define BENCH_ADDRESSES 64
+#define BENCH_SECONDS 2.0
+
+
+typedef std::chrono::steady_clock benchClock;
+
+
+// Runs "call" repeatedly for about BENCH_SECONDS; returns calls per second
+template <class TCall>
+static double callsPerSecond(TCall call)
+{
+  uint32_t calls = 0;
+  double elapsed = 0.0;
+  benchClock::time_point start = benchClock::now();
+
+  do
+  {
+    for (uint8_t i = 0; i < BENCH_ADDRESSES; i++)
+    {
+      call(i);
+    }
+    calls += BENCH_ADDRESSES;
+    elapsed = std::chrono::duration<double>(benchClock::now() - start).count();
+  } while (elapsed < BENCH_SECONDS);
+
+  return calls / elapsed;
+}
+
+
+int main()
+{
+  static char addresses[BENCH_ADDRESSES][ALGOADDRESS_B32_LEN + 1];
+  static uint8_t publicKey[ALGOADDRESS_KEY_BYTES];
+  uint32_t valid = 0;
+
+  for (uint8_t i = 0; i < BENCH_ADDRESSES; i++)
+  {
+    for (uint8_t j = 0; j < ALGOADDRESS_KEY_BYTES; j++)
+    {
+      publicKey[j] = (uint8_t)(i * 31 + j * 7);
+    }
+    AlgoAddress::encode(publicKey, addresses[i]);
+  }
+
+  printf("AlgoAddress, %u distinct addresses, 1 thread\n", BENCH_ADDRESSES);
+  printf("decode() (validating): %10.0f addresses/s\n",
+         callsPerSecond([&](uint8_t i) { valid += (AlgoAddress::decode(addresses[i], publicKey) == ALGOADDRESS_NO_ERROR); }));
+  printf("encode():              %10.0f addresses/s\n",
+         callsPerSecond([&](uint8_t i) { AlgoAddress::encode(publicKey, addresses[i]); }));
+  printf("(%u valid)\n", valid);
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+// codec_benchmark.cpp
+// Base64 / Base32 throughput (GB/s) of AlgoBulkCodec code paths and of the scalar functions, on a Linux host
+// v20261018-1
+
+// Single thread, 1 MB buffers (of decoded data). Build e.g.
+//   g++ -O2 -I../.. codec_benchmark.cpp ../../algobulkcodec.cpp ../../base32decode.cpp -o bench_codec
+// With Densaugeo's base64.hpp (the one AlgoIoT uses on the ESP32) in the include path, e.g. -I<base64_arduino>/src,
+// its functions are measured too
+// No special compiler flags needed: SIMD paths are chosen at run time (see algobulkcodec.h)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <chrono>
+#include "algobulkcodec.h"
+#include "base32decode.h"
+
+#if defined(__has_include)
+  #if __has_include(<base64.hpp>)
+    #include <base64.hpp>
+    #define BENCH_DENSAUGEO_BASE64 1
+  #endif
+#endif
+
+#define BENCH_BYTES (1024 * 1024)
+#define BENCH_SECONDS 1.0
+
+
+typedef std::chrono::steady_clock benchClock;
+
+
+// Runs "call" repeatedly for about BENCH_SECONDS; returns GB/s, counting "bytes" (decoded size) per call
+template <class TCall>
+static double gigabytesPerSecond(const size_t bytes, TCall call)
+{
+  uint32_t calls = 0;
+  double elapsed = 0.0;
+  benchClock::time_point start = benchClock::now();
+
+  do
+  {
+    call();
+    calls++;
+    elapsed = std::chrono::duration<double>(benchClock::now() - start).count();
+  } while (elapsed < BENCH_SECONDS);
+
+  return (double)bytes * calls / elapsed / 1e9;
+}
+
+
+int main()
+{
+  static uint8_t data[BENCH_BYTES];
+  static uint8_t decoded[BENCH_BYTES + 64];
+  static char base64[ALGOBULK_BASE64_ENCODED_LEN(BENCH_BYTES) + 1];
+  static char base32[BASE32_ENCODED_LEN(BENCH_BYTES) + 1];
+  const uint8_t bestLevel = AlgoBulkCodec::simdLevel();
+  size_t base64Len = 0;
+  size_t base32Len = 0;
+
+  srand(1);
+  for (uint32_t i = 0; i < BENCH_BYTES; i++)
+  {
+    data[i] = (uint8_t)rand();
+  }
+  base64Len = AlgoBulkCodec::base64Encode(data, BENCH_BYTES, base64, sizeof(base64));
+  base32Len = AlgoBulkCodec::base32Encode(data, BENCH_BYTES, base32, sizeof(base32));
+
+  printf("GB/s of decoded data, %u-byte buffers, 1 thread; best code path on this CPU: %s\n\n",
+         BENCH_BYTES, AlgoBulkCodec::simdLevelName(bestLevel));
+  printf("%-32s %8s %8s %8s %8s\n", "", "b64 enc", "b64 dec", "b32 enc", "b32 dec");
+
+  for (uint8_t level = ALGOBULK_SCALAR; level <= bestLevel; level++)
+  {
+    AlgoBulkCodec::setSimdLevel(level);
+    printf("AlgoBulkCodec %-18s %8.2f %8.2f %8.2f %8.2f\n", AlgoBulkCodec::simdLevelName(level),
+           gigabytesPerSecond(BENCH_BYTES, [&]() { AlgoBulkCodec::base64Encode(data, BENCH_BYTES, base64, sizeof(base64)); }),
+           gigabytesPerSecond(BENCH_BYTES, [&]() { AlgoBulkCodec::base64Decode(base64, base64Len, decoded, sizeof(decoded)); }),
+           gigabytesPerSecond(BENCH_BYTES, [&]() { AlgoBulkCodec::base32Encode(data, BENCH_BYTES, base32, sizeof(base32)); }),
+           gigabytesPerSecond(BENCH_BYTES, [&]() { AlgoBulkCodec::base32Decode(base32, base32Len, decoded, sizeof(decoded)); }));
+  }
+
+  printf("%-32s %8s %8s %8.2f %8.2f\n", "Base32::encode()/decode()", "-", "-",
+         gigabytesPerSecond(BENCH_BYTES, [&]() { Base32::encode(data, BENCH_BYTES, base32, sizeof(base32)); }),
+         gigabytesPerSecond(BENCH_BYTES, [&]() { Base32::decode(base32, (int)base32Len, decoded, sizeof(decoded)); }));
+  printf("%-32s %8s %8s %8s %8.2f\n", "Base32::fromBase32() (malloc)", "-", "-", "-",
+         gigabytesPerSecond(BENCH_BYTES, [&]() { uint8_t* out = NULL; Base32::fromBase32((uint8_t*)base32, (int)base32Len, out); free(out); }));
+#ifdef BENCH_DENSAUGEO_BASE64
+  printf("%-32s %8.2f %8.2f %8s %8s\n", "base64.hpp (Densaugeo)",
+         gigabytesPerSecond(BENCH_BYTES, [&]() { encode_base64(data, BENCH_BYTES, (unsigned char*)base64); }),
+         gigabytesPerSecond(BENCH_BYTES, [&]() { decode_base64((unsigned char*)base64, decoded); }), "-", "-");
+#endif
+
+  AlgoBulkCodec::setSimdLevel(bestLevel);
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+// ed25519_benchmark.cpp
+// Signing throughput of the AlgoEd25519 backend compiled in, on a Linux (or any POSIX) host
+// v20261018-2
+
+// Single thread, so the result is signatures per second per core
+// Backend and base table tier are chosen at compile time (see ALGOED25519_BACKEND and ALGOED25519_BASE_TABLE
+// in algoed25519.h): build once per configuration, e.g.
+//   g++ -O2 -I../.. ed25519_benchmark.cpp ../../algoed25519.cpp ../../algosha512.cpp -o bench_host64
+//   g++ -O2 -I../.. -I<Crypto library>/src -DALGOED25519_BACKEND=1 ed25519_benchmark.cpp ../../algoed25519.cpp <Crypto library sources> -o bench_mcu
+// On the ESP32 the same figures come from the AlgoIoT_benchmark example sketch
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+#include "algoed25519.h"
+
+#define BENCH_MESSAGE_BYTES 256   // About the size of a payment transaction with a short note
+#define BENCH_SECONDS 2.0
+
+
+typedef std::chrono::steady_clock benchClock;
+
+
+// Runs "call" repeatedly for about BENCH_SECONDS; returns calls per second
+template <class TCall>
+static double callsPerSecond(TCall call)
+{
+  uint32_t calls = 0;
+  double elapsed = 0.0;
+  benchClock::time_point start = benchClock::now();
+
+  do
+  {
+    for (uint8_t i = 0; i < 16; i++)
+    {
+      call();
+    }
+    calls += 16;
+    elapsed = std::chrono::duration<double>(benchClock::now() - start).count();
+  } while (elapsed < BENCH_SECONDS);
+
+  return calls / elapsed;
+}
+
+
+int main()
+{
+  static uint8_t seed[ED25519_KEY_BYTES];
+  static uint8_t expandedKey[ED25519_EXPANDED_KEY_BYTES];
+  static uint8_t publicKey[ED25519_KEY_BYTES];
+  static uint8_t message[BENCH_MESSAGE_BYTES];
+  static uint8_t signature[ED25519_SIG_BYTES];
+  mpkSegment segment;
+
+  for (uint16_t i = 0; i < ED25519_KEY_BYTES; i++)
+  {
+    seed[i] = (uint8_t)i;
+  }
+  for (uint16_t i = 0; i < BENCH_MESSAGE_BYTES; i++)
+  {
+    message[i] = (uint8_t)(i * 7);
+  }
+  segment.data = message;
+  segment.len = BENCH_MESSAGE_BYTES;
+
+  AlgoEd25519::expandPrivateKey(expandedKey, seed);
+  AlgoEd25519::derivePublicKeyExpanded(publicKey, expandedKey);
+
+  printf("AlgoEd25519 backend: %s, base table tier %d, %u-byte message, 1 thread\n",
+         ALGOED25519_BACKEND_NAME, ALGOED25519_BASE_TABLE, BENCH_MESSAGE_BYTES);
+  printf("signExpanded():    %10.0f signatures/s\n",
+         callsPerSecond([&]() { AlgoEd25519::signExpanded(signature, expandedKey, publicKey, &segment, 1); }));
+  printf("sign() (seed):     %10.0f signatures/s\n",
+         callsPerSecond([&]() { AlgoEd25519::sign(signature, seed, publicKey, &segment, 1); }));
+  printf("derivePublicKey(): %10.0f keys/s\n",
+         callsPerSecond([&]() { AlgoEd25519::derivePublicKey(publicKey, seed); }));
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+// algoiot_send.cpp
+// AlgoIoT on a Linux (or any POSIX) host: notarizes one reading, as the AlgoIoT_sendData sketch does on the ESP32
+// v20261018-1
+
+// Same library sources as the sketch, over POSIX sockets (see algoiottransport.h and algoiotsocket.h). Needs
+// ArduinoJson and Densaugeo's base64.hpp (header only, as for the sketch) in the include path; https needs OpenSSL
+// Build e.g.
+//   g++ -O2 -DALGOIOT_SOCKET_TLS -I../.. -I<ArduinoJson>/src -I<base64_arduino>/src algoiot_send.cpp <sources> -lssl -lcrypto -o algoiot_send
+// <sources>: the library's, in ../..
+//   AlgoIoT.cpp algoiothttp.cpp algoiottransport.cpp algoiotsocket.cpp algoiotplatform.cpp algoiotretry.cpp
+//   algoiotendpoints.cpp algoiotjson.cpp algoiotkeycache.cpp algoiotoutbox.cpp algoed25519.cpp algosha512.cpp
+//   algoaddress.cpp minmpk.cpp minmpkdecode.cpp base32decode.cpp bip39en.cpp
+// Without -DALGOIOT_SOCKET_TLS (and OpenSSL) only http:// endpoints work
+// Run:
+//   ALGOIOT_MNEMONIC="<25 words>" ./algoiot_send [temperature [algod URL [API token]]]
+// Default algod: Algonode Testnet. Library debug output goes to stderr
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "AlgoIoT.h"
+
+#define APP_NAME "AlgoIoT-Linux"  // Short: it goes in every transaction note
+
+
+// Called by waitForConfirmations() once the transaction is in a block (or will never be)
+static void onConfirmation(const AlgoIoTConfirmation* confirmation, void* context)
+{
+  (void)context;
+  printf("Transaction %s: state %u, round %llu, %lu ms from sample\n", confirmation->txID, (unsigned)confirmation->state,
+         (unsigned long long)confirmation->confirmedRound, (unsigned long)confirmation->latencyMs);
+}
+
+
+int main(int argc, char** argv)
+{
+  const char* mnemonic = getenv("ALGOIOT_MNEMONIC");
+  float temperature = (argc > 1) ? (float)atof(argv[1]) : 21.5f;
+  int result = 0;
+
+  if (mnemonic == NULL)
+  {
+    fprintf(stderr, "Set ALGOIOT_MNEMONIC to the 25 words of the sending account\n");
+    return 1;
+  }
+
+  AlgoIoT algoIoT(APP_NAME, mnemonic);
+
+  result = algoIoT.begin();
+  if (result != ALGOIOT_NO_ERROR)
+  {
+    fprintf(stderr, "begin() failed: %d\n", result);
+    return 1;
+  }
+  if (argc > 2)
+  { // Own algod (e.g. a local node) instead of the default one
+    algoIoT.clearAlgodEndpoints();
+    result = algoIoT.addAlgodEndpoint(argv[2], (argc > 3) ? argv[3] : NULL);
+    if (result != ALGOIOT_NO_ERROR)
+    {
+      fprintf(stderr, "Bad algod URL %s: %d\n", argv[2], result);
+      return 1;
+    }
+  }
+  algoIoT.setConfirmationTracking(onConfirmation);
+
+  algoIoT.dataAddFloatField("Temperature", temperature);
+  result = algoIoT.submitTransactionToAlgorand();
+  if (result != ALGOIOT_NO_ERROR)
+  {
+    fprintf(stderr, "Submission failed: %d\n", result);
+    return 1;
+  }
+  printf("Submitted: %s\n", algoIoT.getTransactionID());
+
+  // One long poll per block, until the transaction is confirmed (or expired)
+  while (algoIoT.confirmationsPending() > 0)
+  {
+    result = algoIoT.waitForConfirmations();
+    if (result != ALGOIOT_NO_ERROR)
+    {
+      fprintf(stderr, "Status request failed: %d\n", result);
+      break;
+    }
+  }
+
+  algoIoT.closeConnection();
+
+  return (result == ALGOIOT_NO_ERROR) ? 0 : 1;
+}
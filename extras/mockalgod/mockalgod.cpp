@@ -0,0 +1,1081 @@
+// mockalgod.cpp
+// AlgoMockAlgod: a stand-in for algod on loopback, with latency and fault injection (POSIX host)
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <chrono>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <openssl/evp.h>
+#include "mockalgod.h"
+#include "minmpkdecode.h"
+#include "base32decode.h"
+
+#define RESPONSE_BODY_BYTES 4096
+#define RESPONSE_BYTES (RESPONSE_BODY_BYTES * 2)  // Headers, and chunk sizes when chunked
+#define CHUNK_MAX_BYTES 64                        // Chunk sizes drawn in 1..CHUNK_MAX_BYTES: the client sees any split
+#define WAIT_SLICE_MS 50                          // Longest sleep without checking for stop()
+#define SIGNED_MESSAGE_BYTES (MOCKALGOD_MAX_REQUEST_BYTES + 2)
+#define CONSENSUS_VERSION "https://github.com/algorandfoundation/specs/tree/925a46433742afb0b51bb939354bd907fa88bf95"
+
+#define ED25519_KEY_BYTES 32
+#define ED25519_SIG_BYTES 64
+#define HASH_BYTES 32             // SHA-512/256
+
+
+///////////////////////////////
+// Helpers
+///////////////////////////////
+
+static uint64_t nowMs()
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+static const char* reasonPhrase(const int status)
+{
+  switch (status)
+  {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 500: return "Internal Server Error";
+    case 502: return "Bad Gateway";
+    case 503: return "Service Unavailable";
+    case 504: return "Gateway Timeout";
+    default: return "Error";
+  }
+}
+
+
+// All of it, or nothing: the connection is over anyway if it fails
+static uint8_t sendAll(const int fd, const char* data, uint32_t len)
+{
+  while (len > 0)
+  {
+    ssize_t sent = send(fd, data, len, MSG_NOSIGNAL);
+    if (sent <= 0)
+      return 0;
+    data += sent;
+    len -= (uint32_t)sent;
+  }
+
+  return 1;
+}
+
+
+// Value of header "name" (e.g. "Content-Length:"), case-insensitive, up to its end of line, into "value"
+static uint8_t findHeader(const char* headers, const char* name, char* value, const uint32_t valueSize)
+{
+  const uint32_t nameLen = strlen(name);
+  const char* line = strstr(headers, "\r\n");
+
+  while ((line != NULL) && (line[2] != '\r'))
+  {
+    line += 2;
+    if (strncasecmp(line, name, nameLen) == 0)
+    {
+      const char* start = line + nameLen;
+      const char* end = strstr(start, "\r\n");
+      uint32_t len = 0;
+
+      while ((*start == ' ') || (*start == '\t'))
+        start++;
+      len = (end != NULL) ? (uint32_t)(end - start) : strlen(start);
+      if (len >= valueSize)
+        len = valueSize - 1;
+      memcpy(value, start, len);
+      value[len] = '\0';
+      return 1;
+    }
+    line = strstr(line, "\r\n");
+  }
+
+  return 0;
+}
+
+
+static int jsonMessage(char* response, const uint32_t responseSize, const int status, const char* message)
+{
+  snprintf(response, responseSize, "{\"message\":\"%s\"}", message);
+
+  return status;
+}
+
+
+// SHA-512/256 of "prefix" and the "nParts" byte ranges in "parts" (pointer, length pairs)
+static uint8_t hashParts(const char* prefix, const uint8_t* const* parts, const uint32_t* lens, const uint8_t nParts,
+                         uint8_t hash[HASH_BYTES])
+{
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  unsigned int len = 0;
+  uint8_t ok = 0;
+
+  if (ctx == NULL)
+    return 0;
+  if ((EVP_DigestInit_ex(ctx, EVP_sha512_256(), NULL) == 1) && (EVP_DigestUpdate(ctx, prefix, strlen(prefix)) == 1))
+  {
+    ok = 1;
+    for (uint8_t i = 0; ok && (i < nParts); i++)
+      ok = (lens[i] == 0) || (EVP_DigestUpdate(ctx, parts[i], lens[i]) == 1);
+    ok = ok && (EVP_DigestFinal_ex(ctx, hash, &len) == 1) && (len == HASH_BYTES);
+  }
+  EVP_MD_CTX_free(ctx);
+
+  return ok;
+}
+
+
+// Ed25519 (RFC 8032) signature of "TX" and the transaction, by the sender's key
+static uint8_t verifyTransaction(const uint8_t* txn, const uint32_t txnLen, const uint8_t sig[ED25519_SIG_BYTES],
+                                 const uint8_t sender[ED25519_KEY_BYTES], uint8_t* message)
+{
+  EVP_PKEY* key = EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519, NULL, sender, ED25519_KEY_BYTES);
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  uint8_t ok = 0;
+
+  memcpy(message, "TX", 2);
+  memcpy(message + 2, txn, txnLen);
+  if ((key != NULL) && (ctx != NULL) && (EVP_DigestVerifyInit(ctx, NULL, NULL, NULL, key) == 1))
+    ok = (EVP_DigestVerify(ctx, sig, ED25519_SIG_BYTES, message, txnLen + 2) == 1);
+  EVP_MD_CTX_free(ctx);
+  EVP_PKEY_free(key);
+
+  return ok;
+}
+
+
+///////////////////////////////
+// Transactions
+///////////////////////////////
+
+// One signed transaction of a post, as decoded
+typedef struct mockSignedTx
+{
+  const uint8_t* signedTx;
+  uint32_t signedTxLen;
+  const uint8_t* txn;       // Transaction map, as signed
+  uint32_t txnLen;
+  uint32_t txnPairs;
+  uint32_t txnHeaderLen;    // Map header bytes
+  uint32_t grpStart;        // "grp" pair (key and value) offsets in the transaction; grpEnd = 0 if none
+  uint32_t grpEnd;
+  const uint8_t* sig;
+  const uint8_t* snd;
+  const uint8_t* gh;
+  const uint8_t* grp;
+  const char* gen;
+  uint32_t genLen;
+  const uint8_t* note;
+  uint32_t noteLen;
+  uint64_t fee;
+  uint64_t fv;
+  uint64_t lv;
+  uint8_t txID[HASH_BYTES];
+  char txIDText[MOCKALGOD_TXID_CHARS + 1];
+} mockSignedTx;
+
+
+// Decodes one canonical signed transaction ("sig" and "txn" only: no multisig nor logic signature)
+// Returns an algod-like error message, or NULL if decoded
+static const char* decodeSignedTx(const uint8_t* buffer, const uint32_t len, mockSignedTx* tx)
+{
+  mpkReader reader;
+  uint32_t pairs = 0;
+  uint32_t itemLen = 0;
+
+  memset(tx, 0, sizeof(*tx));
+  if (msgpackValidateCanonical(buffer, len, &itemLen) != MPK_NO_ERROR)
+    return "msgpack decode error: not a canonical signed transaction";
+  tx->signedTx = buffer;
+  tx->signedTxLen = itemLen;
+
+  msgpackReaderInit(&reader, buffer, itemLen);
+  if (msgpackReadMap(&reader, &pairs) != MPK_NO_ERROR)
+    return "msgpack decode error: signed transaction is not a map";
+  for (uint32_t i = 0; i < pairs; i++)
+  {
+    const char* key = NULL;
+    uint32_t keyLen = 0;
+    uint32_t sigLen = 0;
+
+    if (msgpackReadString(&reader, &key, &keyLen) != MPK_NO_ERROR)
+      return "msgpack decode error: bad key";
+    if ((keyLen == 3) && (memcmp(key, "sig", 3) == 0))
+    {
+      if ((msgpackReadByteArray(&reader, &tx->sig, &sigLen) != MPK_NO_ERROR) || (sigLen != ED25519_SIG_BYTES))
+        return "msgpack decode error: bad signature field";
+    }
+    else if ((keyLen == 3) && (memcmp(key, "txn", 3) == 0))
+    {
+      uint32_t start = msgpackReaderGetPosition(&reader);
+      if (msgpackSkip(&reader) != MPK_NO_ERROR)
+        return "msgpack decode error: bad transaction";
+      tx->txn = buffer + start;
+      tx->txnLen = msgpackReaderGetPosition(&reader) - start;
+    }
+    else
+      return "only single-signature transactions are supported by this mock";
+  }
+  if ((tx->sig == NULL) || (tx->txn == NULL))
+    return "signed transaction without signature or transaction";
+
+  // Transaction fields
+  msgpackReaderInit(&reader, tx->txn, tx->txnLen);
+  if (msgpackReadMap(&reader, &tx->txnPairs) != MPK_NO_ERROR)
+    return "msgpack decode error: transaction is not a map";
+  tx->txnHeaderLen = msgpackReaderGetPosition(&reader);
+  for (uint32_t i = 0; i < tx->txnPairs; i++)
+  {
+    const uint32_t pairStart = msgpackReaderGetPosition(&reader);
+    const char* key = NULL;
+    uint32_t keyLen = 0;
+    uint32_t binLen = 0;
+    int err = MPK_NO_ERROR;
+
+    if (msgpackReadString(&reader, &key, &keyLen) != MPK_NO_ERROR)
+      return "msgpack decode error: bad transaction key";
+    if ((keyLen == 3) && (memcmp(key, "fee", 3) == 0))
+      err = msgpackReadUInt(&reader, &tx->fee);
+    else if ((keyLen == 2) && (memcmp(key, "fv", 2) == 0))
+      err = msgpackReadUInt(&reader, &tx->fv);
+    else if ((keyLen == 2) && (memcmp(key, "lv", 2) == 0))
+      err = msgpackReadUInt(&reader, &tx->lv);
+    else if ((keyLen == 3) && (memcmp(key, "gen", 3) == 0))
+      err = msgpackReadString(&reader, &tx->gen, &tx->genLen);
+    else if ((keyLen == 2) && (memcmp(key, "gh", 2) == 0))
+      err = ((msgpackReadByteArray(&reader, &tx->gh, &binLen) != MPK_NO_ERROR) || (binLen != HASH_BYTES));
+    else if ((keyLen == 3) && (memcmp(key, "grp", 3) == 0))
+    {
+      err = ((msgpackReadByteArray(&reader, &tx->grp, &binLen) != MPK_NO_ERROR) || (binLen != HASH_BYTES));
+      tx->grpStart = pairStart;
+      tx->grpEnd = msgpackReaderGetPosition(&reader);
+    }
+    else if ((keyLen == 4) && (memcmp(key, "note", 4) == 0))
+      err = msgpackReadByteArray(&reader, &tx->note, &tx->noteLen);
+    else if ((keyLen == 3) && (memcmp(key, "snd", 3) == 0))
+      err = ((msgpackReadByteArray(&reader, &tx->snd, &binLen) != MPK_NO_ERROR) || (binLen != ED25519_KEY_BYTES));
+    else
+      err = msgpackSkip(&reader);
+    if (err != MPK_NO_ERROR)
+      return "msgpack decode error: bad transaction field";
+  }
+  if ((tx->snd == NULL) || (tx->gh == NULL) || (tx->lv == 0))
+    return "transaction without sender, genesis hash or last valid round";
+
+  // Transaction ID: SHA-512/256 of "TX" and the transaction, Base32
+  const uint8_t* parts[1] = { tx->txn };
+  uint32_t lens[1] = { tx->txnLen };
+  if (!hashParts("TX", parts, lens, 1, tx->txID) ||
+      (Base32::encode(tx->txID, HASH_BYTES, tx->txIDText, sizeof(tx->txIDText)) != MOCKALGOD_TXID_CHARS))
+    return "cannot compute transaction ID";
+
+  return NULL;
+}
+
+
+// Group ID as the group was built: SHA-512/256 of "TG" and { "txlist": [ IDs of the members without "grp" ] }
+static uint8_t groupID(const mockSignedTx* txs, const uint8_t count, uint8_t group[HASH_BYTES])
+{
+  uint8_t list[12 + MOCKALGOD_MAX_GROUP_TXNS * (2 + HASH_BYTES)];
+  uint32_t len = 0;
+
+  list[len++] = 0x81;  // fixmap, 1 pair
+  list[len++] = 0xA6;  // fixstr, 6 chars
+  memcpy(list + len, "txlist", 6);
+  len += 6;
+  if (count < 16)
+    list[len++] = 0x90 | count;  // fixarray
+  else
+  {
+    list[len++] = 0xDC;  // array 16
+    list[len++] = 0;
+    list[len++] = count;
+  }
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const mockSignedTx* tx = &txs[i];
+    uint8_t header[3];
+    uint32_t headerLen = 0;
+    const uint32_t pairs = tx->txnPairs - ((tx->grpEnd > 0) ? 1 : 0);
+
+    if (pairs < 16)
+      header[headerLen++] = 0x80 | (uint8_t)pairs;  // fixmap
+    else
+    {
+      header[headerLen++] = 0xDE;  // map 16
+      header[headerLen++] = (uint8_t)(pairs >> 8);
+      header[headerLen++] = (uint8_t)pairs;
+    }
+
+    // Transaction without its "grp" pair: new header, the pairs before it, the pairs after it
+    const uint32_t grpStart = (tx->grpEnd > 0) ? tx->grpStart : tx->txnLen;
+    const uint32_t grpEnd = (tx->grpEnd > 0) ? tx->grpEnd : tx->txnLen;
+    const uint8_t* parts[3] = { header, tx->txn + tx->txnHeaderLen, tx->txn + grpEnd };
+    uint32_t lens[3] = { headerLen, grpStart - tx->txnHeaderLen, tx->txnLen - grpEnd };
+
+    list[len++] = 0xC4;  // bin 8
+    list[len++] = HASH_BYTES;
+    if (!hashParts("TX", parts, lens, 3, list + len))
+      return 0;
+    len += HASH_BYTES;
+  }
+
+  const uint8_t* parts[1] = { list };
+  uint32_t lens[1] = { len };
+
+  return hashParts("TG", parts, lens, 1, group);
+}
+
+
+///////////////////////////////
+// Server
+///////////////////////////////
+
+AlgoMockAlgod::AlgoMockAlgod()
+{
+  m_stopping = 1;
+  for (uint8_t i = 0; i < MOCKALGOD_MAX_CONNECTIONS; i++)
+  {
+    m_connections[i].fd = -1;
+    m_connections[i].done = 0;
+  }
+  defaultConfig(&m_config);
+  memset(&m_stats, 0, sizeof(m_stats));
+}
+
+
+AlgoMockAlgod::~AlgoMockAlgod()
+{
+  stop();
+}
+
+
+void AlgoMockAlgod::defaultConfig(AlgoMockAlgodConfig* config)
+{
+  memset(config, 0, sizeof(*config));
+  strcpy(config->genesisID, MOCKALGOD_DEFAULT_GENESIS_ID);
+  strcpy(config->genesisHash, MOCKALGOD_DEFAULT_GENESIS_HASH);
+  config->firstRound = MOCKALGOD_DEFAULT_FIRST_ROUND;
+  config->roundMs = MOCKALGOD_DEFAULT_ROUND_MS;
+  config->minFee = MOCKALGOD_DEFAULT_MIN_FEE;
+  config->seed = 1;
+  config->faults.errorStatus = 503;
+  config->faults.routes = MOCKALGOD_ALL_ROUTES;
+}
+
+
+int AlgoMockAlgod::start(const AlgoMockAlgodConfig* config, const uint16_t port)
+{
+  struct sockaddr_in address;
+  socklen_t addressLen = sizeof(address);
+  int reuse = 1;
+
+  if (m_listenFd >= 0)
+    return MOCKALGOD_ERROR_RUNNING;
+  if ((config == NULL) || (config->roundMs == 0) || (config->firstRound == 0) ||
+      (EVP_DecodeBlock(m_genesisHash, (const unsigned char*)config->genesisHash, strlen(config->genesisHash)) < HASH_BYTES))
+    return MOCKALGOD_ERROR_BAD_PARAM;
+
+  m_listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (m_listenFd < 0)
+    return MOCKALGOD_ERROR_SOCKET;
+  setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if ((bind(m_listenFd, (struct sockaddr*)&address, sizeof(address)) != 0) || (listen(m_listenFd, MOCKALGOD_MAX_CONNECTIONS) != 0) ||
+      (getsockname(m_listenFd, (struct sockaddr*)&address, &addressLen) != 0))
+  {
+    close(m_listenFd);
+    m_listenFd = -1;
+    return MOCKALGOD_ERROR_SOCKET;
+  }
+  m_port = ntohs(address.sin_port);
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_config = *config;
+    m_random = (config->seed != 0) ? config->seed : 1;
+    m_nTxns = 0;
+    memset(&m_stats, 0, sizeof(m_stats));
+  }
+  m_startMs = nowMs();
+  m_stopping = 0;
+  m_acceptThread = std::thread(&AlgoMockAlgod::acceptLoop, this);
+
+  return MOCKALGOD_NO_ERROR;
+}
+
+
+// Connection threads are woken by shutdown(): their sockets are closed once they are over
+void AlgoMockAlgod::stop()
+{
+  if (m_listenFd < 0)
+    return;
+
+  m_stopping = 1;
+  if (m_acceptThread.joinable())
+    m_acceptThread.join();
+  for (uint8_t i = 0; i < MOCKALGOD_MAX_CONNECTIONS; i++)
+  {
+    Connection* connection = &m_connections[i];
+    if (connection->fd < 0)
+      continue;
+    shutdown(connection->fd, SHUT_RDWR);
+    if (connection->thread.joinable())
+      connection->thread.join();
+    close(connection->fd);
+    connection->fd = -1;
+  }
+  close(m_listenFd);
+  m_listenFd = -1;
+}
+
+
+uint16_t AlgoMockAlgod::port()
+{
+  return m_port;
+}
+
+
+void AlgoMockAlgod::url(char* out, const uint32_t outSize)
+{
+  snprintf(out, outSize, "http://127.0.0.1:%u", (unsigned)m_port);
+}
+
+
+void AlgoMockAlgod::setFaults(const AlgoMockFaults* faults)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+
+  m_config.faults = *faults;
+}
+
+
+void AlgoMockAlgod::setLatency(const uint8_t route, const AlgoMockLatency* latency)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+
+  if (route < MOCKALGOD_ROUTES)
+    m_config.latency[route] = *latency;
+}
+
+
+void AlgoMockAlgod::setTransactionCallback(AlgoMockTransactionCallback callback, void* context)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+
+  m_callback = callback;
+  m_callbackContext = context;
+}
+
+
+uint8_t AlgoMockAlgod::hasTransaction(const char* txID, uint64_t* confirmedRound)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+  Transaction* tx = findTransaction(txID);
+
+  if ((tx != NULL) && (confirmedRound != NULL))
+    *confirmedRound = tx->confirmedRound;
+
+  return (tx != NULL);
+}
+
+
+void AlgoMockAlgod::getStats(AlgoMockAlgodStats* stats)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+
+  *stats = m_stats;
+}
+
+
+void AlgoMockAlgod::resetStats()
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+
+  memset(&m_stats, 0, sizeof(m_stats));
+}
+
+
+// Finished connections are reaped when a new one comes: a slot is joined before it is used again
+void AlgoMockAlgod::acceptLoop()
+{
+  while (!m_stopping)
+  {
+    struct pollfd listening = { m_listenFd, POLLIN, 0 };
+    Connection* connection = NULL;
+    int fd = -1;
+    int noDelay = 1;
+
+    if (poll(&listening, 1, WAIT_SLICE_MS) <= 0)
+      continue;
+    fd = accept(m_listenFd, NULL, NULL);
+    if (fd < 0)
+      continue;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+    for (uint8_t i = 0; (i < MOCKALGOD_MAX_CONNECTIONS) && (connection == NULL); i++)
+    {
+      if ((m_connections[i].fd >= 0) && m_connections[i].done)
+      {
+        m_connections[i].thread.join();
+        close(m_connections[i].fd);
+        m_connections[i].fd = -1;
+      }
+      if (m_connections[i].fd < 0)
+        connection = &m_connections[i];
+    }
+    if (connection == NULL)
+    { // As a server out of workers
+      close(fd);
+      continue;
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_stats.connections++;
+    }
+    connection->fd = fd;
+    connection->done = 0;
+    connection->thread = std::thread(&AlgoMockAlgod::serve, this, connection);
+  }
+}
+
+
+// Requests of one connection, in turn, until the client closes it, a fault does, or stop()
+void AlgoMockAlgod::serve(Connection* connection)
+{
+  char* buffer = (char*)malloc(MOCKALGOD_MAX_REQUEST_BYTES + 1);
+  char* response = (char*)malloc(RESPONSE_BODY_BYTES);
+  char* out = (char*)malloc(RESPONSE_BYTES);
+  uint8_t* message = (uint8_t*)malloc(SIGNED_MESSAGE_BYTES);
+  uint32_t have = 0;
+  uint16_t served = 0;
+
+  while ((buffer != NULL) && (response != NULL) && (out != NULL) && (message != NULL) && !m_stopping)
+  {
+    uint32_t headerLen = 0;
+    uint32_t bodyLen = 0;
+    uint32_t requestLen = readRequest(connection->fd, buffer, &have, &headerLen, &bodyLen);
+    char method[8] = "";
+    char path[128] = "";
+    char token[MOCKALGOD_TOKEN_CHARS + 1] = "";
+    char value[32] = "";
+    uint8_t route = MOCKALGOD_ROUTES;
+    uint8_t closeAfter = 0;
+    uint8_t inject = 0;
+    uint8_t fail = 0;
+    uint8_t lost = 0;
+    uint8_t drop = 0;
+    uint8_t truncate = 0;
+    uint8_t chunked = 0;
+    uint32_t delayMs = 0;
+    int errorStatus = 0;
+    int status = 0;
+
+    if (requestLen == 0)
+      break;
+
+    // Request line and the headers that matter. Body (binary) follows the headers
+    buffer[headerLen - 2] = '\0';  // Headers end with the empty line: the last "\r\n" is enough for findHeader()
+    if (sscanf(buffer, "%7s %127s", method, path) != 2)
+      break;
+    findHeader(buffer, "X-Algo-API-Token:", token, sizeof(token));
+    if (findHeader(buffer, "Connection:", value, sizeof(value)) && (strcasecmp(value, "close") == 0))
+      closeAfter = 1;
+    route = routeOf(method, path);
+
+    // Faults and delay drawn for this request
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+
+      if (route < MOCKALGOD_ROUTES)
+      {
+        m_stats.requests[route]++;
+        inject = ((m_config.faults.routes & MOCKALGOD_ROUTE_BIT(route)) != 0);
+        delayMs = latencyMs(route);
+      }
+      else
+        m_stats.otherRequests++;
+      fail = inject && draw(m_config.faults.errorPerMille);
+      lost = inject && !fail && draw(m_config.faults.lostPerMille);
+      drop = inject && !fail && !lost && draw(m_config.faults.dropPerMille);
+      truncate = inject && !fail && !lost && !drop && draw(m_config.faults.truncatePerMille);
+      if (fail)
+        m_stats.errors++;
+      if (lost)
+        m_stats.lost++;
+      if (drop)
+        m_stats.drops++;
+      if (truncate)
+        m_stats.truncations++;
+      errorStatus = m_config.faults.errorStatus;
+      chunked = m_config.chunked;
+      if ((m_config.keepAliveRequests > 0) && (served + 1 >= m_config.keepAliveRequests))
+        closeAfter = 1;
+    }
+    if (lost)
+      break;
+    sleepMs(delayMs);
+
+    if ((m_config.apiToken[0] != '\0') && (strcmp(token, m_config.apiToken) != 0))
+      status = jsonMessage(response, RESPONSE_BODY_BYTES, 401, "Invalid API Token");
+    else if (fail)
+    {
+      status = jsonMessage(response, RESPONSE_BODY_BYTES, errorStatus, "mock algod: injected error");
+    }
+    else
+      status = handle(route, method, path, (const uint8_t*)buffer + headerLen, bodyLen, message, response, RESPONSE_BODY_BYTES);
+    if (drop)
+      break;
+
+    // Response, whole or cut short
+    const uint32_t bodyBytes = strlen(response);
+    uint32_t outLen = (uint32_t)snprintf(out, RESPONSE_BYTES, "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\n%s%s",
+                                         status, reasonPhrase(status), closeAfter ? "Connection: close\r\n" : "",
+                                         chunked ? "Transfer-Encoding: chunked\r\n" : "");
+    const uint32_t headersOut = (chunked ? 0 : (uint32_t)snprintf(out + outLen, RESPONSE_BYTES - outLen, "Content-Length: %u\r\n", bodyBytes));
+
+    outLen += headersOut;
+    outLen += (uint32_t)snprintf(out + outLen, RESPONSE_BYTES - outLen, "\r\n");
+    const uint32_t bodyStart = outLen;
+    if (chunked)
+    {
+      uint32_t done = 0;
+      while (done < bodyBytes)
+      {
+        uint32_t chunk = 0;
+        {
+          std::lock_guard<std::mutex> guard(m_lock);
+          chunk = 1 + (uint32_t)(nextRandom() % CHUNK_MAX_BYTES);
+        }
+        if (chunk > bodyBytes - done)
+          chunk = bodyBytes - done;
+        outLen += (uint32_t)snprintf(out + outLen, RESPONSE_BYTES - outLen, "%x\r\n", chunk);
+        memcpy(out + outLen, response + done, chunk);
+        outLen += chunk;
+        memcpy(out + outLen, "\r\n", 2);
+        outLen += 2;
+        done += chunk;
+      }
+      memcpy(out + outLen, "0\r\n\r\n", 5);
+      outLen += 5;
+    }
+    else
+    {
+      memcpy(out + outLen, response, bodyBytes);
+      outLen += bodyBytes;
+    }
+    if (truncate)
+      outLen = bodyStart + (outLen - bodyStart) / 2;
+    if (!sendAll(connection->fd, out, outLen) || truncate || closeAfter)
+      break;
+    served++;
+
+    // What the client sent after this request (it should not, before the response) is the next one
+    have -= requestLen;
+    memmove(buffer, buffer + requestLen, have);
+  }
+
+  free(buffer);
+  free(response);
+  free(out);
+  free(message);
+  shutdown(connection->fd, SHUT_RDWR);
+  connection->done = 1;
+}
+
+
+// Waits for a whole request: headers, then Content-Length bytes of body. "buffer" holds "have" bytes already
+uint32_t AlgoMockAlgod::readRequest(const int fd, char* buffer, uint32_t* have, uint32_t* headerLen, uint32_t* bodyLen)
+{
+  *headerLen = 0;
+  *bodyLen = 0;
+
+  for (;;)
+  {
+    if (*headerLen == 0)
+    {
+      buffer[*have] = '\0';
+      char* end = strstr(buffer, "\r\n\r\n");  // Request line and headers are text
+      if (end != NULL)
+      {
+        char value[16] = "";
+
+        *headerLen = (uint32_t)(end - buffer) + 4;
+        end[2] = '\0';
+        if (findHeader(buffer, "Content-Length:", value, sizeof(value)))
+          *bodyLen = (uint32_t)strtoul(value, NULL, 10);
+        end[2] = '\r';
+        if (*bodyLen > MOCKALGOD_MAX_REQUEST_BYTES - *headerLen)
+          return 0;  // Too long: connection closed
+      }
+    }
+    if ((*headerLen > 0) && (*have >= *headerLen + *bodyLen))
+      return *headerLen + *bodyLen;
+    if (*have >= MOCKALGOD_MAX_REQUEST_BYTES)
+      return 0;
+
+    struct pollfd readable = { fd, POLLIN, 0 };
+    if (m_stopping)
+      return 0;
+    if (poll(&readable, 1, WAIT_SLICE_MS) <= 0)
+      continue;
+    ssize_t received = recv(fd, buffer + *have, MOCKALGOD_MAX_REQUEST_BYTES - *have, 0);
+    if (received <= 0)
+      return 0;  // Client closed the connection, or it failed
+    *have += (uint32_t)received;
+  }
+}
+
+
+uint8_t AlgoMockAlgod::routeOf(const char* method, const char* path)
+{
+  if (strcmp(method, "GET") == 0)
+  {
+    if (strcmp(path, "/v2/transactions/params") == 0)
+      return MOCKALGOD_ROUTE_PARAMS;
+    if (strncmp(path, "/v2/transactions/pending/", 25) == 0)
+      return MOCKALGOD_ROUTE_PENDING;
+    if ((strcmp(path, "/v2/status") == 0) || (strncmp(path, "/v2/status/wait-for-block-after/", 32) == 0))
+      return MOCKALGOD_ROUTE_STATUS;
+  }
+  if ((strcmp(method, "POST") == 0) && (strcmp(path, "/v2/transactions") == 0))
+    return MOCKALGOD_ROUTE_SUBMIT;
+
+  return MOCKALGOD_ROUTES;
+}
+
+
+int AlgoMockAlgod::handle(const uint8_t route, const char* method, const char* path, const uint8_t* body, const uint32_t bodyLen,
+                          uint8_t* message, char* response, const uint32_t responseSize)
+{
+  switch (route)
+  {
+    case MOCKALGOD_ROUTE_PARAMS:
+      snprintf(response, responseSize, "{\"consensus-version\":\"" CONSENSUS_VERSION "\",\"fee\":0,\"genesis-hash\":\"%s\","
+               "\"genesis-id\":\"%s\",\"last-round\":%llu,\"min-fee\":%llu}", m_config.genesisHash, m_config.genesisID,
+               (unsigned long long)currentRound(), (unsigned long long)m_config.minFee);
+      return 200;
+
+    case MOCKALGOD_ROUTE_SUBMIT:
+      return postTransactions(body, bodyLen, message, response, responseSize);
+
+    case MOCKALGOD_ROUTE_PENDING:
+    {
+      char txID[MOCKALGOD_TXID_CHARS + 1];
+      uint32_t len = strcspn(path + 25, "?");  // "?format=json" ignored
+
+      if (len != MOCKALGOD_TXID_CHARS)
+        return jsonMessage(response, responseSize, 400, "bad transaction ID");
+      memcpy(txID, path + 25, len);
+      txID[len] = '\0';
+      return getPending(txID, response, responseSize);
+    }
+
+    case MOCKALGOD_ROUTE_STATUS:
+      if (strncmp(path, "/v2/status/wait-for-block-after/", 32) == 0)
+        return waitForBlockAfter(strtoull(path + 32, NULL, 10), response, responseSize);
+      return getStatus(response, responseSize);
+
+    default:
+      if ((strcmp(method, "GET") != 0) && (strcmp(method, "POST") != 0))
+        return jsonMessage(response, responseSize, 405, "method not allowed");
+      return jsonMessage(response, responseSize, 404, "not found");
+  }
+}
+
+
+// As algod: a post is one signed transaction, or the signed members of one group; accepted or refused as a whole
+int AlgoMockAlgod::postTransactions(const uint8_t* body, const uint32_t bodyLen, uint8_t* message, char* response, const uint32_t responseSize)
+{
+  mockSignedTx txs[MOCKALGOD_MAX_GROUP_TXNS];
+  uint8_t count = 0;
+  uint32_t position = 0;
+  const char* error = NULL;
+  char text[160];
+
+  while ((position < bodyLen) && (error == NULL))
+  {
+    if (count == MOCKALGOD_MAX_GROUP_TXNS)
+      error = "transaction group too large";
+    else
+    {
+      error = decodeSignedTx(body + position, bodyLen - position, &txs[count]);
+      position += txs[count].signedTxLen;
+      count++;
+    }
+  }
+  if ((error == NULL) && (count == 0))
+    error = "empty request";
+
+  const uint64_t round = currentRound();
+  for (uint8_t i = 0; (i < count) && (error == NULL); i++)
+  {
+    const mockSignedTx* tx = &txs[i];
+
+    if (memcmp(tx->gh, m_genesisHash, HASH_BYTES) != 0)
+      error = "genesis hash mismatch";
+    else if ((tx->gen != NULL) && ((tx->genLen != strlen(m_config.genesisID)) || (memcmp(tx->gen, m_config.genesisID, tx->genLen) != 0)))
+      error = "genesis ID mismatch";
+    else if (tx->lv < tx->fv)
+      error = "transaction invalid range";
+    else if (tx->lv - tx->fv > MOCKALGOD_MAX_TX_LIFE)
+      error = "transaction window size excessive";
+    else if ((round + 1 < tx->fv) || (round + 1 > tx->lv))
+    {
+      snprintf(text, sizeof(text), "TransactionPool.Remember: txn dead: round %llu outside of %llu--%llu",
+               (unsigned long long)(round + 1), (unsigned long long)tx->fv, (unsigned long long)tx->lv);
+      error = text;
+    }
+    else if (tx->fee < m_config.minFee)
+    {
+      snprintf(text, sizeof(text), "transaction had fee %llu, which is less than the minimum %llu",
+               (unsigned long long)tx->fee, (unsigned long long)m_config.minFee);
+      error = text;
+    }
+    else if (tx->noteLen > MOCKALGOD_MAX_NOTE_BYTES)
+      error = "note too big";
+    else if ((count > 1) && (tx->grp == NULL))
+      error = "transactionGroup: incomplete group";
+    else if (!verifyTransaction(tx->txn, tx->txnLen, tx->sig, tx->snd, message))
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_stats.badSignatures++;
+      error = "At least one signature didn't pass verification";
+    }
+  }
+
+  // Group ID: every member carries the one of the whole group
+  if ((error == NULL) && ((count > 1) || (txs[0].grp != NULL)))
+  {
+    uint8_t group[HASH_BYTES];
+
+    if (!groupID(txs, count, group))
+      error = "cannot compute group ID";
+    for (uint8_t i = 0; (i < count) && (error == NULL); i++)
+    {
+      if (memcmp(txs[i].grp, group, HASH_BYTES) != 0)
+        error = "transactionGroup: incomplete group";
+    }
+  }
+
+  if (error != NULL)
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_stats.refused++;
+    return jsonMessage(response, responseSize, 400, error);
+  }
+
+  // Into the pool, unless posted already
+  AlgoMockTransactionCallback callback = NULL;
+  void* context = NULL;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+      if (findTransaction(txs[i].txIDText) != NULL)
+      {
+        m_stats.duplicates++;
+        snprintf(text, sizeof(text), "transaction already in ledger: %s", txs[i].txIDText);
+        return jsonMessage(response, responseSize, 400, text);
+      }
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+      Transaction* tx = &m_txns[m_nTxns % MOCKALGOD_MAX_TXNS];
+
+      strcpy(tx->txID, txs[i].txIDText);
+      tx->confirmedRound = round + 1;
+      tx->fee = txs[i].fee;
+      tx->fv = txs[i].fv;
+      tx->lv = txs[i].lv;
+      m_nTxns++;
+    }
+    m_stats.accepted += count;
+    if (count > 1)
+      m_stats.groups++;
+    callback = m_callback;
+    context = m_callbackContext;
+  }
+  if (callback != NULL)
+  {
+    for (uint8_t i = 0; i < count; i++)
+      callback(txs[i].txIDText, txs[i].signedTx, txs[i].signedTxLen, txs[i].note, txs[i].noteLen, context);
+  }
+
+  snprintf(response, responseSize, "{\"txId\":\"%s\"}", txs[0].txIDText);
+
+  return 200;
+}
+
+
+// Pending transaction: "confirmed-round" once its block is there. The transaction itself follows, nested
+int AlgoMockAlgod::getPending(const char* txID, char* response, const uint32_t responseSize)
+{
+  std::lock_guard<std::mutex> guard(m_lock);
+  Transaction* tx = findTransaction(txID);
+  char confirmed[48] = "";
+
+  if (tx == NULL)
+    return jsonMessage(response, responseSize, 404, "txn does not exist");
+  if (currentRound() >= tx->confirmedRound)
+    snprintf(confirmed, sizeof(confirmed), "\"confirmed-round\":%llu,", (unsigned long long)tx->confirmedRound);
+  snprintf(response, responseSize, "{%s\"pool-error\":\"\",\"txn\":{\"txn\":{\"fee\":%llu,\"fv\":%llu,\"lv\":%llu,"
+           "\"type\":\"pay\"}}}", confirmed, (unsigned long long)tx->fee, (unsigned long long)tx->fv, (unsigned long long)tx->lv);
+
+  return 200;
+}
+
+
+// Answers once round "afterRound" + 1 is there, or after MOCKALGOD_WAIT_BLOCK_MAX_MS
+int AlgoMockAlgod::waitForBlockAfter(const uint64_t afterRound, char* response, const uint32_t responseSize)
+{
+  const uint64_t deadline = nowMs() + MOCKALGOD_WAIT_BLOCK_MAX_MS;
+
+  while ((currentRound() <= afterRound) && (nowMs() < deadline) && !m_stopping)
+  {
+    const uint64_t roundAt = roundStartMs(afterRound + 1);
+    const uint64_t now = nowMs();
+    sleepMs((roundAt > now) ? (uint32_t)(roundAt - now) : 1);
+  }
+
+  return getStatus(response, responseSize);
+}
+
+
+int AlgoMockAlgod::getStatus(char* response, const uint32_t responseSize)
+{
+  const uint64_t round = currentRound();
+  const uint64_t sinceRound = nowMs() - roundStartMs(round);
+
+  snprintf(response, responseSize, "{\"catchup-time\":0,\"last-catchpoint\":\"\",\"last-round\":%llu,\"last-version\":\""
+           CONSENSUS_VERSION "\",\"next-version\":\"" CONSENSUS_VERSION "\",\"next-version-round\":%llu,"
+           "\"next-version-supported\":true,\"stopped-at-unsupported-round\":false,\"time-since-last-round\":%llu}",
+           (unsigned long long)round, (unsigned long long)(round + 1), (unsigned long long)(sinceRound * 1000000ULL));
+
+  return 200;
+}
+
+
+uint64_t AlgoMockAlgod::currentRound()
+{
+  return m_config.firstRound + (nowMs() - m_startMs) / m_config.roundMs;
+}
+
+
+uint64_t AlgoMockAlgod::roundStartMs(const uint64_t round)
+{
+  return m_startMs + (round - m_config.firstRound) * m_config.roundMs;
+}
+
+
+// Sliced, so that stop() does not wait for a long delay
+void AlgoMockAlgod::sleepMs(uint32_t ms)
+{
+  while ((ms > 0) && !m_stopping)
+  {
+    const uint32_t slice = (ms < WAIT_SLICE_MS) ? ms : WAIT_SLICE_MS;
+    std::this_thread::sleep_for(std::chrono::milliseconds(slice));
+    ms -= slice;
+  }
+}
+
+
+AlgoMockAlgod::Transaction* AlgoMockAlgod::findTransaction(const char* txID)
+{
+  const uint32_t kept = (m_nTxns < MOCKALGOD_MAX_TXNS) ? m_nTxns : MOCKALGOD_MAX_TXNS;
+
+  for (uint32_t i = 0; i < kept; i++)
+  {
+    if (strcmp(m_txns[i].txID, txID) == 0)
+      return &m_txns[i];
+  }
+
+  return NULL;
+}
+
+
+// xorshift64*: fast, and the same sequence for the same seed
+uint64_t AlgoMockAlgod::nextRandom()
+{
+  m_random ^= m_random >> 12;
+  m_random ^= m_random << 25;
+  m_random ^= m_random >> 27;
+
+  return m_random * 0x2545F4914F6CDD1DULL;
+}
+
+
+// In [0, 1)
+double AlgoMockAlgod::uniform()
+{
+  return (double)(nextRandom() >> 11) / 9007199254740992.0;  // 2^53
+}
+
+
+uint8_t AlgoMockAlgod::draw(const uint16_t perMille)
+{
+  return (perMille > 0) && ((nextRandom() % 1000) < perMille);
+}
+
+
+uint32_t AlgoMockAlgod::latencyMs(const uint8_t route)
+{
+  const AlgoMockLatency* latency = &m_config.latency[route];
+  double extra = 0.0;
+  double ms = 0.0;
+
+  switch (latency->distribution)
+  {
+    case MOCKALGOD_LATENCY_UNIFORM:
+      extra = uniform() * latency->spreadMs;
+      break;
+    case MOCKALGOD_LATENCY_EXPONENTIAL:
+      extra = -log(1.0 - uniform()) * latency->spreadMs;
+      break;
+    case MOCKALGOD_LATENCY_LOGNORMAL:
+    { // Box-Muller: one standard normal draw
+      const double normal = sqrt(-2.0 * log(1.0 - uniform())) * cos(2.0 * M_PI * uniform());
+      extra = latency->spreadMs * exp(normal * latency->sigmaPercent / 100.0);
+      break;
+    }
+    default:
+      break;
+  }
+  ms = latency->minMs + extra;
+  if ((latency->maxMs > 0) && (ms > latency->maxMs))
+    ms = latency->maxMs;
+
+  return (uint32_t)ms;
+}
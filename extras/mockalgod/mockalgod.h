@@ -0,0 +1,251 @@
+// mockalgod.h
+// header for AlgoMockAlgod: a stand-in for algod on loopback, with latency and fault injection (POSIX host)
+// v20261018-1
+
+// Serves, on 127.0.0.1, what AlgoIoT asks algod for:
+//   GET  /v2/transactions/params
+//   POST /v2/transactions                       (one signed transaction, or a group of up to 16)
+//   GET  /v2/transactions/pending/<ID>
+//   GET  /v2/status, /v2/status/wait-for-block-after/<round>
+// Transactions received are checked as algod does, and refused with a 400 otherwise: canonical MessagePack,
+// Ed25519 signature of the sender (OpenSSL: independent of the signing code under test), genesis ID and hash,
+// validity window, fee, note size, group ID. Transaction IDs are computed, not made up; a transaction posted
+// again gets algod's "transaction already in ledger" answer
+// The chain is simulated: one round every "roundMs", a transaction accepted is in the block of the next round
+// Faults are drawn per request, from a seeded generator (reproducible runs): response delay (see AlgoMockLatency),
+// 5xx errors, responses cut short, connections dropped without an answer (see AlgoMockFaults)
+// Runs in threads of its own (one per connection), in the process of the code under test: start(), then point
+// AlgoIoT at url(). Counters (see AlgoMockAlgodStats) tell what the client really did
+// Needs OpenSSL (-lcrypto) and threads (-pthread)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __MOCKALGOD_H
+#define __MOCKALGOD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#define MOCKALGOD_MAX_CONNECTIONS 16
+#define MOCKALGOD_MAX_TXNS 4096            // Transactions remembered (oldest forgotten first)
+#define MOCKALGOD_MAX_GROUP_TXNS 16
+#define MOCKALGOD_MAX_REQUEST_BYTES 65536  // Headers and body
+#define MOCKALGOD_TXID_CHARS 52
+#define MOCKALGOD_TOKEN_CHARS 64
+#define MOCKALGOD_GENESIS_ID_CHARS 31
+#define MOCKALGOD_GENESIS_HASH_CHARS 44    // Base64
+#define MOCKALGOD_MAX_NOTE_BYTES 1024
+#define MOCKALGOD_MAX_TX_LIFE 1000         // Rounds, last valid - first valid
+#define MOCKALGOD_WAIT_BLOCK_MAX_MS 60000  // wait-for-block-after answers after one minute at most, as algod
+
+// Defaults: Testnet, a round every 2.8 s
+#define MOCKALGOD_DEFAULT_GENESIS_ID "testnet-v1.0"
+#define MOCKALGOD_DEFAULT_GENESIS_HASH "SGO1GKSzyE7IEPItTxCByw9x8FmnrCDexi9/cOUJOiI="
+#define MOCKALGOD_DEFAULT_FIRST_ROUND 35000000ULL
+#define MOCKALGOD_DEFAULT_ROUND_MS 2800
+#define MOCKALGOD_DEFAULT_MIN_FEE 1000
+
+// Routes, as bits of AlgoMockFaults::routes
+#define MOCKALGOD_ROUTE_PARAMS 0
+#define MOCKALGOD_ROUTE_SUBMIT 1
+#define MOCKALGOD_ROUTE_PENDING 2
+#define MOCKALGOD_ROUTE_STATUS 3    // Both status requests
+#define MOCKALGOD_ROUTES 4
+#define MOCKALGOD_ROUTE_BIT(route) (1 << (route))
+#define MOCKALGOD_ALL_ROUTES 0x0F
+
+// Latency distributions: "minMs" plus...
+#define MOCKALGOD_LATENCY_FIXED 0        // ...nothing
+#define MOCKALGOD_LATENCY_UNIFORM 1      // ...uniform in 0..spreadMs (jitter)
+#define MOCKALGOD_LATENCY_EXPONENTIAL 2  // ...exponential, mean spreadMs (a queue)
+#define MOCKALGOD_LATENCY_LOGNORMAL 3    // ...log-normal, median spreadMs, sigma sigmaPercent / 100 (long tail, as a WAN)
+
+// Error codes
+#define MOCKALGOD_NO_ERROR 0
+#define MOCKALGOD_ERROR_SOCKET 1
+#define MOCKALGOD_ERROR_RUNNING 2
+#define MOCKALGOD_ERROR_BAD_PARAM 3
+
+
+// Delay before each response (after the request is read), capped at "maxMs" (0 = no cap)
+typedef struct AlgoMockLatency
+{
+  uint8_t distribution;   // MOCKALGOD_LATENCY_*
+  uint32_t minMs;
+  uint32_t spreadMs;
+  uint16_t sigmaPercent;  // Log-normal only
+  uint32_t maxMs;
+} AlgoMockLatency;
+
+// Per mille of the requests of "routes" that fail, each way drawn on its own (in this order)
+// Errors and lost requests are not processed; drops and truncations are, before failing: a transaction posted may
+// then be in the pool although the client never got the answer (as when a gateway fails)
+typedef struct AlgoMockFaults
+{
+  uint16_t errorPerMille;     // "errorStatus" with an algod-like JSON message
+  uint16_t errorStatus;       // 500, 502, 503...
+  uint16_t lostPerMille;      // Connection closed as the request is read: never processed
+  uint16_t dropPerMille;      // Connection closed without an answer, request processed
+  uint16_t truncatePerMille;  // Headers announce the whole body; part of it is sent, then the connection closed
+  uint8_t routes;             // MOCKALGOD_ROUTE_BIT()s
+} AlgoMockFaults;
+
+typedef struct AlgoMockAlgodConfig
+{
+  char genesisID[MOCKALGOD_GENESIS_ID_CHARS + 1];
+  char genesisHash[MOCKALGOD_GENESIS_HASH_CHARS + 1];
+  uint64_t firstRound;              // Round at start()
+  uint32_t roundMs;                 // Block time
+  uint64_t minFee;
+  char apiToken[MOCKALGOD_TOKEN_CHARS + 1];  // X-Algo-API-Token required; "" = none
+  uint16_t keepAliveRequests;       // Connection closed after this many responses ("Connection: close"); 0 = never
+  uint8_t chunked;                  // Responses sent chunked (Transfer-Encoding), instead of with Content-Length
+  uint64_t seed;                    // Fault and latency generator
+  AlgoMockLatency latency[MOCKALGOD_ROUTES];  // Wait-for-block delay is on top of the wait for the round
+  AlgoMockFaults faults;
+} AlgoMockAlgodConfig;
+
+typedef struct AlgoMockAlgodStats
+{
+  uint32_t connections;
+  uint32_t requests[MOCKALGOD_ROUTES];
+  uint32_t otherRequests;       // Unknown path or method (404/405), bad token (401)
+  uint32_t accepted;            // Transactions in the pool (groups: each member)
+  uint32_t groups;              // Posts of more than one transaction, accepted
+  uint32_t duplicates;          // Posted again: "transaction already in ledger"
+  uint32_t refused;             // Posts refused: not decodable, bad signature, outside validity, etc.
+  uint32_t badSignatures;       // ...of which, signature not verified
+  uint32_t errors;              // Faults injected
+  uint32_t lost;
+  uint32_t drops;
+  uint32_t truncations;
+} AlgoMockAlgodStats;
+
+// Called, from a server thread, for each transaction accepted: its ID, the signed transaction (MessagePack), and
+// its note (NULL if none). Pointers valid during the call only
+typedef void (*AlgoMockTransactionCallback)(const char* txID, const uint8_t* signedTx, const uint32_t signedTxLen,
+                                            const uint8_t* note, const uint32_t noteLen, void* context);
+
+
+class AlgoMockAlgod
+{
+  private:
+  struct Connection
+  {
+    int fd;
+    std::thread thread;
+    std::atomic<uint8_t> done;
+  };
+
+  struct Transaction
+  {
+    char txID[MOCKALGOD_TXID_CHARS + 1];
+    uint64_t confirmedRound;  // Block of the round after the one it was accepted in
+    uint64_t fee;
+    uint64_t fv;
+    uint64_t lv;
+  };
+
+  AlgoMockAlgodConfig m_config;
+  int m_listenFd = -1;
+  uint16_t m_port = 0;
+  std::atomic<uint8_t> m_stopping;
+  std::thread m_acceptThread;
+  Connection m_connections[MOCKALGOD_MAX_CONNECTIONS];
+  uint64_t m_startMs = 0;
+  uint8_t m_genesisHash[48];        // Decoded from the configuration (32 bytes)
+
+  std::mutex m_lock;                // What follows: shared by the connection threads
+  AlgoMockAlgodStats m_stats;
+  uint64_t m_random = 0;
+  Transaction m_txns[MOCKALGOD_MAX_TXNS];
+  uint32_t m_nTxns = 0;             // Ever accepted: the latest MOCKALGOD_MAX_TXNS are kept (ring)
+  AlgoMockTransactionCallback m_callback = NULL;
+  void* m_callbackContext = NULL;
+
+  void acceptLoop();
+
+  // Requests of one connection, until it is over
+  void serve(Connection* connection);
+
+  // Waits for a whole request, "have" bytes of which are in "buffer" already (MOCKALGOD_MAX_REQUEST_BYTES + 1)
+  // Returns its length, headers ("headerLen") and body ("bodyLen"); 0 if the connection is over
+  uint32_t readRequest(const int fd, char* buffer, uint32_t* have, uint32_t* headerLen, uint32_t* bodyLen);
+
+  // MOCKALGOD_ROUTE_* of a request, MOCKALGOD_ROUTES if none
+  uint8_t routeOf(const char* method, const char* path);
+
+  // Processes a request. "message": scratch for signature checks (MOCKALGOD_MAX_REQUEST_BYTES + 2)
+  // Returns HTTP status code; JSON body in "response"
+  int handle(const uint8_t route, const char* method, const char* path, const uint8_t* body, const uint32_t bodyLen,
+             uint8_t* message, char* response, const uint32_t responseSize);
+  int postTransactions(const uint8_t* body, const uint32_t bodyLen, uint8_t* message, char* response, const uint32_t responseSize);
+  int getPending(const char* txID, char* response, const uint32_t responseSize);
+  int waitForBlockAfter(const uint64_t afterRound, char* response, const uint32_t responseSize);
+  int getStatus(char* response, const uint32_t responseSize);
+
+  // Current round of the simulated chain, and the time (see nowMs() in mockalgod.cpp) "round" started
+  uint64_t currentRound();
+  uint64_t roundStartMs(const uint64_t round);
+
+  // Sleeps, unless stop() is called meanwhile
+  void sleepMs(uint32_t ms);
+
+  // Remembered transaction, or NULL. Lock held by the caller
+  Transaction* findTransaction(const char* txID);
+
+  // Random draws, under the lock
+  uint64_t nextRandom();
+  double uniform();
+  uint8_t draw(const uint16_t perMille);
+  uint32_t latencyMs(const uint8_t route);
+
+  public:
+  AlgoMockAlgod();
+  ~AlgoMockAlgod();
+
+  // Defaults: MOCKALGOD_DEFAULT_*, no latency, no faults, keep-alive, Content-Length, seed 1
+  static void defaultConfig(AlgoMockAlgodConfig* config);
+
+  // Listens on 127.0.0.1:"port" (0 = any free port, see port()). The chain starts at config->firstRound now
+  // Return: error code (0 = OK)
+  int start(const AlgoMockAlgodConfig* config, const uint16_t port = 0);
+
+  // Closes all connections and waits for the threads. Remembered transactions are kept until the next start()
+  void stop();
+
+  uint16_t port();
+
+  // "http://127.0.0.1:<port>", for AlgoIoT::addAlgodEndpoint()
+  void url(char* out, const uint32_t outSize);
+
+  // Faults and latency changed while running (e.g. an outage, then recovery)
+  void setFaults(const AlgoMockFaults* faults);
+  void setLatency(const uint8_t route, const AlgoMockLatency* latency);
+
+  void setTransactionCallback(AlgoMockTransactionCallback callback, void* context = NULL);
+
+  // Whether the transaction was accepted (and not forgotten yet); "confirmedRound" (may be NULL) receives its block
+  uint8_t hasTransaction(const char* txID, uint64_t* confirmedRound = NULL);
+
+  void getStats(AlgoMockAlgodStats* stats);
+  void resetStats();
+};
+
+#endif
@@ -0,0 +1,452 @@
+// mockalgod_bench.cpp
+// AlgoIoT submission pipeline against AlgoMockAlgod on loopback: latency, retries and faults, without a network
+// v20261018-2
+
+// Each scenario starts a mock algod (see mockalgod.h) in this process, points a fresh AlgoIoT at it and submits
+// through the usual code paths (getAlgorandTxParams(), submitTransaction(), the asynchronous submission,
+// confirmation tracking, endpoint failover, outbox), over the POSIX socket transport. It then checks what the
+// client reported against what the mock received: every transaction ID returned is one the mock verified and
+// accepted, no signature failed, nothing was refused, and no reading was written twice (signed again after a post
+// that got no answer). Exit status 1 if any check fails: usable as a regression test
+// Build e.g.
+//   g++ -O2 -pthread -I../.. -I<ArduinoJson>/src -I<base64_arduino>/src mockalgod_bench.cpp mockalgod.cpp <sources> -lcrypto -o bench_mockalgod
+// <sources>: the library's, in ../.. (as for extras/linux/algoiot_send.cpp)
+// Run: ./bench_mockalgod [seed] 2>/dev/null   (library debug output goes to stderr)
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include "AlgoIoT.h"
+#include "mockalgod.h"
+
+#define BENCH_APP_NAME "AlgoIoT-Bench"
+#define BENCH_MNEMONIC "shadow market lounge gauge battle small crash funny supreme regular obtain require control oil lend reward galaxy tuition elder owner flavor rural expose absent sniff"  // Demo account of the sketches
+#define BENCH_SUBMISSIONS 40
+#define BENCH_TRACKED 8              // Confirmation scenario: fewer than ALGOIOT_MAX_TRACKED_TXNS
+#define BENCH_ROUND_MS 400           // Faster chain than the real one: confirmation rounds do not dominate the run
+#define BENCH_CONFIRM_ROUNDS 20      // Confirmation scenario: rounds waited at most
+#define BENCH_OUTBOX_PATH "/tmp/mockalgod_bench.outbox"
+#define BENCH_OUTBOX_SLOTS 64
+#define BENCH_OUTBOX_FLUSHES 200     // flushOutbox() calls at most, faults going on
+#define BENCH_EXPIRY_ROUND_MS 5      // BENCH_OUTBOX_EXPIRED: queued transactions expire in seconds
+
+// Scenario modes
+#define BENCH_SYNC 0        // submitTransactionToAlgorand()
+#define BENCH_ASYNC 1       // beginSubmit(), then poll() every millisecond, as loop() would
+#define BENCH_CONFIRM 2     // BENCH_SYNC, then waitForConfirmations() until all are in a block
+#define BENCH_FAILOVER 3    // BENCH_SYNC, first endpoint failing every request (503)
+#define BENCH_OUTBOX 4      // Three submissions out of four to an algod that cannot be reached (queued in the
+                            // outbox), no retries; then flushOutbox() until empty, faults going on
+#define BENCH_TAMPER 5      // One submission, then its signed transaction posted again, as is and altered
+#define BENCH_OUTBOX_EXPIRED 6  // BENCH_OUTBOX, but flushed once the queued transactions expired: signed again as groups
+
+
+typedef std::chrono::steady_clock benchClock;
+
+typedef struct benchScenario
+{
+  const char* name;
+  uint8_t mode;
+  uint8_t chunked;
+  uint16_t keepAliveRequests;
+  AlgoMockLatency latency;      // All routes
+  AlgoMockFaults faults;
+} benchScenario;
+
+static const benchScenario scenarios[] =
+{ // name          mode            chunk  keep   latency: dist, min, spread, sigma, max    faults: err, status, lost, drop, trunc, routes
+  { "clean",       BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_FIXED, 2, 0, 0, 0 },        { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "jitter",      BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 5, 30, 0, 0 },     { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "wan-tail",    BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_LOGNORMAL, 10, 40, 80, 1500 }, { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "queueing",    BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_EXPONENTIAL, 2, 25, 0, 800 }, { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "5xx-20%",     BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 200, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "lost-15%",    BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 0, 503, 150, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "drop-15%",    BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 0, 503, 0, 150, 0, MOCKALGOD_ALL_ROUTES } },
+  { "truncated",   BENCH_SYNC,     0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 0, 503, 0, 0, 150, MOCKALGOD_ALL_ROUTES } },
+  { "chunked",     BENCH_SYNC,     1,     3,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 0, 503, 0, 0, 100, MOCKALGOD_ALL_ROUTES } },
+  { "async",       BENCH_ASYNC,    0,     0,     { MOCKALGOD_LATENCY_LOGNORMAL, 5, 20, 60, 500 }, { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "async-faults", BENCH_ASYNC,   1,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 20, 0, 0 },     { 100, 502, 50, 50, 50, MOCKALGOD_ALL_ROUTES } },
+  { "confirm",     BENCH_CONFIRM,  0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 100, 503, 0, 0, 0, MOCKALGOD_ROUTE_BIT(MOCKALGOD_ROUTE_PENDING) } },
+  { "failover",    BENCH_FAILOVER, 0,     0,     { MOCKALGOD_LATENCY_UNIFORM, 2, 10, 0, 0 },     { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+  { "outbox",      BENCH_OUTBOX,   0,     0,     { MOCKALGOD_LATENCY_FIXED, 2, 0, 0, 0 },        { 0, 503, 0, 0, 0, MOCKALGOD_ROUTE_BIT(MOCKALGOD_ROUTE_SUBMIT) } },
+  { "outbox-drop", BENCH_OUTBOX,   0,     0,     { MOCKALGOD_LATENCY_FIXED, 2, 0, 0, 0 },        { 0, 503, 0, 250, 250, MOCKALGOD_ROUTE_BIT(MOCKALGOD_ROUTE_SUBMIT) } },
+  { "outbox-exp",  BENCH_OUTBOX_EXPIRED, 0, 0,   { MOCKALGOD_LATENCY_FIXED, 2, 0, 0, 0 },        { 0, 503, 0, 250, 250, MOCKALGOD_ROUTE_BIT(MOCKALGOD_ROUTE_SUBMIT) } },
+  { "tamper",      BENCH_TAMPER,   0,     0,     { MOCKALGOD_LATENCY_FIXED, 0, 0, 0, 0 },        { 0, 503, 0, 0, 0, MOCKALGOD_ALL_ROUTES } },
+};
+
+// What a scenario saw
+typedef struct benchResult
+{
+  uint32_t submissions;
+  uint32_t ok;
+  uint32_t failed;
+  uint32_t queued;
+  uint32_t confirmed;
+  uint32_t checksFailed;
+  uint32_t latencyMs[BENCH_SUBMISSIONS];
+  char txIDs[BENCH_SUBMISSIONS][ALGORAND_TRANSACTIONID_SIZE + 1];
+} benchResult;
+
+// First signed transaction accepted by the mock, for BENCH_TAMPER, and notes of all of them: each reading has a
+// note of its own, so there are as many notes as transactions accepted unless a reading was written twice
+static std::mutex capturedLock;
+static uint8_t captured[ALGORAND_SIGNED_TX_MAX_BYTES];
+static uint32_t capturedLen = 0;
+static std::set<std::string> acceptedNotes;
+
+
+static uint32_t elapsedMs(const benchClock::time_point start)
+{
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(benchClock::now() - start).count();
+}
+
+
+static void check(benchResult* result, const uint8_t condition, const char* what)
+{
+  if (!condition)
+  {
+    printf("    CHECK FAILED: %s\n", what);
+    result->checksFailed++;
+  }
+}
+
+
+static void onAccepted(const char* txID, const uint8_t* signedTx, const uint32_t signedTxLen, const uint8_t* note,
+                       const uint32_t noteLen, void* context)
+{
+  std::lock_guard<std::mutex> guard(capturedLock);
+
+  (void)txID; (void)context;
+  if ((capturedLen == 0) && (signedTxLen <= sizeof(captured)))
+  {
+    memcpy(captured, signedTx, signedTxLen);
+    capturedLen = signedTxLen;
+  }
+  if (note != NULL)
+    acceptedNotes.insert(std::string((const char*)note, noteLen));
+}
+
+
+typedef struct benchConfirmContext
+{
+  AlgoMockAlgod* mock;
+  benchResult* result;
+} benchConfirmContext;
+
+
+// The round AlgoIoT reports has to be the block the mock put the transaction in
+static void onConfirmation(const AlgoIoTConfirmation* confirmation, void* context)
+{
+  benchConfirmContext* confirm = (benchConfirmContext*)context;
+  uint64_t round = 0;
+
+  confirm->result->confirmed++;
+  check(confirm->result, confirmation->state == ALGOIOT_CONFIRMATION_CONFIRMED, "transaction confirmed");
+  check(confirm->result, confirm->mock->hasTransaction(confirmation->txID, &round) && (round == confirmation->confirmedRound),
+        "confirmed round is the mock's");
+}
+
+
+// One submission, blocking or asynchronous. Returns AlgoIoT error code
+static int submitOne(AlgoIoT& algoIoT, const uint8_t mode, const uint32_t n)
+{
+  int result = 0;
+
+  algoIoT.dataAddUInt32Field("n", n);
+  algoIoT.dataAddFloatField("T", 20.0f + (float)(n % 10) / 4.0f);
+  if (mode != BENCH_ASYNC)
+    return algoIoT.submitTransactionToAlgorand();
+
+  result = algoIoT.beginSubmit();
+  if (result != ALGOIOT_NO_ERROR)
+    return result;
+  while ((result = algoIoT.poll()) == ALGOIOT_IN_PROGRESS)
+  {
+    usleep(1000);
+  }
+
+  return result;
+}
+
+
+// Loopback URL where connections are refused: a port bound, not listened on. "fd" closed by the caller
+static int unreachableURL(char* url, const uint32_t urlSize)
+{
+  struct sockaddr_in address;
+  socklen_t addressLen = sizeof(address);
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if ((fd < 0) || (bind(fd, (struct sockaddr*)&address, sizeof(address)) != 0) ||
+      (getsockname(fd, (struct sockaddr*)&address, &addressLen) != 0))
+  {
+    if (fd >= 0)
+      close(fd);
+    return -1;
+  }
+  snprintf(url, urlSize, "http://127.0.0.1:%u", (unsigned)ntohs(address.sin_port));
+
+  return fd;
+}
+
+
+// Posts raw bytes to the mock through a transport of our own. Returns HTTP status code
+static int postRaw(const char* url, const uint8_t* body, const uint32_t bodyLen)
+{
+  AlgoIoTSocketTransport transport;
+  mpkSegment segment = { body, bodyLen };
+  AlgoIoTSegmentStream stream(&segment, 1);
+  char postURL[64];
+  int status = 0;
+
+  snprintf(postURL, sizeof(postURL), "%s" POST_TRANSACTION, url);
+  status = transport.request(postURL, "POST", NULL, NULL, ALGORAND_POST_MIME_TYPE, &stream, bodyLen, 5000);
+  transport.close();
+
+  return status;
+}
+
+
+static void runScenario(const benchScenario* scenario, const uint64_t seed, benchResult* result)
+{
+  AlgoMockAlgod mock;
+  AlgoMockAlgod failing;
+  AlgoMockAlgodConfig config;
+  AlgoIoTFileOutboxStorage storage(BENCH_OUTBOX_PATH, BENCH_OUTBOX_SLOTS);
+  AlgoIoTOutbox outbox(storage);
+  benchConfirmContext confirm = { &mock, result };
+  char url[48];
+  char offlineURL[48];
+  int offlineFd = -1;
+  uint8_t outboxMode = (scenario->mode == BENCH_OUTBOX) || (scenario->mode == BENCH_OUTBOX_EXPIRED);
+  uint32_t count = BENCH_SUBMISSIONS;
+
+  memset(result, 0, sizeof(*result));
+  AlgoMockAlgod::defaultConfig(&config);
+  config.roundMs = (scenario->mode == BENCH_OUTBOX_EXPIRED) ? BENCH_EXPIRY_ROUND_MS : BENCH_ROUND_MS;
+  config.chunked = scenario->chunked;
+  config.keepAliveRequests = scenario->keepAliveRequests;
+  config.seed = seed;
+  for (uint8_t route = 0; route < MOCKALGOD_ROUTES; route++)
+    config.latency[route] = scenario->latency;
+  config.faults = scenario->faults;
+  if (mock.start(&config) != MOCKALGOD_NO_ERROR)
+  {
+    check(result, 0, "mock algod started");
+    return;
+  }
+  mock.url(url, sizeof(url));
+  capturedLen = 0;
+  acceptedNotes.clear();
+  mock.setTransactionCallback(onAccepted);
+
+  AlgoIoT algoIoT(BENCH_APP_NAME, BENCH_MNEMONIC);
+  if (algoIoT.begin() != ALGOIOT_NO_ERROR)
+  {
+    check(result, 0, "AlgoIoT started");
+    return;
+  }
+  algoIoT.clearAlgodEndpoints();
+  algoIoT.setRetryPolicy(6, 5, 100, 5000);
+
+  if (scenario->mode == BENCH_FAILOVER)
+  { // Same chain, every request answered 503: listed first, it is tried first
+    AlgoMockAlgodConfig failingConfig = config;
+    char failingURL[48];
+
+    failingConfig.faults.errorPerMille = 1000;
+    failing.start(&failingConfig);
+    failing.url(failingURL, sizeof(failingURL));
+    algoIoT.addAlgodEndpoint(failingURL);
+  }
+  algoIoT.addAlgodEndpoint(url);
+
+  if (scenario->mode == BENCH_CONFIRM)
+  {
+    count = BENCH_TRACKED;
+    algoIoT.setConfirmationTracking(onConfirmation, &confirm);
+  }
+  if (outboxMode)
+  { // No retries while submitting: each fault injected is what the submission ends with
+    unlink(BENCH_OUTBOX_PATH);
+    check(result, algoIoT.setOutbox(&outbox) == ALGOIOT_NO_ERROR, "outbox opened");
+    offlineFd = unreachableURL(offlineURL, sizeof(offlineURL));
+    check(result, offlineFd >= 0, "unreachable endpoint set up");
+    algoIoT.setRetryPolicy(1, 5, 100, 5000);
+    count = BENCH_OUTBOX_SLOTS / 2;
+  }
+  if (scenario->mode == BENCH_OUTBOX_EXPIRED)
+    algoIoT.setTxParamsMaxAge(0);  // Rounds of a few milliseconds: an extrapolated round would be far behind
+  if (scenario->mode == BENCH_TAMPER)
+    count = 1;
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    const uint8_t offline = outboxMode && ((i % 4) != 0);  // The first one online: parameters known
+    benchClock::time_point start;
+    int iErr = 0;
+
+    if (outboxMode)
+    {
+      algoIoT.clearAlgodEndpoints();
+      algoIoT.addAlgodEndpoint(offline ? offlineURL : url);
+    }
+    start = benchClock::now();
+    iErr = submitOne(algoIoT, scenario->mode, i);
+
+    result->latencyMs[result->submissions++] = elapsedMs(start);
+    if (iErr == ALGOIOT_NO_ERROR)
+    {
+      strcpy(result->txIDs[result->ok++], algoIoT.getTransactionID());
+      check(result, mock.hasTransaction(algoIoT.getTransactionID()), "transaction ID returned is one the mock accepted");
+    }
+    else if (iErr == ALGOIOT_TRANSACTION_QUEUED)
+      result->queued++;
+    else
+      result->failed++;
+    if (offline)
+      check(result, iErr == ALGOIOT_TRANSACTION_QUEUED, "transaction queued while algod could not be reached");
+  }
+
+  switch (scenario->mode)
+  {
+    case BENCH_CONFIRM:
+    { // As a sketch would: a round failing (pending requests have faults) is followed by the next one
+      uint32_t rounds = 0;
+      while ((algoIoT.confirmationsPending() > 0) && (rounds++ < BENCH_CONFIRM_ROUNDS))
+        algoIoT.waitForConfirmations();
+      check(result, result->confirmed == result->ok, "every transaction confirmed");
+      break;
+    }
+
+    case BENCH_OUTBOX:
+    case BENCH_OUTBOX_EXPIRED:
+    { // Algod back: the backlog goes, answers still dropped or cut short. Still valid transactions are posted as
+      // queued; expired ones are signed again, as groups, each verified member by member
+      AlgoMockAlgodStats stats;
+      uint32_t flushes = 0;
+
+      algoIoT.clearAlgodEndpoints();
+      algoIoT.addAlgodEndpoint(url);
+      algoIoT.setRetryPolicy(6, 5, 100, 5000);
+      if (scenario->mode == BENCH_OUTBOX_EXPIRED)
+        usleep((MOCKALGOD_MAX_TX_LIFE + 100) * BENCH_EXPIRY_ROUND_MS * 1000);
+      while ((algoIoT.outboxPending() > 0) && (flushes++ < BENCH_OUTBOX_FLUSHES))
+        algoIoT.flushOutbox();
+      check(result, algoIoT.outboxPending() == 0, "outbox empty");
+      mock.getStats(&stats);
+      if (scenario->mode == BENCH_OUTBOX_EXPIRED)
+        check(result, stats.groups > 0, "expired backlog posted as groups");
+      else
+        check(result, stats.groups == 0, "valid backlog posted as queued");
+      // Posts answered or not, processed: every reading is in, once
+      check(result, stats.accepted == count, "every reading accepted");
+      unlink(BENCH_OUTBOX_PATH);
+      close(offlineFd);
+      break;
+    }
+
+    case BENCH_TAMPER:
+      if (capturedLen > 0)
+      {
+        AlgoMockAlgodStats stats;
+        check(result, postRaw(url, captured, capturedLen) == 400, "same signed transaction refused");
+        captured[capturedLen - 1] ^= 0x01;  // Last byte of the transaction (its type): signature no longer matches
+        check(result, postRaw(url, captured, capturedLen) == 400, "altered signed transaction refused");
+        mock.getStats(&stats);
+        check(result, (stats.duplicates == 1) && (stats.badSignatures == 1), "duplicate and bad signature detected");
+      }
+      else
+        check(result, 0, "transaction accepted by the mock");
+      break;
+
+    default:
+      break;
+  }
+
+  // Every ID returned is distinct; the mock verified every transaction it got
+  AlgoMockAlgodStats stats;
+  mock.getStats(&stats);
+  for (uint32_t i = 1; i < result->ok; i++)
+  {
+    for (uint32_t j = 0; j < i; j++)
+      check(result, strcmp(result->txIDs[i], result->txIDs[j]) != 0, "transaction IDs distinct");
+  }
+  check(result, stats.accepted >= result->ok, "mock accepted at least what the client reported");
+  {
+    std::lock_guard<std::mutex> guard(capturedLock);
+    check(result, stats.accepted == acceptedNotes.size(), "no reading accepted twice");
+  }
+  if (scenario->mode != BENCH_TAMPER)
+    check(result, (stats.refused == 0) && (stats.badSignatures == 0), "nothing refused by the mock");
+  if (!outboxMode && (scenario->faults.errorPerMille == 0) && (scenario->faults.lostPerMille == 0) &&
+      (scenario->faults.dropPerMille == 0) && (scenario->faults.truncatePerMille == 0))
+    check(result, result->ok == count, "all submissions succeeded");
+  if (scenario->mode == BENCH_FAILOVER)
+    check(result, result->ok == count, "all submissions succeeded through the second endpoint");
+
+  // One line per scenario
+  uint32_t sorted[BENCH_SUBMISSIONS];
+  AlgoIoTRetryStats retries;
+  const uint32_t n = result->submissions;
+
+  memcpy(sorted, result->latencyMs, n * sizeof(uint32_t));
+  std::sort(sorted, sorted + n);
+  algoIoT.getRetryStats(&retries);
+  printf("%-13s %3u/%-3u %4u %6u %7u %7u %7u %8u %5u %8u %4u %6u  %s\n", scenario->name, result->ok, n, result->failed,
+         result->queued, sorted[n / 2], sorted[(n * 99) / 100], sorted[n - 1], retries.attempts, stats.connections,
+         stats.accepted, stats.duplicates, stats.errors + stats.lost + stats.drops + stats.truncations,
+         (result->checksFailed == 0) ? "ok" : "FAILED");
+
+  algoIoT.closeConnection();
+  mock.stop();
+  failing.stop();
+}
+
+
+int main(int argc, char** argv)
+{
+  const uint64_t seed = (argc > 1) ? strtoull(argv[1], NULL, 10) : 1;
+  uint32_t failed = 0;
+  static benchResult result;  // Large: not on the stack
+
+  printf("Mock algod on loopback, seed %llu, %u submissions per scenario, a round every %u ms\n\n",
+         (unsigned long long)seed, BENCH_SUBMISSIONS, BENCH_ROUND_MS);
+  printf("%-13s %7s %4s %6s %7s %7s %7s %8s %5s %8s %4s %6s  %s\n", "scenario", "ok/n", "fail", "queued", "p50 ms",
+         "p99 ms", "max ms", "attempts", "conns", "accepted", "dup", "faults", "checks");
+  for (uint32_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+  {
+    runScenario(&scenarios[i], seed + i, &result);
+    failed += (result.checksFailed > 0);
+  }
+  printf("\n%u scenario(s) failed\n", failed);
+
+  return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+# gen_bip39_packed.py
+# Generates bip39enwords.h: the BIP39 English wordlist in packed form, for bip39en.cpp
+# v20261018-1
+#
+# BIP39 words are 3 to 8 lowercase letters, and their first 4 letters are unique in the list, so:
+# - each word gets a 3-byte entry: 4-letter prefix at 5 bits per letter ('a' = 1, 0 = no letter),
+#   then the number of letters after the 4th (0..4) in the low 3 bits. Big-endian, so entries
+#   compare (and sort) as the words do
+# - letters after the 4th are concatenated, without separators, in one suffix blob
+# - the blob offset of the first suffix of every block of BIP39_EN_BLOCK_WORDS words is indexed
+# About 9 KB instead of about 21 KB (2048 pointers on a 32-bit MCU, plus the strings)
+#
+# Usage: python3 gen_bip39_packed.py english.txt > ../../bip39enwords.h
+# english.txt: the standard BIP39 English list, one word per line (bitcoin/bips repository)
+#
+# By Fernando Carello for GT50
+# Copyright 2023 GT50 S.r.l.
+# Licensed under the Apache License, Version 2.0
+
+import sys
+
+WORDS_NUM = 2048
+BLOCK_WORDS = 32
+PREFIX_LEN = 4
+
+
+def entry(word):
+    key = 0
+    for i in range(PREFIX_LEN):
+        key = (key << 5) | ((ord(word[i]) - ord('a') + 1) if i < len(word) else 0)
+    suffix_len = max(len(word) - PREFIX_LEN, 0)
+    return (key << 3) | suffix_len
+
+
+def main():
+    with open(sys.argv[1]) as f:
+        words = [w.strip() for w in f if w.strip()]
+    assert len(words) == WORDS_NUM
+    assert all(3 <= len(w) <= 8 and w.isalpha() and w.islower() for w in words)
+    assert words == sorted(words)
+    assert len(set(w[:PREFIX_LEN] for w in words)) == WORDS_NUM
+
+    entries = [entry(w) for w in words]
+    assert entries == sorted(entries)
+    suffixes = [w[PREFIX_LEN:] for w in words]
+    offsets = []
+    pos = 0
+    for i, s in enumerate(suffixes):
+        if i % BLOCK_WORDS == 0:
+            offsets.append(pos)
+        pos += len(s)
+    blob = "".join(suffixes)
+
+    out = []
+    out.append("// bip39enwords.h")
+    out.append("// BIP39 English wordlist, packed (see bip39en.h)")
+    out.append("// v20261018-1")
+    out.append("")
+    out.append("// GENERATED by extras/tools/gen_bip39_packed.py: do not edit")
+    out.append("// Entry: 4-letter prefix, 5 bits per letter ('a' = 1, 0 = no letter), then suffix length (3 bits)")
+    out.append("// Suffixes (letters after the 4th) are concatenated in BIP39_EN_SUFFIXES, indexed per block of words")
+    out.append("// Included only by bip39en.cpp. Const data: on ESP32 it stays in flash (memory-mapped)")
+    out.append("")
+    out.append("#ifndef _BIP39ENWORDS_H")
+    out.append("#define _BIP39ENWORDS_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("#define BIP39_EN_ENTRY_BYTES 3")
+    out.append("#define BIP39_EN_BLOCK_WORDS %d" % BLOCK_WORDS)
+    out.append("#define BIP39_EN_SUFFIXES_LEN %d" % len(blob))
+    out.append("")
+    out.append("static const uint8_t BIP39_EN_ENTRIES[BIP39_EN_WORDS_NUM * BIP39_EN_ENTRY_BYTES] =")
+    out.append("{")
+    for i in range(0, WORDS_NUM, 8):
+        row = []
+        for e in entries[i:i + 8]:
+            row.append("0x%02x, 0x%02x, 0x%02x" % ((e >> 16) & 0xFF, (e >> 8) & 0xFF, e & 0xFF))
+        comma = "," if i + 8 < WORDS_NUM else ""
+        out.append("  " + ",  ".join(row) + comma + "  // " + " ".join(words[i:i + 8]))
+    out.append("};")
+    out.append("")
+    out.append("static const uint16_t BIP39_EN_SUFFIX_OFFSETS[BIP39_EN_WORDS_NUM / BIP39_EN_BLOCK_WORDS] =")
+    out.append("{")
+    for i in range(0, len(offsets), 8):
+        comma = "," if i + 8 < len(offsets) else ""
+        out.append("  " + ", ".join("%4d" % o for o in offsets[i:i + 8]) + comma)
+    out.append("};")
+    out.append("")
+    out.append("static const char BIP39_EN_SUFFIXES[BIP39_EN_SUFFIXES_LEN + 1] =")
+    for i in range(0, len(blob), 96):
+        end = ";" if i + 96 >= len(blob) else ""
+        out.append("  \"" + blob[i:i + 96] + "\"" + end)
+    out.append("")
+    out.append("#endif // _BIP39ENWORDS_H")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# gen_ed25519_basetable.py
+# Generates algoed25519basetable.h: precomputed multiples of the Ed25519 base point
+# v20261018-1
+#
+# Row i (0..63) holds j * 16^i * B for j = 1..8, in affine "Niels" form:
+# (y + x, y - x, 2 * d * x * y), each as 32 little-endian bytes (96 bytes per entry)
+# Bytes, not field limbs, so the same table serves every AlgoEd25519 backend
+# Each row is compiled only if selected by ALGOED25519_BASE_SPACING (see algoed25519.h)
+#
+# Usage: python3 gen_ed25519_basetable.py > ../../algoed25519basetable.h
+#
+# By Fernando Carello for GT50
+# Copyright 2023 GT50 S.r.l.
+# Licensed under the Apache License, Version 2.0
+
+P = 2**255 - 19
+D = (-121665 * pow(121666, P - 2, P)) % P
+BY = (4 * pow(5, P - 2, P)) % P
+
+
+def recover_x(y):
+    xx = (y * y - 1) * pow(D * y * y + 1, P - 2, P) % P
+    x = pow(xx, (P + 3) // 8, P)
+    if (x * x - xx) % P != 0:
+        x = x * pow(2, (P - 1) // 4, P) % P
+    if x % 2 != 0:
+        x = P - x
+    return x
+
+
+def add(p1, p2):
+    (x1, y1), (x2, y2) = p1, p2
+    t = D * x1 * x2 * y1 * y2 % P
+    x3 = (x1 * y2 + x2 * y1) * pow(1 + t, P - 2, P) % P
+    y3 = (y1 * y2 + x1 * x2) * pow(1 - t, P - 2, P) % P
+    return (x3, y3)
+
+
+def le_bytes(v):
+    return [(v >> (8 * k)) & 0xFF for k in range(32)]
+
+
+def main():
+    base = (recover_x(BY), BY)
+    out = []
+    out.append("// algoed25519basetable.h")
+    out.append("// Precomputed multiples of the Ed25519 base point, for AlgoEd25519 fixed-base multiplication")
+    out.append("// v20261018-1")
+    out.append("")
+    out.append("// GENERATED by extras/tools/gen_ed25519_basetable.py: do not edit")
+    out.append("// Row i holds j * 16^i * B, j = 1..8, as (y + x, y - x, 2dxy): 3 x 32 little-endian bytes")
+    out.append("// Only rows multiple of ALGOED25519_BASE_SPACING are compiled in (see algoed25519.h)")
+    out.append("// Included only by algoed25519.cpp. Const data: on ESP32 it stays in flash (memory-mapped)")
+    out.append("")
+    out.append("#ifndef __ALGOED25519BASETABLE_H")
+    out.append("#define __ALGOED25519BASETABLE_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("static const uint8_t ED25519_BASE_TABLE[64 / ALGOED25519_BASE_SPACING][8][96] =")
+    out.append("{")
+    row_base = base
+    for i in range(64):
+        out.append("#if (%d %% ALGOED25519_BASE_SPACING) == 0" % i)
+        out.append("  { // 16^%d B" % i)
+        multiple = row_base
+        for j in range(1, 9):
+            x, y = multiple
+            entry = le_bytes((y + x) % P) + le_bytes((y - x) % P) + le_bytes(2 * D * x * y % P)
+            for k in range(0, 96, 16):
+                line = ", ".join("0x%02x" % b for b in entry[k:k + 16])
+                if k == 0:
+                    out.append("    {" + line + ",")
+                elif k == 80:
+                    out.append("     " + line + "}" + ("," if j < 8 else ""))
+                else:
+                    out.append("     " + line + ",")
+            multiple = add(multiple, row_base)
+        out.append("  },")
+        out.append("#endif")
+        # Next row: 16 * current row base
+        for _ in range(4):
+            row_base = add(row_base, row_base)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
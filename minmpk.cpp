@@ -2,9 +2,8 @@
 // minimal messagepack builder straight from the specs at https://github.com/msgpack/msgpack/blob/master/spec.md
 // W.I.P. use with care
 // In C because we need it on C-only platforms too
-// v20231012-1
+// v20261018-4
 
-// TODO test floats and signed ints
 
 // By Fernando Carello for GT50
 /* Copyright 2023 GT50 S.r.l.
@@ -24,6 +23,42 @@
 #include <string.h>
 #include <stdint.h>
 #include "minmpk.h"
+#include "minmpkencode.h"  // Item headers, shared with MpkWriter (minmpkwriter.h)
+
+
+// Where the next item goes. No checks: callers made room with msgpackReserve()
+static uint8_t* currentDest(msgPack mPack)
+{
+  return &(mPack->msgBuffer[mPack->currentPosition]);
+}
+
+static void advance(msgPack mPack, const uint32_t len)
+{
+  mPack->currentPosition += len;
+  mPack->currentMsgLen += len;
+}
+
+static void putBytes(msgPack mPack, const uint8_t* data, const uint32_t len)
+{
+  memcpy((void*)currentDest(mPack), (const void*)data, len);
+  advance(mPack, len);
+}
+
+
+int msgpackInitStruct(mpkStruct* mPack, uint8_t* buffer, const uint32_t bufferLen)
+{
+  if (mPack == NULL)
+    return MPK_ERR_NULL_MPACK;
+  if ((buffer == NULL) || (bufferLen == 0))
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+
+  mPack->msgBuffer = buffer;
+  mPack->bufferLen = bufferLen;
+  mPack->currentMsgLen = 0;
+  mPack->currentPosition = 0;
+
+  return MPK_NO_ERROR;
+}
 
 
 msgPack msgpackInit(uint8_t* buffer, const uint32_t bufferLen)
@@ -39,10 +74,7 @@ msgPack msgpackInit(uint8_t* buffer, const uint32_t bufferLen)
     return NULL;
   }
 
-  mPack->msgBuffer = buffer;
-  mPack->bufferLen = bufferLen;
-  mPack->currentMsgLen = 0;
-  mPack->currentPosition = 0;
+  msgpackInitStruct(mPack, buffer, bufferLen);
 
   return mPack;
 }
@@ -88,10 +120,8 @@ uint32_t msgPackGetLen(msgPack mPack)
 }
 
 
-int msgpackAddShortMap(msgPack mPack, const uint8_t nFields)
+int msgpackReserve(msgPack mPack, const uint32_t bytes)
 {
-  uint8_t specifier = 0;
-
   if (mPack == NULL)
   {
     return MPK_ERR_NULL_MPACK;
@@ -100,40 +130,286 @@ int msgpackAddShortMap(msgPack mPack, const uint8_t nFields)
   {
     return MPK_ERR_NULL_INTERNAL_BUFFER;
   }
-  if (nFields > 15)
-  {
-    return MPK_ERR_BAD_PARAM;
-  }
-  if (mPack->currentPosition + 1 >= mPack->bufferLen)
+  if ((mPack->currentPosition > mPack->bufferLen) || (bytes > mPack->bufferLen - mPack->currentPosition))
   {
     return MPK_ERR_BUFFER_TOO_SHORT;
   }
 
+  return MPK_NO_ERROR;
+}
+
+
+// Unchecked encoders: headers from minmpkencode.h, the same ones MpkWriter writes
+
+void msgpackPutShortMap(msgPack mPack, const uint8_t nFields)
+{
   // Our map will contain max 15 fields, so we can use a FixMap (https://github.com/msgpack/msgpack/blob/master/spec.md#map-format-family)
   // FixMap specifier = 1000xxxx where xxxx are 4 bits keeping the number of fields
   // So for example with N = 9 -> xxxx = 1001 -> specifier = 10001001 = 0x89 = 137
-  specifier = 128 + nFields; // 10000000 + 4-bit totalFields
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  mPack->currentMsgLen++;
-  
-  return 0;
+  advance(mPack, mpkHeaderShortMap(currentDest(mPack), nFields));
 }
 
 
-int msgpackAddShortString(msgPack mPack, const char* string)
+void msgpackPutShortString(msgPack mPack, const char* string, const uint8_t len)
 {
-  uint32_t len = 0;
-  uint8_t pos = 0;
-  uint8_t specifier = 0;
+  // We can use a Fixstr (https://github.com/msgpack/msgpack/blob/master/spec.md#str-format-family)
+  // Fixstr specifier = 101XXXXX (5 bits of string len)
+  // Ex. N = 3 -> 10100011 = 0xA3
+  advance(mPack, mpkHeaderShortString(currentDest(mPack), len));
+  putBytes(mPack, (const uint8_t*)string, len);
+}
 
-  if (mPack == NULL)
+
+void msgpackPutUInt7(msgPack mPack, const uint8_t value)
+{
+  // We use "positive fixint" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderUInt7(currentDest(mPack), value));
+}
+
+
+void msgpackPutInt8(msgPack mPack, const int8_t value)
+{
+  // We use "int 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderInt8(currentDest(mPack), value));
+}
+
+
+void msgpackPutUInt8(msgPack mPack, const uint8_t value)
+{
+  // We use "uint 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderUInt8(currentDest(mPack), value));
+}
+
+
+void msgpackPutInt16(msgPack mPack, const int16_t value)
+{
+  // We use "int 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderInt16(currentDest(mPack), value));
+}
+
+
+void msgpackPutUInt16(msgPack mPack, const uint16_t value)
+{
+  // We use "uint 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderUInt16(currentDest(mPack), value));
+}
+
+
+void msgpackPutInt32(msgPack mPack, const int32_t value)
+{
+  // We use "int 32" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderInt32(currentDest(mPack), value));
+}
+
+
+void msgpackPutUInt32(msgPack mPack, const uint32_t value)
+{
+  // We use "uint 32" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
+  advance(mPack, mpkHeaderUInt32(currentDest(mPack), value));
+}
+
+
+void msgpackPutFloat(msgPack mPack, const float value)
+{
+  // We use "float" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#float-format-family
+  advance(mPack, mpkHeaderFloat(currentDest(mPack), value));
+}
+
+
+void msgpackPutShortByteArray(msgPack mPack, const uint8_t* inputArray, const uint8_t inputBytes)
+{
+  // It fits into "bin 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#bin-format-family
+  // Format specifier = 0xC4
+  // First byte (len) = inputBytes
+  advance(mPack, mpkHeaderShortByteArray(currentDest(mPack), inputBytes));
+  putBytes(mPack, inputArray, inputBytes);
+}
+
+
+void msgpackPutByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes)
+{
+  // It fits into "bin 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#bin-format-family
+  // Format specifier = 0xC5
+  // Then 2 bytes = inputBytes, as big endian
+  advance(mPack, mpkHeaderByteArray(currentDest(mPack), inputBytes));
+  putBytes(mPack, inputArray, inputBytes);
+}
+
+
+void msgpackPutUInt64(msgPack mPack, const uint64_t value)
+{
+  // "uint 64"
+  advance(mPack, mpkHeaderUInt64(currentDest(mPack), value));
+}
+
+
+void msgpackPutInt64(msgPack mPack, const int64_t value)
+{
+  // "int 64"
+  advance(mPack, mpkHeaderInt64(currentDest(mPack), value));
+}
+
+
+void msgpackPutDouble(msgPack mPack, const double value)
+{
+  // "float 64"
+  advance(mPack, mpkHeaderDouble(currentDest(mPack), value));
+}
+
+
+void msgpackPutNil(msgPack mPack)
+{
+  advance(mPack, mpkHeaderNil(currentDest(mPack)));
+}
+
+
+void msgpackPutBool(msgPack mPack, const uint8_t value)
+{
+  // 0xC2 = false, 0xC3 = true
+  advance(mPack, mpkHeaderBool(currentDest(mPack), value));
+}
+
+
+// Generic encoders: smallest encoding for value/length
+
+uint32_t msgpackSizeUInt(const uint64_t value)
+{
+  if (value < 128)
+    return 1;
+  if (value <= 0xFF)
+    return 2;
+  if (value <= 0xFFFF)
+    return 3;
+  if (value <= 0xFFFFFFFFULL)
+    return 5;
+
+  return 9;
+}
+
+
+uint32_t msgpackSizeInt(const int64_t value)
+{
+  if (value >= 0)
+    return msgpackSizeUInt((uint64_t)value);
+  if (value >= -32)
+    return 1;
+  if (value >= INT8_MIN)
+    return 2;
+  if (value >= INT16_MIN)
+    return 3;
+  if (value >= INT32_MIN)
+    return 5;
+
+  return 9;
+}
+
+
+uint32_t msgpackSizeString(const uint32_t len)
+{
+  if (len < 32)
+    return 1 + len;
+  if (len <= 0xFF)
+    return 2 + len;
+  if (len <= 0xFFFF)
+    return 3 + len;
+
+  return 5 + len;
+}
+
+
+uint32_t msgpackSizeBinary(const uint32_t len)
+{
+  if (len <= 0xFF)
+    return 2 + len;
+  if (len <= 0xFFFF)
+    return 3 + len;
+
+  return 5 + len;
+}
+
+
+uint32_t msgpackSizeMap(const uint32_t nFields)
+{
+  if (nFields < 16)
+    return 1;
+  if (nFields <= 0xFFFF)
+    return 3;
+
+  return 5;
+}
+
+
+uint32_t msgpackSizeArray(const uint32_t nElements)
+{
+  return msgpackSizeMap(nElements); // Same thresholds
+}
+
+
+void msgpackPutUInt(msgPack mPack, const uint64_t value)
+{
+  advance(mPack, mpkHeaderUInt(currentDest(mPack), value));
+}
+
+
+void msgpackPutInt(msgPack mPack, const int64_t value)
+{
+  advance(mPack, mpkHeaderInt(currentDest(mPack), value));
+}
+
+
+void msgpackPutString(msgPack mPack, const char* string, const uint32_t len)
+{
+  advance(mPack, mpkHeaderString(currentDest(mPack), len));
+  putBytes(mPack, (const uint8_t*)string, len);
+}
+
+
+void msgpackPutBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes)
+{
+  advance(mPack, mpkHeaderBinary(currentDest(mPack), inputBytes));
+  putBytes(mPack, inputArray, inputBytes);
+}
+
+
+void msgpackPutMap(msgPack mPack, const uint32_t nFields)
+{
+  advance(mPack, mpkHeaderMap(currentDest(mPack), nFields));
+}
+
+
+void msgpackPutArray(msgPack mPack, const uint32_t nElements)
+{
+  advance(mPack, mpkHeaderArray(currentDest(mPack), nElements));
+}
+
+
+// Checked encoders: validate, reserve, then store
+
+int msgpackAddShortMap(msgPack mPack, const uint8_t nFields)
+{
+  int iErr = 0;
+
+  if (nFields > 15)
   {
-    return MPK_ERR_NULL_MPACK;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->msgBuffer == NULL)
+  iErr = msgpackReserve(mPack, 1);
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
+
+  msgpackPutShortMap(mPack, nFields);
+  
+  return 0;
+}
+
+
+int msgpackAddShortString(msgPack mPack, const char* string)
+{
+  uint32_t len = 0;
+  int iErr = 0;
+
   if (string == NULL)
   {
     return MPK_ERR_BAD_PARAM;
@@ -145,21 +421,13 @@ int msgpackAddShortString(msgPack mPack, const char* string)
   {
     return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->currentPosition + len + 1 >= mPack->bufferLen)
+  iErr = msgpackReserve(mPack, len + 1);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We can use a Fixstr (https://github.com/msgpack/msgpack/blob/master/spec.md#str-format-family)
-  // Fixstr specifier = 101XXXXX (5 bits of string len)
-  // Ex. N = 3 -> 10100011 = 0xA3
-  specifier = 160 + (uint8_t) len; // 10100000 + 5-bit len
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  for (pos = 0; pos < len; pos++)
-  {
-    mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)string[pos];
-  }
-  mPack->currentMsgLen += len + 1;
+  msgpackPutShortString(mPack, string, (uint8_t)len);
   
   return 0;
 }
@@ -167,23 +435,13 @@ int msgpackAddShortString(msgPack mPack, const char* string)
 
 int msgpackAddUInt7(msgPack mPack, const uint8_t value)
 {
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 1);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
+    return iErr;
   }
-  if (mPack->msgBuffer == NULL)
-  {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
-  }
-  if (mPack->currentPosition + 1 >= mPack->bufferLen)
-  {
-    return MPK_ERR_BUFFER_TOO_SHORT;
-  }
-
-  // We use "positive fixint" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = value & 0x7F;
 
-  mPack->currentMsgLen += 1;
+  msgpackPutUInt7(mPack, value);
 
   return 0;
 }
@@ -191,26 +449,13 @@ int msgpackAddUInt7(msgPack mPack, const uint8_t value)
 
 int msgpackAddInt8(msgPack mPack, const int8_t value)
 {
-  const uint8_t specifier = 0xD0;
-
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 2);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
-  }
-  if (mPack->msgBuffer == NULL)
-  {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
-  }
-  if (mPack->currentPosition + 2 >= mPack->bufferLen)
-  {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "int 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  mPack->msgBuffer[mPack->currentPosition++] = value;
-
-  mPack->currentMsgLen += 2;
+  msgpackPutInt8(mPack, value);
 
   return 0;
 }
@@ -218,277 +463,299 @@ int msgpackAddInt8(msgPack mPack, const int8_t value)
 
 int msgpackAddUInt8(msgPack mPack, const uint8_t value)
 {
-  const uint8_t specifier = 0xCC;
-
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 2);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
+    return iErr;
   }
-  if (mPack->msgBuffer == NULL)
+
+  msgpackPutUInt8(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddInt16(msgPack mPack, const int16_t value)
+{
+  int iErr = msgpackReserve(mPack, 3);
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
-  if (mPack->currentPosition + 2 >= mPack->bufferLen)
+
+  msgpackPutInt16(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddUInt16(msgPack mPack, const uint16_t value)
+{
+  int iErr = msgpackReserve(mPack, 3);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "uint 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  mPack->msgBuffer[mPack->currentPosition++] = value;
-
-  mPack->currentMsgLen += 2;
+  msgpackPutUInt16(mPack, value);
 
   return 0;
 }
 
 
-int msgpackAddInt16(msgPack mPack, const int16_t value)
+int msgpackAddInt32(msgPack mPack, const int32_t value)
 {
-  const uint8_t specifier = 0xD1;
-
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 5);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
+    return iErr;
   }
-  if (mPack->msgBuffer == NULL)
+
+  msgpackPutInt32(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddUInt32(msgPack mPack, const uint32_t value)
+{
+  int iErr = msgpackReserve(mPack, 5);
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
-  if (mPack->currentPosition + 3 >= mPack->bufferLen)
+
+  msgpackPutUInt32(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddFloat(msgPack mPack, const float value)
+{
+  int iErr = msgpackReserve(mPack, 5);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "int 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&value, 2);
-  mPack->currentPosition += 2;
-  #else
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0xFF00) >> 8);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x00FF));
-  #endif
-
-  mPack->currentMsgLen += 3;
+  msgpackPutFloat(mPack, value);
 
   return 0;
 }
 
 
-int msgpackAddUInt16(msgPack mPack, const uint16_t value)
+// Max 255 bytes
+int msgpackAddShortByteArray(msgPack mPack, const uint8_t* inputArray, const uint8_t inputBytes)
 {
-  const uint8_t specifier = 0xCD;
+  int iErr = 0;
 
-  if (mPack == NULL)
-  {
-    return MPK_ERR_NULL_MPACK;
-  }
-  if (mPack->msgBuffer == NULL)
+  if (inputArray == NULL)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->currentPosition + 3 >= mPack->bufferLen)
+  iErr = msgpackReserve(mPack, inputBytes + 2);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "uint 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&value, 2);
-  mPack->currentPosition += 2;
-  #else
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0xFF00) >> 8);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x00FF));
-  #endif
-
-  mPack->currentMsgLen += 3;
+  msgpackPutShortByteArray(mPack, inputArray, inputBytes);
 
   return 0;
 }
 
 
-int msgpackAddInt32(msgPack mPack, const int32_t value)
-{
-  const uint8_t specifier = 0xD2;
+// Max 65535 bytes
+int msgpackAddByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes)
+{ 
+  int iErr = 0;
 
-  if (mPack == NULL)
+  if (inputArray == NULL)
   {
-    return MPK_ERR_NULL_MPACK;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->msgBuffer == NULL)
+  iErr = msgpackReserve(mPack, inputBytes + 3);
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
-  if (mPack->currentPosition + 5 >= mPack->bufferLen)
+
+  msgpackPutByteArray(mPack, inputArray, inputBytes);
+
+  return 0;
+}
+
+
+int msgpackAddUInt64(msgPack mPack, const uint64_t value)
+{
+  int iErr = msgpackReserve(mPack, 9);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "int 32" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&value, 4);
-  mPack->currentPosition += 4;
-  #else
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0xFF000000) >> 24);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x00FF0000) >> 16);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x0000FF00) >> 8);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x000000FF));
-  #endif
-
-  mPack->currentMsgLen += 5;
+  msgpackPutUInt64(mPack, value);
 
   return 0;
 }
 
 
-int msgpackAddUInt32(msgPack mPack, const uint32_t value)
+int msgpackAddInt64(msgPack mPack, const int64_t value)
 {
-  const uint8_t specifier = 0xCE;
-
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 9);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
+    return iErr;
   }
-  if (mPack->msgBuffer == NULL)
+
+  msgpackPutInt64(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddDouble(msgPack mPack, const double value)
+{
+  int iErr = msgpackReserve(mPack, 9);
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
-  if (mPack->currentPosition + 5 >= mPack->bufferLen)
+
+  msgpackPutDouble(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddNil(msgPack mPack)
+{
+  int iErr = msgpackReserve(mPack, 1);
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "uint 32" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#int-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&value, 4);
-  mPack->currentPosition += 4;
-  #else
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0xFF000000) >> 24);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x00FF0000) >> 16);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x0000FF00) >> 8);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((value & 0x000000FF));
-  #endif
-
-  mPack->currentMsgLen += 5;
+  msgpackPutNil(mPack);
 
   return 0;
 }
 
 
-int msgpackAddFloat(msgPack mPack, const float value)
+int msgpackAddBool(msgPack mPack, const uint8_t value)
 {
-  const uint8_t specifier = 0xCA;
-  uint8_t floatBytes[4];
-
-  if (mPack == NULL)
+  int iErr = msgpackReserve(mPack, 1);
+  if (iErr)
   {
-    return MPK_ERR_NULL_MPACK;
+    return iErr;
   }
-  if (mPack->msgBuffer == NULL)
+
+  msgpackPutBool(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddUInt(msgPack mPack, const uint64_t value)
+{
+  int iErr = msgpackReserve(mPack, msgpackSizeUInt(value));
+  if (iErr)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return iErr;
   }
-  if (mPack->currentPosition + 5 >= mPack->bufferLen)
+
+  msgpackPutUInt(mPack, value);
+
+  return 0;
+}
+
+
+int msgpackAddInt(msgPack mPack, const int64_t value)
+{
+  int iErr = msgpackReserve(mPack, msgpackSizeInt(value));
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // We use "float" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#float-format-family
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&value, 4);
-  mPack->currentPosition += 4;
-  #else
-  memcpy((void*) &(floatBytes[0]), (void*)&value, 4);
-  mPack->msgBuffer[mPack->currentPosition++] = floatBytes[3];
-  mPack->msgBuffer[mPack->currentPosition++] = floatBytes[2];
-  mPack->msgBuffer[mPack->currentPosition++] = floatBytes[1];
-  mPack->msgBuffer[mPack->currentPosition++] = floatBytes[0];
-  #endif
-
-  mPack->currentMsgLen += 5;
+  msgpackPutInt(mPack, value);
 
   return 0;
 }
 
 
-// Max 255 bytes
-int msgpackAddShortByteArray(msgPack mPack, const uint8_t* inputArray, const uint8_t inputBytes)
+int msgpackAddString(msgPack mPack, const char* string, const uint32_t len)
 {
-  const uint8_t specifier = 0xC4;
+  int iErr = 0;
 
-  if (mPack == NULL)
-  {
-    return MPK_ERR_NULL_MPACK;
-  }
-  if (mPack->msgBuffer == NULL)
+  if (string == NULL)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (inputArray == NULL)
+  if (len > 0xFFFFFFFFUL - 5)
   {
     return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->currentPosition + inputBytes + 2 >= mPack->bufferLen)
+  iErr = msgpackReserve(mPack, msgpackSizeString(len));
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // It fits into "bin 8" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#bin-format-family
-  // Format specifier = 0xC4
-  // First byte (len) = inputBytes
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  mPack->msgBuffer[mPack->currentPosition++] = inputBytes;
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)inputArray, inputBytes);
-  mPack->currentPosition += inputBytes;
-
-  mPack->currentMsgLen += inputBytes + 2;
+  msgpackPutString(mPack, string, len);
 
   return 0;
 }
 
 
-// Max 65535 bytes
-int msgpackAddByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes)
-{ 
-  const uint8_t specifier = 0xC5;
+int msgpackAddBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes)
+{
+  int iErr = 0;
 
-  if (mPack == NULL)
+  if (inputArray == NULL)
   {
-    return MPK_ERR_NULL_MPACK;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (mPack->msgBuffer == NULL)
+  if (inputBytes > 0xFFFFFFFFUL - 5)
   {
-    return MPK_ERR_NULL_INTERNAL_BUFFER;
+    return MPK_ERR_BAD_PARAM;
   }
-  if (inputArray == NULL)
+  iErr = msgpackReserve(mPack, msgpackSizeBinary(inputBytes));
+  if (iErr)
   {
-    return MPK_ERR_BAD_PARAM;
+    return iErr;
   }
-  if (mPack->currentPosition + inputBytes + 3 >= mPack->bufferLen)
+
+  msgpackPutBinary(mPack, inputArray, inputBytes);
+
+  return 0;
+}
+
+
+int msgpackAddMap(msgPack mPack, const uint32_t nFields)
+{
+  int iErr = msgpackReserve(mPack, msgpackSizeMap(nFields));
+  if (iErr)
   {
-    return MPK_ERR_BUFFER_TOO_SHORT;
+    return iErr;
   }
 
-  // It fits into "bin 16" encoding https://github.com/msgpack/msgpack/blob/master/spec.md#bin-format-family
-  // Format specifier = 0xC5
-  // Then 2 bytes = inputBytes, as big endian
-  mPack->msgBuffer[mPack->currentPosition++] = specifier;
-  #ifdef IS_BIG_ENDIAN
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)&inputBytes, 2);
-  mPack->currentPosition += 2;
-  #else
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((inputBytes & 0xFF00) >> 8);
-  mPack->msgBuffer[mPack->currentPosition++] = (uint8_t)((inputBytes & 0x00FF));
-  #endif
-  memcpy((void*) &(mPack->msgBuffer[mPack->currentPosition]), (void*)inputArray, inputBytes);
-  mPack->currentPosition += inputBytes;
-
-  mPack->currentMsgLen += inputBytes + 3;
+  msgpackPutMap(mPack, nFields);
+
+  return 0;
+}
+
+
+int msgpackAddArray(msgPack mPack, const uint32_t nElements)
+{
+  int iErr = msgpackReserve(mPack, msgpackSizeArray(nElements));
+  if (iErr)
+  {
+    return iErr;
+  }
+
+  msgpackPutArray(mPack, nElements);
 
   return 0;
 }
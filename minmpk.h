@@ -1,9 +1,8 @@
 // minmpk.h
 // header for minimal messagepack builder
-// v20231012-2
+// v20261018-5
 
-// TODO:
-//  Add more types
+// Covers all MessagePack types except ext and timestamps
 
 // By Fernando Carello for GT50
 // Released under MIT license:
@@ -27,6 +26,11 @@ THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR I
 #define MPK_ERR_NULL_INTERNAL_BUFFER 2
 #define MPK_ERR_BAD_PARAM 3
 #define MPK_ERR_BUFFER_TOO_SHORT 4
+#define MPK_ERR_UNEXPECTED_END 5    // Reader: item truncated at end of buffer
+#define MPK_ERR_TYPE_MISMATCH 6     // Reader: item is not of the requested type
+#define MPK_ERR_UNSUPPORTED_TYPE 7  // Reader: ext types and the reserved 0xC1 byte
+#define MPK_ERR_NOT_CANONICAL 8     // Validator: well-formed but not canonically encoded
+#define MPK_ERR_TOO_DEEP 9          // Reader/validator: nesting deeper than MPK_MAX_DEPTH
 
 // #define IS_BIG_ENDIAN  // Don't know of big-endian MCUs; in case, uncomment
 
@@ -40,14 +44,29 @@ typedef struct mpkStruct
 } mpkStruct;
 
 typedef mpkStruct* msgPack;
+
+// One piece of a message assembled by reference (scatter-gather): data is *not* owned
+typedef struct mpkSegment
+{
+  const uint8_t* data;
+  uint32_t len;
+} mpkSegment;
 // End typedefs
 
 // MessagePack functions. Not all types are implemented yet
+// Item headers are written by minmpkencode.h, shared with the C++ MpkWriter (minmpkwriter.h)
 
 // To be called only once for each MessagePack
+// Struct is owned by caller (stack, global or class member), so no heap is involved
 // Buffer (static or dynamic) has to be passed by caller, and then freed by caller if appropriate. Needs to be "large enough"
+// Returns error code (0 = OK)
+int msgpackInitStruct(mpkStruct* mPack, uint8_t* buffer, const uint32_t bufferLen);
+
+// As msgpackInit(), but the struct is allocated on the heap: has to be released with msgPackFree()
+// Prefer msgpackInitStruct()
 msgPack msgpackInit(uint8_t* buffer, const uint32_t bufferLen);
 
+// Only for structs returned by msgpackInit()
 // Please note it does *not* free the buffer passed via msgpackInit()
 // Returns error code (0 = OK)
 int msgPackFree(msgPack mPack);
@@ -98,6 +117,92 @@ int msgpackAddShortByteArray(msgPack mPack, const uint8_t* inputArray, const uin
 // Returns error code (0 = OK)
 int msgpackAddByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes);
 
+// Returns error code (0 = OK)
+int msgpackAddUInt64(msgPack mPack, const uint64_t value);
+
+// Returns error code (0 = OK)
+int msgpackAddInt64(msgPack mPack, const int64_t value);
+
+// "float 64"
+// Returns error code (0 = OK)
+int msgpackAddDouble(msgPack mPack, const double value);
+
+// Returns error code (0 = OK)
+int msgpackAddNil(msgPack mPack);
+
+// Returns error code (0 = OK)
+int msgpackAddBool(msgPack mPack, const uint8_t value);
+
+
+// Generic encoders: each one always picks the smallest encoding for its value/length,
+// as required by canonical MessagePack (e.g. Algorand transactions)
+
+// positive fixint, uint 8, 16, 32 or 64
+// Returns error code (0 = OK)
+int msgpackAddUInt(msgPack mPack, const uint64_t value);
+
+// Non-negative values as msgpackAddUInt(); negative fixint, int 8, 16, 32 or 64 otherwise
+// Returns error code (0 = OK)
+int msgpackAddInt(msgPack mPack, const int64_t value);
+
+// fixstr, str 8, 16 or 32. "len" bytes of "string" are encoded (UTF-8, no trailing NULL)
+// Returns error code (0 = OK)
+int msgpackAddString(msgPack mPack, const char* string, const uint32_t len);
+
+// bin 8, 16 or 32
+// Returns error code (0 = OK)
+int msgpackAddBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes);
+
+// fixmap, map 16 or 32: "nFields" key/value pairs have to follow
+// Returns error code (0 = OK)
+int msgpackAddMap(msgPack mPack, const uint32_t nFields);
+
+// fixarray, array 16 or 32: "nElements" items have to follow
+// Returns error code (0 = OK)
+int msgpackAddArray(msgPack mPack, const uint32_t nElements);
+
+
+// Encoded sizes of the generic encoders, for msgpackReserve()
+uint32_t msgpackSizeUInt(const uint64_t value);
+uint32_t msgpackSizeInt(const int64_t value);
+uint32_t msgpackSizeString(const uint32_t len);     // Header + len
+uint32_t msgpackSizeBinary(const uint32_t len);     // Header + len
+uint32_t msgpackSizeMap(const uint32_t nFields);    // Header only
+uint32_t msgpackSizeArray(const uint32_t nElements); // Header only
+
+
+// Fast path for a run of fields whose total size is known in advance:
+// msgpackReserve() checks once that "bytes" more bytes fit, then the msgpackPut*() functions write
+// with no checks at all (no NULL pointers, no buffer room, no parameter limits) up to that many bytes
+// Returns error code (0 = OK)
+int msgpackReserve(msgPack mPack, const uint32_t bytes);
+
+// Encoded sizes: 1 byte, except where noted
+void msgpackPutShortMap(msgPack mPack, const uint8_t nFields);
+void msgpackPutShortString(msgPack mPack, const char* string, const uint8_t len); // 1 + len
+void msgpackPutUInt7(msgPack mPack, const uint8_t value);
+void msgpackPutInt8(msgPack mPack, const int8_t value);     // 2
+void msgpackPutUInt8(msgPack mPack, const uint8_t value);   // 2
+void msgpackPutInt16(msgPack mPack, const int16_t value);   // 3
+void msgpackPutUInt16(msgPack mPack, const uint16_t value); // 3
+void msgpackPutInt32(msgPack mPack, const int32_t value);   // 5
+void msgpackPutUInt32(msgPack mPack, const uint32_t value); // 5
+void msgpackPutFloat(msgPack mPack, const float value);     // 5
+void msgpackPutShortByteArray(msgPack mPack, const uint8_t* inputArray, const uint8_t inputBytes); // 2 + inputBytes
+void msgpackPutByteArray(msgPack mPack, const uint8_t* inputArray, const uint16_t inputBytes);     // 3 + inputBytes
+void msgpackPutUInt64(msgPack mPack, const uint64_t value); // 9
+void msgpackPutInt64(msgPack mPack, const int64_t value);   // 9
+void msgpackPutDouble(msgPack mPack, const double value);   // 9
+void msgpackPutNil(msgPack mPack);
+void msgpackPutBool(msgPack mPack, const uint8_t value);
+// Generic encoders: see msgpackSize*() above
+void msgpackPutUInt(msgPack mPack, const uint64_t value);
+void msgpackPutInt(msgPack mPack, const int64_t value);
+void msgpackPutString(msgPack mPack, const char* string, const uint32_t len);
+void msgpackPutBinary(msgPack mPack, const uint8_t* inputArray, const uint32_t inputBytes);
+void msgpackPutMap(msgPack mPack, const uint32_t nFields);
+void msgpackPutArray(msgPack mPack, const uint32_t nElements);
+
 
 
 #endif
@@ -0,0 +1,815 @@
+// minmpkdecode.cpp
+// minimal messagepack reader and canonical-encoding validator, straight from the specs at https://github.com/msgpack/msgpack/blob/master/spec.md
+// In C because we need it on C-only platforms too
+// v20261018-2
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "minmpkdecode.h"
+
+
+// Multi-byte values are always big endian in MessagePack
+static uint16_t readBE16(const uint8_t* p)
+{
+  return (uint16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static uint32_t readBE32(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static uint64_t readBE64(const uint8_t* p)
+{
+  return ((uint64_t)readBE32(p) << 32) | (uint64_t)readBE32(p + 4);
+}
+
+
+// Decodes the item at "position" without touching the reader
+// "itemBytes" receives the number of bytes consumed by the item (header only for maps and arrays)
+static int decodeItemAt(const mpkReader* reader, const uint32_t position, mpkItem* item, uint32_t* itemBytes)
+{
+  const uint8_t* p = NULL;
+  uint32_t avail = 0;
+  uint32_t header = 1;  // Format byte + length/value bytes
+  uint8_t format = 0;
+  uint32_t tmp32 = 0;
+  uint64_t tmp64 = 0;
+
+  if (position >= reader->bufferLen)
+  {
+    return MPK_ERR_UNEXPECTED_END;
+  }
+  p = reader->msgBuffer + position;
+  avail = reader->bufferLen - position;
+  format = p[0];
+
+  item->format = format;
+  item->len = 0;
+  item->data = NULL;
+  item->value.u = 0;
+
+  // Single-byte families first (https://github.com/msgpack/msgpack/blob/master/spec.md#formats)
+  if (format <= 0x7F)
+  { // positive fixint
+    item->type = MPK_TYPE_UINT;
+    item->value.u = format;
+  }
+  else if (format <= 0x8F)
+  { // fixmap
+    item->type = MPK_TYPE_MAP;
+    item->len = format & 0x0F;
+  }
+  else if (format <= 0x9F)
+  { // fixarray
+    item->type = MPK_TYPE_ARRAY;
+    item->len = format & 0x0F;
+  }
+  else if (format <= 0xBF)
+  { // fixstr
+    item->type = MPK_TYPE_STRING;
+    item->len = format & 0x1F;
+  }
+  else if (format >= 0xE0)
+  { // negative fixint
+    item->type = MPK_TYPE_INT;
+    item->value.i = (int8_t)format;
+  }
+  else
+  {
+    switch (format)
+    {
+      case 0xC0:
+        item->type = MPK_TYPE_NIL;
+        break;
+      case 0xC2:
+      case 0xC3:
+        item->type = MPK_TYPE_BOOL;
+        item->value.b = format & 0x01;
+        break;
+      case 0xC4:  // bin 8
+      case 0xD9:  // str 8
+        header = 2;
+        break;
+      case 0xC5:  // bin 16
+      case 0xDA:  // str 16
+      case 0xDC:  // array 16
+      case 0xDE:  // map 16
+        header = 3;
+        break;
+      case 0xC6:  // bin 32
+      case 0xDB:  // str 32
+      case 0xDD:  // array 32
+      case 0xDF:  // map 32
+        header = 5;
+        break;
+      case 0xCA:  // float 32
+        header = 5;
+        item->type = MPK_TYPE_FLOAT;
+        break;
+      case 0xCB:  // float 64
+        header = 9;
+        item->type = MPK_TYPE_DOUBLE;
+        break;
+      case 0xCC:  // uint 8
+      case 0xD0:  // int 8
+        header = 2;
+        break;
+      case 0xCD:  // uint 16
+      case 0xD1:  // int 16
+        header = 3;
+        break;
+      case 0xCE:  // uint 32
+      case 0xD2:  // int 32
+        header = 5;
+        break;
+      case 0xCF:  // uint 64
+      case 0xD3:  // int 64
+        header = 9;
+        break;
+      default:    // 0xC1 (never used) and ext family
+        return MPK_ERR_UNSUPPORTED_TYPE;
+    }
+  }
+
+  if (header > avail)
+  {
+    return MPK_ERR_UNEXPECTED_END;
+  }
+
+  // Multi-byte families: values and lengths
+  switch (format)
+  {
+    case 0xC4: case 0xC5: case 0xC6:
+      item->type = MPK_TYPE_BINARY;
+      break;
+    case 0xD9: case 0xDA: case 0xDB:
+      item->type = MPK_TYPE_STRING;
+      break;
+    case 0xDC: case 0xDD:
+      item->type = MPK_TYPE_ARRAY;
+      break;
+    case 0xDE: case 0xDF:
+      item->type = MPK_TYPE_MAP;
+      break;
+    case 0xCC: case 0xCD: case 0xCE: case 0xCF:
+      item->type = MPK_TYPE_UINT;
+      break;
+    case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+      item->type = MPK_TYPE_INT;
+      break;
+    default:
+      break;
+  }
+  switch (format)
+  {
+    case 0xC4: case 0xD9:
+      item->len = p[1];
+      break;
+    case 0xC5: case 0xDA: case 0xDC: case 0xDE:
+      item->len = readBE16(p + 1);
+      break;
+    case 0xC6: case 0xDB: case 0xDD: case 0xDF:
+      item->len = readBE32(p + 1);
+      break;
+    case 0xCA:
+      tmp32 = readBE32(p + 1);
+      memcpy((void*)&(item->value.f), (void*)&tmp32, 4);
+      break;
+    case 0xCB:
+      tmp64 = readBE64(p + 1);
+      memcpy((void*)&(item->value.d), (void*)&tmp64, 8);
+      break;
+    case 0xCC: item->value.u = p[1]; break;
+    case 0xCD: item->value.u = readBE16(p + 1); break;
+    case 0xCE: item->value.u = readBE32(p + 1); break;
+    case 0xCF: item->value.u = readBE64(p + 1); break;
+    case 0xD0: item->value.i = (int8_t)p[1]; break;
+    case 0xD1: item->value.i = (int16_t)readBE16(p + 1); break;
+    case 0xD2: item->value.i = (int32_t)readBE32(p + 1); break;
+    case 0xD3: item->value.i = (int64_t)readBE64(p + 1); break;
+    default:
+      break;
+  }
+
+  // Strings and byte arrays: payload follows the header
+  if ((item->type == MPK_TYPE_STRING) || (item->type == MPK_TYPE_BINARY))
+  {
+    if (item->len > avail - header)
+    {
+      return MPK_ERR_UNEXPECTED_END;
+    }
+    item->data = p + header;
+    header += item->len;
+  }
+
+  *itemBytes = header;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReaderInit(mpkReader* reader, const uint8_t* buffer, const uint32_t bufferLen)
+{
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (buffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+
+  reader->msgBuffer = buffer;
+  reader->bufferLen = bufferLen;
+  reader->currentPosition = 0;
+
+  return MPK_NO_ERROR;
+}
+
+
+uint32_t msgpackReaderGetPosition(const mpkReader* reader)
+{
+  return reader->currentPosition;
+}
+
+
+uint8_t msgpackReaderAtEnd(const mpkReader* reader)
+{
+  return (reader->currentPosition >= reader->bufferLen);
+}
+
+
+int msgpackPeekItem(const mpkReader* reader, mpkItem* item)
+{
+  uint32_t itemBytes = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (reader->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+  if (item == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+
+  return decodeItemAt(reader, reader->currentPosition, item, &itemBytes);
+}
+
+
+int msgpackReadItem(mpkReader* reader, mpkItem* item)
+{
+  uint32_t itemBytes = 0;
+  int iErr = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (reader->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+  if (item == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+
+  iErr = decodeItemAt(reader, reader->currentPosition, item, &itemBytes);
+  if (iErr)
+  {
+    return iErr;
+  }
+  reader->currentPosition += itemBytes;
+
+  return MPK_NO_ERROR;
+}
+
+
+// Reads next item only if it has the expected type
+static int readTyped(mpkReader* reader, const uint8_t type, mpkItem* item)
+{
+  int iErr = 0;
+
+  iErr = msgpackPeekItem(reader, item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if (item->type != type)
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+
+  return msgpackReadItem(reader, item);
+}
+
+
+int msgpackReadMap(mpkReader* reader, uint32_t* nPairs)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (nPairs == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_MAP, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *nPairs = item.len;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadArray(mpkReader* reader, uint32_t* nElements)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (nElements == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_ARRAY, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *nElements = item.len;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadString(mpkReader* reader, const char** string, uint32_t* len)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if ((string == NULL) || (len == NULL))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_STRING, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *string = (const char*)item.data;
+  *len = item.len;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadByteArray(mpkReader* reader, const uint8_t** bytes, uint32_t* len)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if ((bytes == NULL) || (len == NULL))
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_BINARY, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *bytes = item.data;
+  *len = item.len;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadUInt(mpkReader* reader, uint64_t* value)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = msgpackPeekItem(reader, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if ((item.type == MPK_TYPE_INT) && (item.value.i >= 0))
+  {
+    *value = (uint64_t)item.value.i;
+  }
+  else if (item.type == MPK_TYPE_UINT)
+  {
+    *value = item.value.u;
+  }
+  else
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+
+  return msgpackReadItem(reader, &item);
+}
+
+
+int msgpackReadInt(mpkReader* reader, int64_t* value)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = msgpackPeekItem(reader, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if (item.type == MPK_TYPE_INT)
+  {
+    *value = item.value.i;
+  }
+  else if ((item.type == MPK_TYPE_UINT) && (item.value.u <= (uint64_t)INT64_MAX))
+  {
+    *value = (int64_t)item.value.u;
+  }
+  else
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+
+  return msgpackReadItem(reader, &item);
+}
+
+
+int msgpackReadFloat(mpkReader* reader, float* value)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_FLOAT, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *value = item.value.f;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadDouble(mpkReader* reader, double* value)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = msgpackPeekItem(reader, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  if (item.type == MPK_TYPE_DOUBLE)
+  {
+    *value = item.value.d;
+  }
+  else if (item.type == MPK_TYPE_FLOAT)
+  {
+    *value = (double)item.value.f;
+  }
+  else
+  {
+    return MPK_ERR_TYPE_MISMATCH;
+  }
+
+  return msgpackReadItem(reader, &item);
+}
+
+
+int msgpackReadBool(mpkReader* reader, uint8_t* value)
+{
+  mpkItem item;
+  int iErr = 0;
+
+  if (value == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+  iErr = readTyped(reader, MPK_TYPE_BOOL, &item);
+  if (iErr)
+  {
+    return iErr;
+  }
+  *value = item.value.b;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackReadNil(mpkReader* reader)
+{
+  mpkItem item;
+
+  return readTyped(reader, MPK_TYPE_NIL, &item);
+}
+
+
+int msgpackSkip(mpkReader* reader)
+{
+  mpkItem item;
+  uint64_t pending = 1; // Items still to be skipped, including nested ones
+  uint32_t position = 0;
+  uint32_t itemBytes = 0;
+  int iErr = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (reader->msgBuffer == NULL)
+  {
+    return MPK_ERR_NULL_INTERNAL_BUFFER;
+  }
+
+  // Iterative, so that nesting depth does not cost stack
+  position = reader->currentPosition;
+  while (pending > 0)
+  {
+    iErr = decodeItemAt(reader, position, &item, &itemBytes);
+    if (iErr)
+    {
+      return iErr;
+    }
+    position += itemBytes;
+    pending--;
+    if (item.type == MPK_TYPE_MAP)
+    {
+      pending += 2 * (uint64_t)item.len;
+    }
+    else if (item.type == MPK_TYPE_ARRAY)
+    {
+      pending += item.len;
+    }
+    // Each item takes at least one byte: bail out early on bogus lengths
+    if (pending > (uint64_t)(reader->bufferLen - position))
+    {
+      return MPK_ERR_UNEXPECTED_END;
+    }
+  }
+  reader->currentPosition = position;
+
+  return MPK_NO_ERROR;
+}
+
+
+int msgpackMapFind(mpkReader* reader, const char* key)
+{
+  mpkReader cursor;
+  mpkItem item;
+  uint32_t nPairs = 0;
+  uint32_t keyLen = 0;
+  int iErr = 0;
+
+  if (reader == NULL)
+  {
+    return MPK_ERR_NULL_MPACK;
+  }
+  if (key == NULL)
+  {
+    return MPK_ERR_BAD_PARAM;
+  }
+
+  // Work on a copy, so the caller cursor stays on the map when the key is missing
+  cursor = *reader;
+  iErr = msgpackReadMap(&cursor, &nPairs);
+  if (iErr)
+  {
+    return iErr;
+  }
+  keyLen = strlen(key);
+  while (nPairs > 0)
+  {
+    iErr = msgpackPeekItem(&cursor, &item);
+    if (iErr)
+    {
+      return iErr;
+    }
+    if ((item.type == MPK_TYPE_STRING) && (item.len == keyLen) && (!memcmp(item.data, key, keyLen)))
+    {
+      msgpackReadItem(&cursor, &item);
+      reader->currentPosition = cursor.currentPosition;
+      return MPK_NO_ERROR;
+    }
+    iErr = msgpackSkip(&cursor); // Key (any type)
+    if (iErr)
+    {
+      return iErr;
+    }
+    iErr = msgpackSkip(&cursor); // Value
+    if (iErr)
+    {
+      return iErr;
+    }
+    nPairs--;
+  }
+
+  return MPK_ERR_TYPE_MISMATCH;
+}
+
+
+// Validator
+
+// Shortest-encoding check for a single item (container contents are checked separately)
+static uint8_t isMinimalEncoding(const mpkItem* item)
+{
+  switch (item->format)
+  {
+    // Unsigned
+    case 0xCC: return (item->value.u > 0x7F);
+    case 0xCD: return (item->value.u > 0xFF);
+    case 0xCE: return (item->value.u > 0xFFFF);
+    case 0xCF: return (item->value.u > 0xFFFFFFFFULL);
+    // Signed: only for negative values, that do not fit the smaller formats
+    case 0xD0: return (item->value.i < -32);
+    case 0xD1: return (item->value.i < INT8_MIN);
+    case 0xD2: return (item->value.i < INT16_MIN);
+    case 0xD3: return (item->value.i < INT32_MIN);
+    // Strings
+    case 0xD9: return (item->len > 31);
+    case 0xDA: return (item->len > 0xFF);
+    case 0xDB: return (item->len > 0xFFFF);
+    // Byte arrays
+    case 0xC5: return (item->len > 0xFF);
+    case 0xC6: return (item->len > 0xFFFF);
+    // Arrays and maps
+    case 0xDC: case 0xDE: return (item->len > 15);
+    case 0xDD: case 0xDF: return (item->len > 0xFFFF);
+    default:
+      return 1;
+  }
+}
+
+
+// "Zero" values have to be omitted from maps
+static uint8_t isZeroValue(const mpkItem* item)
+{
+  switch (item->type)
+  {
+    case MPK_TYPE_NIL: return 1;
+    case MPK_TYPE_BOOL: return (item->value.b == 0);
+    case MPK_TYPE_UINT: return (item->value.u == 0);
+    case MPK_TYPE_INT: return (item->value.i == 0);
+    case MPK_TYPE_FLOAT: return (item->value.f == 0.0f);
+    case MPK_TYPE_DOUBLE: return (item->value.d == 0.0);
+    default:  // Strings, byte arrays and containers
+      return (item->len == 0);
+  }
+}
+
+
+// Bytewise comparison, shorter key first on common prefix
+static int compareKeys(const uint8_t* a, const uint32_t aLen, const uint8_t* b, const uint32_t bLen)
+{
+  int cmp = memcmp(a, b, (aLen < bLen) ? aLen : bLen);
+
+  if (cmp != 0)
+    return cmp;
+  if (aLen == bLen)
+    return 0;
+
+  return (aLen < bLen) ? -1 : 1;
+}
+
+
+typedef struct mpkValidatorFrame
+{
+  uint32_t remaining;     // Elements (arrays) or pairs (maps) still to be read
+  uint8_t isMap;
+  uint8_t expectKey;
+  const uint8_t* prevKey; // Last key seen in this map, NULL if none yet
+  uint32_t prevKeyLen;
+} mpkValidatorFrame;
+
+
+int msgpackValidateCanonical(const uint8_t* buffer, const uint32_t bufferLen, uint32_t* itemLen)
+{
+  mpkValidatorFrame stack[MPK_MAX_DEPTH + 1];
+  mpkValidatorFrame* frame = NULL;
+  mpkReader reader;
+  mpkItem item;
+  int depth = 0;
+  int iErr = 0;
+
+  iErr = msgpackReaderInit(&reader, buffer, bufferLen);
+  if (iErr)
+  {
+    return iErr;
+  }
+
+  // Root frame: a single item, not inside a map
+  stack[0].remaining = 1;
+  stack[0].isMap = 0;
+  stack[0].expectKey = 0;
+  stack[0].prevKey = NULL;
+  stack[0].prevKeyLen = 0;
+
+  while (depth >= 0)
+  {
+    frame = &(stack[depth]);
+    if (frame->remaining == 0)
+    { // Container completed
+      depth--;
+      continue;
+    }
+
+    iErr = msgpackReadItem(&reader, &item);
+    if (iErr)
+    {
+      return iErr;
+    }
+    if (!isMinimalEncoding(&item))
+    {
+      return MPK_ERR_NOT_CANONICAL;
+    }
+
+    if (frame->isMap && frame->expectKey)
+    {
+      if (item.type != MPK_TYPE_STRING)
+      {
+        return MPK_ERR_NOT_CANONICAL;
+      }
+      if ((frame->prevKey != NULL) && (compareKeys(frame->prevKey, frame->prevKeyLen, item.data, item.len) >= 0))
+      {
+        return MPK_ERR_NOT_CANONICAL; // Unsorted or repeated key
+      }
+      frame->prevKey = item.data;
+      frame->prevKeyLen = item.len;
+      frame->expectKey = 0;
+      continue;
+    }
+
+    if (frame->isMap)
+    {
+      if (isZeroValue(&item))
+      {
+        return MPK_ERR_NOT_CANONICAL;
+      }
+      frame->expectKey = 1;
+    }
+    frame->remaining--;
+
+    if ( ((item.type == MPK_TYPE_MAP) || (item.type == MPK_TYPE_ARRAY)) && (item.len > 0) )
+    {
+      if (depth >= MPK_MAX_DEPTH)
+      {
+        return MPK_ERR_TOO_DEEP;
+      }
+      depth++;
+      stack[depth].remaining = item.len;
+      stack[depth].isMap = (item.type == MPK_TYPE_MAP);
+      stack[depth].expectKey = 1;
+      stack[depth].prevKey = NULL;
+      stack[depth].prevKeyLen = 0;
+    }
+  }
+
+  if (itemLen != NULL)
+  {
+    *itemLen = msgpackReaderGetPosition(&reader);
+  }
+
+  return MPK_NO_ERROR;
+}
@@ -0,0 +1,148 @@
+// minmpkdecode.h
+// header for minimal messagepack reader and canonical-encoding validator
+// v20261018-1
+
+// The reader is a cursor over a buffer owned by the caller: nothing is allocated or copied,
+// strings and byte arrays are returned as pointers into that buffer
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __MINMPKDECODE_H
+#define __MINMPKDECODE_H
+
+#include <stdint.h>
+#include "minmpk.h" // Error codes are shared with the builder
+
+// Max nesting of maps/arrays accepted by msgpackValidateCanonical()
+// Algorand signed transactions use 2 levels
+#define MPK_MAX_DEPTH 16
+
+// Item types returned by the reader
+#define MPK_TYPE_NIL 0
+#define MPK_TYPE_BOOL 1
+#define MPK_TYPE_UINT 2     // Any non-negative integer encoding (positive fixint, uint 8..64)
+#define MPK_TYPE_INT 3      // Negative fixint and int 8..64
+#define MPK_TYPE_FLOAT 4    // float 32
+#define MPK_TYPE_DOUBLE 5   // float 64
+#define MPK_TYPE_STRING 6
+#define MPK_TYPE_BINARY 7
+#define MPK_TYPE_ARRAY 8
+#define MPK_TYPE_MAP 9
+
+// Typedefs
+typedef struct mpkReader
+{
+  const uint8_t* msgBuffer;
+  uint32_t bufferLen;
+  uint32_t currentPosition;
+} mpkReader;
+
+typedef struct mpkItem
+{
+  uint8_t type;           // MPK_TYPE_*
+  uint8_t format;         // First encoded byte, as found in the buffer
+  uint32_t len;           // String/binary bytes, array elements or map pairs
+  const uint8_t* data;    // String/binary content inside the reader buffer (strings are NOT null-terminated)
+  union
+  {
+    uint64_t u;
+    int64_t i;
+    float f;
+    double d;
+    uint8_t b;
+  } value;                // Scalar value, according to type
+} mpkItem;
+// End typedefs
+
+
+// Reader functions. Reader struct is owned by caller (usually on the stack)
+
+// Buffer is borrowed, and has to stay valid as long as the reader and the returned items are used
+// Returns error code (0 = OK)
+int msgpackReaderInit(mpkReader* reader, const uint8_t* buffer, const uint32_t bufferLen);
+
+uint32_t msgpackReaderGetPosition(const mpkReader* reader);
+
+// Non-zero when all the buffer was consumed
+uint8_t msgpackReaderAtEnd(const mpkReader* reader);
+
+// Decodes the next item and advances the cursor past it
+// For maps and arrays only the header is consumed: their "len" contents follow (maps as key, value, key, value...)
+// Returns error code (0 = OK)
+int msgpackReadItem(mpkReader* reader, mpkItem* item);
+
+// Same as msgpackReadItem(), without moving the cursor
+// Returns error code (0 = OK)
+int msgpackPeekItem(const mpkReader* reader, mpkItem* item);
+
+// Typed helpers: fail with MPK_ERR_TYPE_MISMATCH (cursor not moved) if the next item has a different type
+
+// Returns error code (0 = OK)
+int msgpackReadMap(mpkReader* reader, uint32_t* nPairs);
+
+// Returns error code (0 = OK)
+int msgpackReadArray(mpkReader* reader, uint32_t* nElements);
+
+// "string" points into the buffer and is NOT null-terminated
+// Returns error code (0 = OK)
+int msgpackReadString(mpkReader* reader, const char** string, uint32_t* len);
+
+// Returns error code (0 = OK)
+int msgpackReadByteArray(mpkReader* reader, const uint8_t** bytes, uint32_t* len);
+
+// Accepts signed encodings too, as long as the value is not negative
+// Returns error code (0 = OK)
+int msgpackReadUInt(mpkReader* reader, uint64_t* value);
+
+// Fails with MPK_ERR_TYPE_MISMATCH on unsigned values above INT64_MAX
+// Returns error code (0 = OK)
+int msgpackReadInt(mpkReader* reader, int64_t* value);
+
+// Returns error code (0 = OK)
+int msgpackReadFloat(mpkReader* reader, float* value);
+
+// Accepts float 32 too
+// Returns error code (0 = OK)
+int msgpackReadDouble(mpkReader* reader, double* value);
+
+// Returns error code (0 = OK)
+int msgpackReadBool(mpkReader* reader, uint8_t* value);
+
+// Returns error code (0 = OK)
+int msgpackReadNil(mpkReader* reader);
+
+// Skips the next item, including all of its contents if it is a map or an array
+// Returns error code (0 = OK)
+int msgpackSkip(mpkReader* reader);
+
+// Cursor has to be on a map header. Looks for a string key, and leaves the cursor on its value
+// On MPK_ERR_TYPE_MISMATCH (key not found or not a map) the cursor is not moved
+// Returns error code (0 = OK)
+int msgpackMapFind(mpkReader* reader, const char* key);
+
+
+// Checks, in a single pass, that buffer starts with one canonically encoded item:
+// - map keys are strings, sorted bytewise and not repeated
+// - integers, strings, byte arrays, arrays and maps use the shortest encoding for their value/length
+// - non-negative integers are encoded as unsigned
+// - map values are never "zero" (nil, false, 0, 0.0, empty string/byte array/array/map): they must be omitted
+// These are the rules algod applies to transactions
+// "itemLen" (may be NULL) receives the encoded length of the item; trailing bytes are not checked
+// Returns error code (0 = OK, MPK_ERR_NOT_CANONICAL if well-formed but not canonical)
+int msgpackValidateCanonical(const uint8_t* buffer, const uint32_t bufferLen, uint32_t* itemLen);
+
+
+#endif
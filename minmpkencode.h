@@ -0,0 +1,180 @@
+// minmpkencode.h
+// MessagePack item headers (https://github.com/msgpack/msgpack/blob/master/spec.md), shared by both builders:
+// the C API of minmpk.h and the C++ MpkWriter of minmpkwriter.h
+// Plain C (static inline, no heap, no checks): each function writes one header at "dest" and returns its size.
+// Room for it (MPK_MAX_HEADER_BYTES at most) has to be made by caller. Content bytes of strings and
+// byte arrays follow the header and are written by caller too
+// v20261018-1
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __MINMPKENCODE_H
+#define __MINMPKENCODE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Specifier + 8-byte value ("uint 64", "int 64", "float 64")
+#define MPK_MAX_HEADER_BYTES 9
+
+
+// Specifier followed by a big-endian value of "bytes" bytes (0..8), independent of host endianness
+static inline uint8_t mpkHeader(uint8_t* dest, const uint8_t specifier, const uint64_t value, const uint8_t bytes)
+{
+  dest[0] = specifier;
+  for (uint8_t i = 0; i < bytes; i++)
+  {
+    dest[1 + i] = (uint8_t)(value >> (8 * (bytes - 1 - i)));
+  }
+
+  return 1 + bytes;
+}
+
+
+// Fixed encodings. Sizes: 1 byte, except where noted
+
+// FixMap: 1000xxxx, xxxx = number of fields (max 15)
+static inline uint8_t mpkHeaderShortMap(uint8_t* dest, const uint8_t nFields) { return mpkHeader(dest, 0x80 + nFields, 0, 0); }
+
+// Fixstr: 101xxxxx, xxxxx = len (max 31)
+static inline uint8_t mpkHeaderShortString(uint8_t* dest, const uint8_t len) { return mpkHeader(dest, 0xA0 + len, 0, 0); }
+
+// Positive fixint
+static inline uint8_t mpkHeaderUInt7(uint8_t* dest, const uint8_t value) { return mpkHeader(dest, value & 0x7F, 0, 0); }
+
+static inline uint8_t mpkHeaderInt8(uint8_t* dest, const int8_t value) { return mpkHeader(dest, 0xD0, (uint8_t)value, 1); }      // 2
+static inline uint8_t mpkHeaderUInt8(uint8_t* dest, const uint8_t value) { return mpkHeader(dest, 0xCC, value, 1); }             // 2
+static inline uint8_t mpkHeaderInt16(uint8_t* dest, const int16_t value) { return mpkHeader(dest, 0xD1, (uint16_t)value, 2); }   // 3
+static inline uint8_t mpkHeaderUInt16(uint8_t* dest, const uint16_t value) { return mpkHeader(dest, 0xCD, value, 2); }           // 3
+static inline uint8_t mpkHeaderInt32(uint8_t* dest, const int32_t value) { return mpkHeader(dest, 0xD2, (uint32_t)value, 4); }   // 5
+static inline uint8_t mpkHeaderUInt32(uint8_t* dest, const uint32_t value) { return mpkHeader(dest, 0xCE, value, 4); }           // 5
+static inline uint8_t mpkHeaderUInt64(uint8_t* dest, const uint64_t value) { return mpkHeader(dest, 0xCF, value, 8); }           // 9
+static inline uint8_t mpkHeaderInt64(uint8_t* dest, const int64_t value) { return mpkHeader(dest, 0xD3, (uint64_t)value, 8); }   // 9
+
+// "float 32" (5 bytes)
+static inline uint8_t mpkHeaderFloat(uint8_t* dest, const float value)
+{
+  uint32_t floatBits = 0;
+
+  memcpy((void*)&floatBits, (const void*)&value, 4);
+
+  return mpkHeader(dest, 0xCA, floatBits, 4);
+}
+
+// "float 64" (9 bytes)
+static inline uint8_t mpkHeaderDouble(uint8_t* dest, const double value)
+{
+  uint64_t doubleBits = 0;
+
+  memcpy((void*)&doubleBits, (const void*)&value, 8);
+
+  return mpkHeader(dest, 0xCB, doubleBits, 8);
+}
+
+// "bin 8" (2 bytes), "bin 16" (3 bytes): header only
+static inline uint8_t mpkHeaderShortByteArray(uint8_t* dest, const uint8_t len) { return mpkHeader(dest, 0xC4, len, 1); }
+static inline uint8_t mpkHeaderByteArray(uint8_t* dest, const uint16_t len) { return mpkHeader(dest, 0xC5, len, 2); }
+
+static inline uint8_t mpkHeaderNil(uint8_t* dest) { return mpkHeader(dest, 0xC0, 0, 0); }
+
+// 0xC2 = false, 0xC3 = true
+static inline uint8_t mpkHeaderBool(uint8_t* dest, const uint8_t value) { return mpkHeader(dest, value ? 0xC3 : 0xC2, 0, 0); }
+
+
+// Generic encodings: smallest one for value/length, as canonical MessagePack (e.g. Algorand) requires
+// Sizes: msgpackSize*() in minmpk.h
+
+// Positive fixint, uint 8, 16, 32 or 64
+static inline uint8_t mpkHeaderUInt(uint8_t* dest, const uint64_t value)
+{
+  if (value < 128)
+    return mpkHeader(dest, (uint8_t)value, 0, 0);
+  if (value <= 0xFF)
+    return mpkHeader(dest, 0xCC, value, 1);
+  if (value <= 0xFFFF)
+    return mpkHeader(dest, 0xCD, value, 2);
+  if (value <= 0xFFFFFFFFULL)
+    return mpkHeader(dest, 0xCE, value, 4);
+
+  return mpkHeader(dest, 0xCF, value, 8);
+}
+
+// Non-negative values always go unsigned, as canonical encoders do
+// Negative fixint (111xxxxx), int 8, 16, 32 or 64 otherwise
+static inline uint8_t mpkHeaderInt(uint8_t* dest, const int64_t value)
+{
+  if (value >= 0)
+    return mpkHeaderUInt(dest, (uint64_t)value);
+  if (value >= -32)
+    return mpkHeader(dest, (uint8_t)value, 0, 0);
+  if (value >= INT8_MIN)
+    return mpkHeader(dest, 0xD0, (uint8_t)value, 1);
+  if (value >= INT16_MIN)
+    return mpkHeader(dest, 0xD1, (uint16_t)value, 2);
+  if (value >= INT32_MIN)
+    return mpkHeader(dest, 0xD2, (uint32_t)value, 4);
+
+  return mpkHeader(dest, 0xD3, (uint64_t)value, 8);
+}
+
+// Fixstr, str 8, 16 or 32: header only
+static inline uint8_t mpkHeaderString(uint8_t* dest, const uint32_t len)
+{
+  if (len < 32)
+    return mpkHeader(dest, 0xA0 + (uint8_t)len, 0, 0);
+  if (len <= 0xFF)
+    return mpkHeader(dest, 0xD9, len, 1);
+  if (len <= 0xFFFF)
+    return mpkHeader(dest, 0xDA, len, 2);
+
+  return mpkHeader(dest, 0xDB, len, 4);
+}
+
+// Bin 8, 16 or 32: header only
+static inline uint8_t mpkHeaderBinary(uint8_t* dest, const uint32_t len)
+{
+  if (len <= 0xFF)
+    return mpkHeader(dest, 0xC4, len, 1);
+  if (len <= 0xFFFF)
+    return mpkHeader(dest, 0xC5, len, 2);
+
+  return mpkHeader(dest, 0xC6, len, 4);
+}
+
+// Fixmap, map 16 or 32
+static inline uint8_t mpkHeaderMap(uint8_t* dest, const uint32_t nFields)
+{
+  if (nFields < 16)
+    return mpkHeader(dest, 0x80 + (uint8_t)nFields, 0, 0);
+  if (nFields <= 0xFFFF)
+    return mpkHeader(dest, 0xDE, nFields, 2);
+
+  return mpkHeader(dest, 0xDF, nFields, 4);
+}
+
+// Fixarray, array 16 or 32
+static inline uint8_t mpkHeaderArray(uint8_t* dest, const uint32_t nElements)
+{
+  if (nElements < 16)
+    return mpkHeader(dest, 0x90 + (uint8_t)nElements, 0, 0);
+  if (nElements <= 0xFFFF)
+    return mpkHeader(dest, 0xDC, nElements, 2);
+
+  return mpkHeader(dest, 0xDD, nElements, 4);
+}
+
+
+#endif
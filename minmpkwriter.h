@@ -0,0 +1,782 @@
+// minmpkwriter.h
+// minimal messagepack builder, C++ flavour: writer templated over a sink policy
+// Same encodings as minmpk.cpp (https://github.com/msgpack/msgpack/blob/master/spec.md), but bytes go to a "sink"
+// instead of a fixed buffer, so the same encoding code can write, measure or hash a message
+// Item headers come from minmpkencode.h, which the C API of minmpk.h uses too
+// Header-only
+// v20261018-6
+
+// A sink is any class exposing:
+//   int write(const uint8_t* data, const uint32_t len);  // Returns error code (0 = OK)
+//   int reserve(const uint32_t len);                     // Checks room for "len" more bytes. Returns error code (0 = OK)
+//   void put(const uint8_t* data, const uint32_t len);   // Unchecked write, within a previous reserve()
+//   void putRef(const uint8_t* data, const uint32_t len); // As put(), but data may be referenced instead of copied
+//   int reserveRef(const uint32_t copied, const uint32_t referenced); // Checks room for "copied" more bytes plus a putRef() of
+//                                                        // "referenced" bytes. Returns error code (0 = OK)
+//   uint32_t length() const;                             // Bytes accepted so far
+// Sinks that cannot reference (all but MpkScatterSink) simply copy in putRef()
+// Sinks are plain objects (stack or class members): no heap is used anywhere
+
+// By Fernando Carello for GT50
+/* Copyright 2023 GT50 S.r.l.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.*/
+
+
+#ifndef __MINMPKWRITER_H
+#define __MINMPKWRITER_H
+
+#include <stdint.h>
+#include <string.h>
+#include "minmpk.h" // Error codes
+#include "minmpkencode.h" // Item headers, shared with minmpk.cpp
+
+
+///////////
+// Sinks
+///////////
+
+// Writes into a fixed buffer, owned by caller
+class MpkBufferSink
+{
+  private:
+  uint8_t* m_buffer;
+  uint32_t m_bufferLen;
+  uint32_t m_len;
+
+  public:
+  MpkBufferSink(uint8_t* buffer, const uint32_t bufferLen) : m_buffer(buffer), m_bufferLen(bufferLen), m_len(0) {}
+
+  int reserve(const uint32_t len)
+  {
+    if (m_buffer == NULL)
+      return MPK_ERR_NULL_INTERNAL_BUFFER;
+    if (len > m_bufferLen - m_len)
+      return MPK_ERR_BUFFER_TOO_SHORT;
+
+    return MPK_NO_ERROR;
+  }
+
+  void put(const uint8_t* data, const uint32_t len)
+  {
+    memcpy((void*)&(m_buffer[m_len]), (const void*)data, len);
+    m_len += len;
+  }
+
+  int write(const uint8_t* data, const uint32_t len)
+  {
+    int iErr = reserve(len);
+    if (iErr)
+      return iErr;
+
+    put(data, len);
+
+    return MPK_NO_ERROR;
+  }
+
+  int reserveRef(const uint32_t copied, const uint32_t referenced)
+  {
+    if (referenced > 0xFFFFFFFFUL - copied)
+      return MPK_ERR_BUFFER_TOO_SHORT;
+
+    return reserve(copied + referenced);
+  }
+
+  void putRef(const uint8_t* data, const uint32_t len) { put(data, len); }
+
+  uint32_t length() const { return m_len; }
+  uint8_t* buffer() const { return m_buffer; }
+};
+
+
+// Writes nothing: only counts bytes. A dry run with this sink gives the exact encoded size
+// Referenced bytes are counted apart too, so the same dry run sizes the scratch buffer of a MpkScatterSink
+class MpkCountingSink
+{
+  private:
+  uint32_t m_len;
+  uint32_t m_refLen;
+  uint8_t m_nRefs;
+
+  public:
+  MpkCountingSink() : m_len(0), m_refLen(0), m_nRefs(0) {}
+
+  int reserve(const uint32_t len) { (void)len; return MPK_NO_ERROR; }
+
+  void put(const uint8_t* data, const uint32_t len)
+  {
+    (void)data;
+    m_len += len;
+  }
+
+  int write(const uint8_t* data, const uint32_t len)
+  {
+    put(data, len);
+
+    return MPK_NO_ERROR;
+  }
+
+  int reserveRef(const uint32_t copied, const uint32_t referenced) { (void)copied; (void)referenced; return MPK_NO_ERROR; }
+
+  void putRef(const uint8_t* data, const uint32_t len)
+  {
+    put(data, len);
+    m_refLen += len;
+    m_nRefs++;
+  }
+
+  uint32_t length() const { return m_len; }
+  uint32_t copiedLength() const { return m_len - m_refLen; }
+  uint8_t refCount() const { return m_nRefs; }
+};
+
+
+// Feeds a hash while encoding. THash needs "update(const void*, size_t)", as the Crypto library hashes do
+// (e.g. MpkHashSink<SHA512> hashes the message as it is produced, without re-reading it)
+// Hash is owned by caller, and is neither reset nor finalized here
+template <class THash>
+class MpkHashSink
+{
+  private:
+  THash& m_hash;
+  uint32_t m_len;
+
+  public:
+  explicit MpkHashSink(THash& hash) : m_hash(hash), m_len(0) {}
+
+  int reserve(const uint32_t len) { (void)len; return MPK_NO_ERROR; }
+
+  void put(const uint8_t* data, const uint32_t len)
+  {
+    m_hash.update((const void*)data, len);
+    m_len += len;
+  }
+
+  int write(const uint8_t* data, const uint32_t len)
+  {
+    put(data, len);
+
+    return MPK_NO_ERROR;
+  }
+
+  int reserveRef(const uint32_t copied, const uint32_t referenced) { (void)copied; (void)referenced; return MPK_NO_ERROR; }
+  void putRef(const uint8_t* data, const uint32_t len) { put(data, len); }
+
+  uint32_t length() const { return m_len; }
+};
+
+
+// Sends the same bytes to two sinks; tees may be nested to feed more
+// First sink is written first: put the one that can fail (buffer) there, so the second never sees rejected bytes
+template <class TFirst, class TSecond>
+class MpkTeeSink
+{
+  private:
+  TFirst& m_first;
+  TSecond& m_second;
+
+  public:
+  MpkTeeSink(TFirst& first, TSecond& second) : m_first(first), m_second(second) {}
+
+  int reserve(const uint32_t len)
+  {
+    int iErr = m_first.reserve(len);
+    if (iErr)
+      return iErr;
+
+    return m_second.reserve(len);
+  }
+
+  void put(const uint8_t* data, const uint32_t len)
+  {
+    m_first.put(data, len);
+    m_second.put(data, len);
+  }
+
+  int write(const uint8_t* data, const uint32_t len)
+  {
+    int iErr = m_first.write(data, len);
+    if (iErr)
+      return iErr;
+
+    return m_second.write(data, len);
+  }
+
+  int reserveRef(const uint32_t copied, const uint32_t referenced)
+  {
+    int iErr = m_first.reserveRef(copied, referenced);
+    if (iErr)
+      return iErr;
+
+    return m_second.reserveRef(copied, referenced);
+  }
+
+  void putRef(const uint8_t* data, const uint32_t len)
+  {
+    m_first.putRef(data, len);
+    m_second.putRef(data, len);
+  }
+
+  uint32_t length() const { return m_first.length(); }
+};
+
+
+// Scatter-gather: builds a message as a list of segments (see mpkSegment in minmpk.h) instead of a single buffer
+// Encoded bytes are copied into a scratch buffer owned by caller; putRef() data is only referenced,
+// so large fields (e.g. a transaction note) are neither copied nor need room in the scratch buffer
+// Consecutive copied bytes share one segment. Referenced data has to stay valid and unchanged
+// as long as the segments are used
+// reserve() checks room in the scratch buffer only; segment exhaustion (more than MAX_SEGMENTS)
+// is reported by status(), as put() cannot fail
+template <uint8_t MAX_SEGMENTS>
+class MpkScatterSink
+{
+  private:
+  uint8_t* m_scratch;
+  uint32_t m_scratchLen;
+  uint32_t m_scratchUsed;
+  mpkSegment m_segments[MAX_SEGMENTS];
+  uint8_t m_nSegments;
+  uint8_t m_lastIsScratch;
+  uint32_t m_len;
+  int m_status;
+
+  public:
+  MpkScatterSink(uint8_t* scratch, const uint32_t scratchLen) :
+    m_scratch(scratch), m_scratchLen(scratchLen), m_scratchUsed(0), m_nSegments(0), m_lastIsScratch(0), m_len(0), m_status(MPK_NO_ERROR) {}
+
+  int reserve(const uint32_t len)
+  {
+    if (m_scratch == NULL)
+      return MPK_ERR_NULL_INTERNAL_BUFFER;
+    if (len > m_scratchLen - m_scratchUsed)
+      return MPK_ERR_BUFFER_TOO_SHORT;
+
+    return MPK_NO_ERROR;
+  }
+
+  void put(const uint8_t* data, const uint32_t len)
+  {
+    if ((len == 0) || (m_status != MPK_NO_ERROR))
+      return;
+    if (!m_lastIsScratch)
+    { // Open a new scratch segment
+      if (m_nSegments >= MAX_SEGMENTS)
+      {
+        m_status = MPK_ERR_BUFFER_TOO_SHORT;
+        return;
+      }
+      m_segments[m_nSegments].data = &(m_scratch[m_scratchUsed]);
+      m_segments[m_nSegments].len = 0;
+      m_nSegments++;
+      m_lastIsScratch = 1;
+    }
+    memcpy((void*)&(m_scratch[m_scratchUsed]), (const void*)data, len);
+    m_scratchUsed += len;
+    m_segments[m_nSegments - 1].len += len;
+    m_len += len;
+  }
+
+  int write(const uint8_t* data, const uint32_t len)
+  {
+    int iErr = reserve(len);
+    if (iErr)
+      return iErr;
+
+    put(data, len);
+
+    return m_status;
+  }
+
+  // Referenced bytes take a segment, not scratch room. Copied bytes (e.g. the header written ahead of
+  // the reference) take one more when the last segment is not a scratch one: all are checked here,
+  // so that put()/putRef() within this reserve never run out of segments
+  int reserveRef(const uint32_t copied, const uint32_t referenced)
+  {
+    const uint8_t needed = ((copied > 0) && !m_lastIsScratch) ? 2 : 1;
+
+    (void)referenced;
+    if (needed > MAX_SEGMENTS - m_nSegments)
+      return MPK_ERR_BUFFER_TOO_SHORT;
+
+    return reserve(copied);
+  }
+
+  void putRef(const uint8_t* data, const uint32_t len)
+  {
+    if ((len == 0) || (m_status != MPK_NO_ERROR))
+      return;
+    if (m_nSegments >= MAX_SEGMENTS)
+    {
+      m_status = MPK_ERR_BUFFER_TOO_SHORT;
+      return;
+    }
+    m_segments[m_nSegments].data = data;
+    m_segments[m_nSegments].len = len;
+    m_nSegments++;
+    m_lastIsScratch = 0;
+    m_len += len;
+  }
+
+  uint32_t length() const { return m_len; }
+  uint32_t scratchUsed() const { return m_scratchUsed; }
+  const mpkSegment* segments() const { return m_segments; }
+  uint8_t segmentCount() const { return m_nSegments; }
+
+  // Returns error code (0 = OK, MPK_ERR_BUFFER_TOO_SHORT if segments ran out)
+  int status() const { return m_status; }
+};
+
+
+////////////
+// Writer
+////////////
+
+// Two families of encoders:
+// - add*(): mirror the msgpackAdd*() functions of minmpk.h, with the same limits and error codes
+// - put*(): no checks at all, for a run of fields whose total size was made available with reserve()
+//   (for instance the exact size obtained by a dry run on MpkCountingSink)
+template <class TSink>
+class MpkWriter
+{
+  private:
+  TSink& m_sink;
+
+  // Headers are built on the stack by minmpkencode.h, then go to the sink in one put()
+  typedef uint8_t Header[MPK_MAX_HEADER_BYTES];
+
+  public:
+  explicit MpkWriter(TSink& sink) : m_sink(sink) {}
+
+  TSink& sink() { return m_sink; }
+
+  uint32_t length() const { return m_sink.length(); }
+
+  // Checks once that "bytes" more bytes can be written
+  // Returns error code (0 = OK)
+  int reserve(const uint32_t bytes) { return m_sink.reserve(bytes); }
+
+
+  // Unchecked encoders. Encoded sizes: 1 byte, except where noted
+
+  void putRaw(const uint8_t* data, const uint32_t len) { m_sink.put(data, len); }    // len
+
+  // FixMap: 1000xxxx, xxxx = number of fields
+  void putShortMap(const uint8_t nFields) { Header h; m_sink.put(h, mpkHeaderShortMap(h, nFields)); }
+
+  // Fixstr: 101xxxxx, xxxxx = len
+  void putShortString(const char* string, const uint8_t len)                        // 1 + len
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderShortString(h, len));
+    m_sink.put((const uint8_t*)string, len);
+  }
+
+  void putShortString(const char* string) { putShortString(string, (uint8_t)strlen(string)); }
+
+  void putUInt7(const uint8_t value) { Header h; m_sink.put(h, mpkHeaderUInt7(h, value)); }
+  void putInt8(const int8_t value) { Header h; m_sink.put(h, mpkHeaderInt8(h, value)); }          // 2
+  void putUInt8(const uint8_t value) { Header h; m_sink.put(h, mpkHeaderUInt8(h, value)); }       // 2
+  void putInt16(const int16_t value) { Header h; m_sink.put(h, mpkHeaderInt16(h, value)); }       // 3
+  void putUInt16(const uint16_t value) { Header h; m_sink.put(h, mpkHeaderUInt16(h, value)); }    // 3
+  void putInt32(const int32_t value) { Header h; m_sink.put(h, mpkHeaderInt32(h, value)); }       // 5
+  void putUInt32(const uint32_t value) { Header h; m_sink.put(h, mpkHeaderUInt32(h, value)); }    // 5
+  void putFloat(const float value) { Header h; m_sink.put(h, mpkHeaderFloat(h, value)); }         // 5
+
+  // "bin 8"
+  void putShortByteArray(const uint8_t* inputArray, const uint8_t inputBytes)       // 2 + inputBytes
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderShortByteArray(h, inputBytes));
+    m_sink.put(inputArray, inputBytes);
+  }
+
+  // "bin 16"
+  void putByteArray(const uint8_t* inputArray, const uint16_t inputBytes)           // 3 + inputBytes
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderByteArray(h, inputBytes));
+    m_sink.put(inputArray, inputBytes);
+  }
+
+
+  void putUInt64(const uint64_t value) { Header h; m_sink.put(h, mpkHeaderUInt64(h, value)); }    // 9
+  void putInt64(const int64_t value) { Header h; m_sink.put(h, mpkHeaderInt64(h, value)); }       // 9
+  void putDouble(const double value) { Header h; m_sink.put(h, mpkHeaderDouble(h, value)); }      // 9
+
+  void putNil() { Header h; m_sink.put(h, mpkHeaderNil(h)); }
+  void putBool(const uint8_t value) { Header h; m_sink.put(h, mpkHeaderBool(h, value)); }
+
+  // Generic encoders: smallest encoding for value/length. Sizes from msgpackSize*() (minmpk.h)
+
+  void putUInt(const uint64_t value) { Header h; m_sink.put(h, mpkHeaderUInt(h, value)); }
+  void putInt(const int64_t value) { Header h; m_sink.put(h, mpkHeaderInt(h, value)); }
+
+  void putString(const char* string, const uint32_t len)
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderString(h, len));
+    m_sink.put((const uint8_t*)string, len);
+  }
+
+  void putBinary(const uint8_t* inputArray, const uint32_t inputBytes)
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderBinary(h, inputBytes));
+    m_sink.put(inputArray, inputBytes);
+  }
+
+  // As putBinary(), but content goes to the sink by reference (see MpkScatterSink): only the header is copied
+  void putBinaryRef(const uint8_t* inputArray, const uint32_t inputBytes)
+  {
+    Header h;
+
+    m_sink.put(h, mpkHeaderBinary(h, inputBytes));
+    m_sink.putRef(inputArray, inputBytes);
+  }
+
+  void putMap(const uint32_t nFields) { Header h; m_sink.put(h, mpkHeaderMap(h, nFields)); }
+  void putArray(const uint32_t nElements) { Header h; m_sink.put(h, mpkHeaderArray(h, nElements)); }
+
+
+  // Checked encoders. Each one validates, reserves and puts
+
+  // Already-encoded MessagePack bytes, copied as they are
+  // Returns error code (0 = OK)
+  int addRaw(const uint8_t* data, const uint32_t len)
+  {
+    if (data == NULL)
+      return MPK_ERR_BAD_PARAM;
+
+    return m_sink.write(data, len);
+  }
+
+  // "nFields" max value = 15
+  // Returns error code (0 = OK)
+  int addShortMap(const uint8_t nFields)
+  {
+    if (nFields > 15)
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(1);
+    if (iErr)
+      return iErr;
+
+    putShortMap(nFields);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Up to 31 single-byte chars; trailing NULL is not encoded
+  // Returns error code (0 = OK)
+  int addShortString(const char* string)
+  {
+    uint32_t len = 0;
+
+    if (string == NULL)
+      return MPK_ERR_BAD_PARAM;
+    len = strlen(string);
+    if (len > 31)
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(1 + len);
+    if (iErr)
+      return iErr;
+
+    putShortString(string, (uint8_t)len);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt7(const uint8_t value)
+  {
+    int iErr = reserve(1);
+    if (iErr)
+      return iErr;
+
+    putUInt7(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addInt8(const int8_t value)
+  {
+    int iErr = reserve(2);
+    if (iErr)
+      return iErr;
+
+    putInt8(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt8(const uint8_t value)
+  {
+    int iErr = reserve(2);
+    if (iErr)
+      return iErr;
+
+    putUInt8(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addInt16(const int16_t value)
+  {
+    int iErr = reserve(3);
+    if (iErr)
+      return iErr;
+
+    putInt16(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt16(const uint16_t value)
+  {
+    int iErr = reserve(3);
+    if (iErr)
+      return iErr;
+
+    putUInt16(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addInt32(const int32_t value)
+  {
+    int iErr = reserve(5);
+    if (iErr)
+      return iErr;
+
+    putInt32(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt32(const uint32_t value)
+  {
+    int iErr = reserve(5);
+    if (iErr)
+      return iErr;
+
+    putUInt32(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addFloat(const float value)
+  {
+    int iErr = reserve(5);
+    if (iErr)
+      return iErr;
+
+    putFloat(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Max 255 bytes
+  // Returns error code (0 = OK)
+  int addShortByteArray(const uint8_t* inputArray, const uint8_t inputBytes)
+  {
+    if (inputArray == NULL)
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(2 + inputBytes);
+    if (iErr)
+      return iErr;
+
+    putShortByteArray(inputArray, inputBytes);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Max 65535 bytes
+  // Returns error code (0 = OK)
+  int addByteArray(const uint8_t* inputArray, const uint16_t inputBytes)
+  {
+    if (inputArray == NULL)
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(3 + (uint32_t)inputBytes);
+    if (iErr)
+      return iErr;
+
+    putByteArray(inputArray, inputBytes);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt64(const uint64_t value)
+  {
+    int iErr = reserve(9);
+    if (iErr)
+      return iErr;
+
+    putUInt64(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addInt64(const int64_t value)
+  {
+    int iErr = reserve(9);
+    if (iErr)
+      return iErr;
+
+    putInt64(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addDouble(const double value)
+  {
+    int iErr = reserve(9);
+    if (iErr)
+      return iErr;
+
+    putDouble(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addBool(const uint8_t value)
+  {
+    int iErr = reserve(1);
+    if (iErr)
+      return iErr;
+
+    putBool(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addNil()
+  {
+    int iErr = reserve(1);
+    if (iErr)
+      return iErr;
+
+    putNil();
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addUInt(const uint64_t value)
+  {
+    int iErr = reserve(msgpackSizeUInt(value));
+    if (iErr)
+      return iErr;
+
+    putUInt(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addInt(const int64_t value)
+  {
+    int iErr = reserve(msgpackSizeInt(value));
+    if (iErr)
+      return iErr;
+
+    putInt(value);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addString(const char* string, const uint32_t len)
+  {
+    if ((string == NULL) || (len > 0xFFFFFFFFUL - 5))
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(msgpackSizeString(len));
+    if (iErr)
+      return iErr;
+
+    putString(string, len);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addBinary(const uint8_t* inputArray, const uint32_t inputBytes)
+  {
+    if ((inputArray == NULL) || (inputBytes > 0xFFFFFFFFUL - 5))
+      return MPK_ERR_BAD_PARAM;
+    int iErr = reserve(msgpackSizeBinary(inputBytes));
+    if (iErr)
+      return iErr;
+
+    putBinary(inputArray, inputBytes);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Content is referenced, where the sink allows it: it has to stay valid as long as the message is used
+  // Returns error code (0 = OK)
+  int addBinaryRef(const uint8_t* inputArray, const uint32_t inputBytes)
+  {
+    if ((inputArray == NULL) || (inputBytes > 0xFFFFFFFFUL - 5))
+      return MPK_ERR_BAD_PARAM;
+    int iErr = m_sink.reserveRef(msgpackSizeBinary(inputBytes) - inputBytes, inputBytes);
+    if (iErr)
+      return iErr;
+
+    putBinaryRef(inputArray, inputBytes);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addMap(const uint32_t nFields)
+  {
+    int iErr = reserve(msgpackSizeMap(nFields));
+    if (iErr)
+      return iErr;
+
+    putMap(nFields);
+
+    return MPK_NO_ERROR;
+  }
+
+  // Returns error code (0 = OK)
+  int addArray(const uint32_t nElements)
+  {
+    int iErr = reserve(msgpackSizeArray(nElements));
+    if (iErr)
+      return iErr;
+
+    putArray(nElements);
+
+    return MPK_NO_ERROR;
+  }
+};
+
+
+#endif